@@ -1,24 +1,24 @@
-/*
- * Copyright 2018-2020,2022 NXP
- * All rights reserved.
- *
- * SPDX-License-Identifier: BSD-3-Clause
- */
-#ifndef _APP_H_
-#define _APP_H_
-
-/*${header:start}*/
-#include "fsl_phyksz8081.h"
-/*${header:end}*/
-
-/*******************************************************************************
- * Definitions
- ******************************************************************************/
-/*${macro:start}*/
-
-/* @TEST_ANCHOR */
-
-/* IP address configuration. */
-
-
-#endif /* _APP_H_ */
+/*
+ * Copyright 2018-2020,2022 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _APP_H_
+#define _APP_H_
+
+/*${header:start}*/
+#include "fsl_phyksz8081.h"
+/*${header:end}*/
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*${macro:start}*/
+
+/* @TEST_ANCHOR */
+
+/* IP address configuration. */
+
+
+#endif /* _APP_H_ */
@@ -1,23 +1,23 @@
-/**
- * @file    tcp_test.h
- * @brief   Header file for TCP server test functionality.
- *
- * Declares the test initialization function for starting a basic TCP server
- * that sends a welcome message to connected clients.
- *
- * (C) Copyright Centum T&S Group 2025. All rights reserved.
- * This computer program may not be used, copied, distributed, translated, transmitted or assigned
- * without the prior written authorization of Centum T&S Group.
- */
-
-
-#ifndef ETHERNETINTERFACE_TEST_TCP_TEST_H_
-#define ETHERNETINTERFACE_TEST_TCP_TEST_H_
-
-//------------------------------------ [ INCLUDE FILES ] ----------------------------
-
-//------------------------------------ [ PROTOTYPES ] -------------------------------
-
-void TCPTestInit(void);
-
-#endif /* ETHERNETINTERFACE_TEST_TCP_TEST_H_ */
+/**
+ * @file    tcp_test.h
+ * @brief   Header file for TCP server test functionality.
+ *
+ * Declares the test initialization function for starting a basic TCP server
+ * that sends a welcome message to connected clients.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+
+#ifndef ETHERNETINTERFACE_TEST_TCP_TEST_H_
+#define ETHERNETINTERFACE_TEST_TCP_TEST_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+
+//------------------------------------ [ PROTOTYPES ] -------------------------------
+
+void TCPTestInit(void);
+
+#endif /* ETHERNETINTERFACE_TEST_TCP_TEST_H_ */
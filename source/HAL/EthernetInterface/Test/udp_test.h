@@ -1,29 +1,29 @@
-/**
- * @file    udp_test.h
- * @brief   Header for UDP test functionality.
- *
- * This header declares initialization and handler functions for the UDP
- * test application involving three server ports and one client.
- *
- * (C) Copyright Centum T&S Group 2025. All rights reserved.
- * This computer program may not be used, copied, distributed, translated, transmitted or assigned
- * without the prior written authorization of Centum T&S Group.
- */
-
-#ifndef ETHERNETINTERFACE_TEST_UDP_TEST_H_
-#define ETHERNETINTERFACE_TEST_UDP_TEST_H_
-
-//------------------------------------ [ INCLUDE FILES ] ----------------------------
-
-//------------------------------------ [ DEFINES ] ----------------------------------
-
-//------------------------------------ [ TYPEDEF ] ----------------------------------
-
-//------------------------------------ [ PROTOTYPES ] -------------------------------
-
-void UDPTestinit(void);
-
-void UDPTestHandler(void);
-
-
-#endif /* ETHERNETINTERFACE_TEST_UDP_TEST_H_ */
+/**
+ * @file    udp_test.h
+ * @brief   Header for UDP test functionality.
+ *
+ * This header declares initialization and handler functions for the UDP
+ * test application involving three server ports and one client.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+#ifndef ETHERNETINTERFACE_TEST_UDP_TEST_H_
+#define ETHERNETINTERFACE_TEST_UDP_TEST_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+
+//------------------------------------ [ DEFINES ] ----------------------------------
+
+//------------------------------------ [ TYPEDEF ] ----------------------------------
+
+//------------------------------------ [ PROTOTYPES ] -------------------------------
+
+void UDPTestinit(void);
+
+void UDPTestHandler(void);
+
+
+#endif /* ETHERNETINTERFACE_TEST_UDP_TEST_H_ */
@@ -0,0 +1,174 @@
+/**
+ * @file LEDBcm.c
+ * @brief Binary code modulation (BCM) sequencer for the LED matrix scan.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/LEDBcm.h"
+#include "HAL/LEDDriverInterface/LEDBrightness.h"
+#include "HAL/LEDDriverInterface/LEDBlankRows.h"
+#include <stddef.h>
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Initializes the sequencer at the start of a scan cycle.
+ *
+ * @param psBcm       Sequencer.
+ * @param ubScanRate  Scan addresses per cycle.
+ * @param ubPlanes    Bit-planes per address (1..LED_BCM_MAX_PLANES).
+ * @param ulUnitNs    OE time of the least significant plane.
+ * @return 1 on success, 0 on invalid parameters.
+ */
+uint8_t LEDBcm_Init(sLEDBcm_t *psBcm, uint8_t ubScanRate, uint8_t ubPlanes, uint32_t ulUnitNs)
+{
+    if ((psBcm == NULL) || (ubScanRate == 0))
+    {
+        return 0;
+    }
+
+    psBcm->ubScanRate = ubScanRate;
+    psBcm->usDuty = LED_BRIGHTNESS_FULL_DUTY;
+    psBcm->ulSkipMask = 0;
+    psBcm->ubFirstAddress = 0;
+    return LEDBcm_SetPlanes(psBcm, ubPlanes, ulUnitNs);
+}
+
+/**
+ * @brief Changes the plane count and unit time; the sequence restarts a scan cycle.
+ *
+ * Every extra plane doubles the gray levels and adds one shift per address, while the
+ * OE time of a cycle grows to (2^N - 1) units per address.
+ *
+ * @return 1 on success, 0 on invalid parameters (sequencer unchanged).
+ */
+uint8_t LEDBcm_SetPlanes(sLEDBcm_t *psBcm, uint8_t ubPlanes, uint32_t ulUnitNs)
+{
+    if ((psBcm == NULL) || (ubPlanes == 0) || (ubPlanes > LED_BCM_MAX_PLANES) || (ulUnitNs == 0))
+    {
+        return 0;
+    }
+
+    psBcm->ubPlanes = ubPlanes;
+    psBcm->ulUnitNs = ulUnitNs;
+    psBcm->ubAddress = psBcm->ubFirstAddress;
+    psBcm->ubPlane = 0;
+    LEDBcm_SetDuty(psBcm, psBcm->usDuty);
+    return 1;
+}
+
+/**
+ * @brief Sets the OE duty of every slot; the slots keep their length.
+ *
+ * Takes effect from the next step. Every plane is scaled by the same duty, so the gray
+ * weights keep their ratio (up to the rounding of the shortest plane).
+ *
+ * @param usDuty Duty (0..LED_BRIGHTNESS_FULL_DUTY).
+ */
+void LEDBcm_SetDuty(sLEDBcm_t *psBcm, uint16_t usDuty)
+{
+    psBcm->usDuty = usDuty;
+    for (uint8_t ubPlane = 0; ubPlane < psBcm->ubPlanes; ubPlane++)
+    {
+        psBcm->aulOnTimeNs[ubPlane] = LEDBrightness_ScaleOnTime(psBcm->ulUnitNs << ubPlane, usDuty);
+    }
+}
+
+/**
+ * @brief Leaves scan addresses out of the cycle; the sequence restarts a scan cycle.
+ *
+ * @param ulSkipMask Bit n set to skip address n. If every address is set, the first one
+ *                   is still shown so the cycle keeps its pace.
+ */
+void LEDBcm_SetSkipMask(sLEDBcm_t *psBcm, uint32_t ulSkipMask)
+{
+    uint8_t ubFirst = 0;
+
+    while ((ubFirst < psBcm->ubScanRate) && ((ulSkipMask & (1UL << ubFirst)) != 0U))
+    {
+        ubFirst++;
+    }
+    if (ubFirst >= psBcm->ubScanRate)
+    {
+        ubFirst = 0;
+        ulSkipMask &= ~1UL;
+    }
+
+    psBcm->ulSkipMask = ulSkipMask;
+    psBcm->ubFirstAddress = ubFirst;
+    psBcm->ubAddress = ubFirst;
+    psBcm->ubPlane = 0;
+}
+
+/**
+ * @brief Returns the next step and advances the sequence.
+ *
+ * @param psBcm  Sequencer.
+ * @param psStep Returns the step to shift now.
+ */
+void LEDBcm_NextStep(sLEDBcm_t *psBcm, sLEDBcmStep_t *psStep)
+{
+    psStep->ubAddress = psBcm->ubAddress;
+    psStep->ubPlane = psBcm->ubPlane;
+    psStep->ulOnTimeNs = psBcm->aulOnTimeNs[psBcm->ubPlane];
+    psStep->ulDarkNs = (psBcm->ulUnitNs << psBcm->ubPlane) - psStep->ulOnTimeNs;
+    psStep->bCycleStart = (psBcm->ubAddress == psBcm->ubFirstAddress) && (psBcm->ubPlane == 0);
+
+    psBcm->ubPlane++;
+    if (psBcm->ubPlane >= psBcm->ubPlanes)
+    {
+        psBcm->ubPlane = 0;
+        // The first address is never skipped, so this ends
+        do
+        {
+            psBcm->ubAddress++;
+            if (psBcm->ubAddress >= psBcm->ubScanRate)
+            {
+                psBcm->ubAddress = 0;
+            }
+        } while ((psBcm->ulSkipMask & (1UL << psBcm->ubAddress)) != 0U);
+    }
+}
+
+/**
+ * @brief Returns the number of shifts (and latches) in one scan cycle.
+ */
+uint32_t LEDBcm_GetStepsPerCycle(const sLEDBcm_t *psBcm)
+{
+    return (uint32_t)LEDBlankRows_CountShown(psBcm->ulSkipMask, psBcm->ubScanRate) * psBcm->ubPlanes;
+}
+
+/**
+ * @brief Returns the total OE slot time of one scan cycle: shown addresses * (2^N - 1) units.
+ */
+uint64_t LEDBcm_GetOnTimePerCycleNs(const sLEDBcm_t *psBcm)
+{
+    return (uint64_t)LEDBlankRows_CountShown(psBcm->ulSkipMask, psBcm->ubScanRate) *
+           (((uint64_t)1U << psBcm->ubPlanes) - 1U) * psBcm->ulUnitNs;
+}
+
+/**
+ * @brief Estimates the refresh rate for a given fixed cost per step.
+ *
+ * @param psBcm            Sequencer.
+ * @param ulStepOverheadNs Time of a step outside its OE slot (shift, latch, blanking).
+ * @return Refresh rate in mHz.
+ */
+uint32_t LEDBcm_EstimateRefreshMilliHz(const sLEDBcm_t *psBcm, uint32_t ulStepOverheadNs)
+{
+    uint64_t udCycleNs = LEDBcm_GetOnTimePerCycleNs(psBcm) +
+                         ((uint64_t)LEDBcm_GetStepsPerCycle(psBcm) * ulStepOverheadNs);
+
+    if (udCycleNs == 0)
+    {
+        return 0;
+    }
+    return (uint32_t)(1000000000000ULL / udCycleNs);
+}
@@ -0,0 +1,76 @@
+/**
+ * @file LEDBcm.h
+ * @brief Binary code modulation (BCM) sequencer for the LED matrix scan.
+ *
+ * Decides which scan address and bit-plane is shifted next and how long OE is held for
+ * it. Plane p of a frame is shown for (1 << p) time units, so N planes give 2^N gray
+ * levels per scan address at the cost of N shifts per address. A brightness duty scales
+ * OE within every slot and leaves the slot length alone. The sequencer has no
+ * hardware dependency; LEDDriver turns its steps into LE/OE pulses and SPI transfers.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_LEDBCM_H_
+#define HAL_LEDDRIVERINTERFACE_LEDBCM_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+#include <stdbool.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define LED_BCM_MAX_PLANES      8U
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief One step of the scan: the data shifted for it and its OE time once latched.
+ */
+typedef struct {
+    uint8_t  ubAddress;     // Scan address the plane row belongs to
+    uint8_t  ubPlane;       // Bit-plane shifted (0 - least significant)
+    uint32_t ulOnTimeNs;    // OE time of the step: (1 << ubPlane) units scaled by the duty
+    uint32_t ulDarkNs;      // Rest of the step's slot with OE off (dimming)
+    bool     bCycleStart;   // First step of a scan cycle (first address shown, plane 0)
+} sLEDBcmStep_t;
+
+/**
+ * @brief Sequencer state. Steps run plane by plane within an address, address by
+ *        address within a scan cycle.
+ */
+typedef struct {
+    uint32_t ulUnitNs;      // OE time of plane 0
+    uint8_t  ubScanRate;    // Scan addresses per cycle
+    uint8_t  ubPlanes;      // Bit-planes per address (1..LED_BCM_MAX_PLANES)
+    uint8_t  ubAddress;     // Address of the next step
+    uint8_t  ubPlane;       // Plane of the next step
+    uint32_t ulSkipMask;    // Scan addresses left out of the cycle (blank rows)
+    uint8_t  ubFirstAddress; // First address shown
+    uint16_t usDuty;        // OE duty of every slot (0..LED_BRIGHTNESS_FULL_DUTY)
+    uint32_t aulOnTimeNs[LED_BCM_MAX_PLANES]; // OE time of each plane at usDuty
+} sLEDBcm_t;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t LEDBcm_Init(sLEDBcm_t *psBcm, uint8_t ubScanRate, uint8_t ubPlanes, uint32_t ulUnitNs);
+
+uint8_t LEDBcm_SetPlanes(sLEDBcm_t *psBcm, uint8_t ubPlanes, uint32_t ulUnitNs);
+
+void LEDBcm_SetDuty(sLEDBcm_t *psBcm, uint16_t usDuty);
+
+void LEDBcm_SetSkipMask(sLEDBcm_t *psBcm, uint32_t ulSkipMask);
+
+void LEDBcm_NextStep(sLEDBcm_t *psBcm, sLEDBcmStep_t *psStep);
+
+uint32_t LEDBcm_GetStepsPerCycle(const sLEDBcm_t *psBcm);
+
+uint64_t LEDBcm_GetOnTimePerCycleNs(const sLEDBcm_t *psBcm);
+
+uint32_t LEDBcm_EstimateRefreshMilliHz(const sLEDBcm_t *psBcm, uint32_t ulStepOverheadNs);
+
+#endif /* HAL_LEDDRIVERINTERFACE_LEDBCM_H_ */
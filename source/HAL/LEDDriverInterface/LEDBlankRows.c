@@ -0,0 +1,124 @@
+/**
+ * @file LEDBlankRows.c
+ * @brief Blank scan address detection for the LED matrix scan.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/LEDBlankRows.h"
+#include <stddef.h>
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Finds the scan addresses whose payloads are zero in every plane.
+ *
+ * Stops looking at an address at its first non-zero word, so a full frame costs about
+ * one word per address and an empty one a read of the payloads.
+ *
+ * @param ptubPayloads   Payload of plane p, address n at [p * ubScanRate + n].
+ * @param ubScanRate     Scan addresses (at most 32).
+ * @param ubPlanes       Planes shown.
+ * @param ulPayloadBytes Bytes of one payload.
+ * @return Bit n set if address n is blank.
+ */
+uint32_t LEDBlankRows_Find(uint8_t *const *ptubPayloads, uint8_t ubScanRate, uint8_t ubPlanes,
+                           uint32_t ulPayloadBytes)
+{
+    uint32_t ulBlankMask = 0;
+
+    if ((ptubPayloads == NULL) || (ubScanRate > 32U))
+    {
+        return 0;
+    }
+
+    for (uint8_t ubAddress = 0; ubAddress < ubScanRate; ubAddress++)
+    {
+        bool bBlank = true;
+
+        for (uint8_t ubPlane = 0; bBlank && (ubPlane < ubPlanes); ubPlane++)
+        {
+            bBlank = LEDBlankRows_IsZero(ptubPayloads[(ubPlane * ubScanRate) + ubAddress], ulPayloadBytes);
+        }
+        if (bBlank)
+        {
+            ulBlankMask |= (1UL << ubAddress);
+        }
+    }
+    return ulBlankMask;
+}
+
+/**
+ * @brief Returns true if every byte is zero; reads whole words once aligned.
+ */
+bool LEDBlankRows_IsZero(const uint8_t *pubData, uint32_t ulBytes)
+{
+    while ((ulBytes != 0) && (((uintptr_t)pubData & 0x3U) != 0U))
+    {
+        if (*pubData != 0U)
+        {
+            return false;
+        }
+        pubData++;
+        ulBytes--;
+    }
+
+    const uint32_t *pulData = (const uint32_t *)(const void *)pubData;
+    for (; ulBytes >= 4U; ulBytes -= 4U)
+    {
+        if (*pulData++ != 0U)
+        {
+            return false;
+        }
+    }
+
+    pubData = (const uint8_t *)pulData;
+    while (ulBytes-- != 0U)
+    {
+        if (*pubData++ != 0U)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Returns the scan addresses left to show; at least one, so the scan keeps its pace.
+ */
+uint8_t LEDBlankRows_CountShown(uint32_t ulBlankMask, uint8_t ubScanRate)
+{
+    uint8_t ubShown = 0;
+
+    for (uint8_t ubAddress = 0; ubAddress < ubScanRate; ubAddress++)
+    {
+        if ((ulBlankMask & (1UL << ubAddress)) == 0U)
+        {
+            ubShown++;
+        }
+    }
+    return (ubShown != 0) ? ubShown : 1U;
+}
+
+/**
+ * @brief Scales a cycle period or an OE duty by the share of addresses shown.
+ *
+ * A cycle without the blank addresses is (ubShown / ubScanRate) of a full one; the same
+ * OE time in a shorter cycle looks brighter, so the duty is scaled down by that ratio.
+ *
+ * @return ulValue * ubShown / ubScanRate, rounded to nearest.
+ */
+uint32_t LEDBlankRows_ScaleToShown(uint32_t ulValue, uint8_t ubShown, uint8_t ubScanRate)
+{
+    if ((ubScanRate == 0) || (ubShown >= ubScanRate))
+    {
+        return ulValue;
+    }
+    return (uint32_t)((((uint64_t)ulValue * ubShown) + (ubScanRate / 2U)) / ubScanRate);
+}
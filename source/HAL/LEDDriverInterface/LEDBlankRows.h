@@ -0,0 +1,35 @@
+/**
+ * @file LEDBlankRows.h
+ * @brief Blank scan address detection for the LED matrix scan.
+ *
+ * A scan address whose payloads are zero in every bit-plane lights nothing: the scan can
+ * leave out its shifts and OE slots. The cycle then takes (shown / scan rate) of the time,
+ * so the refresh rate rises by the inverse; the OE duty is scaled by the same ratio so
+ * the lit rows keep their brightness. No hardware dependency.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_LEDBLANKROWS_H_
+#define HAL_LEDDRIVERINTERFACE_LEDBLANKROWS_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+#include <stdbool.h>
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint32_t LEDBlankRows_Find(uint8_t *const *ptubPayloads, uint8_t ubScanRate, uint8_t ubPlanes,
+                           uint32_t ulPayloadBytes);
+
+bool LEDBlankRows_IsZero(const uint8_t *pubData, uint32_t ulBytes);
+
+uint8_t LEDBlankRows_CountShown(uint32_t ulBlankMask, uint8_t ubScanRate);
+
+uint32_t LEDBlankRows_ScaleToShown(uint32_t ulValue, uint8_t ubShown, uint8_t ubScanRate);
+
+#endif /* HAL_LEDDRIVERINTERFACE_LEDBLANKROWS_H_ */
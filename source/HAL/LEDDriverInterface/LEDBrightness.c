@@ -0,0 +1,129 @@
+/**
+ * @file LEDBrightness.c
+ * @brief Gamma-corrected brightness of the LED matrix.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/LEDBrightness.h"
+#include <math.h>
+#include <stddef.h>
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Initializes full brightness, no limits and the default gamma.
+ */
+void LEDBrightness_Init(sLEDBrightness_t *psBrightness)
+{
+    psBrightness->ubLowLimit = 0;
+    psBrightness->ubHighLimit = LED_BRIGHTNESS_MAX_LEVEL;
+    psBrightness->ubTarget = LED_BRIGHTNESS_MAX_LEVEL;
+    (void)LEDBrightness_SetGamma(psBrightness, LED_BRIGHTNESS_DEFAULT_GAMMA_X100);
+}
+
+/**
+ * @brief Rebuilds the duty LUT for a gamma.
+ *
+ * Level 0 is dark and level 255 full duty; every other level gets at least the smallest
+ * duty, so no level above 0 is black and the LUT stays non-decreasing.
+ *
+ * @param usGammaX100 Gamma * 100 (LED_BRIGHTNESS_MIN_GAMMA_X100..LED_BRIGHTNESS_MAX_GAMMA_X100).
+ * @return 1 on success, 0 if the gamma is out of range (LUT unchanged).
+ */
+uint8_t LEDBrightness_SetGamma(sLEDBrightness_t *psBrightness, uint16_t usGammaX100)
+{
+    float fGamma = (float)usGammaX100 / 100.0f;
+
+    if ((usGammaX100 < LED_BRIGHTNESS_MIN_GAMMA_X100) || (usGammaX100 > LED_BRIGHTNESS_MAX_GAMMA_X100))
+    {
+        return 0;
+    }
+
+    psBrightness->ausDutyLut[0] = 0;
+    for (uint16_t usLevel = 1; usLevel < LED_BRIGHTNESS_LEVELS; usLevel++)
+    {
+        float fDuty = powf((float)usLevel / (float)LED_BRIGHTNESS_MAX_LEVEL, fGamma) * (float)LED_BRIGHTNESS_FULL_DUTY;
+        uint32_t ulDuty = (uint32_t)(fDuty + 0.5f);
+
+        // Rounding of powf must not break the order of the levels
+        if (ulDuty <= psBrightness->ausDutyLut[usLevel - 1U])
+        {
+            ulDuty = psBrightness->ausDutyLut[usLevel - 1U] + ((usLevel == 1U) ? 1U : 0U);
+        }
+        if (ulDuty > LED_BRIGHTNESS_FULL_DUTY)
+        {
+            ulDuty = LED_BRIGHTNESS_FULL_DUTY;
+        }
+        psBrightness->ausDutyLut[usLevel] = (uint16_t)ulDuty;
+    }
+    psBrightness->ausDutyLut[LED_BRIGHTNESS_MAX_LEVEL] = LED_BRIGHTNESS_FULL_DUTY;
+    psBrightness->usGammaX100 = usGammaX100;
+    return 1;
+}
+
+/**
+ * @brief Sets the range of levels that may be shown.
+ *
+ * @return 1 on success, 0 if ubLow > ubHigh (limits unchanged).
+ */
+uint8_t LEDBrightness_SetLimits(sLEDBrightness_t *psBrightness, uint8_t ubLow, uint8_t ubHigh)
+{
+    if (ubLow > ubHigh)
+    {
+        return 0;
+    }
+
+    psBrightness->ubLowLimit = ubLow;
+    psBrightness->ubHighLimit = ubHigh;
+    return 1;
+}
+
+/**
+ * @brief Sets the requested level; it is clamped to the limits when it is read.
+ */
+void LEDBrightness_SetTarget(sLEDBrightness_t *psBrightness, uint8_t ubTarget)
+{
+    psBrightness->ubTarget = ubTarget;
+}
+
+/**
+ * @brief Returns the requested level clamped to the limits.
+ */
+uint8_t LEDBrightness_GetLevel(const sLEDBrightness_t *psBrightness)
+{
+    if (psBrightness->ubTarget < psBrightness->ubLowLimit)
+    {
+        return psBrightness->ubLowLimit;
+    }
+    if (psBrightness->ubTarget > psBrightness->ubHighLimit)
+    {
+        return psBrightness->ubHighLimit;
+    }
+    return psBrightness->ubTarget;
+}
+
+/**
+ * @brief Returns the OE duty of the clamped level (0..LED_BRIGHTNESS_FULL_DUTY).
+ */
+uint16_t LEDBrightness_GetDuty(const sLEDBrightness_t *psBrightness)
+{
+    return psBrightness->ausDutyLut[LEDBrightness_GetLevel(psBrightness)];
+}
+
+/**
+ * @brief Returns the OE time within a slot for a duty; non-decreasing in both arguments.
+ *
+ * @param ulSlotNs OE slot at full duty.
+ * @param usDuty   Duty (0..LED_BRIGHTNESS_FULL_DUTY).
+ */
+uint32_t LEDBrightness_ScaleOnTime(uint32_t ulSlotNs, uint16_t usDuty)
+{
+    return (uint32_t)(((uint64_t)ulSlotNs * usDuty) / LED_BRIGHTNESS_FULL_DUTY);
+}
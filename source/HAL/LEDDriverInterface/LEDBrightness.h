@@ -0,0 +1,61 @@
+/**
+ * @file LEDBrightness.h
+ * @brief Gamma-corrected brightness of the LED matrix.
+ *
+ * Maps a brightness level (0-255) through a gamma LUT to an OE duty (0-65535 of the OE
+ * slot). The level is clamped to the limits set by the control centre (INIT request)
+ * before it is looked up. The duty only shortens OE within a slot, the rest of the slot
+ * is dark, so dimming does not change the refresh rate. No hardware dependency.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_LEDBRIGHTNESS_H_
+#define HAL_LEDDRIVERINTERFACE_LEDBRIGHTNESS_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define LED_BRIGHTNESS_LEVELS               256U
+#define LED_BRIGHTNESS_MAX_LEVEL            255U
+#define LED_BRIGHTNESS_FULL_DUTY            65535U
+#define LED_BRIGHTNESS_DEFAULT_GAMMA_X100   220U    // Gamma 2.2
+#define LED_BRIGHTNESS_MIN_GAMMA_X100       100U    // Linear
+#define LED_BRIGHTNESS_MAX_GAMMA_X100       400U
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief Brightness state: gamma LUT, limits and requested level.
+ */
+typedef struct {
+    uint16_t ausDutyLut[LED_BRIGHTNESS_LEVELS]; // OE duty of every level, non-decreasing
+    uint16_t usGammaX100;   // Gamma of the LUT * 100
+    uint8_t  ubLowLimit;    // Lowest level shown
+    uint8_t  ubHighLimit;   // Highest level shown
+    uint8_t  ubTarget;      // Requested level (before clamping)
+} sLEDBrightness_t;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+void LEDBrightness_Init(sLEDBrightness_t *psBrightness);
+
+uint8_t LEDBrightness_SetGamma(sLEDBrightness_t *psBrightness, uint16_t usGammaX100);
+
+uint8_t LEDBrightness_SetLimits(sLEDBrightness_t *psBrightness, uint8_t ubLow, uint8_t ubHigh);
+
+void LEDBrightness_SetTarget(sLEDBrightness_t *psBrightness, uint8_t ubTarget);
+
+uint8_t LEDBrightness_GetLevel(const sLEDBrightness_t *psBrightness);
+
+uint16_t LEDBrightness_GetDuty(const sLEDBrightness_t *psBrightness);
+
+uint32_t LEDBrightness_ScaleOnTime(uint32_t ulSlotNs, uint16_t usDuty);
+
+#endif /* HAL_LEDDRIVERINTERFACE_LEDBRIGHTNESS_H_ */
@@ -1,399 +1,1903 @@
-/**
- * @file LEDDriver.c
- * @brief Low-level driver implementation for controlling the LED matrix via LPSPI and EDMA.
- *
- * This file contains the hardware configuration for the LPSPI master, EDMA, and DMAMUX,
- * as well as data preparation routines (Gray code conversion, row mapping) necessary
- * to stream frame buffer data to the LED panels.
- *
- * (C) Copyright Centum T&S Group 2025. All rights reserved.
- * This computer program may not be used, copied, distributed, translated,
- * transmitted or assigned without the prior written authorization of
- * Centum T&S Group.
- */
-
-//------------------------------------ [ INCLUDE FILES ] ----------------------------//
-//
-#include "HAL/LEDDriverInterface/LEDDriver.h"
-#include "string.h"
-
-//-------------------------------------[ TYPEDEF ] ----------------------------------//
-//
-typedef struct {
-    int dec;      // Scan Address
-    int row;      // Physical Rows
-} sRowAddress_t;
-
-//-------------------------------------[ STATIC VARIABLE ] --------------------------//
-//
-static lpspi_master_config_t sLpspiConfig;
-static lpspi_master_edma_handle_t sEdmaHandle;
-static edma_config_t sEdmaConfig = {
-		  .enableContinuousLinkMode = false,
-		  .enableHaltOnError = true,
-		  .enableRoundRobinArbitration = false,
-		  .enableDebugMode = false};
-static edma_handle_t sLpspiEdmaMasterRxRegToRxDataHandle;
-static edma_handle_t sLpspiEdmaMasterTxRegToTxDataHandle;
-
-// Array to store the mapping, filled programmatically at runtime.
-static sRowAddress_t *psRowAddressMap = NULL;
-static uint8_t **ubCombinedData = NULL;
-static uint8_t ubRowSize = 0;
-static lpspi_transfer_t sMasterXfer;
-
-static volatile bool bIsTransferCompleted = true;
-
-//Configuration parameters received from LEDDriver_ConfigurePanel()
-static uint16_t usRowsPerPanel = 0;
-static uint16_t usColumnsPerPanel = 0;
-static uint8_t ubNumberofPanels = 0;
-static uint8_t ubIsDoubleSidedDisplay = 0;
-static uint8_t ubIsRGB = 0;
-static uint8_t ubNumberofRowAddressBits = 0;
-
-//Derived Parameters
-static uint8_t ubScanRate = 0;
-static uint8_t ubRowsPerScanAddress = 0;
-static uint8_t ubTotalColumnsPerRowBytes = 0;
-static uint32_t ulDataBitsPerScanCycle = 0;
-static uint32_t ulSpiPayloadSizeBytes = 0;
-
-//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
-//
-static void LPSPIMasterUserCallback(LPSPI_Type *base, lpspi_master_edma_handle_t *handle, status_t status, void *userData);
-static void InitializeRowAddressMap();
-static void SPITransfer(void);
-
-//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
-//
-
-/**
- * @brief Initializes the eDMA peripheral and LPSPI1 peripheral as a Master.
- *
- *
- * Configures the clock, sets standard SPI parameters (baud rate, bits per frame),
- * and creates the EDMA-aware transfer handle for asynchronous operations.
- */
-
-void LEDDriver_Init()
-{
-	/*DMA Mux setting and EDMA init*/
-	#if defined(FSL_FEATURE_SOC_DMAMUX_COUNT) && FSL_FEATURE_SOC_DMAMUX_COUNT
-	    /* DMA MUX init*/
-	    DMAMUX_Init(LPSPI_MASTER_DMA_MUX_BASE);
-
-	    DMAMUX_SetSource(LPSPI_MASTER_DMA_MUX_BASE, LPSPI_MASTER_DMA_RX_CHANNEL,
-	                     LPSPI_MASTER_DMA_RX_REQUEST_SOURCE);
-	    DMAMUX_EnableChannel(LPSPI_MASTER_DMA_MUX_BASE, LPSPI_MASTER_DMA_RX_CHANNEL);
-
-	    DMAMUX_SetSource(LPSPI_MASTER_DMA_MUX_BASE, LPSPI_MASTER_DMA_TX_CHANNEL,
-	                     LPSPI_MASTER_DMA_TX_REQUEST_SOURCE);
-	    DMAMUX_EnableChannel(LPSPI_MASTER_DMA_MUX_BASE, LPSPI_MASTER_DMA_TX_CHANNEL);
-	#endif
-
-    /* EDMA init*/
-    EDMA_GetDefaultConfig(&sEdmaConfig);
-#if defined(BOARD_GetEDMAConfig)
-    BOARD_GetEDMAConfig(sEdmaConfig);
-#endif
-    EDMA_Init(LPSPI_MASTER_DMA_BASE, &sEdmaConfig);
-
-    EDMA_EnableMinorLoopMapping(LPSPI_MASTER_DMA_BASE, true);
-
-
-    memset(&(sLpspiEdmaMasterRxRegToRxDataHandle), 0, sizeof(sLpspiEdmaMasterRxRegToRxDataHandle));
-    memset(&(sLpspiEdmaMasterTxRegToTxDataHandle), 0, sizeof(sLpspiEdmaMasterTxRegToTxDataHandle));
-
-    EDMA_CreateHandle(&(sLpspiEdmaMasterRxRegToRxDataHandle), LPSPI_MASTER_DMA_BASE,
-                      LPSPI_MASTER_DMA_RX_CHANNEL);
-    EDMA_CreateHandle(&(sLpspiEdmaMasterTxRegToTxDataHandle), LPSPI_MASTER_DMA_BASE,
-                      LPSPI_MASTER_DMA_TX_CHANNEL);
-
-#if defined(FSL_FEATURE_EDMA_HAS_CHANNEL_MUX) && FSL_FEATURE_EDMA_HAS_CHANNEL_MUX
-    EDMA_SetChannelMux(LPSPI_MASTER_DMA_BASE, LPSPI_MASTER_DMA_TX_CHANNEL,
-                       DEMO_LPSPI_TRANSMIT_EDMA_CHANNEL);
-    EDMA_SetChannelMux(LPSPI_MASTER_DMA_BASE, LPSPI_MASTER_DMA_RX_CHANNEL,
-                       DEMO_LPSPI_RECEIVE_EDMA_CHANNEL);
-#endif
-
-    /*Set clock source for LPSPI*/
-    	CLOCK_SetMux(kCLOCK_LpspiMux, LPSPI_CLOCK_SOURCE_SELECT);
-    	CLOCK_SetDiv(kCLOCK_LpspiDiv, LPSPI_CLOCK_SOURCE_DIVIDER);
-
-        LPSPI_MasterGetDefaultConfig(&sLpspiConfig);
-        sLpspiConfig.baudRate = TRANSFER_BAUDRATE;
-        sLpspiConfig.bitsPerFrame = 8;
-    	sLpspiConfig.whichPcs = LPSPI_MASTER_PCS_FOR_INIT;
-    	sLpspiConfig.pcsToSckDelayInNanoSec        = 0;
-    	sLpspiConfig.lastSckToPcsDelayInNanoSec    = 0;
-    	sLpspiConfig.betweenTransferDelayInNanoSec = 0;
-
-        LPSPI_MasterInit(BOARD_LED_LPSPI1_PERIPHERAL, &sLpspiConfig, BOARD_LED_LPSPI1_CLOCK_FREQ);
-
-        /*Set up lpspi master transfer handle*/
-        // This function sets up the internal EDMA callbacks, preventing the hang.
-        LPSPI_MasterTransferCreateHandleEDMA(LPSPI_MASTER_BASEADDR, &sEdmaHandle, LPSPIMasterUserCallback,
-                 	 	 	 	 	 	 	  NULL, &sLpspiEdmaMasterRxRegToRxDataHandle,
-    										  &sLpspiEdmaMasterTxRegToTxDataHandle);
-     	LPSPI_MasterTransferPrepareEDMALite(BOARD_LED_LPSPI1_PERIPHERAL, &sEdmaHandle, kLPSPI_MasterPcs0 | kLPSPI_MasterPcsContinuous);
-}
-
-
-//TODO: Needs to be called by display controller
-void LEDDriver_ConfigurePanel(uint16_t usDisplayRows,
-							  uint16_t usDisplayColumns,
-							  uint8_t  ubDoubleSidedDisplay,
-							  uint8_t  ubLedType,
-							  uint8_t  ubNumPanels,
-							  uint8_t  ubNumRowSelection)
-{
-	//-------------------------------------------------//
-	//Extract all LED configuration parameters
-	usRowsPerPanel = usDisplayRows;
-	usColumnsPerPanel = usDisplayColumns;
-	ubIsDoubleSidedDisplay = ubDoubleSidedDisplay;
-	ubIsRGB = ubLedType;
-	ubNumberofPanels = ubNumPanels;
-	ubNumberofRowAddressBits = ubNumRowSelection;
-
-	//-------------------------------------------------//
-	//Initialising derived parameters
-
-	//Number of unique scan addresses
-	ubScanRate = (1 << ubNumberofRowAddressBits);
-
-	// The number of physical rows selected simultaneously by one address
-	ubRowsPerScanAddress = (usRowsPerPanel/ubScanRate);
-
-	// The size of one physical row's data across all panels, in bytes.
-	// Eg : (128 columns / 8 bits/byte = 16 bytes)
-	ubTotalColumnsPerRowBytes = ((ubNumberofPanels * usColumnsPerPanel)/8);
-
-	//Total number of data bits per scan cycle - Across all columns and panels for number of rows that can be selected at once
-	ulDataBitsPerScanCycle = (ubNumberofPanels * usColumnsPerPanel * ubRowsPerScanAddress);
-
-	// Size of the SPI payload buffer in bytes (e.g., 256 bits / 8 = 32 bytes)
-	ulSpiPayloadSizeBytes = (ulDataBitsPerScanCycle / 8);
-
-
-	//Allocating memory for ubCombinedData
-	size_t TotalDataBytes = (size_t)ubScanRate*ulSpiPayloadSizeBytes;
-	if(ubCombinedData != NULL && ubCombinedData[0] != NULL)
-	{
-		free(ubCombinedData[0]);
-		free(ubCombinedData);
-	}
-
-	// Allocate the array of row pointers (The "rows" of the 2D array)
-	ubCombinedData = (uint8_t **)malloc(ubScanRate * sizeof(uint8_t *));
-	if (ubCombinedData == NULL)
-	{ /* Handle error */
-		return;
-	}
-
-	// Allocate the single, contiguous block for all the data (The memory for the SPI transfer)
-	uint8_t *pubDataBlock = (uint8_t *)malloc(TotalDataBytes);
-	if (pubDataBlock == NULL)
-	{
-		free(ubCombinedData);
-		ubCombinedData = NULL; /* Handle error */
-		return;
-	}
-
-	// Point each row pointer into the contiguous data block
-	for (int n = 0; n < ubScanRate; n++)
-	{
-		ubCombinedData[n] = pubDataBlock + (n * ulSpiPayloadSizeBytes);
-	}
-
-	// Initialize the new buffer to zero for safety
-	memset(pubDataBlock, 0, TotalDataBytes);
-
-	//-------------------------------------------------//
-	//Allocating memory for psRowAddress
-
-	// Check if memory is already allocated (for re-configuration) and free it
-	if (psRowAddressMap != NULL)
-	{
-		free(psRowAddressMap);
-	}
-
-	// Allocate the exact amount of memory needed
-	psRowAddressMap = (sRowAddress_t *)malloc(usRowsPerPanel * sizeof(sRowAddress_t));
-
-	if (psRowAddressMap == NULL)
-	{
-		// Handle allocation failure
-		usRowsPerPanel = 0;
-		return;
-	}
-	//Build Row address map according to the configuration parameters
-	InitializeRowAddressMap();
-
-}
-/**
- * @brief Prepares the `ubCombinedData` buffer for all scan addresses.
- *
- * Reads data from the active frame buffer (`ptubActiveBufferNow`), applies the
- * row mapping (including rotation), and concatenates the rows required
- * for each physical scan address into a single contiguous block for SPI transfer.
- *
- * Note : Needs to be called every time the data in Active buffer changes
- */
-void LEDDriver_PrepareDisplayBuffer(uint8_t **ptubActiveBufferNow)
-{
-    for (int n = 0; n < ubScanRate; n++)
-    {
-        uint8_t ubFound = 0;
-        for (int i = 0; i < usRowsPerPanel; i++)
-        {
-            if (psRowAddressMap[i].dec == n)
-            {
-                memcpy(ubCombinedData[n] + ubFound * ubTotalColumnsPerRowBytes, ptubActiveBufferNow[psRowAddressMap[i].row], ubTotalColumnsPerRowBytes);
-                ubFound++;
-                if (ubFound == ubRowsPerScanAddress) break;
-            }
-        }
-    }
-}
-
-void LEDDriver_DisplayOnLED()
-{
-	if (bIsTransferCompleted == 1)
-	{
-		LED_LE_ENABLE;
-		SDK_DelayAtLeastUs(10, CLOCK_GetCoreSysClkFreq());// TODO :
-		LED_LE_DISABLE;
-
-		LED_OE_ENABLE;
-		SDK_DelayAtLeastUs(100, CLOCK_GetCoreSysClkFreq());// TODO :
-		LED_OE_DISABLE;
-
-		SDK_DelayAtLeastUs(100, CLOCK_GetCoreSysClkFreq());// TODO :
-		SPITransfer();
-	}
-}
-
-//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
-//
-/**
- * @brief Initializes the row address map for display rotation.
- *
- * Calculates the source row index (`row`) in the frame buffer that corresponds to a
- * physical scan address (`dec`) for a 180-degree display rotation.
- * This is called once during initialization or before building data.
- */
-static void InitializeRowAddressMap(void)
-{
-    // This function is updated to map data for a 180-degree rotation.
-    for (int i = 0; i < usRowsPerPanel; i++)
-    {
-        // 1. Determine the source row index in the frame buffer to flip the content (15 -> 0, 0 -> 15)
-        uint8_t ubSourceRowIndex = usRowsPerPanel - 1 - i;
-
-        // 2. Apply the original scan address logic to the *source row index* (0 to 15)
-        uint8_t ubScanAddress;
-
-        if (ubSourceRowIndex < ubScanRate)
-        {
-            // First half of source data (rows 0-7) map to scan addresses 7 down to 0
-            ubScanAddress = ubScanRate - 1 - ubSourceRowIndex; // 7 - ubSourceRowIndex
-        }
-        else
-        {
-            // Second half of source data (rows 8-15) map to scan addresses 0 up to 7
-            ubScanAddress = ubSourceRowIndex - ubScanRate; // ubSourceRowIndex - 8
-        }
-
-        // The current physical display row (i) is driven by 'ubScanAddress'
-        // and should pull its data from 'ubSourceRowIndex'.
-        psRowAddressMap[i].dec = ubScanAddress;
-        psRowAddressMap[i].row = ubSourceRowIndex; // Set data source row to the flipped index
-    }
-}
-
-
-/**
- * @brief Converts a standard binary number to its corresponding Gray code.
- *
- * The Gray code is used for the row select addresses to prevent transient states.
- *
- * @param ubBin The binary value to convert (e.g., the row index).
- * @return The 8-bit Gray code equivalent.
- */
-static inline uint8_t BinaryToGray(uint8_t ubBin) {
-    // Standard binary to Gray conversion: G = B ^ (B >> 1)
-    return ubBin ^ (ubBin >> 1);
-}
-
-/**
- * @brief Selects the physical row to be displayed by driving the address lines (A, B, C, etc.).
- *
- * The row index is first converted to Gray code before being output to the LED address pins.
- *
- * @param ubRow The 0-indexed row (0 to ubScanRate - 1) to select.
- */
-static void LEDRowSelect(uint8_t ubRow)
-{
-    // Ensure input is within bounds
-    if (ubRow >= ubScanRate) return;
-
-    // 1. Calculate the Gray Code for the binary scan address (0-7)
-    // This removes the hardcoded lookup table for address bits.
-    uint8_t ubGrayCode = BinaryToGray(ubRow);
-
-    // 2. Output the calculated Gray code bits to the address pins.
-    LED_A0((ubGrayCode >> 0) & 0x01);
-    LED_A1((ubGrayCode >> 1) & 0x01);
-    LED_A2((ubGrayCode >> 2) & 0x01);
-}
-
-/**
- * @brief SPI handler for display refresh.
- *
- * Manages one step of the display scan cycle: setting the row address, initiating
- * the LPSPI DMA transfer, and advancing the row counter.
- *
- * @param void No parameters.
- * @return void No return value.
- */
-static void SPITransfer(void)
-{
-    bIsTransferCompleted = false;
-    LEDRowSelect(ubRowSize);
-	/*Start master transfer*/
-	sMasterXfer.txData   = ubCombinedData[ubRowSize];
-	sMasterXfer.rxData   = NULL;
-	sMasterXfer.dataSize = ulSpiPayloadSizeBytes;
-	LPSPI_MasterTransferEDMALite(BOARD_LED_LPSPI1_PERIPHERAL, &sEdmaHandle, &sMasterXfer);
-
-	ubRowSize++;
-	if(ubRowSize  >= 8 )
-	{
-		ubRowSize = 0;
-	}
-}
-
-/**
- * @brief Callback function executed upon completion of an LPSPI Master EDMA transfer.
- *
- * This function is registered with the EDMA handle and is called by the EDMA interrupt
- * service routine when the transfer is finished.
- *
- * @param base LPSPI peripheral base address.
- * @param handle Pointer to the LPSPI master EDMA transfer handle.
- * @param status Status of the transfer (kStatus_Success or an error code).
- * @param userData Custom data pointer (unused in this implementation).
- */
-static void LPSPIMasterUserCallback(LPSPI_Type *base, lpspi_master_edma_handle_t *handle, status_t status, void *userData)
-{
-
-    if (status == kStatus_Success)
-    {
-        // The transfer finished. We set a flag to release the CPU from its waiting loop.
-        bIsTransferCompleted = true;
-    }
-}
-
-
+/**
+ * @file LEDDriver.c
+ * @brief Low-level driver implementation for controlling the LED matrix via LPSPI and EDMA.
+ *
+ * This file contains the hardware configuration for the LPSPI master, EDMA, and DMAMUX,
+ * as well as data preparation routines (Gray code conversion, row mapping) necessary
+ * to stream frame buffer data to the LED panels.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/LEDDriver.h"
+#include "HAL/LEDDriverInterface/LEDScan.h"
+#include "HAL/LEDDriverInterface/LEDScanChain.h"
+#include "HAL/LEDDriverInterface/LEDRowAddress.h"
+#include "HAL/LEDDriverInterface/LEDBlankRows.h"
+#include "HAL/MemoryManager/MemoryManager.h"
+#include "string.h"
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef struct {
+    uint32_t ulDestOffset;  // Byte offset of the segment in the payload block of its face
+    uint16_t usSourceRow;   // Frame buffer row copied to it
+    uint16_t usSourceOffset;// First byte of the segment in the source row
+    uint16_t usBytes;       // Segment length
+    uint8_t  ubReversed;    // Segment belongs to a rotated panel: copied mirrored (bytes and bits)
+} sLEDGatherEntry_t;
+
+/**
+ * @brief Packing plan and payloads of one face of the unit.
+ */
+typedef struct {
+    sLEDGatherEntry_t *psGatherTable;   // Scan pattern compiled into frame row -> payload copies, in payload order
+    uint16_t usGatherEntries;
+    uint8_t **ptubPayloads;             // Plane p, address n is [p * ubScanRate + n]
+    uint8_t *pubPayloadBlock;           // Own payloads, one contiguous block; ptubPayloads point here
+                                        // unless bit-planes are streamed (front face)
+    volatile uint32_t ulBlankAddresses; // Addresses blank in every plane, found by the last pack
+} sLEDFace_t;
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define LED_FACE_FRONT  0U
+#define LED_FACE_REAR   1U
+#define LED_FACES       2U
+
+//-------------------------------------[ STATIC VARIABLE ] --------------------------//
+//
+static lpspi_master_config_t sLpspiConfig;
+static lpspi_master_edma_handle_t sEdmaHandle;
+static edma_config_t sEdmaConfig = {
+		  .enableContinuousLinkMode = false,
+		  .enableHaltOnError = true,
+		  .enableRoundRobinArbitration = false,
+		  .enableDebugMode = false};
+static edma_handle_t sLpspiEdmaMasterRxRegToRxDataHandle;
+static edma_handle_t sLpspiEdmaMasterTxRegToTxDataHandle;
+static lpspi_transfer_t sMasterXfer;
+
+// Rear face of a double-sided unit: own LPSPI and eDMA channels, shifted with the front
+static lpspi_master_edma_handle_t sRearEdmaHandle;
+static edma_handle_t sRearEdmaRxHandle;
+static edma_handle_t sRearEdmaTxHandle;
+static lpspi_transfer_t sRearXfer;
+
+// Packing plan and payloads of the front and (double-sided) rear face
+static sLEDFace_t asFaces[LED_FACES];
+static uint8_t ubFaces = 1;
+static pfnLEDRearFrameSource_t pfnRearFrameSource = NULL;
+
+// BCM sequencing: requested depth and the active sequence
+static uint8_t ubBitPlanes = 1;
+static uint32_t ulBcmUnitNs = LED_BCM_DEFAULT_UNIT_NS;
+static uint8_t ubAllocatedPlanes = 0;
+static sLEDBcm_t sBcm;
+
+// Blank scan addresses are left out of the timed scan, at constant brightness
+static bool bSkipBlankRows = true;
+
+// SPI clock and OE unit planned for the geometry, plane count and refresh rate
+static sLEDSpiDivider_t sSpiDivider;
+static sLEDRefreshPlan_t sRefreshPlan;
+
+// Brightness: LUT and limits, and the duty picked up by the scan at the next cycle start
+static sLEDBrightness_t sBrightness;
+static volatile uint16_t usBrightnessDuty = LED_BRIGHTNESS_FULL_DUTY;
+
+// Interrupt-driven scan and its hardware operations
+static uint32_t ulRefreshRateHz = LED_SCAN_DEFAULT_REFRESH_HZ;
+static uint32_t ulGptClockHz = 0;
+static uint32_t ulLastCycleCount = 0;
+static uint32_t ulTimeNs = 0;
+static uint32_t ulTimeRemainder = 0;
+static sLEDScan_t sScan;
+
+// Scan as one eDMA chain per cycle: TCDs, GPIO words and the TCR barrier word behind them
+static eLEDScanMode_t eScanMode = LED_SCAN_MODE_TIMED;
+static sLEDChainTcd_t *psChainTcds = NULL;
+static uint32_t *pulChainWords = NULL;
+static volatile bool bChainRunning = false;
+static uint32_t ulChainCycleStartNs = 0;
+static sLEDScanStats_t sChainStats;
+
+// Port writes of every scan address, built for the configured address lines
+static const uint32_t aulRowAddressLines[LED_ROW_ADDRESS_LINES] = {
+	LED_A0_MASK, LED_A1_MASK, LED_A2_MASK,
+#if (LED_ROW_ADDRESS_LINES > 3U)
+	LED_A3_MASK,
+#endif
+#if (LED_ROW_ADDRESS_LINES > 4U)
+	LED_A4_MASK,
+#endif
+};
+static sLEDRowAddressOutput_t asRowAddressTable[LED_ROW_ADDRESS_MAX_ENTRIES];
+
+// Frame source polled at the start of every scan cycle (NULL - caller prepares explicitly)
+static pfnLEDFrameSource_t pfnFrameSource = NULL;
+// Bit-plane frame source, polled instead of pfnFrameSource while set
+static pfnLEDBitPlaneSource_t pfnBitPlaneSource = NULL;
+// Front payloads point into the planes of the last bit-plane frame instead of the own block
+static bool bStreamingPlanes = false;
+static volatile pfnLEDCycleStartCallback_t pfnCycleStartCallback = NULL;
+
+static sLEDPackStats_t sPackStats;
+
+//Configuration parameters received from LEDDriver_ConfigurePanel()
+static uint16_t usRowsPerPanel = 0;
+static uint16_t usColumnsPerPanel = 0;
+static uint8_t ubNumberofPanels = 0;
+static uint8_t ubIsDoubleSidedDisplay = 0;
+static uint8_t ubIsRGB = 0;
+static uint8_t ubNumberofRowAddressBits = 0;
+
+//Derived Parameters
+static uint8_t ubScanRate = 0;
+static uint8_t ubRowsPerScanAddress = 0;
+static uint16_t usTotalColumnsPerRowBytes = 0;
+static uint32_t ulDataBitsPerScanCycle = 0;
+static uint32_t ulSpiPayloadSizeBytes = 0;
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static void LPSPIMasterUserCallback(LPSPI_Type *base, lpspi_master_edma_handle_t *handle, status_t status, void *userData);
+static uint8_t IsScanPatternValid(const sLEDScanPattern_t *psPattern);
+static uint8_t CompileGatherTable(sLEDFace_t *psFace, const sLEDScanPattern_t *psPattern);
+static uint8_t AllocateFace(sLEDFace_t *psFace, const sLEDScanPattern_t *psPattern);
+static void FreeFace(sLEDFace_t *psFace);
+static uint8_t IsFrontStreamable(void);
+static void RestoreFrontPayloads(void);
+static void PrepareFace(sLEDFace_t *psFace, uint8_t **ptubFrame, const uint32_t *pulDirtyRows);
+static inline uint8_t ReverseBits(uint8_t ubByte);
+static void PackPlane(const sLEDFace_t *psFace, uint8_t ubPlane, uint8_t *const *ptubRows, const uint8_t *pubPlane,
+                      uint16_t usStride, const uint32_t *pulDirtyRows);
+static void OnScanCycleStart(sLEDBcmStep_t *psStep);
+static void PollFrameSource(void);
+static void PlanRefresh(void);
+static void FillRefreshBudget(sLEDRefreshBudget_t *psBudget, uint8_t ubPanels, uint16_t usPanelColumns,
+							  uint8_t ubRowsPerAddress, uint8_t ubAddressScanRate, uint8_t ubPlanes,
+							  uint32_t ulTargetRefreshHz);
+static uint8_t BuildScanChain(void);
+static void FreeScanChain(void);
+static void StartChainCycle(void);
+static void ScanChainCallback(edma_handle_t *handle, void *userData, bool transferDone, uint32_t tcds);
+static void PrepareSpiTransfers(void);
+static void LEDRowSelect(uint8_t ubRow);
+static void ScanSetLatch(bool bActive);
+static void ScanSetOutputEnable(bool bEnabled);
+static void SPITransfer(uint8_t ubChannel, const uint8_t *pubData, uint32_t ulBytes);
+static void ScanStartTimer(uint32_t ulDelayNs);
+static uint32_t ScanGetTimeNs(void);
+
+static const sLEDScanHal_t sScanHal = {
+    .pfnSelectAddress   = LEDRowSelect,
+    .pfnSetLatch        = ScanSetLatch,
+    .pfnSetOutputEnable = ScanSetOutputEnable,
+    .pfnStartShift      = SPITransfer,
+    .pfnStartTimer      = ScanStartTimer,
+    .pfnGetTimeNs       = ScanGetTimeNs,
+};
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Initializes the eDMA peripheral and LPSPI1 peripheral as a Master.
+ *
+ *
+ * Configures the clock, sets standard SPI parameters (baud rate, bits per frame),
+ * and creates the EDMA-aware transfer handle for asynchronous operations.
+ */
+
+void LEDDriver_Init()
+{
+	/*DMA Mux setting and EDMA init*/
+	#if defined(FSL_FEATURE_SOC_DMAMUX_COUNT) && FSL_FEATURE_SOC_DMAMUX_COUNT
+	    /* DMA MUX init*/
+	    DMAMUX_Init(LPSPI_MASTER_DMA_MUX_BASE);
+
+	    DMAMUX_SetSource(LPSPI_MASTER_DMA_MUX_BASE, LPSPI_MASTER_DMA_RX_CHANNEL,
+	                     LPSPI_MASTER_DMA_RX_REQUEST_SOURCE);
+	    DMAMUX_EnableChannel(LPSPI_MASTER_DMA_MUX_BASE, LPSPI_MASTER_DMA_RX_CHANNEL);
+
+	    DMAMUX_SetSource(LPSPI_MASTER_DMA_MUX_BASE, LPSPI_MASTER_DMA_TX_CHANNEL,
+	                     LPSPI_MASTER_DMA_TX_REQUEST_SOURCE);
+	    DMAMUX_EnableChannel(LPSPI_MASTER_DMA_MUX_BASE, LPSPI_MASTER_DMA_TX_CHANNEL);
+
+	    DMAMUX_SetSource(LPSPI_MASTER_DMA_MUX_BASE, LED_REAR_DMA_RX_CHANNEL, LED_REAR_DMA_RX_REQUEST_SOURCE);
+	    DMAMUX_EnableChannel(LPSPI_MASTER_DMA_MUX_BASE, LED_REAR_DMA_RX_CHANNEL);
+	    DMAMUX_SetSource(LPSPI_MASTER_DMA_MUX_BASE, LED_REAR_DMA_TX_CHANNEL, LED_REAR_DMA_TX_REQUEST_SOURCE);
+	    DMAMUX_EnableChannel(LPSPI_MASTER_DMA_MUX_BASE, LED_REAR_DMA_TX_CHANNEL);
+	#endif
+
+    /* EDMA init*/
+    EDMA_GetDefaultConfig(&sEdmaConfig);
+#if defined(BOARD_GetEDMAConfig)
+    BOARD_GetEDMAConfig(sEdmaConfig);
+#endif
+    EDMA_Init(LPSPI_MASTER_DMA_BASE, &sEdmaConfig);
+
+    EDMA_EnableMinorLoopMapping(LPSPI_MASTER_DMA_BASE, true);
+
+
+    memset(&(sLpspiEdmaMasterRxRegToRxDataHandle), 0, sizeof(sLpspiEdmaMasterRxRegToRxDataHandle));
+    memset(&(sLpspiEdmaMasterTxRegToTxDataHandle), 0, sizeof(sLpspiEdmaMasterTxRegToTxDataHandle));
+    memset(&sRearEdmaRxHandle, 0, sizeof(sRearEdmaRxHandle));
+    memset(&sRearEdmaTxHandle, 0, sizeof(sRearEdmaTxHandle));
+
+    EDMA_CreateHandle(&(sLpspiEdmaMasterRxRegToRxDataHandle), LPSPI_MASTER_DMA_BASE,
+                      LPSPI_MASTER_DMA_RX_CHANNEL);
+    EDMA_CreateHandle(&(sLpspiEdmaMasterTxRegToTxDataHandle), LPSPI_MASTER_DMA_BASE,
+                      LPSPI_MASTER_DMA_TX_CHANNEL);
+    EDMA_CreateHandle(&sRearEdmaRxHandle, LPSPI_MASTER_DMA_BASE, LED_REAR_DMA_RX_CHANNEL);
+    EDMA_CreateHandle(&sRearEdmaTxHandle, LPSPI_MASTER_DMA_BASE, LED_REAR_DMA_TX_CHANNEL);
+
+#if defined(FSL_FEATURE_EDMA_HAS_CHANNEL_MUX) && FSL_FEATURE_EDMA_HAS_CHANNEL_MUX
+    EDMA_SetChannelMux(LPSPI_MASTER_DMA_BASE, LPSPI_MASTER_DMA_TX_CHANNEL,
+                       DEMO_LPSPI_TRANSMIT_EDMA_CHANNEL);
+    EDMA_SetChannelMux(LPSPI_MASTER_DMA_BASE, LPSPI_MASTER_DMA_RX_CHANNEL,
+                       DEMO_LPSPI_RECEIVE_EDMA_CHANNEL);
+#endif
+
+    /*Set clock source for LPSPI*/
+    	CLOCK_SetMux(kCLOCK_LpspiMux, LPSPI_CLOCK_SOURCE_SELECT);
+    	CLOCK_SetDiv(kCLOCK_LpspiDiv, LPSPI_CLOCK_SOURCE_DIVIDER);
+
+        /*Fastest SCK the panels take; the same for every geometry*/
+        if (LEDRefreshPlan_SelectSpiDivider(BOARD_LED_LPSPI1_CLOCK_FREQ, LED_SPI_MAX_BAUDRATE, &sSpiDivider) == 0)
+        {
+        	sSpiDivider.ulBaudRate = LED_SPI_MAX_BAUDRATE;
+        }
+
+        LPSPI_MasterGetDefaultConfig(&sLpspiConfig);
+        sLpspiConfig.baudRate = sSpiDivider.ulBaudRate;
+        sLpspiConfig.bitsPerFrame = 8;
+    	sLpspiConfig.whichPcs = LPSPI_MASTER_PCS_FOR_INIT;
+    	sLpspiConfig.pcsToSckDelayInNanoSec        = 0;
+    	sLpspiConfig.lastSckToPcsDelayInNanoSec    = 0;
+    	sLpspiConfig.betweenTransferDelayInNanoSec = 0;
+
+        LPSPI_MasterInit(BOARD_LED_LPSPI1_PERIPHERAL, &sLpspiConfig, BOARD_LED_LPSPI1_CLOCK_FREQ);
+        /*Rear face: same root clock and settings, so both faces shift in the same time*/
+        LPSPI_MasterInit(LED_REAR_LPSPI, &sLpspiConfig, BOARD_LED_LPSPI1_CLOCK_FREQ);
+
+        /*Set up lpspi master transfer handle*/
+        PrepareSpiTransfers();
+
+        /*Cycle counter used to time the scan cycles; never reset, other time bases share it*/
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+        /*One-shot timer for the latch, OE and blanking times*/
+        gpt_config_t sGptConfig;
+        GPT_GetDefaultConfig(&sGptConfig);
+        sGptConfig.clockSource = kGPT_ClockSource_Periph;
+        sGptConfig.enableMode = true;       // Counter restarts from 0 on every start
+        sGptConfig.enableFreeRun = false;
+        GPT_Init(LED_SCAN_GPT, &sGptConfig);
+        GPT_EnableInterrupts(LED_SCAN_GPT, kGPT_OutputCompare1InterruptEnable);
+        ulGptClockHz = CLOCK_GetFreq(kCLOCK_PerClk);
+        NVIC_SetPriority(LED_SCAN_GPT_IRQn, LED_SCAN_IRQ_PRIORITY);
+        EnableIRQ(LED_SCAN_GPT_IRQn);
+
+        /*Full brightness, no limits until the control centre sets them*/
+        LEDBrightness_Init(&sBrightness);
+        usBrightnessDuty = LEDBrightness_GetDuty(&sBrightness);
+}
+
+
+void LEDDriver_ConfigurePanel(uint16_t usDisplayRows,
+							  uint16_t usDisplayColumns,
+							  uint8_t  ubDoubleSidedDisplay,
+							  uint8_t  ubLedType,
+							  uint8_t  ubNumPanels,
+							  uint8_t  ubNumRowSelection)
+{
+	sLEDScanPattern_t sPattern;
+
+	LEDDriver_GetDefaultScanPattern(&sPattern, ubNumRowSelection);
+	(void)LEDDriver_ConfigurePanelPattern(usDisplayRows, usDisplayColumns, ubDoubleSidedDisplay,
+										  ubLedType, ubNumPanels, &sPattern);
+}
+
+/**
+ * @brief Fills a scan pattern with the layout of the modules this board ships with.
+ *
+ * The default is the split-half pattern of the 16-row modules: the last row group is
+ * shifted first, and group 0 is addressed bottom-up (address 0 lights its last row), so
+ * the picture comes out rotated by 180 degrees vertically. Panels form a single row.
+ *
+ * @param psPattern         Pattern to fill.
+ * @param ubNumRowSelection Number of row address lines.
+ */
+void LEDDriver_GetDefaultScanPattern(sLEDScanPattern_t *psPattern, uint8_t ubNumRowSelection)
+{
+	if (psPattern == NULL)
+	{
+		return;
+	}
+
+	memset(psPattern, 0, sizeof(*psPattern));
+	psPattern->ubAddressBits = ubNumRowSelection;
+	psPattern->eGroupOrder = LED_ROW_GROUPS_DESCENDING;
+	psPattern->ulGroupReverseMask = 0x1UL;
+}
+
+/**
+ * @brief Configures the panel geometry and compiles a scan pattern into the packing plan.
+ *
+ * usDisplayRows and usDisplayColumns are the size of one panel. The frame passed to
+ * LEDDriver_PrepareDisplayBuffer() is the grid of panels described by the pattern:
+ * (ubNumPanels / ubPanelsPerChainRow) panels high and ubPanelsPerChainRow panels wide.
+ *
+ * On failure the driver is left unconfigured and the scan stops.
+ *
+ * @return 1 on success, 0 if the pattern does not fit the geometry or the address lines
+ *         of the board, or if memory could not be allocated.
+ */
+uint8_t LEDDriver_ConfigurePanelPattern(uint16_t usDisplayRows,
+										uint16_t usDisplayColumns,
+										uint8_t  ubDoubleSidedDisplay,
+										uint8_t  ubLedType,
+										uint8_t  ubNumPanels,
+										const sLEDScanPattern_t *psPattern)
+{
+	//-------------------------------------------------//
+	//Release the previous configuration
+	LEDDriver_ReleasePanel();
+
+	//-------------------------------------------------//
+	//Extract all LED configuration parameters
+	usRowsPerPanel = usDisplayRows;
+	usColumnsPerPanel = usDisplayColumns;
+	ubIsDoubleSidedDisplay = ubDoubleSidedDisplay;
+	ubIsRGB = ubLedType;
+	ubNumberofPanels = ubNumPanels;
+
+	if (IsScanPatternValid(psPattern) == 0)
+	{
+		usRowsPerPanel = 0;
+		return 0;
+	}
+	ubNumberofRowAddressBits = psPattern->ubAddressBits;
+	ubFaces = (ubIsDoubleSidedDisplay != 0) ? 2U : 1U;
+
+	//-------------------------------------------------//
+	//Initialising derived parameters
+
+	//Number of unique scan addresses
+	ubScanRate = (1 << ubNumberofRowAddressBits);
+
+	// The number of physical rows selected simultaneously by one address
+	ubRowsPerScanAddress = (usRowsPerPanel/ubScanRate);
+
+	// The size of one physical row's data across all panels, in bytes.
+	// Eg : (128 columns / 8 bits/byte = 16 bytes)
+	usTotalColumnsPerRowBytes = ((ubNumberofPanels * usColumnsPerPanel)/8);
+
+	//Total number of data bits per scan cycle - Across all columns and panels for number of rows that can be selected at once
+	ulDataBitsPerScanCycle = (ubNumberofPanels * usColumnsPerPanel * ubRowsPerScanAddress);
+
+	// Size of the SPI payload buffer in bytes (e.g., 256 bits / 8 = 32 bytes)
+	ulSpiPayloadSizeBytes = (ulDataBitsPerScanCycle / 8);
+
+
+	memset(&sPackStats, 0, sizeof(sPackStats));
+
+	//-------------------------------------------------//
+	//Compile the pattern once so that packing a frame is a run of copies.
+	//The rear face is seen from the other side: its chain runs the other way.
+	if (AllocateFace(&asFaces[LED_FACE_FRONT], psPattern) == 0)
+	{
+		usRowsPerPanel = 0;
+		return 0;
+	}
+	if (ubFaces > 1U)
+	{
+		sLEDScanPattern_t sRearPattern = *psPattern;
+
+		sRearPattern.bMirroredChain = !psPattern->bMirroredChain;
+		if (AllocateFace(&asFaces[LED_FACE_REAR], &sRearPattern) == 0)
+		{
+			FreeFace(&asFaces[LED_FACE_FRONT]);
+			usRowsPerPanel = 0;
+			return 0;
+		}
+		// The chain drives one LPSPI, a double-sided unit scans timed
+		if (eScanMode == LED_SCAN_MODE_DMA_CHAIN)
+		{
+			PrepareSpiTransfers();
+			eScanMode = LED_SCAN_MODE_TIMED;
+		}
+	}
+
+	(void)LEDRowAddress_BuildTable(aulRowAddressLines, ubNumberofRowAddressBits, asRowAddressTable);
+
+	ubAllocatedPlanes = ubBitPlanes;
+	LEDScan_Init(&sScan, &sScanHal, &sBcm, asFaces[LED_FACE_FRONT].ptubPayloads, ulSpiPayloadSizeBytes);
+	if (ubFaces > 1U)
+	{
+		(void)LEDScan_SetChannelPayloads(&sScan, LED_FACE_REAR, asFaces[LED_FACE_REAR].ptubPayloads);
+	}
+	PlanRefresh();
+	(void)LEDBcm_Init(&sBcm, ubScanRate, ubBitPlanes, sRefreshPlan.ulUnitNs);
+	LEDScan_SetCycleStartCallback(&sScan, OnScanCycleStart);
+	return 1;
+}
+
+/**
+ * @brief Releases the configured geometry: stops the scan and frees the payloads,
+ *        packing plans and eDMA chain.
+ *
+ * The driver is left unconfigured until the next LEDDriver_ConfigurePanel().
+ */
+void LEDDriver_ReleasePanel(void)
+{
+	LEDDriver_StopScan();
+	FreeScanChain();
+	FreeFace(&asFaces[LED_FACE_FRONT]);
+	FreeFace(&asFaces[LED_FACE_REAR]);
+	bStreamingPlanes = false;
+	ubAllocatedPlanes = 0;
+	usRowsPerPanel = 0;
+}
+
+/**
+ * @brief Computes the memory LEDDriver_ConfigurePanel() would allocate for a geometry.
+ *
+ * Payloads, payload table and packing plan of every face with the default scan pattern,
+ * for the planes set with LEDDriver_SetBitPlanes(), plus the eDMA chain in chain scan
+ * mode. Memory manager block headers are not included.
+ *
+ * @return Bytes, or 0 if the geometry is invalid.
+ */
+uint32_t LEDDriver_ComputeFootprint(uint16_t usDisplayRows,
+									uint16_t usDisplayColumns,
+									uint8_t  ubDoubleSidedDisplay,
+									uint8_t  ubNumPanels,
+									uint8_t  ubNumRowSelection)
+{
+	sMMPlanEntry_t asEntries[LED_MAX_PLAN_ENTRIES];
+	uint8_t ubEntries = LEDDriver_GetAllocationPlan(usDisplayRows, usDisplayColumns, ubDoubleSidedDisplay,
+													ubNumPanels, ubNumRowSelection, ubBitPlanes, asEntries);
+	uint32_t ulBytes = 0;
+
+	for (uint8_t ubEntry = 0; ubEntry < ubEntries; ubEntry++)
+	{
+		ulBytes += asEntries[ubEntry].ulSize;
+	}
+	return ulBytes;
+}
+
+/**
+ * @brief Lists the blocks LEDDriver_ConfigurePanel() would allocate for a geometry, in
+ *        allocation order, followed by the eDMA chain built by LEDDriver_StartScan().
+ *
+ * Same assumptions as LEDDriver_ComputeFootprint(), for the given planes; to check against
+ * the memory manager with MM_CheckPlan() before anything is allocated.
+ *
+ * @param ubPlanes  Bit-planes the payloads are sized for (1..LED_BCM_MAX_PLANES).
+ * @param psEntries Returns the blocks; room for LED_MAX_PLAN_ENTRIES.
+ * @return Number of blocks, or 0 if the geometry or plane count is invalid.
+ */
+uint8_t LEDDriver_GetAllocationPlan(uint16_t usDisplayRows,
+									uint16_t usDisplayColumns,
+									uint8_t  ubDoubleSidedDisplay,
+									uint8_t  ubNumPanels,
+									uint8_t  ubNumRowSelection,
+									uint8_t  ubPlanes,
+									sMMPlanEntry_t *psEntries)
+{
+	if ((ubNumRowSelection == 0) || (ubNumRowSelection > LED_MAX_ADDRESS_BITS) || (ubNumPanels == 0) ||
+		((usDisplayRows % (1U << ubNumRowSelection)) != 0) || ((usDisplayColumns % 8U) != 0) ||
+		(ubPlanes == 0) || (ubPlanes > LED_BCM_MAX_PLANES) || (psEntries == NULL))
+	{
+		return 0;
+	}
+
+	uint32_t ulAddresses = 1UL << ubNumRowSelection;
+	uint32_t ulPayloadBytes = ((uint32_t)ubNumPanels * usDisplayColumns * (usDisplayRows / ulAddresses)) / 8U;
+	uint8_t ubFaces = (ubDoubleSidedDisplay != 0) ? 2U : 1U;
+	uint8_t ubEntries = 0;
+
+	for (uint8_t ubFace = 0; ubFace < ubFaces; ubFace++)
+	{
+		// Payload table, payloads, packing plan (one copy per row with the default pattern)
+		psEntries[ubEntries++] = (sMMPlanEntry_t){ MM_PURPOSE_LOOKUP_TABLE,
+												   ubPlanes * ulAddresses * sizeof(uint8_t *), 0U };
+		psEntries[ubEntries++] = (sMMPlanEntry_t){ MM_PURPOSE_DMA_SOURCE,
+												   ubPlanes * ulAddresses * ulPayloadBytes, 0U };
+		psEntries[ubEntries++] = (sMMPlanEntry_t){ MM_PURPOSE_LOOKUP_TABLE,
+												   (uint32_t)usDisplayRows * ubNumPanels * sizeof(sLEDGatherEntry_t), 0U };
+	}
+
+	if ((eScanMode == LED_SCAN_MODE_DMA_CHAIN) && (ubDoubleSidedDisplay == 0))
+	{
+		psEntries[ubEntries++] = (sMMPlanEntry_t){ MM_PURPOSE_DMA_SOURCE,
+												   LEDChain_GetTcdCount((uint8_t)ulAddresses) * sizeof(sLEDChainTcd_t), 0U };
+		psEntries[ubEntries++] = (sMMPlanEntry_t){ MM_PURPOSE_DMA_SOURCE,
+												   (LEDChain_GetGpioWordCount((uint8_t)ulAddresses) + 1U) * sizeof(uint32_t), 0U };
+	}
+	return ubEntries;
+}
+
+/**
+ * @brief Plans the refresh of a geometry without configuring it.
+ *
+ * Same plan as LEDDriver_ConfigurePanel() would make after LEDDriver_SetBitPlanes() with
+ * the given planes and OE unit: board timing, planes, unit and refresh rate.
+ *
+ * @param ubPlanes    Bit-planes shown (1..LED_BCM_MAX_PLANES).
+ * @param ulUnitNs    Shortest OE time of plane 0 in ns.
+ * @param ulRefreshHz Target scan cycles per second (0 - as fast as possible).
+ * @param psPlan      Returns the plan; ulShortfallMilliHz tells by how much it is missed.
+ * @return 1 if the target is reached, 0 if not or the geometry is invalid.
+ */
+uint8_t LEDDriver_CheckRefreshBudget(uint16_t usDisplayRows,
+									 uint16_t usDisplayColumns,
+									 uint8_t  ubNumPanels,
+									 uint8_t  ubNumRowSelection,
+									 uint8_t  ubPlanes,
+									 uint32_t ulUnitNs,
+									 uint32_t ulRefreshHz,
+									 sLEDRefreshPlan_t *psPlan)
+{
+	sLEDRefreshBudget_t sBudget;
+
+	if ((psPlan == NULL) || (ubNumRowSelection == 0) || (ubNumRowSelection > LED_MAX_ADDRESS_BITS) ||
+		(usDisplayRows < (1U << ubNumRowSelection)) || (ubPlanes == 0) || (ubPlanes > LED_BCM_MAX_PLANES) || (ulUnitNs == 0))
+	{
+		return 0;
+	}
+
+	FillRefreshBudget(&sBudget, ubNumPanels, usDisplayColumns,
+					  (uint8_t)(usDisplayRows >> ubNumRowSelection), (uint8_t)(1U << ubNumRowSelection), ubPlanes,
+					  ulRefreshHz);
+	sBudget.ulMinUnitNs = ulUnitNs;
+	return LEDRefreshPlan_Compute(&sBudget, psPlan);
+}
+
+/**
+ * @brief Replaces the packing plan of the rear face of a double-sided unit.
+ *
+ * LEDDriver_ConfigurePanelPattern() gives the rear face the front pattern with the chain
+ * mirrored (bMirroredChain inverted); this is for a rear face wired differently. The
+ * geometry and address lines stay those of the front face. A running scan is stopped.
+ *
+ * @return 1 on success, 0 if the unit is not double-sided, the pattern does not fit or
+ *         memory could not be allocated (the rear face is then left dark).
+ */
+uint8_t LEDDriver_SetRearScanPattern(const sLEDScanPattern_t *psPattern)
+{
+	sLEDFace_t *psRear = &asFaces[LED_FACE_REAR];
+
+	if ((ubFaces < 2U) || (psRear->ptubPayloads == NULL) || (IsScanPatternValid(psPattern) == 0) ||
+		(psPattern->ubAddressBits != ubNumberofRowAddressBits))
+	{
+		return 0;
+	}
+
+	LEDDriver_StopScan();
+	MM_Free(psRear->psGatherTable);
+	psRear->psGatherTable = NULL;
+	psRear->usGatherEntries = 0;
+	if (CompileGatherTable(psRear, psPattern) == 0)
+	{
+		memset(psRear->pubPayloadBlock, 0, (size_t)ubAllocatedPlanes * ubScanRate * ulSpiPayloadSizeBytes);
+		return 0;
+	}
+	return 1;
+}
+
+/**
+ * @brief Registers the function that supplies frames to the scan.
+ *
+ * The source is called between two scan cycles, when no payload is being transferred,
+ * so a new frame is always packed and shown as a whole.
+ *
+ * @param pfnSource Frame source (e.g. FBM_AcquireScanBuffer), or NULL to disable.
+ */
+void LEDDriver_SetFrameSource(pfnLEDFrameSource_t pfnSource)
+{
+	pfnFrameSource = pfnSource;
+}
+
+/**
+ * @brief Registers the function that supplies grayscale frames as bit-planes.
+ *
+ * While set it is polled instead of the frame source and new frames are packed with
+ * LEDDriver_PrepareBitPlanes(). Bit-plane frames are shown on the front face only.
+ *
+ * @param pfnSource Bit-plane source, or NULL to go back to the frame source.
+ */
+void LEDDriver_SetBitPlaneSource(pfnLEDBitPlaneSource_t pfnSource)
+{
+	pfnBitPlaneSource = pfnSource;
+}
+
+/**
+ * @brief Registers the function that supplies the rear frames of a double-sided unit.
+ *
+ * Called right after the frame source returned a new frame; not used for a single-sided
+ * unit.
+ *
+ * @param pfnSource Rear frame source (e.g. FBM_GetActiveRearBuffer), or NULL to disable.
+ */
+void LEDDriver_SetRearFrameSource(pfnLEDRearFrameSource_t pfnSource)
+{
+	pfnRearFrameSource = pfnSource;
+}
+
+/**
+ * @brief Registers the function told of the start of every scan cycle.
+ *
+ * Lets a renderer time its publishes to the scan (vsync). Called in interrupt context,
+ * in the timed and the eDMA chain scan.
+ *
+ * @param pfnCallback Callback, or NULL to disable.
+ */
+void LEDDriver_SetCycleStartCallback(pfnLEDCycleStartCallback_t pfnCallback)
+{
+	pfnCycleStartCallback = pfnCallback;
+}
+
+/**
+ * @brief Prepares the payloads of the front face for all scan addresses.
+ *
+ * Reads data from the active frame buffer (`ptubActiveBufferNow`) and copies each row
+ * to the place the gather table compiled from the scan pattern (including rotation)
+ * gives it, concatenating the rows of every scan address into one contiguous block for
+ * SPI transfer.
+ * Only the source rows flagged in `pulDirtyRows` are copied; the rest of the payloads
+ * still hold them from the previous frame.
+ *
+ * Note : Needs to be called every time the data in Active buffer changes
+ *
+ * @param ptubActiveBufferNow Frame to pack.
+ * @param pulDirtyRows        Bitmap of changed source rows (row r is bit (r & 31) of
+ *                            word (r >> 5)), or NULL to pack every row.
+ */
+void LEDDriver_PrepareDisplayBuffer(uint8_t **ptubActiveBufferNow, const uint32_t *pulDirtyRows)
+{
+    if (bStreamingPlanes && (ptubActiveBufferNow != NULL))
+    {
+        // The own payloads were not kept up to date while planes were streamed
+        RestoreFrontPayloads();
+        pulDirtyRows = NULL;
+    }
+    PrepareFace(&asFaces[LED_FACE_FRONT], ptubActiveBufferNow, pulDirtyRows);
+}
+
+/**
+ * @brief Prepares the payloads of the rear face of a double-sided unit.
+ *
+ * Same as LEDDriver_PrepareDisplayBuffer(), through the rear packing plan. Does nothing
+ * for a single-sided unit.
+ *
+ * @param ptubRearBuffer Rear frame to pack.
+ * @param pulDirtyRows   Bitmap of changed source rows, or NULL to pack every row.
+ */
+void LEDDriver_PrepareRearDisplayBuffer(uint8_t **ptubRearBuffer, const uint32_t *pulDirtyRows)
+{
+    if (ubFaces > 1U)
+    {
+        PrepareFace(&asFaces[LED_FACE_REAR], ptubRearBuffer, pulDirtyRows);
+    }
+}
+
+/**
+ * @brief Gets the rows packed and skipped by the last and all previous prepares.
+ *
+ * @param psStats Pointer to store the statistics.
+ */
+void LEDDriver_GetPackStatistics(sLEDPackStats_t *psStats)
+{
+	if (psStats != NULL)
+	{
+		*psStats = sPackStats;
+	}
+}
+
+/**
+ * @brief Gets the payloads the scan shifts for a face, as packed by the last prepare.
+ *
+ * Lets the host tests feed the driver's own payloads to the panel emulator. Entry
+ * (plane * scan rate + address) is the payload of that plane and scan address; the
+ * table is valid until the geometry is configured again.
+ *
+ * @param ubFace          0 - front, 1 - rear (the LEDScan channel).
+ * @param pulPayloadBytes Returns the bytes of one payload.
+ * @return The payload table, or NULL if the face is not configured.
+ */
+uint8_t *const *LEDDriver_GetScanPayloads(uint8_t ubFace, uint32_t *pulPayloadBytes)
+{
+	if ((ubFace >= ubFaces) || (asFaces[ubFace].ptubPayloads == NULL))
+	{
+		return NULL;
+	}
+	if (pulPayloadBytes != NULL)
+	{
+		*pulPayloadBytes = ulSpiPayloadSizeBytes;
+	}
+	return asFaces[ubFace].ptubPayloads;
+}
+
+/**
+ * @brief Shows a grayscale frame given as bit-planes (front face).
+ *
+ * Plane p is shown for (1 << p) BCM units, so plane 0 is the least significant bit (the
+ * layout of FBM_BitPlaneFromGray8()). Only the first ubPlanes planes are taken; the count
+ * shown is set with LEDDriver_SetBitPlanes(). A frame with more planes than the payloads
+ * were allocated for is not shown and counted in ulRejectedFrames.
+ *
+ * Planes in the order of LEDDriver_GetStreamRowOrder() are already the SPI payloads: the
+ * timed scan then shifts them in place, so they must stay untouched until the next frame
+ * replaces them (as the FBM slots of a published frame do). Other planes, and any planes
+ * in the eDMA chain scan, are packed through the gather table.
+ *
+ * @param psPlanes     Frame to show.
+ * @param pulDirtyRows Bitmap of changed source rows, or NULL to pack every row.
+ */
+void LEDDriver_PrepareBitPlanes(const sLEDBitPlaneSet_t *psPlanes, const uint32_t *pulDirtyRows)
+{
+    sLEDFace_t *psFront = &asFaces[LED_FACE_FRONT];
+
+    if ((psPlanes == NULL) || (psFront->psGatherTable == NULL))
+    {
+        return;
+    }
+    if (psPlanes->ubPlanes > ubAllocatedPlanes)
+    {
+        // Planes the payloads have no room for: FBM and driver were set up apart
+        sPackStats.ulRejectedFrames++;
+        return;
+    }
+
+    sPackStats.usRowsPacked = 0;
+    sPackStats.usRowsSkipped = 0;
+    sPackStats.ulBytesPacked = 0;
+
+    if (psPlanes->bStreamOrder && (psPlanes->usStride == usTotalColumnsPerRowBytes) &&
+        (eScanMode == LED_SCAN_MODE_TIMED) && (IsFrontStreamable() != 0))
+    {
+        // Scan address n of a plane is its rows n * ubRowsPerScanAddress onwards
+        uint32_t ulAddressBytes = (uint32_t)ubRowsPerScanAddress * psPlanes->usStride;
+        for (uint8_t ubPlane = 0; ubPlane < psPlanes->ubPlanes; ubPlane++)
+        {
+            for (uint16_t n = 0; n < ubScanRate; n++)
+            {
+                psFront->ptubPayloads[(ubPlane * ubScanRate) + n] =
+                    (uint8_t *)(uintptr_t)(psPlanes->apubPlanes[ubPlane] + (n * ulAddressBytes));
+            }
+        }
+        bStreamingPlanes = true;
+        sPackStats.ulStreamedFrames++;
+    }
+    else
+    {
+        if (bStreamingPlanes)
+        {
+            RestoreFrontPayloads();
+            pulDirtyRows = NULL;
+        }
+        for (uint8_t ubPlane = 0; ubPlane < psPlanes->ubPlanes; ubPlane++)
+        {
+            PackPlane(psFront, ubPlane, NULL, psPlanes->apubPlanes[ubPlane], psPlanes->usStride, pulDirtyRows);
+        }
+    }
+    // Planes not given now keep older data: look at every allocated plane
+    psFront->ulBlankAddresses = LEDBlankRows_Find(psFront->ptubPayloads, ubScanRate, ubAllocatedPlanes,
+                                                  ulSpiPayloadSizeBytes);
+
+    sPackStats.ulTotalRowsPacked += sPackStats.usRowsPacked;
+    sPackStats.ulTotalRowsSkipped += sPackStats.usRowsSkipped;
+}
+
+/**
+ * @brief Gets the row order in which bit-planes are the SPI payloads of the front face.
+ *
+ * Row position k (k = scan address * rows per address + slot) gets the frame row the
+ * configured pattern shifts there. Planes laid out in this order (FBM_SetScanRowOrder())
+ * with rows of exactly the chain width are shifted without packing. Patterns that split
+ * or mirror rows (zigzag, rotated panels, several chain rows) have no such order.
+ *
+ * @param pusRowOrder Returns the order; room for usRows entries.
+ * @param usRows      Rows of the frame.
+ * @return 1 on success, 0 if not configured, the frame is not one chain row high or the
+ *         pattern needs packing.
+ */
+uint8_t LEDDriver_GetStreamRowOrder(uint16_t *pusRowOrder, uint16_t usRows)
+{
+    const sLEDFace_t *psFront = &asFaces[LED_FACE_FRONT];
+
+    if ((pusRowOrder == NULL) || (usRows != psFront->usGatherEntries) || (IsFrontStreamable() == 0))
+    {
+        return 0;
+    }
+
+    for (uint16_t usPosition = 0; usPosition < usRows; usPosition++)
+    {
+        pusRowOrder[usPosition] = psFront->psGatherTable[usPosition].usSourceRow;
+    }
+    return 1;
+}
+
+/**
+ * @brief Sets the number of bit-planes shown and the shortest OE time of the least
+ *        significant one.
+ *
+ * Before LEDDriver_ConfigurePanel() this also sets the planes the payload buffers are
+ * sized for. Afterwards the count can be changed up to that size and takes effect at
+ * the start of the next scan cycle: fewer planes trade gray depth for refresh rate.
+ * With a fixed refresh rate the OE time is lengthened to fill the refresh period.
+ *
+ * @param ubPlanes Bit-planes per scan address (1..LED_BCM_MAX_PLANES).
+ * @param ulUnitNs Shortest OE time of plane 0 in ns.
+ * @return 1 on success, 0 if the values are invalid, exceed the allocated planes or the
+ *         scan runs as an eDMA chain and more than one plane is requested.
+ */
+uint8_t LEDDriver_SetBitPlanes(uint8_t ubPlanes, uint32_t ulUnitNs)
+{
+	if ((ubPlanes == 0) || (ubPlanes > LED_BCM_MAX_PLANES) || (ulUnitNs == 0))
+	{
+		return 0;
+	}
+	if ((asFaces[LED_FACE_FRONT].ptubPayloads != NULL) && (ubPlanes > ubAllocatedPlanes))
+	{
+		return 0;
+	}
+	if ((eScanMode == LED_SCAN_MODE_DMA_CHAIN) && (ubPlanes != 1))
+	{
+		return 0;
+	}
+
+	ubBitPlanes = ubPlanes;
+	ulBcmUnitNs = ulUnitNs;
+	PlanRefresh();
+	return 1;
+}
+
+/**
+ * @brief Gets the gray depth and the measured and expected refresh rates of the scan.
+ *
+ * @param psStats Pointer to store the statistics.
+ */
+void LEDDriver_GetRefreshStatistics(sLEDRefreshStats_t *psStats)
+{
+	if (psStats == NULL)
+	{
+		return;
+	}
+
+	// Every step shifts one payload (per face, at the same time), latches it and blanks
+	// before the next address
+	uint32_t ulShiftNs = sRefreshPlan.ulShiftNs;
+	uint32_t ulStepOverheadNs = ulShiftNs + ((LED_LATCH_TIME_US + LED_BLANKING_TIME_US) * 1000U);
+
+	memset(psStats, 0, sizeof(*psStats));
+	psStats->ubPlanes = ubBitPlanes;
+	psStats->ubAllocatedPlanes = ubAllocatedPlanes;
+	psStats->ulUnitNs = sRefreshPlan.ulUnitNs;
+	psStats->ulSpiBaudRate = sSpiDivider.ulBaudRate;
+	if (ulRefreshRateHz != 0)
+	{
+		psStats->ulTargetRefreshMilliHz = ulRefreshRateHz * 1000U;
+	}
+	psStats->ubBrightness = LEDBrightness_GetLevel(&sBrightness);
+	psStats->usDuty = usBrightnessDuty;
+	if ((asFaces[LED_FACE_FRONT].ptubPayloads != NULL) && (eScanMode == LED_SCAN_MODE_DMA_CHAIN))
+	{
+		// Every row is lit while the next payload shifts, the tail shift included
+		uint64_t udCycleNs = ((uint64_t)ubScanRate + 1U) * ulShiftNs;
+		if (udCycleNs != 0)
+		{
+			psStats->ulEstimatedRefreshMilliHz = (uint32_t)(1000000000000ULL / udCycleNs);
+		}
+		psStats->ulScanCycles = sChainStats.ulCycles;
+		psStats->ulOverruns = sChainStats.ulOverruns;
+		if (sChainStats.ulLastCycleNs != 0)
+		{
+			psStats->ulRefreshMilliHz = (uint32_t)(1000000000000ULL / sChainStats.ulLastCycleNs);
+		}
+	}
+	else if (asFaces[LED_FACE_FRONT].ptubPayloads != NULL)
+	{
+		sLEDBcm_t sPlanned = sBcm;
+		(void)LEDBcm_SetPlanes(&sPlanned, ubBitPlanes, sRefreshPlan.ulUnitNs);
+		psStats->ulEstimatedRefreshMilliHz = LEDBcm_EstimateRefreshMilliHz(&sPlanned, ulStepOverheadNs);
+		psStats->ulShortfallMilliHz = sRefreshPlan.ulShortfallMilliHz;
+		psStats->ubBlankAddresses = (uint8_t)(ubScanRate - LEDBlankRows_CountShown(sBcm.ulSkipMask, ubScanRate));
+
+		sLEDScanStats_t sScanStats;
+		LEDScan_GetStatistics(&sScan, &sScanStats);
+		psStats->ulScanCycles = sScanStats.ulCycles;
+		psStats->ulOverruns = sScanStats.ulOverruns;
+		if (sScanStats.ulLastCycleNs != 0)
+		{
+			psStats->ulRefreshMilliHz = (uint32_t)(1000000000000ULL / sScanStats.ulLastCycleNs);
+		}
+	}
+}
+
+/**
+ * @brief Sets the fixed scan cycle rate.
+ *
+ * Every scan cycle then starts 1/ulRefreshHz after the previous one, whatever the load of
+ * the main loop, and the OE time of the planes is planned to fill the period. A rate the
+ * geometry and plane count cannot reach is reported as ulShortfallMilliHz, counted in
+ * ulOverruns, and the scan runs as fast as it can.
+ *
+ * @param ulRefreshHz Scan cycles per second, 0 to scan as fast as possible.
+ */
+void LEDDriver_SetRefreshRate(uint32_t ulRefreshHz)
+{
+	ulRefreshRateHz = ulRefreshHz;
+	PlanRefresh();
+}
+
+/**
+ * @brief Enables leaving blank scan addresses out of the timed scan.
+ *
+ * An address whose payloads are zero on every face is not shifted nor given an OE slot.
+ * The refresh period and the OE duty shrink with the share of addresses shown, so sparse
+ * content refreshes faster at the same brightness. Takes effect at the next scan cycle.
+ *
+ * @param bEnable true to skip blank addresses (default), false to scan every address.
+ */
+void LEDDriver_SetBlankRowSkipping(bool bEnable)
+{
+	bSkipBlankRows = bEnable;
+}
+
+/**
+ * @brief Sets the brightness level (0-255).
+ *
+ * The level is clamped to the limits of LEDDriver_SetBrightnessLimits() and mapped through
+ * the gamma LUT to an OE duty, which the scan applies at the start of the next cycle. The
+ * OE slots keep their length, so the refresh rate does not change. The eDMA chain scan
+ * always shows full duty.
+ *
+ * @param ubLevel Requested level (0 - dark, 255 - full).
+ */
+void LEDDriver_SetBrightness(uint8_t ubLevel)
+{
+	LEDBrightness_SetTarget(&sBrightness, ubLevel);
+	usBrightnessDuty = LEDBrightness_GetDuty(&sBrightness);
+}
+
+/**
+ * @brief Sets the range of brightness levels shown, e.g. from the INIT request.
+ *
+ * @return 1 on success, 0 if ubLow > ubHigh (limits unchanged).
+ */
+uint8_t LEDDriver_SetBrightnessLimits(uint8_t ubLow, uint8_t ubHigh)
+{
+	if (LEDBrightness_SetLimits(&sBrightness, ubLow, ubHigh) == 0)
+	{
+		return 0;
+	}
+	usBrightnessDuty = LEDBrightness_GetDuty(&sBrightness);
+	return 1;
+}
+
+/**
+ * @brief Sets the gamma of the brightness LUT.
+ *
+ * @param usGammaX100 Gamma * 100 (LED_BRIGHTNESS_MIN_GAMMA_X100..LED_BRIGHTNESS_MAX_GAMMA_X100).
+ * @return 1 on success, 0 if the gamma is out of range.
+ */
+uint8_t LEDDriver_SetGamma(uint16_t usGammaX100)
+{
+	if (LEDBrightness_SetGamma(&sBrightness, usGammaX100) == 0)
+	{
+		return 0;
+	}
+	usBrightnessDuty = LEDBrightness_GetDuty(&sBrightness);
+	return 1;
+}
+
+/**
+ * @brief Selects how the scan is run; a running scan is stopped.
+ *
+ * LED_SCAN_MODE_DMA_CHAIN runs a whole scan cycle as one eDMA scatter-gather chain with
+ * a single interrupt per cycle, instead of two interrupts per step. Every row is then lit
+ * for the time the next payload takes to shift, so only one bit-plane is shown and LE, OE
+ * and the address lines must be on one GPIO port (LED_CHAIN_SINGLE_PORT). The chain
+ * drives one LPSPI, so a double-sided unit always scans timed.
+ *
+ * @param eMode Scan mode.
+ * @return 1 on success, 0 if the mode is not possible (scan mode unchanged).
+ */
+uint8_t LEDDriver_SetScanMode(eLEDScanMode_t eMode)
+{
+	if ((eMode != LED_SCAN_MODE_TIMED) && (eMode != LED_SCAN_MODE_DMA_CHAIN))
+	{
+		return 0;
+	}
+#if (LED_CHAIN_SINGLE_PORT == 0U)
+	if (eMode == LED_SCAN_MODE_DMA_CHAIN)
+	{
+		return 0;
+	}
+#endif
+	if ((eMode == LED_SCAN_MODE_DMA_CHAIN) && ((ubBitPlanes != 1) || (ubFaces > 1U)))
+	{
+		return 0;
+	}
+
+	LEDDriver_StopScan();
+	if ((eScanMode == LED_SCAN_MODE_DMA_CHAIN) && (eMode == LED_SCAN_MODE_TIMED))
+	{
+		// The chain took over the TX channel callback and the LPSPI FIFO setup
+		PrepareSpiTransfers();
+	}
+	eScanMode = eMode;
+	return 1;
+}
+
+/**
+ * @brief Starts the interrupt-driven scan of the configured panel.
+ *
+ * From then on the eDMA and timer interrupts run the scan; the main loop is not involved.
+ * Does nothing if the scan runs or the panel is not configured.
+ */
+void LEDDriver_StartScan(void)
+{
+	if ((asFaces[LED_FACE_FRONT].ptubPayloads == NULL) || LEDScan_IsRunning(&sScan) || bChainRunning)
+	{
+		return;
+	}
+
+	if (eScanMode == LED_SCAN_MODE_TIMED)
+	{
+		LEDScan_Start(&sScan);
+		return;
+	}
+
+	if ((psChainTcds == NULL) && (BuildScanChain() == 0))
+	{
+		return;
+	}
+
+	// Only the TX channel runs: TX request on an empty FIFO paces the chain, RX is discarded
+	LPSPI_SetFifoWatermarks(BOARD_LED_LPSPI1_PERIPHERAL, 0U, 0U);
+	BOARD_LED_LPSPI1_PERIPHERAL->TCR |= LPSPI_TCR_RXMSK_MASK;
+	pulChainWords[LEDChain_GetGpioWordCount(ubScanRate)] = BOARD_LED_LPSPI1_PERIPHERAL->TCR;
+	EDMA_SetCallback(&sLpspiEdmaMasterTxRegToTxDataHandle, ScanChainCallback, NULL);
+	LPSPI_EnableDMA(BOARD_LED_LPSPI1_PERIPHERAL, kLPSPI_TxDmaEnable);
+
+	memset(&sChainStats, 0, sizeof(sChainStats));
+	bChainRunning = true;
+	StartChainCycle();
+}
+
+/**
+ * @brief Stops the scan immediately and turns the LEDs off.
+ */
+void LEDDriver_StopScan(void)
+{
+	uint32_t ulPrimask = DisableGlobalIRQ();
+
+	GPT_StopTimer(LED_SCAN_GPT);
+	GPT_ClearStatusFlags(LED_SCAN_GPT, kGPT_OutputCompare1Flag);
+	if (bChainRunning)
+	{
+		EDMA_AbortTransfer(&sLpspiEdmaMasterTxRegToTxDataHandle);
+		bChainRunning = false;
+		ScanSetOutputEnable(false);
+		ScanSetLatch(false);
+	}
+	if (sScan.eState == LED_SCAN_SHIFTING)
+	{
+		LPSPI_MasterTransferAbortEDMA(BOARD_LED_LPSPI1_PERIPHERAL, &sEdmaHandle);
+		if (ubFaces > 1U)
+		{
+			LPSPI_MasterTransferAbortEDMA(LED_REAR_LPSPI, &sRearEdmaHandle);
+		}
+	}
+	if (sScan.psHal != NULL)
+	{
+		LEDScan_Stop(&sScan);
+	}
+
+	EnableGlobalIRQ(ulPrimask);
+}
+
+/**
+ * @brief Kept for existing callers: starts the scan if it is not running.
+ *
+ * The scan is interrupt driven (see LEDDriver_StartScan()); calling this from the main
+ * loop costs a state check.
+ */
+void LEDDriver_DisplayOnLED()
+{
+	LEDDriver_StartScan();
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Packs one frame into the payloads of a face and updates the pack statistics.
+ */
+static void PrepareFace(sLEDFace_t *psFace, uint8_t **ptubFrame, const uint32_t *pulDirtyRows)
+{
+    if ((ptubFrame == NULL) || (psFace->ptubPayloads == NULL) || (psFace->psGatherTable == NULL))
+    {
+        return;
+    }
+
+    sPackStats.usRowsPacked = 0;
+    sPackStats.usRowsSkipped = 0;
+    sPackStats.ulBytesPacked = 0;
+
+    PackPlane(psFace, 0, ptubFrame, NULL, 0, pulDirtyRows);
+
+    // A one-bit frame is at full brightness: every plane shows it
+    if (sPackStats.usRowsPacked != 0)
+    {
+        for (uint8_t ubPlane = 1; ubPlane < ubAllocatedPlanes; ubPlane++)
+        {
+            memcpy(psFace->ptubPayloads[ubPlane * ubScanRate], psFace->ptubPayloads[0],
+                   (size_t)ubScanRate * ulSpiPayloadSizeBytes);
+        }
+        psFace->ulBlankAddresses = LEDBlankRows_Find(psFace->ptubPayloads, ubScanRate, 1U, ulSpiPayloadSizeBytes);
+    }
+
+    sPackStats.ulTotalRowsPacked += sPackStats.usRowsPacked;
+    sPackStats.ulTotalRowsSkipped += sPackStats.usRowsSkipped;
+}
+
+/**
+ * @brief Copies the rows of one plane to the face's payload block through its gather table.
+ *
+ * Rows come from ptubRows when given, otherwise from pubPlane with usStride bytes per
+ * row. Only rows flagged in pulDirtyRows (all when NULL) are copied; the statistics of
+ * the current prepare are updated.
+ */
+static void PackPlane(const sLEDFace_t *psFace, uint8_t ubPlane, uint8_t *const *ptubRows, const uint8_t *pubPlane,
+                      uint16_t usStride, const uint32_t *pulDirtyRows)
+{
+    uint8_t *pubDataBlock = psFace->ptubPayloads[ubPlane * ubScanRate];
+    const sLEDGatherEntry_t *psEntry = psFace->psGatherTable;
+    const sLEDGatherEntry_t *psEnd = psFace->psGatherTable + psFace->usGatherEntries;
+
+    for (; psEntry < psEnd; psEntry++)
+    {
+        uint16_t usRow = psEntry->usSourceRow;
+        if ((pulDirtyRows == NULL) || (pulDirtyRows[usRow >> 5] & (1UL << (usRow & 31))))
+        {
+            const uint8_t *pubRow = (ptubRows != NULL) ? ptubRows[usRow] : (pubPlane + ((uint32_t)usRow * usStride));
+            const uint8_t *pubSource = pubRow + psEntry->usSourceOffset;
+            uint8_t *pubDest = pubDataBlock + psEntry->ulDestOffset;
+            if (psEntry->ubReversed)
+            {
+                // Rotated panel: last column first, bits of each byte mirrored
+                for (uint16_t usByte = 0; usByte < psEntry->usBytes; usByte++)
+                {
+                    pubDest[usByte] = ReverseBits(pubSource[psEntry->usBytes - 1U - usByte]);
+                }
+            }
+            else
+            {
+                memcpy(pubDest, pubSource, psEntry->usBytes);
+            }
+            sPackStats.usRowsPacked++;
+            sPackStats.ulBytesPacked += psEntry->usBytes;
+        }
+        else
+        {
+            sPackStats.usRowsSkipped++;
+        }
+    }
+}
+
+/**
+ * @brief Start of a scan cycle (interrupt context): picks up the latest complete frame and
+ *        applies a new plane count, brightness or set of blank addresses.
+ *
+ * Blank addresses (on every face) are left out of the cycle. The cycle then takes the
+ * share of the addresses shown, so the refresh period and the OE duty are scaled by it:
+ * the refresh rate rises and the lit rows keep their brightness.
+ *
+ * @param psStep First step of the cycle; replaced if the sequence changes.
+ */
+static void OnScanCycleStart(sLEDBcmStep_t *psStep)
+{
+	PollFrameSource();
+
+	uint32_t ulUnitNs = sRefreshPlan.ulUnitNs;
+	uint32_t ulSkipMask = 0;
+
+	if (bSkipBlankRows)
+	{
+		ulSkipMask = asFaces[LED_FACE_FRONT].ulBlankAddresses;
+		if (ubFaces > 1U)
+		{
+			ulSkipMask &= asFaces[LED_FACE_REAR].ulBlankAddresses;
+		}
+	}
+
+	uint8_t ubShown = LEDBlankRows_CountShown(ulSkipMask, ubScanRate);
+	uint16_t usDuty = (uint16_t)LEDBlankRows_ScaleToShown(usBrightnessDuty, ubShown, ubScanRate);
+
+	if ((sBcm.ubPlanes != ubBitPlanes) || (sBcm.ulUnitNs != ulUnitNs) || (sBcm.usDuty != usDuty) ||
+		(sBcm.ulSkipMask != ulSkipMask))
+	{
+		(void)LEDBcm_SetPlanes(&sBcm, ubBitPlanes, ulUnitNs);
+		LEDBcm_SetSkipMask(&sBcm, ulSkipMask);
+		LEDBcm_SetDuty(&sBcm, usDuty);
+		LEDBcm_NextStep(&sBcm, psStep);
+	}
+
+	LEDScan_SetTiming(&sScan, LED_LATCH_TIME_US * 1000U, LED_BLANKING_TIME_US * 1000U,
+					  (ulRefreshRateHz != 0) ?
+					  LEDBlankRows_ScaleToShown(1000000000UL / ulRefreshRateHz, ubShown, ubScanRate) : 0);
+}
+
+/**
+ * @brief Picks up the latest complete frame, if a frame or bit-plane source is registered.
+ *
+ * The cycle start callback runs first. A bit-plane source takes precedence. The rear frame is packed whole: the dirty rows
+ * are those of the front frame.
+ */
+static void PollFrameSource(void)
+{
+	pfnLEDCycleStartCallback_t pfnCallback = pfnCycleStartCallback;
+
+	if (pfnCallback != NULL)
+	{
+		pfnCallback();
+	}
+
+	if (pfnBitPlaneSource != NULL)
+	{
+		sLEDBitPlaneSet_t sPlanes;
+		const uint32_t *pulDirtyRows = NULL;
+		memset(&sPlanes, 0, sizeof(sPlanes));
+		if (pfnBitPlaneSource(&sPlanes, &pulDirtyRows))
+		{
+			LEDDriver_PrepareBitPlanes(&sPlanes, pulDirtyRows);
+		}
+	}
+	else if (pfnFrameSource != NULL)
+	{
+		bool bIsNewFrame = false;
+		const uint32_t *pulDirtyRows = NULL;
+		uint8_t **ptubFrame = pfnFrameSource(&bIsNewFrame, &pulDirtyRows);
+		if (bIsNewFrame)
+		{
+			LEDDriver_PrepareDisplayBuffer(ptubFrame, pulDirtyRows);
+			if ((ubFaces > 1U) && (pfnRearFrameSource != NULL))
+			{
+				LEDDriver_PrepareRearDisplayBuffer(pfnRearFrameSource(), NULL);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Plans the OE unit of the configured geometry for the plane count and the refresh
+ *        rate, and sets the scan timing.
+ *
+ * Unconfigured, or when the budget is invalid, the unit is the shortest one requested.
+ */
+static void PlanRefresh(void)
+{
+	sLEDRefreshBudget_t sBudget;
+
+	FillRefreshBudget(&sBudget, ubNumberofPanels, usColumnsPerPanel, ubRowsPerScanAddress, ubScanRate,
+					  ubBitPlanes, ulRefreshRateHz);
+	(void)LEDRefreshPlan_Compute(&sBudget, &sRefreshPlan);
+	if (sRefreshPlan.ulUnitNs == 0)
+	{
+		sRefreshPlan.ulUnitNs = ulBcmUnitNs;
+	}
+
+	LEDScan_SetTiming(&sScan, sBudget.ulLatchNs, sBudget.ulBlankingNs,
+					  (ulRefreshRateHz != 0) ? (1000000000UL / ulRefreshRateHz) : 0);
+}
+
+/**
+ * @brief Fills the refresh budget of a geometry and plane count with the board timing and
+ *        the OE unit set with LEDDriver_SetBitPlanes().
+ */
+static void FillRefreshBudget(sLEDRefreshBudget_t *psBudget, uint8_t ubPanels, uint16_t usPanelColumns,
+							  uint8_t ubRowsPerAddress, uint8_t ubAddressScanRate, uint8_t ubPlanes,
+							  uint32_t ulTargetRefreshHz)
+{
+	psBudget->ubPanels = ubPanels;
+	psBudget->usPanelColumns = usPanelColumns;
+	psBudget->ubRowsPerAddress = ubRowsPerAddress;
+	psBudget->ubScanRate = ubAddressScanRate;
+	psBudget->ubPlanes = ubPlanes;
+	psBudget->ulSpiClockHz = BOARD_LED_LPSPI1_CLOCK_FREQ;
+	psBudget->ulMaxBaudRate = LED_SPI_MAX_BAUDRATE;
+	psBudget->ulMinUnitNs = ulBcmUnitNs;
+	psBudget->ulLatchNs = LED_LATCH_TIME_US * 1000U;
+	psBudget->ulBlankingNs = LED_BLANKING_TIME_US * 1000U;
+	psBudget->ulStepSlackNs = LED_SCAN_STEP_SLACK_NS;
+	psBudget->ulTargetRefreshHz = ulTargetRefreshHz;
+}
+
+/**
+ * @brief Builds the eDMA chain of one scan cycle for the configured geometry.
+ *
+ * @return 1 on success, 0 if the memory could not be allocated.
+ */
+static uint8_t BuildScanChain(void)
+{
+	sLEDChainConfig_t sConfig;
+	GPIO_Type *psGpio = BOARD_LPSPI1_LED_PINS_LED_LE_GPIO;
+	uint32_t ulWordCount = LEDChain_GetGpioWordCount(ubScanRate);
+
+	psChainTcds = (sLEDChainTcd_t *)MM_Alloc(MM_PURPOSE_DMA_SOURCE, LEDChain_GetTcdCount(ubScanRate) * sizeof(sLEDChainTcd_t));
+	// One word more for the TCR value rewritten as barrier
+	pulChainWords = (uint32_t *)MM_Alloc(MM_PURPOSE_DMA_SOURCE, (ulWordCount + 1U) * sizeof(uint32_t));
+	if ((psChainTcds == NULL) || (pulChainWords == NULL))
+	{
+		FreeScanChain();
+		return 0;
+	}
+
+	memset(&sConfig, 0, sizeof(sConfig));
+	sConfig.ulTcdAddress = (uint32_t)(uintptr_t)psChainTcds;
+	sConfig.ulGpioWordsAddress = (uint32_t)(uintptr_t)pulChainWords;
+	sConfig.ulPayloadAddress = (uint32_t)(uintptr_t)asFaces[LED_FACE_FRONT].pubPayloadBlock;
+	sConfig.ulPayloadBytes = ulSpiPayloadSizeBytes;
+	sConfig.ubScanRate = ubScanRate;
+	sConfig.psAddressTable = asRowAddressTable;
+	sConfig.ulSpiTdrAddress = LPSPI_GetTxRegisterAddress(BOARD_LED_LPSPI1_PERIPHERAL);
+	sConfig.ulSpiTcrAddress = (uint32_t)(uintptr_t)&BOARD_LED_LPSPI1_PERIPHERAL->TCR;
+	sConfig.ulTcrValueAddress = (uint32_t)(uintptr_t)&pulChainWords[ulWordCount];
+	sConfig.ulGpioSetAddress = (uint32_t)(uintptr_t)&psGpio->DR_SET;
+	sConfig.ulLatchMask = BOARD_LPSPI1_LED_PINS_LED_LE_GPIO_PIN_MASK;
+	sConfig.ulOutputEnableMask = BOARD_LPSPI1_LED_PINS_LED_OE_GPIO_PIN_MASK;
+
+	if (LEDChain_Build(&sConfig, psChainTcds, pulChainWords) == 0)
+	{
+		FreeScanChain();
+		return 0;
+	}
+	return 1;
+}
+
+/**
+ * @brief Releases the eDMA chain; it is rebuilt by the next chain scan start.
+ */
+static void FreeScanChain(void)
+{
+	if (psChainTcds != NULL)
+	{
+		MM_Free(psChainTcds);
+		psChainTcds = NULL;
+	}
+	if (pulChainWords != NULL)
+	{
+		MM_Free(pulChainWords);
+		pulChainWords = NULL;
+	}
+}
+
+/**
+ * @brief Starts one scan cycle of the eDMA chain.
+ *
+ * Called with the chain stopped, so the payloads can be repacked before it runs.
+ */
+static void StartChainCycle(void)
+{
+	uint32_t ulNow = ScanGetTimeNs();
+
+	if (sChainStats.ulCycles != 0)
+	{
+		sChainStats.ulLastCycleNs = ulNow - ulChainCycleStartNs;
+	}
+	ulChainCycleStartNs = ulNow;
+	sChainStats.ulCycles++;
+
+	PollFrameSource();
+
+	EDMA_InstallTCD(LPSPI_MASTER_DMA_BASE, LPSPI_MASTER_DMA_TX_CHANNEL, (edma_tcd_t *)(void *)psChainTcds);
+	EDMA_EnableChannelRequest(LPSPI_MASTER_DMA_BASE, LPSPI_MASTER_DMA_TX_CHANNEL);
+}
+
+/**
+ * @brief eDMA interrupt at the end of the chain: the cycle is shown and the LEDs are off.
+ *
+ * Starts the next cycle now or, with a fixed refresh period, from the scan timer.
+ */
+static void ScanChainCallback(edma_handle_t *handle, void *userData, bool transferDone, uint32_t tcds)
+{
+	uint32_t ulPeriodNs = (ulRefreshRateHz != 0) ? (1000000000UL / ulRefreshRateHz) : 0;
+
+	if (!bChainRunning)
+	{
+		return;
+	}
+
+	if (ulPeriodNs != 0)
+	{
+		uint32_t ulElapsed = ScanGetTimeNs() - ulChainCycleStartNs;
+		if (ulElapsed < ulPeriodNs)
+		{
+			ScanStartTimer(ulPeriodNs - ulElapsed);
+			return;
+		}
+		sChainStats.ulOverruns++;
+	}
+	StartChainCycle();
+}
+
+/**
+ * @brief Sets up the LPSPI eDMA handles of both faces for the per-step transfers of the
+ *        timed scan.
+ */
+static void PrepareSpiTransfers(void)
+{
+	// This function sets up the internal EDMA callbacks, preventing the hang.
+	LPSPI_MasterTransferCreateHandleEDMA(LPSPI_MASTER_BASEADDR, &sEdmaHandle, LPSPIMasterUserCallback,
+										  NULL, &sLpspiEdmaMasterRxRegToRxDataHandle,
+										  &sLpspiEdmaMasterTxRegToTxDataHandle);
+	LPSPI_MasterTransferPrepareEDMALite(BOARD_LED_LPSPI1_PERIPHERAL, &sEdmaHandle, kLPSPI_MasterPcs0 | kLPSPI_MasterPcsContinuous);
+
+	LPSPI_MasterTransferCreateHandleEDMA(LED_REAR_LPSPI, &sRearEdmaHandle, LPSPIMasterUserCallback,
+										  NULL, &sRearEdmaRxHandle, &sRearEdmaTxHandle);
+	LPSPI_MasterTransferPrepareEDMALite(LED_REAR_LPSPI, &sRearEdmaHandle, kLPSPI_MasterPcs0 | kLPSPI_MasterPcsContinuous);
+}
+
+/**
+ * @brief Checks a scan pattern against the configured geometry and the board.
+ *
+ * @return 1 if the pattern can be compiled, 0 otherwise.
+ */
+static uint8_t IsScanPatternValid(const sLEDScanPattern_t *psPattern)
+{
+    if ((psPattern == NULL) || (psPattern->ubAddressBits == 0) ||
+        (psPattern->ubAddressBits > LED_MAX_ADDRESS_BITS) ||
+        (psPattern->ubAddressBits > LED_ROW_ADDRESS_LINES))
+    {
+        return 0;
+    }
+
+    uint16_t usScan = (uint16_t)(1U << psPattern->ubAddressBits);
+    uint16_t usPanelBytes = usColumnsPerPanel / 8U;
+    uint8_t ubPanelsAcross = (psPattern->ubPanelsPerChainRow != 0) ? psPattern->ubPanelsPerChainRow : ubNumberofPanels;
+
+    // Whole row groups, whole bytes per panel, whole rows of panels
+    if ((ubNumberofPanels == 0) || (usRowsPerPanel == 0) || ((usRowsPerPanel % usScan) != 0) ||
+        ((usRowsPerPanel / usScan) > LED_MAX_ROW_GROUPS) ||
+        ((usColumnsPerPanel % 8U) != 0) || (usPanelBytes == 0) ||
+        ((ubNumberofPanels % ubPanelsAcross) != 0))
+    {
+        return 0;
+    }
+
+    if ((psPattern->ubZigzagBytes != 0) && ((usPanelBytes % psPattern->ubZigzagBytes) != 0))
+    {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Resolves where one panel's share of a row group slot comes from in the frame.
+ *
+ * @param psPattern   Scan pattern.
+ * @param n           Scan address.
+ * @param k           Slot of the row group in the payload.
+ * @param p           Panel in chain order.
+ * @param pusRow      Returns the frame row.
+ * @param pusOffset   Returns the first byte of the panel in the frame row.
+ * @param pubReversed Returns 1 if the panel is rotated by 180 degrees.
+ */
+static void ResolvePanelSlot(const sLEDScanPattern_t *psPattern, uint16_t n, uint16_t k, uint16_t p,
+                             uint16_t *pusRow, uint16_t *pusOffset, uint8_t *pubReversed)
+{
+    uint16_t usPanelBytes = usColumnsPerPanel / 8U;
+    uint8_t ubPanelsAcross = (psPattern->ubPanelsPerChainRow != 0) ? psPattern->ubPanelsPerChainRow : ubNumberofPanels;
+
+    // Row group shifted in slot k, and the row of it that address n lights
+    uint16_t usGroup = (psPattern->eGroupOrder == LED_ROW_GROUPS_DESCENDING) ? (ubRowsPerScanAddress - 1U - k) : k;
+    uint16_t usLine = (psPattern->ulGroupReverseMask & (1UL << usGroup)) ? (ubScanRate - 1U - n) : n;
+    uint16_t usPanelRow = (usGroup * ubScanRate) + usLine;
+
+    // Position of the panel in the grid
+    uint16_t usChainRow = p / ubPanelsAcross;
+    uint16_t usColumn = p % ubPanelsAcross;
+    if (psPattern->bSerpentine && (usChainRow & 1U))
+    {
+        usColumn = ubPanelsAcross - 1U - usColumn;
+    }
+    if (psPattern->bMirroredChain)
+    {
+        usColumn = ubPanelsAcross - 1U - usColumn;
+    }
+
+    *pubReversed = ((p < 32U) && (psPattern->ulRotatedPanelMask & (1UL << p))) ? 1U : 0U;
+    if (*pubReversed)
+    {
+        usPanelRow = usRowsPerPanel - 1U - usPanelRow;
+    }
+
+    *pusRow = (usChainRow * usRowsPerPanel) + usPanelRow;
+    *pusOffset = usColumn * usPanelBytes;
+}
+
+/**
+ * @brief Appends a segment to the face's gather table, merging it with the previous one
+ *        when both are plain copies that continue each other in the frame and in the payload.
+ */
+static void AppendGatherEntry(sLEDFace_t *psFace, uint32_t ulDestOffset, uint16_t usRow, uint16_t usOffset,
+                              uint16_t usBytes, uint8_t ubReversed)
+{
+    sLEDGatherEntry_t *psGatherTable = psFace->psGatherTable;
+    uint16_t usGatherEntries = psFace->usGatherEntries;
+
+    if ((usGatherEntries != 0) && (ubReversed == 0))
+    {
+        sLEDGatherEntry_t *psLast = &psGatherTable[usGatherEntries - 1U];
+        if ((psLast->ubReversed == 0) && (psLast->usSourceRow == usRow) &&
+            ((psLast->usSourceOffset + psLast->usBytes) == usOffset) &&
+            ((psLast->ulDestOffset + psLast->usBytes) == ulDestOffset))
+        {
+            psLast->usBytes += usBytes;
+            return;
+        }
+    }
+
+    psGatherTable[usGatherEntries].ulDestOffset = ulDestOffset;
+    psGatherTable[usGatherEntries].usSourceRow = usRow;
+    psGatherTable[usGatherEntries].usSourceOffset = usOffset;
+    psGatherTable[usGatherEntries].usBytes = usBytes;
+    psGatherTable[usGatherEntries].ubReversed = ubReversed;
+    psFace->usGatherEntries = usGatherEntries + 1U;
+}
+
+/**
+ * @brief Compiles a scan pattern into the gather table of a face.
+ *
+ * The payload of scan address n holds one slot per row group. Without zigzag a slot is
+ * the whole chain row, panel after panel; with zigzag each panel's data is interleaved
+ * ubZigzagBytes at a time across the slots, panel after panel. Entries are emitted in
+ * payload order and adjacent plain copies are merged, so the default pattern packs one
+ * copy per row.
+ *
+ * @return 1 on success, 0 if the table could not be allocated.
+ */
+static uint8_t CompileGatherTable(sLEDFace_t *psFace, const sLEDScanPattern_t *psPattern)
+{
+    uint16_t usPanelBytes = usColumnsPerPanel / 8U;
+    uint16_t usBlockBytes = (psPattern->ubZigzagBytes != 0) ? psPattern->ubZigzagBytes : usPanelBytes;
+    uint32_t ulMaxEntries = (uint32_t)usRowsPerPanel * ubNumberofPanels * (usPanelBytes / usBlockBytes);
+
+    if (ulMaxEntries > 0xFFFFUL)
+    {
+        return 0;
+    }
+
+    psFace->psGatherTable = (sLEDGatherEntry_t *)MM_Alloc(MM_PURPOSE_LOOKUP_TABLE, ulMaxEntries * sizeof(sLEDGatherEntry_t));
+    if (psFace->psGatherTable == NULL)
+    {
+        return 0;
+    }
+
+    psFace->usGatherEntries = 0;
+    for (uint16_t n = 0; n < ubScanRate; n++)
+    {
+        uint32_t ulBase = n * ulSpiPayloadSizeBytes;
+        uint16_t usRow, usOffset;
+        uint8_t ubReversed;
+
+        if (psPattern->ubZigzagBytes == 0)
+        {
+            for (uint16_t k = 0; k < ubRowsPerScanAddress; k++)
+            {
+                for (uint16_t p = 0; p < ubNumberofPanels; p++)
+                {
+                    ResolvePanelSlot(psPattern, n, k, p, &usRow, &usOffset, &ubReversed);
+                    AppendGatherEntry(psFace, ulBase + (k * usTotalColumnsPerRowBytes) + (p * usPanelBytes),
+                                      usRow, usOffset, usPanelBytes, ubReversed);
+                }
+            }
+            continue;
+        }
+
+        for (uint16_t p = 0; p < ubNumberofPanels; p++)
+        {
+            uint32_t ulPanelBase = ulBase + ((uint32_t)p * usPanelBytes * ubRowsPerScanAddress);
+            for (uint16_t b = 0; b < (usPanelBytes / usBlockBytes); b++)
+            {
+                for (uint16_t k = 0; k < ubRowsPerScanAddress; k++)
+                {
+                    ResolvePanelSlot(psPattern, n, k, p, &usRow, &usOffset, &ubReversed);
+                    // A rotated panel shows its last column block first
+                    uint16_t usBlock = ubReversed ? (usPanelBytes / usBlockBytes) - 1U - b : b;
+                    AppendGatherEntry(psFace, ulPanelBase + (((uint32_t)b * ubRowsPerScanAddress) + k) * usBlockBytes,
+                                      usRow, usOffset + (usBlock * usBlockBytes), usBlockBytes, ubReversed);
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Allocates the payloads of a face for the configured geometry and planes, and
+ *        compiles its packing plan.
+ *
+ * @return 1 on success, 0 if memory could not be allocated (the face is left free).
+ */
+static uint8_t AllocateFace(sLEDFace_t *psFace, const sLEDScanPattern_t *psPattern)
+{
+	// One payload per scan address and bit-plane
+	size_t TotalDataBytes = (size_t)ubBitPlanes*ubScanRate*ulSpiPayloadSizeBytes;
+
+	// Allocate the array of row pointers (The "rows" of the 2D array)
+	psFace->ptubPayloads = (uint8_t **)MM_Alloc(MM_PURPOSE_LOOKUP_TABLE, ubBitPlanes * ubScanRate * sizeof(uint8_t *));
+	if (psFace->ptubPayloads == NULL)
+	{
+		return 0;
+	}
+
+	// Allocate the single, contiguous block for all the data (The memory for the SPI transfer)
+	uint8_t *pubDataBlock = (uint8_t *)MM_Alloc(MM_PURPOSE_DMA_SOURCE, TotalDataBytes);
+	if (pubDataBlock == NULL)
+	{
+		MM_Free(psFace->ptubPayloads);
+		psFace->ptubPayloads = NULL;
+		return 0;
+	}
+
+	// Point each row pointer into the contiguous data block
+	psFace->pubPayloadBlock = pubDataBlock;
+	for (int n = 0; n < (ubBitPlanes * ubScanRate); n++)
+	{
+		psFace->ptubPayloads[n] = pubDataBlock + (n * ulSpiPayloadSizeBytes);
+	}
+
+	// Initialize the new buffer to zero for safety
+	memset(pubDataBlock, 0, TotalDataBytes);
+	psFace->ulBlankAddresses = 0;	// Nothing packed yet: scan every address
+
+	if (CompileGatherTable(psFace, psPattern) == 0)
+	{
+		FreeFace(psFace);
+		return 0;
+	}
+	return 1;
+}
+
+/**
+ * @brief Releases the payloads and packing plan of a face.
+ */
+static void FreeFace(sLEDFace_t *psFace)
+{
+	if (psFace->pubPayloadBlock != NULL)
+	{
+		MM_Free(psFace->pubPayloadBlock);
+		psFace->pubPayloadBlock = NULL;
+	}
+	if (psFace->ptubPayloads != NULL)
+	{
+		MM_Free(psFace->ptubPayloads);
+		psFace->ptubPayloads = NULL;
+	}
+	if (psFace->psGatherTable != NULL)
+	{
+		MM_Free(psFace->psGatherTable);
+		psFace->psGatherTable = NULL;
+	}
+	psFace->usGatherEntries = 0;
+}
+
+/**
+ * @brief Checks that the front gather table copies whole frame rows, one per payload slot
+ *        and in payload order, so a row order makes bit-planes the payloads.
+ */
+static uint8_t IsFrontStreamable(void)
+{
+	const sLEDFace_t *psFront = &asFaces[LED_FACE_FRONT];
+
+	if ((psFront->psGatherTable == NULL) ||
+		(((uint32_t)psFront->usGatherEntries * usTotalColumnsPerRowBytes) != ((uint32_t)ubScanRate * ulSpiPayloadSizeBytes)))
+	{
+		return 0;
+	}
+
+	for (uint16_t usEntry = 0; usEntry < psFront->usGatherEntries; usEntry++)
+	{
+		const sLEDGatherEntry_t *psEntry = &psFront->psGatherTable[usEntry];
+		if ((psEntry->ulDestOffset != ((uint32_t)usEntry * usTotalColumnsPerRowBytes)) ||
+			(psEntry->usSourceOffset != 0) || (psEntry->usBytes != usTotalColumnsPerRowBytes) ||
+			(psEntry->ubReversed != 0))
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/**
+ * @brief Points the front payloads back at the own payload block after streamed planes.
+ */
+static void RestoreFrontPayloads(void)
+{
+	sLEDFace_t *psFront = &asFaces[LED_FACE_FRONT];
+
+	for (uint32_t n = 0; n < ((uint32_t)ubAllocatedPlanes * ubScanRate); n++)
+	{
+		psFront->ptubPayloads[n] = psFront->pubPayloadBlock + (n * ulSpiPayloadSizeBytes);
+	}
+	bStreamingPlanes = false;
+}
+
+/**
+ * @brief Mirrors the bit order of a byte (leftmost pixel becomes rightmost).
+ */
+static inline uint8_t ReverseBits(uint8_t ubByte)
+{
+    static const uint8_t aubNibble[16] = { 0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE,
+                                           0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF };
+    return (uint8_t)((aubNibble[ubByte & 0x0FU] << 4) | aubNibble[ubByte >> 4]);
+}
+
+/**
+ * @brief Selects the physical row to be displayed by driving the address lines (A, B, C, etc.).
+ *
+ * The Gray coded address comes precomputed from asRowAddressTable and is applied with one
+ * DR_SET and one DR_CLEAR write; between consecutive addresses only one line changes.
+ *
+ * @param ubRow The 0-indexed row (0 to ubScanRate - 1) to select.
+ */
+static void LEDRowSelect(uint8_t ubRow)
+{
+    // Ensure input is within bounds
+    if (ubRow >= ubScanRate) return;
+
+    LED_ADDRESS_GPIO->DR_SET = asRowAddressTable[ubRow].ulSet;
+    LED_ADDRESS_GPIO->DR_CLEAR = asRowAddressTable[ubRow].ulClear;
+}
+
+/**
+ * @brief Scan HAL: drives LE.
+ */
+static void ScanSetLatch(bool bActive)
+{
+	if (bActive)
+	{
+		LED_LE_ENABLE;
+	}
+	else
+	{
+		LED_LE_DISABLE;
+	}
+}
+
+/**
+ * @brief Scan HAL: drives OE.
+ */
+static void ScanSetOutputEnable(bool bEnabled)
+{
+	if (bEnabled)
+	{
+		LED_OE_ENABLE;
+	}
+	else
+	{
+		LED_OE_DISABLE;
+	}
+}
+
+/**
+ * @brief Scan HAL: starts the LPSPI DMA transfer of one step's payload on one face.
+ *
+ * Completion is reported by LPSPIMasterUserCallback().
+ *
+ * @param ubChannel Face (LED_FACE_FRONT - LPSPI1, LED_FACE_REAR - LED_REAR_LPSPI).
+ * @param pubData   Payload.
+ * @param ulBytes   Payload size.
+ */
+static void SPITransfer(uint8_t ubChannel, const uint8_t *pubData, uint32_t ulBytes)
+{
+	if (ubChannel == LED_FACE_REAR)
+	{
+		sRearXfer.txData   = (uint8_t *)pubData;
+		sRearXfer.rxData   = NULL;
+		sRearXfer.dataSize = ulBytes;
+		LPSPI_MasterTransferEDMALite(LED_REAR_LPSPI, &sRearEdmaHandle, &sRearXfer);
+		return;
+	}
+
+	/*Start master transfer*/
+	sMasterXfer.txData   = (uint8_t *)pubData;
+	sMasterXfer.rxData   = NULL;
+	sMasterXfer.dataSize = ulBytes;
+	LPSPI_MasterTransferEDMALite(BOARD_LED_LPSPI1_PERIPHERAL, &sEdmaHandle, &sMasterXfer);
+}
+
+/**
+ * @brief Scan HAL: starts the one-shot timer; expiry is handled by LED_SCAN_GPT_IRQHandler().
+ */
+static void ScanStartTimer(uint32_t ulDelayNs)
+{
+	uint32_t ulTicks = (uint32_t)(((uint64_t)ulDelayNs * ulGptClockHz) / 1000000000ULL);
+
+	GPT_StopTimer(LED_SCAN_GPT);
+	GPT_SetOutputCompareValue(LED_SCAN_GPT, kGPT_OutputCompare_Channel1, (ulTicks != 0) ? ulTicks : 1U);
+	GPT_StartTimer(LED_SCAN_GPT);
+}
+
+/**
+ * @brief Scan HAL: free-running time in ns, from the DWT cycle counter.
+ *
+ * Called from the scan interrupts and, through StartChainCycle(), from the thread that
+ * starts the scan; the update runs under a critical section so a scan interrupt cannot
+ * interleave with it. Called often enough that the counter never wraps twice between
+ * calls.
+ */
+static uint32_t ScanGetTimeNs(void)
+{
+	uint32_t ulPrimask = DisableGlobalIRQ();
+	uint32_t ulCount = DWT->CYCCNT;
+	uint64_t udScaled = ((uint64_t)(ulCount - ulLastCycleCount) * 1000000000ULL) + ulTimeRemainder;
+
+	// Carry the fraction of a ns so the time does not drift
+	ulTimeNs += (uint32_t)(udScaled / SystemCoreClock);
+	ulTimeRemainder = (uint32_t)(udScaled % SystemCoreClock);
+	ulLastCycleCount = ulCount;
+
+	uint32_t ulTime = ulTimeNs;
+	EnableGlobalIRQ(ulPrimask);
+	return ulTime;
+}
+
+/**
+ * @brief Scan timer interrupt: one latch, OE or blanking time has elapsed, or the refresh
+ *        period of a chain cycle.
+ */
+void LED_SCAN_GPT_IRQHandler(void)
+{
+	GPT_ClearStatusFlags(LED_SCAN_GPT, kGPT_OutputCompare1Flag);
+	GPT_StopTimer(LED_SCAN_GPT);
+
+	if (bChainRunning)
+	{
+		StartChainCycle();
+	}
+	else
+	{
+		LEDScan_OnTimerExpired(&sScan);
+	}
+	SDK_ISR_EXIT_BARRIER;
+}
+
+/**
+ * @brief Callback function executed upon completion of an LPSPI Master EDMA transfer.
+ *
+ * This function is registered with the EDMA handles of both faces and is called by the
+ * EDMA interrupt service routine when a face's transfer is finished; the scan latches
+ * once both faces are shifted.
+ *
+ * @param base LPSPI peripheral base address.
+ * @param handle Pointer to the LPSPI master EDMA transfer handle.
+ * @param status Status of the transfer (kStatus_Success or an error code).
+ * @param userData Custom data pointer (unused in this implementation).
+ */
+static void LPSPIMasterUserCallback(LPSPI_Type *base, lpspi_master_edma_handle_t *handle, status_t status, void *userData)
+{
+    (void)base;
+    (void)handle;
+    (void)status;
+    (void)userData;
+
+    // The payload is shifted: latch it. A failed transfer only corrupts one step of one
+    // cycle, so the scan carries on rather than stalling.
+    LEDScan_OnShiftComplete(&sScan);
+}
+
+
@@ -1,79 +1,284 @@
-/**
- * @file LEDDriver.h
- * @brief Hardware Abstraction Layer (HAL) Interface for LED Matrix Panel Driver.
- *
- * (C) Copyright Centum T&S Group 2025. All rights reserved.
- * This computer program may not be used, copied, distributed, translated,
- * transmitted or assigned without the prior written authorization of
- * Centum T&S Group.
- */
-
-#ifndef HAL_LEDDRIVERINTERFACE_LEDDRIVER_H_
-#define HAL_LEDDRIVERINTERFACE_LEDDRIVER_H_
-
-//------------------------------------ [ INCLUDE FILES ] ----------------------------//
-//
-#include "fsl_lpspi.h"
-#include "fsl_edma.h"
-#include "fsl_lpspi_edma.h"
-#if defined(FSL_FEATURE_SOC_DMAMUX_COUNT) && FSL_FEATURE_SOC_DMAMUX_COUNT
-#include "fsl_dmamux.h"
-#endif
-#include "app.h"
-#include "peripherals.h"
-
-//-------------------------------------[ DEFINES ] ----------------------------------//
-//
-/* Definition of peripheral ID */
-#define BOARD_LED_LPSPI1_PERIPHERAL LPSPI1
-/* Definition of clock source */
-#define BOARD_LED_LPSPI1_CLOCK_FREQ 105600000UL
-#define TRANSFER_SIZE     16UL     /* Transfer dataSize */
-#define TRANSFER_BAUDRATE 500000UL /* Transfer baudrate - 500k */
-
-#define LPSPI_MASTER_PCS_FOR_INIT     (kLPSPI_Pcs0)
-#define LPSPI_MASTER_PCS_FOR_TRANSFER (kLPSPI_MasterPcs0)
-
-#define LPSPI_MASTER_BASEADDR              (LPSPI1)
-#define LPSPI_MASTER_DMA_MUX_BASE          (DMAMUX)
-#define LPSPI_MASTER_DMA_RX_REQUEST_SOURCE kDmaRequestMuxLPSPI1Rx
-#define LPSPI_MASTER_DMA_TX_REQUEST_SOURCE kDmaRequestMuxLPSPI1Tx
-#define LPSPI_MASTER_DMA_BASE              (DMA0)
-#define LPSPI_MASTER_DMA_RX_CHANNEL        0U
-#define LPSPI_MASTER_DMA_TX_CHANNEL        1U
-/* Select USB1 PLL PFD0 (480 MHz) as lpspi clock source */
-#define LPSPI_CLOCK_SOURCE_SELECT (1U)
-/* Clock divider for master lpspi clock source */
-#define LPSPI_CLOCK_SOURCE_DIVIDER (7U)
-
-
-//GPIOs for LE, OE and 3 address lines
-//TODO: GPIO configuration for double sided display and RGB
-#define LED_LE_ENABLE		HAL_GpioSetOutput(BOARD_LPSPI1_LED_PINS_LED_LE_handle, 1)
-#define LED_LE_DISABLE		HAL_GpioSetOutput(BOARD_LPSPI1_LED_PINS_LED_LE_handle, 0)
-
-#define LED_OE_ENABLE		HAL_GpioSetOutput(BOARD_LPSPI1_LED_PINS_LED_OE_handle, 0)
-#define LED_OE_DISABLE		HAL_GpioSetOutput(BOARD_LPSPI1_LED_PINS_LED_OE_handle, 1)
-
-#define LED_A0(x)		HAL_GpioSetOutput(BOARD_LPSPI1_LED_PINS_A0_handle, x)
-#define LED_A1(x)		HAL_GpioSetOutput(BOARD_LPSPI1_LED_PINS_A1_handle, x)
-#define LED_A2(x)		HAL_GpioSetOutput(BOARD_LPSPI1_LED_PINS_A2_handle, x)
-
-
-//-------------------------------------[ PROTOTYPES ] -------------------------------//
-//
-
-void LEDDriver_Init();
-
-void LEDDriver_ConfigurePanel(uint16_t usDisplayRows,
-							  uint16_t usDisplayColumns,
-							  uint8_t  ubDoubleSidedDisplay,
-							  uint8_t  ubLedType,
-							  uint8_t  ubNumPanels,
-							  uint8_t  ubNumRowSelection);
-
-void LEDDriver_PrepareDisplayBuffer(uint8_t **ptubActiveBufferNow);
-
-void LEDDriver_DisplayOnLED();
-
-#endif /* HAL_LEDDRIVERINTERFACE_LEDDRIVER_H_ */
+/**
+ * @file LEDDriver.h
+ * @brief Hardware Abstraction Layer (HAL) Interface for LED Matrix Panel Driver.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_LEDDRIVER_H_
+#define HAL_LEDDRIVERINTERFACE_LEDDRIVER_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "fsl_lpspi.h"
+#include "fsl_edma.h"
+#include "fsl_lpspi_edma.h"
+#include "fsl_gpt.h"
+#if defined(FSL_FEATURE_SOC_DMAMUX_COUNT) && FSL_FEATURE_SOC_DMAMUX_COUNT
+#include "fsl_dmamux.h"
+#endif
+#include "app.h"
+#include "peripherals.h"
+#include "HAL/MemoryManager/MemoryManager.h"
+#include "HAL/LEDDriverInterface/LEDBcm.h"
+#include "HAL/LEDDriverInterface/LEDBrightness.h"
+#include "HAL/LEDDriverInterface/LEDRefreshPlan.h"
+#include "HAL/LEDDriverInterface/LEDScanPattern.h"
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+/* Definition of peripheral ID */
+#define BOARD_LED_LPSPI1_PERIPHERAL LPSPI1
+/* Definition of clock source */
+#define BOARD_LED_LPSPI1_CLOCK_FREQ 105600000UL
+#define TRANSFER_SIZE     16UL     /* Transfer dataSize */
+#define LED_SPI_MAX_BAUDRATE 10000000UL /* Fastest SCK the panel chain and its cables take */
+
+#define LPSPI_MASTER_PCS_FOR_INIT     (kLPSPI_Pcs0)
+#define LPSPI_MASTER_PCS_FOR_TRANSFER (kLPSPI_MasterPcs0)
+
+#define LPSPI_MASTER_BASEADDR              (LPSPI1)
+#define LPSPI_MASTER_DMA_MUX_BASE          (DMAMUX)
+#define LPSPI_MASTER_DMA_RX_REQUEST_SOURCE kDmaRequestMuxLPSPI1Rx
+#define LPSPI_MASTER_DMA_TX_REQUEST_SOURCE kDmaRequestMuxLPSPI1Tx
+#define LPSPI_MASTER_DMA_BASE              (DMA0)
+#define LPSPI_MASTER_DMA_RX_CHANNEL        0U
+#define LPSPI_MASTER_DMA_TX_CHANNEL        1U
+/* Rear face of a double-sided unit: second LPSPI on its own eDMA channels, shares LE, OE and address */
+#define LED_REAR_LPSPI                     LPSPI3
+#define LED_REAR_DMA_RX_REQUEST_SOURCE     kDmaRequestMuxLPSPI3Rx
+#define LED_REAR_DMA_TX_REQUEST_SOURCE     kDmaRequestMuxLPSPI3Tx
+#define LED_REAR_DMA_RX_CHANNEL            2U
+#define LED_REAR_DMA_TX_CHANNEL            3U
+/* Select USB1 PLL PFD0 (480 MHz) as lpspi clock source */
+#define LPSPI_CLOCK_SOURCE_SELECT (1U)
+/* Clock divider for master lpspi clock source */
+#define LPSPI_CLOCK_SOURCE_DIVIDER (7U)
+
+
+//GPIOs for LE, OE and the row address lines
+#define LED_LE_ENABLE		HAL_GpioSetOutput(BOARD_LPSPI1_LED_PINS_LED_LE_handle, 1)
+#define LED_LE_DISABLE		HAL_GpioSetOutput(BOARD_LPSPI1_LED_PINS_LED_LE_handle, 0)
+
+#define LED_OE_ENABLE		HAL_GpioSetOutput(BOARD_LPSPI1_LED_PINS_LED_OE_handle, 0)
+#define LED_OE_DISABLE		HAL_GpioSetOutput(BOARD_LPSPI1_LED_PINS_LED_OE_handle, 1)
+
+// Address lines are written together through DR_SET/DR_CLEAR, so they share one port
+#define LED_ADDRESS_GPIO	BOARD_LPSPI1_LED_PINS_A0_GPIO
+#define LED_A0_MASK		BOARD_LPSPI1_LED_PINS_A0_GPIO_PIN_MASK
+#define LED_A1_MASK		BOARD_LPSPI1_LED_PINS_A1_GPIO_PIN_MASK
+#define LED_A2_MASK		BOARD_LPSPI1_LED_PINS_A2_GPIO_PIN_MASK
+
+// 1 when LE, OE and the address lines share one GPIO port (GPIO1 in pin_mux.h), as the
+// eDMA chain scan needs; 0 if the board routes them to different ports
+#define LED_CHAIN_SINGLE_PORT	1U
+
+// A3/A4 exist only when the board routes them (1/16 and 1/32 scan modules)
+#if defined(BOARD_LPSPI1_LED_PINS_A4_PIN_DIRECTION)
+#define LED_A3_MASK		BOARD_LPSPI1_LED_PINS_A3_GPIO_PIN_MASK
+#define LED_A4_MASK		BOARD_LPSPI1_LED_PINS_A4_GPIO_PIN_MASK
+#define LED_ROW_ADDRESS_LINES	5U
+#elif defined(BOARD_LPSPI1_LED_PINS_A3_PIN_DIRECTION)
+#define LED_A3_MASK		BOARD_LPSPI1_LED_PINS_A3_GPIO_PIN_MASK
+#define LED_ROW_ADDRESS_LINES	4U
+#else
+#define LED_ROW_ADDRESS_LINES	3U
+#endif
+
+#define LED_MAX_ADDRESS_BITS	5U		// 1/32 scan
+
+#define LED_LATCH_TIME_US		10U		// LE pulse after every shift
+#define LED_BLANKING_TIME_US	100U	// OE off time before the next row is selected
+#define LED_SCAN_STEP_SLACK_NS	2000U	// Interrupt latency allowed per scan step in the refresh budget
+#define LED_BCM_DEFAULT_UNIT_NS	100000UL	// Shortest OE time of plane 0 (one plane: the former fixed 100 us)
+
+/* One-shot timer pacing the scan (latch, OE and blanking times) */
+#define LED_SCAN_GPT				GPT2
+#define LED_SCAN_GPT_IRQn			GPT2_IRQn
+#define LED_SCAN_GPT_IRQHandler		GPT2_IRQHandler
+#define LED_SCAN_IRQ_PRIORITY		2U		// Above lwIP/LVGL work, timing of OE depends on it
+#define LED_SCAN_DEFAULT_REFRESH_HZ	120U	// Fixed scan cycle rate (0 - as fast as possible)
+#define LED_MAX_ROW_GROUPS		32U		// Rows sharing one scan address (width of ulGroupReverseMask)
+#define LED_MAX_PLAN_ENTRIES	8U		// Blocks of a configuration: 3 per face and 2 for the eDMA chain
+
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief Source of frames for the scan.
+ *
+ * Called once at the start of every scan cycle. Returns the frame to scan and sets
+ * *pbIsNewFrame when it differs from the frame returned by the previous call. For a new
+ * frame, *ppulDirtyRows may be set to a bitmap of the rows that changed (row r is bit
+ * (r & 31) of word (r >> 5)), or NULL to re-pack every row.
+ */
+typedef uint8_t **(*pfnLEDFrameSource_t)(bool *pbIsNewFrame, const uint32_t **ppulDirtyRows);
+
+/**
+ * @brief Source of the rear frames of a double-sided unit.
+ *
+ * Called after the frame source returned a new frame; returns the rear frame of it.
+ */
+typedef uint8_t **(*pfnLEDRearFrameSource_t)(void);
+
+/**
+ * @brief One grayscale frame split into bit-planes (front face).
+ *
+ * Plane p is shown for (1 << p) BCM units, see LEDDriver_PrepareBitPlanes().
+ */
+typedef struct {
+    const uint8_t *apubPlanes[LED_BCM_MAX_PLANES];  // Plane base addresses, least significant first
+    uint8_t        ubPlanes;                        // Number of valid planes
+    uint16_t       usStride;                        // Bytes per row of a plane
+    bool           bStreamOrder;                    // Rows in LEDDriver_GetStreamRowOrder() order, else source order
+} sLEDBitPlaneSet_t;
+
+/**
+ * @brief Source of grayscale frames given as bit-planes.
+ *
+ * Called once at the start of every scan cycle instead of the frame source. Returns true
+ * and fills *psPlanes when a new frame is available; *ppulDirtyRows follows the rules of
+ * pfnLEDFrameSource_t.
+ */
+typedef bool (*pfnLEDBitPlaneSource_t)(sLEDBitPlaneSet_t *psPlanes, const uint32_t **ppulDirtyRows);
+
+/**
+ * @brief Start of a scan cycle (vsync), called from the scan interrupt right before the
+ *        frame source is polled: a frame published before it is shown in this cycle.
+ */
+typedef void (*pfnLEDCycleStartCallback_t)(void);
+
+/**
+ * @brief Packing statistics of LEDDriver_PrepareDisplayBuffer().
+ */
+typedef struct {
+    uint16_t usRowsPacked;          // Row segments copied into the payloads by the last prepare
+    uint16_t usRowsSkipped;         // Unchanged row segments skipped by the last prepare
+    uint32_t ulTotalRowsPacked;     // Rows copied since LEDDriver_ConfigurePanel()
+    uint32_t ulTotalRowsSkipped;    // Rows skipped since LEDDriver_ConfigurePanel()
+    uint32_t ulBytesPacked;         // Bytes copied by the last prepare
+    uint32_t ulStreamedFrames;      // Bit-plane frames shifted straight out of their planes, unpacked
+    uint32_t ulRejectedFrames;      // Bit-plane frames with more planes than allocated, not shown
+} sLEDPackStats_t;
+
+/**
+ * @brief Grayscale depth and refresh rate of the scan.
+ */
+typedef struct {
+    uint8_t  ubPlanes;                  // Bit-planes shown per scan address
+    uint8_t  ubAllocatedPlanes;         // Planes the buffers were sized for at configuration
+    uint32_t ulUnitNs;                  // OE time of plane 0, as planned for the refresh rate
+    uint32_t ulSpiBaudRate;             // SCK of the payload shifts
+    uint32_t ulRefreshMilliHz;          // Measured over the last scan cycle (0 until one completed)
+    uint32_t ulEstimatedRefreshMilliHz; // Expected from OE, latch, blanking and SPI shift times
+    uint32_t ulTargetRefreshMilliHz;    // Fixed rate set with LEDDriver_SetRefreshRate() (0 - free running)
+    uint32_t ulShortfallMilliHz;        // Target the timed scan cannot reach by this much (0 - reached)
+    uint32_t ulScanCycles;              // Scan cycles started since the scan was started
+    uint32_t ulOverruns;                // Cycles longer than the fixed refresh period
+    uint8_t  ubBrightness;              // Brightness level shown (target clamped to the limits)
+    uint16_t usDuty;                    // OE duty of that level (0..LED_BRIGHTNESS_FULL_DUTY)
+    uint8_t  ubBlankAddresses;          // Blank scan addresses left out of the timed scan
+} sLEDRefreshStats_t;
+
+/**
+ * @brief How the scan is run.
+ */
+typedef enum {
+    LED_SCAN_MODE_TIMED = 0,    // Shift, latch, OE and blanking per step from eDMA and timer interrupts (BCM)
+    LED_SCAN_MODE_DMA_CHAIN     // Whole cycle as one eDMA scatter-gather chain, one interrupt per cycle (1 plane)
+} eLEDScanMode_t;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+
+void LEDDriver_Init();
+
+void LEDDriver_ConfigurePanel(uint16_t usDisplayRows,
+							  uint16_t usDisplayColumns,
+							  uint8_t  ubDoubleSidedDisplay,
+							  uint8_t  ubLedType,
+							  uint8_t  ubNumPanels,
+							  uint8_t  ubNumRowSelection);
+
+void LEDDriver_GetDefaultScanPattern(sLEDScanPattern_t *psPattern, uint8_t ubNumRowSelection);
+
+uint8_t LEDDriver_ConfigurePanelPattern(uint16_t usDisplayRows,
+										uint16_t usDisplayColumns,
+										uint8_t  ubDoubleSidedDisplay,
+										uint8_t  ubLedType,
+										uint8_t  ubNumPanels,
+										const sLEDScanPattern_t *psPattern);
+
+uint8_t LEDDriver_SetRearScanPattern(const sLEDScanPattern_t *psPattern);
+
+uint32_t LEDDriver_ComputeFootprint(uint16_t usDisplayRows,
+									uint16_t usDisplayColumns,
+									uint8_t  ubDoubleSidedDisplay,
+									uint8_t  ubNumPanels,
+									uint8_t  ubNumRowSelection);
+
+uint8_t LEDDriver_GetAllocationPlan(uint16_t usDisplayRows,
+									uint16_t usDisplayColumns,
+									uint8_t  ubDoubleSidedDisplay,
+									uint8_t  ubNumPanels,
+									uint8_t  ubNumRowSelection,
+									uint8_t  ubPlanes,
+									sMMPlanEntry_t *psEntries);
+
+void LEDDriver_ReleasePanel(void);
+
+uint8_t LEDDriver_CheckRefreshBudget(uint16_t usDisplayRows,
+									 uint16_t usDisplayColumns,
+									 uint8_t  ubNumPanels,
+									 uint8_t  ubNumRowSelection,
+									 uint8_t  ubPlanes,
+									 uint32_t ulUnitNs,
+									 uint32_t ulRefreshHz,
+									 sLEDRefreshPlan_t *psPlan);
+
+void LEDDriver_SetFrameSource(pfnLEDFrameSource_t pfnSource);
+
+void LEDDriver_SetRearFrameSource(pfnLEDRearFrameSource_t pfnSource);
+
+void LEDDriver_SetBitPlaneSource(pfnLEDBitPlaneSource_t pfnSource);
+
+void LEDDriver_SetCycleStartCallback(pfnLEDCycleStartCallback_t pfnCallback);
+
+void LEDDriver_PrepareDisplayBuffer(uint8_t **ptubActiveBufferNow, const uint32_t *pulDirtyRows);
+
+void LEDDriver_PrepareRearDisplayBuffer(uint8_t **ptubRearBuffer, const uint32_t *pulDirtyRows);
+
+void LEDDriver_GetPackStatistics(sLEDPackStats_t *psStats);
+
+uint8_t *const *LEDDriver_GetScanPayloads(uint8_t ubFace, uint32_t *pulPayloadBytes);
+
+uint8_t LEDDriver_SetBitPlanes(uint8_t ubPlanes, uint32_t ulUnitNs);
+
+void LEDDriver_PrepareBitPlanes(const sLEDBitPlaneSet_t *psPlanes, const uint32_t *pulDirtyRows);
+
+uint8_t LEDDriver_GetStreamRowOrder(uint16_t *pusRowOrder, uint16_t usRows);
+
+void LEDDriver_GetRefreshStatistics(sLEDRefreshStats_t *psStats);
+
+void LEDDriver_SetRefreshRate(uint32_t ulRefreshHz);
+
+void LEDDriver_SetBlankRowSkipping(bool bEnable);
+
+void LEDDriver_SetBrightness(uint8_t ubLevel);
+
+uint8_t LEDDriver_SetBrightnessLimits(uint8_t ubLow, uint8_t ubHigh);
+
+uint8_t LEDDriver_SetGamma(uint16_t usGammaX100);
+
+uint8_t LEDDriver_SetScanMode(eLEDScanMode_t eMode);
+
+void LEDDriver_StartScan(void);
+
+void LEDDriver_StopScan(void);
+
+void LEDDriver_DisplayOnLED();
+
+#endif /* HAL_LEDDRIVERINTERFACE_LEDDRIVER_H_ */
@@ -0,0 +1,125 @@
+/**
+ * @file LEDRefreshPlan.c
+ * @brief Refresh rate budget of the LED matrix scan.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/LEDRefreshPlan.h"
+#include "HAL/LEDDriverInterface/LEDBcm.h"
+#include <stddef.h>
+#include <string.h>
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Selects the LPSPI divider giving the fastest SCK not above ulMaxBaudRate.
+ *
+ * The lowest prescaler that can reach the limit is the finest: any higher one gives the
+ * same or a slower clock.
+ *
+ * @return 1 on success, 0 if even the slowest divider is above the limit.
+ */
+uint8_t LEDRefreshPlan_SelectSpiDivider(uint32_t ulSpiClockHz, uint32_t ulMaxBaudRate,
+                                        sLEDSpiDivider_t *psDivider)
+{
+    if ((psDivider == NULL) || (ulSpiClockHz == 0) || (ulMaxBaudRate == 0))
+    {
+        return 0;
+    }
+
+    for (uint8_t ubPrescale = 0; ubPrescale <= LED_REFRESH_PLAN_MAX_PRESCALE; ubPrescale++)
+    {
+        uint64_t udStep = (uint64_t)ulMaxBaudRate << ubPrescale;
+        uint64_t udScaler = ((uint64_t)ulSpiClockHz + udStep - 1U) / udStep;
+
+        if (udScaler < 2U)
+        {
+            udScaler = 2U;
+        }
+        if (udScaler <= (LED_REFRESH_PLAN_MAX_SCKDIV + 2U))
+        {
+            psDivider->ubPrescale = ubPrescale;
+            psDivider->ubSckDiv = (uint8_t)(udScaler - 2U);
+            psDivider->ulBaudRate = (uint32_t)(ulSpiClockHz / (udScaler << ubPrescale));
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Plans the SPI clock and the OE unit of a geometry for a target refresh rate.
+ *
+ * With a target the unit is the longest that fits the refresh period (never shorter than
+ * ulMinUnitNs): the spare time goes to OE rather than to dark idle. Without a target the
+ * unit is ulMinUnitNs.
+ *
+ * @param psPlan Returns the plan; zeroed if the budget is invalid. If the target cannot be
+ *               reached the plan runs the shortest unit and ulShortfallMilliHz says by how
+ *               much the target is missed.
+ * @return 1 if the target is reached, 0 if it is not or the budget is invalid.
+ */
+uint8_t LEDRefreshPlan_Compute(const sLEDRefreshBudget_t *psBudget, sLEDRefreshPlan_t *psPlan)
+{
+    if (psPlan == NULL)
+    {
+        return 0;
+    }
+    memset(psPlan, 0, sizeof(*psPlan));
+
+    if ((psBudget == NULL) || (psBudget->ubPanels == 0) || (psBudget->usPanelColumns == 0) ||
+        (psBudget->ubRowsPerAddress == 0) || (psBudget->ubScanRate == 0) ||
+        (psBudget->ubPlanes == 0) || (psBudget->ubPlanes > LED_BCM_MAX_PLANES) ||
+        (psBudget->ulMinUnitNs == 0) ||
+        (LEDRefreshPlan_SelectSpiDivider(psBudget->ulSpiClockHz, psBudget->ulMaxBaudRate, &psPlan->sDivider) == 0))
+    {
+        memset(psPlan, 0, sizeof(*psPlan));
+        return 0;
+    }
+
+    // Shift time from the divider rather than the rounded baud rate, rounded up
+    uint64_t udPayloadBits = (uint64_t)psBudget->ubPanels * psBudget->usPanelColumns * psBudget->ubRowsPerAddress;
+    uint64_t udSckPeriods = ((uint64_t)psPlan->sDivider.ubSckDiv + 2U) << psPlan->sDivider.ubPrescale;
+    uint64_t udShiftNs = ((udPayloadBits * udSckPeriods * 1000000000ULL) + psBudget->ulSpiClockHz - 1U) /
+                         psBudget->ulSpiClockHz;
+    uint64_t udOverheadNs = udShiftNs + psBudget->ulLatchNs + psBudget->ulBlankingNs + psBudget->ulStepSlackNs;
+    uint64_t udSteps = (uint64_t)psBudget->ubScanRate * psBudget->ubPlanes;
+    uint64_t udUnits = (uint64_t)psBudget->ubScanRate * ((1UL << psBudget->ubPlanes) - 1U);
+    uint64_t udFixedNs = udSteps * udOverheadNs;
+    uint64_t udMinCycleNs = udFixedNs + (udUnits * psBudget->ulMinUnitNs);
+
+    if ((udOverheadNs > UINT32_MAX) || (udMinCycleNs > UINT32_MAX))
+    {
+        memset(psPlan, 0, sizeof(*psPlan));
+        return 0;
+    }
+
+    psPlan->ulShiftNs = (uint32_t)udShiftNs;
+    psPlan->ulStepOverheadNs = (uint32_t)udOverheadNs;
+    psPlan->ulUnitNs = psBudget->ulMinUnitNs;
+    psPlan->ulCycleNs = (uint32_t)udMinCycleNs;
+    psPlan->ulMaxRefreshMilliHz = (uint32_t)(1000000000000ULL / udMinCycleNs);
+
+    if (psBudget->ulTargetRefreshHz == 0)
+    {
+        return 1;
+    }
+
+    uint64_t udPeriodNs = 1000000000ULL / psBudget->ulTargetRefreshHz;
+    if (udMinCycleNs > udPeriodNs)
+    {
+        psPlan->ulShortfallMilliHz = (psBudget->ulTargetRefreshHz * 1000U) - psPlan->ulMaxRefreshMilliHz;
+        return 0;
+    }
+
+    psPlan->ulUnitNs = (uint32_t)((udPeriodNs - udFixedNs) / udUnits);
+    psPlan->ulCycleNs = (uint32_t)(udFixedNs + (udUnits * psPlan->ulUnitNs));
+    return 1;
+}
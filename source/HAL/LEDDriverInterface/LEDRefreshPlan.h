@@ -0,0 +1,81 @@
+/**
+ * @file LEDRefreshPlan.h
+ * @brief Refresh rate budget of the LED matrix scan.
+ *
+ * A scan cycle is ubScanRate * ubPlanes steps. Every step shifts one payload, pulses LE,
+ * keeps OE on for the weight of its plane and blanks before the next step:
+ *
+ *   cycle = steps * (shift + latch + blanking + slack) + ubScanRate * (2^ubPlanes - 1) * unit
+ *
+ * The planner picks the fastest LPSPI clock the panels take, then the longest OE unit
+ * that still fits the target refresh period, or reports by how much the target is missed
+ * with the shortest unit. Pure functions, no hardware dependency.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_LEDREFRESHPLAN_H_
+#define HAL_LEDDRIVERINTERFACE_LEDREFRESHPLAN_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define LED_REFRESH_PLAN_MAX_PRESCALE   7U      // LPSPI TCR PRESCALE: divide by 1..128
+#define LED_REFRESH_PLAN_MAX_SCKDIV     255U    // LPSPI CCR SCKDIV: divide by 2..257
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief LPSPI clock divider: SCK = functional clock / (2^ubPrescale * (ubSckDiv + 2)).
+ */
+typedef struct {
+    uint8_t  ubPrescale;
+    uint8_t  ubSckDiv;
+    uint32_t ulBaudRate;            // Resulting SCK frequency
+} sLEDSpiDivider_t;
+
+/**
+ * @brief Inputs of the refresh budget.
+ */
+typedef struct {
+    uint8_t  ubPanels;              // Panels in one chain
+    uint16_t usPanelColumns;        // Columns of one panel
+    uint8_t  ubRowsPerAddress;      // Rows of a panel lit by one scan address
+    uint8_t  ubScanRate;            // Scan addresses per cycle
+    uint8_t  ubPlanes;              // BCM bit-planes per address
+    uint32_t ulSpiClockHz;          // LPSPI functional clock
+    uint32_t ulMaxBaudRate;         // Fastest SCK the panels and cabling take
+    uint32_t ulMinUnitNs;           // Shortest OE time of plane 0
+    uint32_t ulLatchNs;             // LE pulse width
+    uint32_t ulBlankingNs;          // OE off time between steps (ghosting)
+    uint32_t ulStepSlackNs;         // Interrupt latency allowed per step
+    uint32_t ulTargetRefreshHz;     // Scan cycles per second (0 - as fast as possible)
+} sLEDRefreshBudget_t;
+
+/**
+ * @brief Timing chosen for a budget.
+ */
+typedef struct {
+    sLEDSpiDivider_t sDivider;
+    uint32_t ulShiftNs;             // SPI time of one payload
+    uint32_t ulStepOverheadNs;      // Shift, latch, blanking and slack of one step
+    uint32_t ulUnitNs;              // OE time of plane 0
+    uint32_t ulCycleNs;             // Busy time of a cycle at ulUnitNs
+    uint32_t ulMaxRefreshMilliHz;   // Fastest refresh, with the shortest unit
+    uint32_t ulShortfallMilliHz;    // Target minus ulMaxRefreshMilliHz (0 - target reached)
+} sLEDRefreshPlan_t;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t LEDRefreshPlan_SelectSpiDivider(uint32_t ulSpiClockHz, uint32_t ulMaxBaudRate,
+                                        sLEDSpiDivider_t *psDivider);
+
+uint8_t LEDRefreshPlan_Compute(const sLEDRefreshBudget_t *psBudget, sLEDRefreshPlan_t *psPlan);
+
+#endif /* HAL_LEDDRIVERINTERFACE_LEDREFRESHPLAN_H_ */
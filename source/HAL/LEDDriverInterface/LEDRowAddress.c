@@ -0,0 +1,74 @@
+/**
+ * @file LEDRowAddress.c
+ * @brief Row address output table for the LED matrix scan.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/LEDRowAddress.h"
+#include <stddef.h>
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Builds the port writes of every scan address.
+ *
+ * @param pulLineMasks  Port pin mask of address line A0, A1, ... (ubAddressBits entries),
+ *                      all lines on one GPIO port.
+ * @param ubAddressBits Address lines used (0..LED_ROW_ADDRESS_MAX_LINES).
+ * @param psTable       Returns 1 << ubAddressBits entries, indexed by scan address.
+ * @return 1 on success, 0 on invalid parameters.
+ */
+uint8_t LEDRowAddress_BuildTable(const uint32_t *pulLineMasks, uint8_t ubAddressBits,
+                                 sLEDRowAddressOutput_t *psTable)
+{
+    uint32_t ulAllLines = 0;
+
+    if ((psTable == NULL) || (ubAddressBits > LED_ROW_ADDRESS_MAX_LINES) ||
+        ((pulLineMasks == NULL) && (ubAddressBits != 0)))
+    {
+        return 0;
+    }
+
+    for (uint8_t ubLine = 0; ubLine < ubAddressBits; ubLine++)
+    {
+        ulAllLines |= pulLineMasks[ubLine];
+    }
+
+    for (uint32_t ulAddress = 0; ulAddress < (1UL << ubAddressBits); ulAddress++)
+    {
+        uint8_t ubGrayCode = LEDRowAddress_BinaryToGray((uint8_t)ulAddress);
+        uint32_t ulSet = 0;
+
+        for (uint8_t ubLine = 0; ubLine < ubAddressBits; ubLine++)
+        {
+            if (((ubGrayCode >> ubLine) & 0x01U) != 0U)
+            {
+                ulSet |= pulLineMasks[ubLine];
+            }
+        }
+        psTable[ulAddress].ulSet = ulSet;
+        psTable[ulAddress].ulClear = ulAllLines & ~ulSet;
+    }
+    return 1;
+}
+
+/**
+ * @brief Converts a standard binary number to its corresponding Gray code.
+ *
+ * The Gray code is used for the row select addresses to prevent transient states.
+ *
+ * @param ubBin The binary value to convert (e.g., the row index).
+ * @return The 8-bit Gray code equivalent.
+ */
+uint8_t LEDRowAddress_BinaryToGray(uint8_t ubBin)
+{
+    // Standard binary to Gray conversion: G = B ^ (B >> 1)
+    return ubBin ^ (ubBin >> 1);
+}
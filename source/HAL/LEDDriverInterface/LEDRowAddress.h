@@ -0,0 +1,45 @@
+/**
+ * @file LEDRowAddress.h
+ * @brief Row address output table for the LED matrix scan.
+ *
+ * Every scan address is precomputed as the bits to set and to clear on the GPIO port of
+ * the address lines, so selecting a row is one DR_SET and one DR_CLEAR write instead of
+ * one driver call per line. Addresses are Gray coded: consecutive addresses differ in one
+ * line, so only one of the two writes changes a pin. Up to five lines (A..E, 1/32 scan).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_LEDROWADDRESS_H_
+#define HAL_LEDDRIVERINTERFACE_LEDROWADDRESS_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define LED_ROW_ADDRESS_MAX_LINES   5U
+#define LED_ROW_ADDRESS_MAX_ENTRIES (1U << LED_ROW_ADDRESS_MAX_LINES)
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief Port writes that select one scan address.
+ */
+typedef struct {
+    uint32_t ulSet;     // Written to DR_SET
+    uint32_t ulClear;   // Written to DR_CLEAR
+} sLEDRowAddressOutput_t;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t LEDRowAddress_BuildTable(const uint32_t *pulLineMasks, uint8_t ubAddressBits,
+                                 sLEDRowAddressOutput_t *psTable);
+
+uint8_t LEDRowAddress_BinaryToGray(uint8_t ubBin);
+
+#endif /* HAL_LEDDRIVERINTERFACE_LEDROWADDRESS_H_ */
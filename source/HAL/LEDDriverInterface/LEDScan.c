@@ -0,0 +1,288 @@
+/**
+ * @file LEDScan.c
+ * @brief Interrupt-driven scan state machine for the LED matrix.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/LEDScan.h"
+#include <stddef.h>
+#include <string.h>
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static void BeginStep(sLEDScan_t *psScan);
+static void StartCycle(sLEDScan_t *psScan);
+static void ShiftStep(sLEDScan_t *psScan);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Initializes an idle scan engine.
+ *
+ * @param psScan         Engine.
+ * @param psHal          Hardware operations.
+ * @param psBcm          Initialized step sequencer.
+ * @param ptubPayloads   Payloads of channel 0, plane p and address n at [p * scan rate + n].
+ * @param ulPayloadBytes Bytes shifted per step and channel.
+ */
+void LEDScan_Init(sLEDScan_t *psScan, const sLEDScanHal_t *psHal, sLEDBcm_t *psBcm,
+                  uint8_t *const *ptubPayloads, uint32_t ulPayloadBytes)
+{
+    memset(psScan, 0, sizeof(*psScan));
+    psScan->psHal = psHal;
+    psScan->psBcm = psBcm;
+    psScan->aptubPayloads[0] = ptubPayloads;
+    psScan->ubChannels = 1;
+    psScan->ulPayloadBytes = ulPayloadBytes;
+    psScan->eState = LED_SCAN_IDLE;
+}
+
+/**
+ * @brief Sets or removes the payloads of a shift channel (scan stopped).
+ *
+ * Channels are used from 0 up to the last one with payloads; every channel shifts
+ * ulPayloadBytes per step with the same plane and address layout as channel 0.
+ *
+ * @param ubChannel    1..LED_SCAN_MAX_CHANNELS-1 (channel 0 is set by LEDScan_Init()).
+ * @param ptubPayloads Payloads, NULL to remove the channel.
+ * @return 1 on success, 0 if the channel is invalid or the scan is running.
+ */
+uint8_t LEDScan_SetChannelPayloads(sLEDScan_t *psScan, uint8_t ubChannel, uint8_t *const *ptubPayloads)
+{
+    if ((ubChannel == 0) || (ubChannel >= LED_SCAN_MAX_CHANNELS) || (psScan->eState != LED_SCAN_IDLE))
+    {
+        return 0;
+    }
+
+    psScan->aptubPayloads[ubChannel] = ptubPayloads;
+    psScan->ubChannels = 1;
+    for (uint8_t ubIndex = 1; ubIndex < LED_SCAN_MAX_CHANNELS; ubIndex++)
+    {
+        if (psScan->aptubPayloads[ubIndex] == NULL)
+        {
+            break;
+        }
+        psScan->ubChannels = ubIndex + 1U;
+    }
+    return 1;
+}
+
+/**
+ * @brief Sets the latch and blanking times and the fixed refresh period.
+ *
+ * With a period, every scan cycle starts ulCyclePeriodNs after the previous one; a cycle
+ * that takes longer is counted as an overrun and the next one starts right away.
+ */
+void LEDScan_SetTiming(sLEDScan_t *psScan, uint32_t ulLatchNs, uint32_t ulBlankingNs, uint32_t ulCyclePeriodNs)
+{
+    psScan->ulLatchNs = ulLatchNs;
+    psScan->ulBlankingNs = ulBlankingNs;
+    psScan->ulCyclePeriodNs = ulCyclePeriodNs;
+}
+
+/**
+ * @brief Registers the function called at the start of every scan cycle.
+ */
+void LEDScan_SetCycleStartCallback(sLEDScan_t *psScan, pfnLEDScanCycleStart_t pfnCycleStart)
+{
+    psScan->pfnCycleStart = pfnCycleStart;
+}
+
+/**
+ * @brief Starts the scan at the beginning of a cycle. Does nothing if running.
+ */
+void LEDScan_Start(sLEDScan_t *psScan)
+{
+    if ((psScan->eState != LED_SCAN_IDLE) || (psScan->aptubPayloads[0] == NULL))
+    {
+        return;
+    }
+
+    psScan->bStopRequested = false;
+    memset(&psScan->sStats, 0, sizeof(psScan->sStats));
+    (void)LEDBcm_SetPlanes(psScan->psBcm, psScan->psBcm->ubPlanes, psScan->psBcm->ulUnitNs);
+    BeginStep(psScan);
+}
+
+/**
+ * @brief Stops the scan immediately with the LEDs off.
+ *
+ * The caller must make sure no shift or timer event arrives afterwards (transfer aborted,
+ * timer stopped).
+ */
+void LEDScan_Stop(sLEDScan_t *psScan)
+{
+    psScan->eState = LED_SCAN_IDLE;
+    psScan->bStopRequested = false;
+    psScan->psHal->pfnSetOutputEnable(false);
+    psScan->psHal->pfnSetLatch(false);
+}
+
+/**
+ * @brief Stops the scan at the end of the current step, with the LEDs off.
+ */
+void LEDScan_RequestStop(sLEDScan_t *psScan)
+{
+    psScan->bStopRequested = true;
+}
+
+/**
+ * @brief Returns true while the scan runs.
+ */
+bool LEDScan_IsRunning(const sLEDScan_t *psScan)
+{
+    return (psScan->eState != LED_SCAN_IDLE);
+}
+
+/**
+ * @brief Shift complete event of one channel: latches the payloads after the last one.
+ */
+void LEDScan_OnShiftComplete(sLEDScan_t *psScan)
+{
+    if ((psScan->eState != LED_SCAN_SHIFTING) || (psScan->ubShiftsPending == 0))
+    {
+        psScan->sStats.ulUnexpectedEvents++;
+        return;
+    }
+
+    psScan->ubShiftsPending--;
+    if (psScan->ubShiftsPending != 0)
+    {
+        return;
+    }
+
+    psScan->psHal->pfnSetLatch(true);
+    psScan->eState = LED_SCAN_LATCHING;
+    psScan->psHal->pfnStartTimer(psScan->ulLatchNs);
+}
+
+/**
+ * @brief Timer event: ends the latch, the OE time, the blanking or the cycle wait.
+ */
+void LEDScan_OnTimerExpired(sLEDScan_t *psScan)
+{
+    const sLEDScanHal_t *psHal = psScan->psHal;
+
+    switch (psScan->eState)
+    {
+        case LED_SCAN_LATCHING:
+            psHal->pfnSetLatch(false);
+            if (psScan->sStep.ulOnTimeNs == 0)
+            {
+                // Dimmed to black: the slot stays dark
+                psScan->eState = LED_SCAN_BLANKING;
+                psHal->pfnStartTimer(psScan->ulBlankingNs + psScan->sStep.ulDarkNs);
+                break;
+            }
+            psHal->pfnSetOutputEnable(true);
+            psScan->eState = LED_SCAN_DISPLAYING;
+            psHal->pfnStartTimer(psScan->sStep.ulOnTimeNs);
+            break;
+
+        case LED_SCAN_DISPLAYING:
+            psHal->pfnSetOutputEnable(false);
+            psScan->eState = LED_SCAN_BLANKING;
+            psHal->pfnStartTimer(psScan->ulBlankingNs + psScan->sStep.ulDarkNs);
+            break;
+
+        case LED_SCAN_BLANKING:
+            if (psScan->bStopRequested)
+            {
+                LEDScan_Stop(psScan);
+                break;
+            }
+            BeginStep(psScan);
+            break;
+
+        case LED_SCAN_WAIT_CYCLE:
+            StartCycle(psScan);
+            ShiftStep(psScan);
+            break;
+
+        default:
+            psScan->sStats.ulUnexpectedEvents++;
+            break;
+    }
+}
+
+/**
+ * @brief Gets the scan statistics.
+ */
+void LEDScan_GetStatistics(const sLEDScan_t *psScan, sLEDScanStats_t *psStats)
+{
+    *psStats = psScan->sStats;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Fetches the next step; a new cycle waits for the refresh period if one is set.
+ */
+static void BeginStep(sLEDScan_t *psScan)
+{
+    LEDBcm_NextStep(psScan->psBcm, &psScan->sStep);
+
+    if (psScan->sStep.bCycleStart && (psScan->sStats.ulCycles != 0) && (psScan->ulCyclePeriodNs != 0))
+    {
+        uint32_t ulElapsed = psScan->psHal->pfnGetTimeNs() - psScan->ulCycleStartNs;
+        if (ulElapsed < psScan->ulCyclePeriodNs)
+        {
+            psScan->eState = LED_SCAN_WAIT_CYCLE;
+            psScan->psHal->pfnStartTimer(psScan->ulCyclePeriodNs - ulElapsed);
+            return;
+        }
+        psScan->sStats.ulOverruns++;
+    }
+
+    if (psScan->sStep.bCycleStart)
+    {
+        StartCycle(psScan);
+    }
+    ShiftStep(psScan);
+}
+
+/**
+ * @brief Records the cycle timing and lets the owner prepare the new cycle.
+ */
+static void StartCycle(sLEDScan_t *psScan)
+{
+    uint32_t ulNow = psScan->psHal->pfnGetTimeNs();
+
+    if (psScan->sStats.ulCycles != 0)
+    {
+        psScan->sStats.ulLastCycleNs = ulNow - psScan->ulCycleStartNs;
+    }
+    psScan->ulCycleStartNs = ulNow;
+    psScan->sStats.ulCycles++;
+
+    if (psScan->pfnCycleStart != NULL)
+    {
+        psScan->pfnCycleStart(&psScan->sStep);
+    }
+}
+
+/**
+ * @brief Selects the step's address (OE is off) and starts shifting its payload on every
+ *        channel.
+ */
+static void ShiftStep(sLEDScan_t *psScan)
+{
+    const sLEDBcmStep_t *psStep = &psScan->sStep;
+    uint32_t ulIndex = (psStep->ubPlane * psScan->psBcm->ubScanRate) + psStep->ubAddress;
+
+    psScan->psHal->pfnSelectAddress(psStep->ubAddress);
+    psScan->eState = LED_SCAN_SHIFTING;
+    // Set before the first start: a completion can arrive before the last channel starts
+    psScan->ubShiftsPending = psScan->ubChannels;
+    for (uint8_t ubChannel = 0; ubChannel < psScan->ubChannels; ubChannel++)
+    {
+        psScan->psHal->pfnStartShift(ubChannel, psScan->aptubPayloads[ubChannel][ulIndex], psScan->ulPayloadBytes);
+    }
+}
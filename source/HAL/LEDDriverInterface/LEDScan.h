@@ -0,0 +1,125 @@
+/**
+ * @file LEDScan.h
+ * @brief Interrupt-driven scan state machine for the LED matrix.
+ *
+ * Runs the BCM steps of LEDBcm from two events, "shift complete" (eDMA) and "timer
+ * expired" (one-shot timer): shift -> latch -> OE on for the plane's time -> blank (and
+ * the dimmed rest of the slot) -> next step. Nothing is polled or busy-waited. The hardware is reached only through the
+ * sLEDScanHal_t operations, so the sequence can be stepped on a host with a fake clock.
+ *
+ * Up to LED_SCAN_MAX_CHANNELS shift channels (e.g. the front and rear face of a double-sided
+ * unit) are shifted at the same time and share the latch, OE and row address; the step
+ * latches when the last channel completes, so a second channel does not lengthen the scan.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_LEDSCAN_H_
+#define HAL_LEDDRIVERINTERFACE_LEDSCAN_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include "HAL/LEDDriverInterface/LEDBcm.h"
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define LED_SCAN_MAX_CHANNELS   2U
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief Hardware operations used by the scan.
+ *
+ * Every pfnStartShift() must end with a call of LEDScan_OnShiftComplete() and pfnStartTimer()
+ * with a call of LEDScan_OnTimerExpired(); shifts of all channels or the timer are
+ * outstanding, never both. The completions of the channels must not preempt each other.
+ */
+typedef struct {
+    void     (*pfnSelectAddress)(uint8_t ubAddress);                    // Drive the row address lines
+    void     (*pfnSetLatch)(bool bActive);                              // LE level
+    void     (*pfnSetOutputEnable)(bool bEnabled);                      // OE (true - LEDs on)
+    void     (*pfnStartShift)(uint8_t ubChannel, const uint8_t *pubData, uint32_t ulBytes); // Start shifting a payload
+    void     (*pfnStartTimer)(uint32_t ulDelayNs);                      // Start the one-shot timer
+    uint32_t (*pfnGetTimeNs)(void);                                     // Free-running time, wraps at 2^32 ns
+} sLEDScanHal_t;
+
+/**
+ * @brief Called at the start of every scan cycle, before its first step is shifted.
+ *
+ * May change the plane count of the sequencer, in which case it replaces *psStep with the
+ * new first step, and may repack the payloads (no transfer is in progress).
+ */
+typedef void (*pfnLEDScanCycleStart_t)(sLEDBcmStep_t *psStep);
+
+typedef enum {
+    LED_SCAN_IDLE = 0,
+    LED_SCAN_SHIFTING,      // Payload transfers in progress
+    LED_SCAN_LATCHING,      // LE pulse
+    LED_SCAN_DISPLAYING,    // OE on for the step's BCM time
+    LED_SCAN_BLANKING,      // OE off before the next address is selected
+    LED_SCAN_WAIT_CYCLE     // Cycle done early, waiting for the fixed refresh period
+} eLEDScanState_t;
+
+/**
+ * @brief Scan statistics.
+ */
+typedef struct {
+    uint32_t ulCycles;              // Scan cycles started
+    uint32_t ulLastCycleNs;         // Duration of the last complete cycle
+    uint32_t ulOverruns;            // Cycles that took longer than the refresh period
+    uint32_t ulUnexpectedEvents;    // Events that did not match the state (ignored)
+} sLEDScanStats_t;
+
+/**
+ * @brief Scan engine.
+ */
+typedef struct {
+    const sLEDScanHal_t   *psHal;
+    sLEDBcm_t             *psBcm;           // Step sequencer
+    uint8_t *const        *aptubPayloads[LED_SCAN_MAX_CHANNELS]; // Payload of plane p, address n at [p * scan rate + n]
+    uint8_t                ubChannels;      // Shift channels in use
+    uint32_t               ulPayloadBytes;  // Per channel
+    pfnLEDScanCycleStart_t pfnCycleStart;   // Optional
+    uint32_t               ulLatchNs;       // LE pulse width
+    uint32_t               ulBlankingNs;    // OE off time after each step
+    uint32_t               ulCyclePeriodNs; // Fixed refresh period (0 - as fast as possible)
+
+    volatile eLEDScanState_t eState;
+    volatile bool          bStopRequested;
+    volatile uint8_t       ubShiftsPending; // Channels still shifting the step
+    sLEDBcmStep_t          sStep;           // Step being shifted or shown
+    uint32_t               ulCycleStartNs;
+    sLEDScanStats_t        sStats;
+} sLEDScan_t;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+void LEDScan_Init(sLEDScan_t *psScan, const sLEDScanHal_t *psHal, sLEDBcm_t *psBcm,
+                  uint8_t *const *ptubPayloads, uint32_t ulPayloadBytes);
+
+uint8_t LEDScan_SetChannelPayloads(sLEDScan_t *psScan, uint8_t ubChannel, uint8_t *const *ptubPayloads);
+
+void LEDScan_SetTiming(sLEDScan_t *psScan, uint32_t ulLatchNs, uint32_t ulBlankingNs, uint32_t ulCyclePeriodNs);
+
+void LEDScan_SetCycleStartCallback(sLEDScan_t *psScan, pfnLEDScanCycleStart_t pfnCycleStart);
+
+void LEDScan_Start(sLEDScan_t *psScan);
+
+void LEDScan_Stop(sLEDScan_t *psScan);
+
+void LEDScan_RequestStop(sLEDScan_t *psScan);
+
+bool LEDScan_IsRunning(const sLEDScan_t *psScan);
+
+void LEDScan_OnShiftComplete(sLEDScan_t *psScan);
+
+void LEDScan_OnTimerExpired(sLEDScan_t *psScan);
+
+void LEDScan_GetStatistics(const sLEDScan_t *psScan, sLEDScanStats_t *psStats);
+
+#endif /* HAL_LEDDRIVERINTERFACE_LEDSCAN_H_ */
@@ -0,0 +1,140 @@
+/**
+ * @file LEDScanChain.c
+ * @brief eDMA scatter-gather chain that scans a whole cycle without the CPU.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/LEDScanChain.h"
+#include <stddef.h>
+#include <string.h>
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static void SetTransfer(sLEDChainTcd_t *psTcd, uint32_t ulSource, int16_t swSourceStep, uint32_t ulDest,
+                        int16_t swDestStep, uint16_t usAttr, uint32_t ulMinorBytes, uint16_t usMajorCount);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Returns the number of TCDs of a chain for the given scan rate.
+ */
+uint32_t LEDChain_GetTcdCount(uint8_t ubScanRate)
+{
+    return ((uint32_t)ubScanRate * LED_CHAIN_TCDS_PER_STEP) + LED_CHAIN_TAIL_TCDS;
+}
+
+/**
+ * @brief Returns the number of 32-bit GPIO words of a chain for the given scan rate.
+ */
+uint32_t LEDChain_GetGpioWordCount(uint8_t ubScanRate)
+{
+    return (((uint32_t)ubScanRate * LED_CHAIN_GPIO_WRITES_PER_STEP) + 1U) * LED_CHAIN_WORDS_PER_GPIO_WRITE;
+}
+
+/**
+ * @brief Builds the TCD chain and the GPIO words it writes.
+ *
+ * The chain starts at psTcds[0] and links every TCD to the next through its bus address.
+ * Row addresses come from the same table as LEDRowSelect(). After the last address a
+ * tail shifts its payload once more, so the last row is lit as long as the others, and
+ * blanks the LEDs. Only the last TCD raises an interrupt; it also clears the channel
+ * request so the chain stops there until it is installed again.
+ *
+ * @param psConfig     Addresses and pins.
+ * @param psTcds       Returns LEDChain_GetTcdCount() TCDs; must be at ulTcdAddress.
+ * @param pulGpioWords Returns LEDChain_GetGpioWordCount() words; must be at ulGpioWordsAddress.
+ * @return 1 on success, 0 on invalid parameters.
+ */
+uint8_t LEDChain_Build(const sLEDChainConfig_t *psConfig, sLEDChainTcd_t *psTcds, uint32_t *pulGpioWords)
+{
+    uint32_t ulTcd = 0;
+    uint32_t ulTcdCount;
+
+    if ((psConfig == NULL) || (psTcds == NULL) || (pulGpioWords == NULL) || (psConfig->psAddressTable == NULL) ||
+        (psConfig->ubScanRate == 0) || (psConfig->ulPayloadBytes == 0) || (psConfig->ulPayloadBytes > 0x7FFFU) ||
+        ((psConfig->ulTcdAddress % LED_CHAIN_TCD_ALIGNMENT) != 0))
+    {
+        return 0;
+    }
+
+    ulTcdCount = LEDChain_GetTcdCount(psConfig->ubScanRate);
+    memset(psTcds, 0, ulTcdCount * sizeof(sLEDChainTcd_t));
+
+    for (uint8_t ubStep = 0; ubStep < psConfig->ubScanRate; ubStep++)
+    {
+        uint32_t *pulWords = &pulGpioWords[(uint32_t)ubStep * LED_CHAIN_GPIO_WRITES_PER_STEP * LED_CHAIN_WORDS_PER_GPIO_WRITE];
+        uint32_t ulWordsAddress = psConfig->ulGpioWordsAddress +
+                                  ((uint32_t)ubStep * LED_CHAIN_GPIO_WRITES_PER_STEP * LED_CHAIN_WORDS_PER_GPIO_WRITE * sizeof(uint32_t));
+        const sLEDRowAddressOutput_t *psAddress = &psConfig->psAddressTable[ubStep];
+
+        /* blank: OE off */
+        pulWords[0] = psConfig->ulOutputEnableMask;
+        pulWords[1] = 0;
+        /* select: row address, LE high */
+        pulWords[2] = psAddress->ulSet | psConfig->ulLatchMask;
+        pulWords[3] = psAddress->ulClear;
+        /* show: LE low, OE on */
+        pulWords[4] = 0;
+        pulWords[5] = psConfig->ulLatchMask | psConfig->ulOutputEnableMask;
+
+        SetTransfer(&psTcds[ulTcd++], psConfig->ulPayloadAddress + ((uint32_t)ubStep * psConfig->ulPayloadBytes), 1,
+                    psConfig->ulSpiTdrAddress, 0, LED_CHAIN_ATTR_8BIT, 1U, (uint16_t)psConfig->ulPayloadBytes);
+        SetTransfer(&psTcds[ulTcd++], psConfig->ulTcrValueAddress, 0,
+                    psConfig->ulSpiTcrAddress, 0, LED_CHAIN_ATTR_32BIT, sizeof(uint32_t), 1U);
+        for (uint32_t ulWrite = 0; ulWrite < LED_CHAIN_GPIO_WRITES_PER_STEP; ulWrite++)
+        {
+            /* DR_SET then DR_CLEAR in one minor loop */
+            SetTransfer(&psTcds[ulTcd++], ulWordsAddress + (ulWrite * LED_CHAIN_WORDS_PER_GPIO_WRITE * sizeof(uint32_t)),
+                        (int16_t)sizeof(uint32_t), psConfig->ulGpioSetAddress, (int16_t)sizeof(uint32_t),
+                        LED_CHAIN_ATTR_32BIT, LED_CHAIN_WORDS_PER_GPIO_WRITE * sizeof(uint32_t), 1U);
+        }
+    }
+
+    /* tail: hold the last row for one more shift (no latch), then OE off */
+    uint32_t ulTailWord = (uint32_t)psConfig->ubScanRate * LED_CHAIN_GPIO_WRITES_PER_STEP * LED_CHAIN_WORDS_PER_GPIO_WRITE;
+    pulGpioWords[ulTailWord] = psConfig->ulOutputEnableMask;
+    pulGpioWords[ulTailWord + 1U] = 0;
+    SetTransfer(&psTcds[ulTcd++], psConfig->ulPayloadAddress + (((uint32_t)psConfig->ubScanRate - 1U) * psConfig->ulPayloadBytes), 1,
+                psConfig->ulSpiTdrAddress, 0, LED_CHAIN_ATTR_8BIT, 1U, (uint16_t)psConfig->ulPayloadBytes);
+    SetTransfer(&psTcds[ulTcd++], psConfig->ulTcrValueAddress, 0,
+                psConfig->ulSpiTcrAddress, 0, LED_CHAIN_ATTR_32BIT, sizeof(uint32_t), 1U);
+    SetTransfer(&psTcds[ulTcd++], psConfig->ulGpioWordsAddress + (ulTailWord * sizeof(uint32_t)),
+                (int16_t)sizeof(uint32_t), psConfig->ulGpioSetAddress, (int16_t)sizeof(uint32_t),
+                LED_CHAIN_ATTR_32BIT, LED_CHAIN_WORDS_PER_GPIO_WRITE * sizeof(uint32_t), 1U);
+
+    for (ulTcd = 0; (ulTcd + 1U) < ulTcdCount; ulTcd++)
+    {
+        psTcds[ulTcd].DLAST_SGA = (int32_t)(psConfig->ulTcdAddress + ((ulTcd + 1U) * sizeof(sLEDChainTcd_t)));
+        psTcds[ulTcd].CSR = LED_CHAIN_CSR_ESG;
+    }
+    psTcds[ulTcd].DLAST_SGA = 0;
+    psTcds[ulTcd].CSR = LED_CHAIN_CSR_INTMAJOR | LED_CHAIN_CSR_DREQ;
+
+    return 1;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Fills the transfer fields of a TCD; the link fields are set by the caller.
+ */
+static void SetTransfer(sLEDChainTcd_t *psTcd, uint32_t ulSource, int16_t swSourceStep, uint32_t ulDest,
+                        int16_t swDestStep, uint16_t usAttr, uint32_t ulMinorBytes, uint16_t usMajorCount)
+{
+    psTcd->SADDR = ulSource;
+    psTcd->SOFF = swSourceStep;
+    psTcd->ATTR = usAttr;
+    psTcd->NBYTES = ulMinorBytes;
+    psTcd->SLAST = 0;
+    psTcd->DADDR = ulDest;
+    psTcd->DOFF = swDestStep;
+    psTcd->CITER = usMajorCount;
+    psTcd->BITER = usMajorCount;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file LEDScanChain.h
+ * @brief eDMA scatter-gather chain that scans a whole cycle without the CPU.
+ *
+ * Every scan address is one group of linked TCDs on the LPSPI TX channel:
+ *
+ *   payload   payload bytes -> LPSPI TDR, one byte per request
+ *   barrier   TCR rewritten: queued behind the payload, so the chain only goes on once
+ *             the last bit has left the shift register
+ *   blank     GPIO DR_SET/DR_CLEAR: OE off
+ *   select    GPIO DR_SET/DR_CLEAR: row address of this step (LEDRowAddress table), LE high
+ *   show      GPIO DR_SET/DR_CLEAR: LE low, OE on
+ *
+ * With the TX watermark at 0 the request is asserted only when the FIFO is empty, which
+ * paces the payload bytes and lets the GPIO writes run right after the barrier. Each row
+ * stays lit while the next payload shifts. A three-TCD tail keeps the last row lit for one
+ * more shift and blanks; its last TCD raises the single interrupt of the cycle and stops
+ * the channel.
+ *
+ * Building the chain is a pure function of the addresses passed in, so the TCD list can
+ * be checked on a host.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_LEDSCANCHAIN_H_
+#define HAL_LEDDRIVERINTERFACE_LEDSCANCHAIN_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+#include "HAL/LEDDriverInterface/LEDRowAddress.h"
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define LED_CHAIN_TCDS_PER_STEP         5U
+#define LED_CHAIN_TAIL_TCDS             3U      // hold payload, barrier, blank
+#define LED_CHAIN_GPIO_WRITES_PER_STEP  3U      // blank, select, show
+#define LED_CHAIN_WORDS_PER_GPIO_WRITE  2U      // DR_SET value, DR_CLEAR value
+#define LED_CHAIN_TCD_ALIGNMENT         32U     // Scatter-gather TCDs must be 32 byte aligned
+
+/* TCD ATTR transfer sizes and CSR bits (eDMA) */
+#define LED_CHAIN_ATTR_8BIT             0x0000U
+#define LED_CHAIN_ATTR_32BIT            0x0202U
+#define LED_CHAIN_CSR_INTMAJOR          0x0002U
+#define LED_CHAIN_CSR_DREQ              0x0008U
+#define LED_CHAIN_CSR_ESG               0x0010U
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief eDMA transfer control descriptor, in the hardware layout (edma_tcd_t).
+ */
+typedef struct {
+    uint32_t SADDR;
+    int16_t  SOFF;
+    uint16_t ATTR;
+    uint32_t NBYTES;
+    int32_t  SLAST;
+    uint32_t DADDR;
+    int16_t  DOFF;
+    uint16_t CITER;
+    int32_t  DLAST_SGA;
+    uint16_t CSR;
+    uint16_t BITER;
+} sLEDChainTcd_t;
+
+/**
+ * @brief Everything the chain refers to, as bus addresses.
+ */
+typedef struct {
+    uint32_t ulTcdAddress;          // Bus address of the TCD array being built
+    uint32_t ulGpioWordsAddress;    // Bus address of the GPIO word array being built
+    uint32_t ulPayloadAddress;      // Payload of scan address 0; address n follows at n * ulPayloadBytes
+    uint32_t ulPayloadBytes;        // Bytes shifted per scan address (1..32767)
+    uint8_t  ubScanRate;            // Scan addresses per cycle
+    const sLEDRowAddressOutput_t *psAddressTable; // Port writes of every scan address (LEDRowAddress_BuildTable())
+    uint32_t ulSpiTdrAddress;       // LPSPI TDR
+    uint32_t ulSpiTcrAddress;       // LPSPI TCR
+    uint32_t ulTcrValueAddress;     // Word holding the TCR value rewritten as barrier
+    uint32_t ulGpioSetAddress;      // GPIO DR_SET; DR_CLEAR is the next register
+    uint32_t ulLatchMask;           // LE pin (active high)
+    uint32_t ulOutputEnableMask;    // OE pin (active low)
+} sLEDChainConfig_t;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint32_t LEDChain_GetTcdCount(uint8_t ubScanRate);
+
+uint32_t LEDChain_GetGpioWordCount(uint8_t ubScanRate);
+
+uint8_t LEDChain_Build(const sLEDChainConfig_t *psConfig, sLEDChainTcd_t *psTcds, uint32_t *pulGpioWords);
+
+#endif /* HAL_LEDDRIVERINTERFACE_LEDSCANCHAIN_H_ */
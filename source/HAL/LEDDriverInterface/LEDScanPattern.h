@@ -0,0 +1,61 @@
+/**
+ * @file LEDScanPattern.h
+ * @brief Description of how a panel module and its chain are scanned.
+ *
+ * Shared by the LED driver, which compiles it into the packing plan, and by anything that
+ * has to know the wiring of the panels without the hardware (e.g. the panel emulator).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_LEDSCANPATTERN_H_
+#define HAL_LEDDRIVERINTERFACE_LEDSCANPATTERN_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+#include <stdbool.h>
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief Order in which the row groups of a scan address are shifted out.
+ *
+ * Row group g is panel rows [g * scan, (g + 1) * scan). Every scan address lights one row
+ * of each group; the group shifted first lands in the first slot of the payload.
+ */
+typedef enum {
+    LED_ROW_GROUPS_ASCENDING = 0,   // Group 0 first
+    LED_ROW_GROUPS_DESCENDING       // Last group first
+} eLEDRowGroupOrder_t;
+
+/**
+ * @brief Declarative description of how a panel module and its chain are scanned.
+ *
+ * Compiled by LEDDriver_ConfigurePanelPattern() into the packing plan, so a new module
+ * type is a new descriptor rather than new driver code.
+ *
+ * Panels are numbered in chain order, panel 0 receiving the first bytes shifted for a
+ * row group. With ubPanelsPerChainRow set, the frame is a grid of panels that many
+ * panels wide and the chain continues on the next row of panels at the left (or at the
+ * right when bSerpentine is set). Panels of a serpentine return row are usually mounted
+ * upside down; list them in ulRotatedPanelMask.
+ *
+ * bMirroredChain describes a chain that enters from the right as seen by the viewer, as
+ * the rear face of a back-to-back unit does when it is wired like the front face.
+ */
+typedef struct {
+    uint8_t  ubAddressBits;             // Row address lines used; scan rate is 1 << ubAddressBits (1/2 to 1/32)
+    eLEDRowGroupOrder_t eGroupOrder;    // Row group interleave in the payload
+    uint32_t ulGroupReverseMask;        // Groups addressed bottom-up: address n lights row (scan - 1 - n) of group g if bit g is set
+    uint8_t  ubZigzagBytes;             // Column zigzag: bytes of a row group shifted before the next group (0 - whole rows)
+    uint8_t  ubPanelsPerChainRow;       // Panels side by side in the frame (0 - all panels in one row)
+    bool     bSerpentine;               // Every other row of panels is chained right to left
+    uint32_t ulRotatedPanelMask;        // Panels (chain order) mounted rotated by 180 degrees
+    bool     bMirroredChain;            // Panel columns of the grid in right-to-left order
+} sLEDScanPattern_t;
+
+#endif /* HAL_LEDDRIVERINTERFACE_LEDSCANPATTERN_H_ */
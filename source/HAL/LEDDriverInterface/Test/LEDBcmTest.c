@@ -0,0 +1,200 @@
+/**
+ * @file LEDBcmTest.c
+ * @brief Table test of the binary code modulation sequencer (LEDBcm).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/Test/LEDBcmTest.h"
+#include "HAL/LEDDriverInterface/LEDBcm.h"
+#include "HAL/LEDDriverInterface/LEDBrightness.h"
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define TEST_CYCLES             3U      // Scan cycles stepped through per case
+#define TEST_MAX_SCAN_RATE      32U     // Addresses a skip mask can describe
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef struct {
+    uint8_t  ubScanRate;
+    uint8_t  ubPlanes;
+    uint32_t ulUnitNs;
+    uint32_t ulSkipMask;
+    uint32_t ulStepOverheadNs;
+    uint32_t ulRefreshMilliHz;  // Expected: 1e12 / (shown * ((2^N - 1) * unit + N * overhead))
+} sBcmCase_t;
+
+//-------------------------------------[ STATIC VARIABLE ] --------------------------//
+//
+static const sBcmCase_t asBcmCases[] = {
+    // 1/8 scan, monochrome: 8 slots of 10 us
+    { 8U,  1U, 10000U, 0x00000000UL, 0U,    12500000U },
+    // 16 gray levels, 2 us shift and latch per step
+    { 8U,  4U, 10000U, 0x00000000UL, 2000U, 791139U },
+    // 256 gray levels, 1/16 scan
+    { 16U, 8U, 1000U,  0x00000000UL, 5000U, 211864U },
+    // Top and bottom address blank
+    { 8U,  4U, 10000U, 0x00000081UL, 2000U, 1054852U },
+    // Every odd address of a 1/32 scan blank
+    { 32U, 3U, 500U,   0xAAAAAAAAUL, 1000U, 9615384U },
+    // Every address blank: address 0 is still shown
+    { 8U,  2U, 10000U, 0x000000FFUL, 0U,    33333333U },
+};
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static uint8_t CheckBcmCase(const sBcmCase_t *psCase);
+static uint8_t CheckWeights(const sLEDBcm_t *psBcm);
+static uint8_t CheckStepOrder(sLEDBcm_t *psBcm, uint32_t ulSkipMask);
+static uint8_t CheckRejections(void);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Runs the sequencer table and the rejected parameters.
+ *
+ * @return Number of failing cases (0 - all passed).
+ */
+uint8_t LEDBcmTest_Run(void)
+{
+    uint8_t ubFailures = 0;
+
+    for (uint32_t ulCase = 0; ulCase < (sizeof(asBcmCases) / sizeof(asBcmCases[0])); ulCase++)
+    {
+        ubFailures += (CheckBcmCase(&asBcmCases[ulCase]) == 0) ? 1U : 0U;
+    }
+    ubFailures += (CheckRejections() == 0) ? 1U : 0U;
+    return ubFailures;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Checks weights, step order, steps per cycle and refresh estimate of one case; 1 if it passes.
+ *
+ * The weights are checked at full duty and again at half duty, where every plane keeps
+ * its slot and its OE time is scaled.
+ */
+static uint8_t CheckBcmCase(const sBcmCase_t *psCase)
+{
+    sLEDBcm_t sBcm;
+
+    if (LEDBcm_Init(&sBcm, psCase->ubScanRate, psCase->ubPlanes, psCase->ulUnitNs) == 0)
+    {
+        return 0;
+    }
+    LEDBcm_SetSkipMask(&sBcm, psCase->ulSkipMask);
+
+    if ((CheckWeights(&sBcm) == 0) || (CheckStepOrder(&sBcm, psCase->ulSkipMask) == 0) ||
+        (LEDBcm_EstimateRefreshMilliHz(&sBcm, psCase->ulStepOverheadNs) != psCase->ulRefreshMilliHz))
+    {
+        return 0;
+    }
+
+    LEDBcm_SetDuty(&sBcm, LED_BRIGHTNESS_FULL_DUTY / 2U);
+    return ((CheckWeights(&sBcm) != 0) && (CheckStepOrder(&sBcm, psCase->ulSkipMask) != 0) &&
+            (LEDBcm_EstimateRefreshMilliHz(&sBcm, psCase->ulStepOverheadNs) == psCase->ulRefreshMilliHz)) ? 1U : 0U;
+}
+
+/**
+ * @brief Checks plane p is weighted 2^p: its OE time is its 2^p unit slot scaled by the duty; 1 if it passes.
+ *
+ * Each plane is then twice the one before, up to the rounding of the shorter one.
+ */
+static uint8_t CheckWeights(const sLEDBcm_t *psBcm)
+{
+    for (uint8_t ubPlane = 0; ubPlane < psBcm->ubPlanes; ubPlane++)
+    {
+        uint32_t ulOnNs = psBcm->aulOnTimeNs[ubPlane];
+
+        if (ulOnNs != LEDBrightness_ScaleOnTime(psBcm->ulUnitNs << ubPlane, psBcm->usDuty))
+        {
+            return 0;
+        }
+        if ((ubPlane != 0) && ((ulOnNs < (2U * psBcm->aulOnTimeNs[ubPlane - 1U])) ||
+                               (ulOnNs > ((2U * psBcm->aulOnTimeNs[ubPlane - 1U]) + 1U))))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Steps through TEST_CYCLES scan cycles and checks every step; 1 if it passes.
+ *
+ * Shown addresses come in ascending order, each with planes 0..N-1, and skipped ones
+ * never; a mask covering every address shows address 0 alone. Only the first step of a
+ * cycle is marked, and each step's OE and dark time fill its slot.
+ */
+static uint8_t CheckStepOrder(sLEDBcm_t *psBcm, uint32_t ulSkipMask)
+{
+    sLEDBcmStep_t sStep;
+    uint8_t aubShown[TEST_MAX_SCAN_RATE];
+    uint8_t ubShown = 0;
+
+    for (uint8_t ubAddress = 0; ubAddress < psBcm->ubScanRate; ubAddress++)
+    {
+        if ((ulSkipMask & (1UL << ubAddress)) == 0U)
+        {
+            aubShown[ubShown++] = ubAddress;
+        }
+    }
+    if (ubShown == 0)
+    {
+        aubShown[ubShown++] = 0;
+    }
+    if (LEDBcm_GetStepsPerCycle(psBcm) != ((uint32_t)ubShown * psBcm->ubPlanes))
+    {
+        return 0;
+    }
+
+    // Restarts the cycle, as the driver does when a frame changes the mask
+    LEDBcm_SetSkipMask(psBcm, ulSkipMask);
+    for (uint8_t ubCycle = 0; ubCycle < TEST_CYCLES; ubCycle++)
+    {
+        for (uint8_t ubIndex = 0; ubIndex < ubShown; ubIndex++)
+        {
+            for (uint8_t ubPlane = 0; ubPlane < psBcm->ubPlanes; ubPlane++)
+            {
+                LEDBcm_NextStep(psBcm, &sStep);
+                if ((sStep.ubAddress != aubShown[ubIndex]) || (sStep.ubPlane != ubPlane) ||
+                    (sStep.bCycleStart != ((ubIndex == 0) && (ubPlane == 0))) ||
+                    (sStep.ulOnTimeNs != psBcm->aulOnTimeNs[ubPlane]) ||
+                    ((sStep.ulOnTimeNs + sStep.ulDarkNs) != (psBcm->ulUnitNs << ubPlane)))
+                {
+                    return 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Checks invalid sequencer parameters are rejected, and SetPlanes leaves the sequencer as it was; 1 if it passes.
+ */
+static uint8_t CheckRejections(void)
+{
+    sLEDBcm_t sBcm;
+
+    if ((LEDBcm_Init(&sBcm, 0U, 4U, 1000U) != 0) || (LEDBcm_Init(&sBcm, 8U, 0U, 1000U) != 0) ||
+        (LEDBcm_Init(&sBcm, 8U, LED_BCM_MAX_PLANES + 1U, 1000U) != 0) || (LEDBcm_Init(&sBcm, 8U, 4U, 0U) != 0) ||
+        (LEDBcm_Init(&sBcm, 8U, 4U, 1000U) == 0))
+    {
+        return 0;
+    }
+    if ((LEDBcm_SetPlanes(&sBcm, 0U, 1000U) != 0) || (LEDBcm_SetPlanes(&sBcm, LED_BCM_MAX_PLANES + 1U, 1000U) != 0) ||
+        (LEDBcm_SetPlanes(&sBcm, 2U, 0U) != 0))
+    {
+        return 0;
+    }
+    return ((sBcm.ubPlanes == 4U) && (sBcm.ulUnitNs == 1000U)) ? 1U : 0U;
+}
@@ -0,0 +1,27 @@
+/**
+ * @file LEDBcmTest.h
+ * @brief Table test of the binary code modulation sequencer (LEDBcm).
+ *
+ * Checks the 1, 2, 4 .. 2^(N-1) OE weights of the planes, at full and reduced duty, the
+ * order of the steps in a scan cycle with and without skipped addresses, and the refresh
+ * rate the sequencer estimates for a known step overhead. No hardware dependency: runs
+ * on the host or on the target.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_TEST_LEDBCMTEST_H_
+#define HAL_LEDDRIVERINTERFACE_TEST_LEDBCMTEST_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t LEDBcmTest_Run(void);
+
+#endif /* HAL_LEDDRIVERINTERFACE_TEST_LEDBCMTEST_H_ */
@@ -0,0 +1,127 @@
+/**
+ * @file LEDBlankRowsBenchmark.c
+ * @brief Benchmark of the blank scan address detection (LEDBlankRows).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/Test/LEDBlankRowsBenchmark.h"
+#include "HAL/LEDDriverInterface/LEDBlankRows.h"
+#include <stddef.h>
+#include <string.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define BENCH_MAX_ADDRESSES     16U
+#define BENCH_MAX_BYTES         2048U   // Payloads of one plane
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef struct {
+    uint8_t  ubScanRate;
+    uint32_t ulPayloadBytes;
+} sBenchGeometry_t;
+
+//-------------------------------------[ STATIC VARIABLE ] --------------------------//
+//
+// 64-column panels: 2 and 16 panels of 16 rows at 1/8 scan, 4 panels of 32 rows at 1/16
+static const sBenchGeometry_t asGeometries[] = {
+    { 8U,  32U },
+    { 8U,  256U },
+    { 16U, 64U },
+};
+
+static uint32_t aulPayloadBlock[BENCH_MAX_BYTES / 4U];  // Word aligned, as the driver's payloads
+static uint8_t *aptubPayloads[BENCH_MAX_ADDRESSES];
+static volatile uint32_t ulSink;    // Keeps the timed detections from being optimized out
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static uint32_t FillContent(const sBenchGeometry_t *psGeometry, uint8_t ubContent);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Runs every geometry with an empty, a one-line and a full frame.
+ *
+ * @param pfnClock  Free-running clock; NULL to check the detection without timing.
+ * @param psResults Returns LED_BLANK_BENCH_CASES results.
+ * @return Number of cases whose detected mask is wrong (0 - all correct).
+ */
+uint8_t LEDBlankRowsBenchmark_Run(pfnLEDBlankBenchClock_t pfnClock, sLEDBlankBenchResult_t *psResults)
+{
+    uint8_t ubFailures = 0;
+    uint8_t ubCase = 0;
+
+    for (uint8_t ubGeometry = 0; ubGeometry < (sizeof(asGeometries) / sizeof(asGeometries[0])); ubGeometry++)
+    {
+        const sBenchGeometry_t *psGeometry = &asGeometries[ubGeometry];
+
+        for (uint8_t ubContent = 0; ubContent < 3U; ubContent++, ubCase++)
+        {
+            sLEDBlankBenchResult_t *psResult = &psResults[ubCase];
+            uint32_t ulExpectedBlank = FillContent(psGeometry, ubContent);
+            uint32_t ulBlank = LEDBlankRows_Find(aptubPayloads, psGeometry->ubScanRate, 1U, psGeometry->ulPayloadBytes);
+
+            memset(psResult, 0, sizeof(*psResult));
+            psResult->ubScanRate = psGeometry->ubScanRate;
+            psResult->ulPayloadBytes = psGeometry->ulPayloadBytes;
+            for (uint8_t ubAddress = 0; ubAddress < psGeometry->ubScanRate; ubAddress++)
+            {
+                psResult->ubLitAddresses += ((ulExpectedBlank & (1UL << ubAddress)) == 0U) ? 1U : 0U;
+            }
+            psResult->ubShown = LEDBlankRows_CountShown(ulBlank, psGeometry->ubScanRate);
+            psResult->ubCorrect = (ulBlank == ulExpectedBlank) ? 1U : 0U;
+            psResult->ulRefreshGainX100 = ((uint32_t)psGeometry->ubScanRate * 100U) / psResult->ubShown;
+            ubFailures += (psResult->ubCorrect == 0U) ? 1U : 0U;
+
+            if (pfnClock != NULL)
+            {
+                uint32_t ulStart = pfnClock();
+                for (uint32_t ulIteration = 0; ulIteration < LED_BLANK_BENCH_ITERATIONS; ulIteration++)
+                {
+                    ulSink = LEDBlankRows_Find(aptubPayloads, psGeometry->ubScanRate, 1U, psGeometry->ulPayloadBytes);
+                }
+                psResult->ulTicksPerFind = (pfnClock() - ulStart) / LED_BLANK_BENCH_ITERATIONS;
+            }
+        }
+    }
+    return ubFailures;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Fills the payloads of one plane with a content and returns its blank mask.
+ *
+ * 0 - empty frame, 1 - one line of text (one address, lit at the end of its payload so
+ * the whole of it is read), 2 - full frame.
+ */
+static uint32_t FillContent(const sBenchGeometry_t *psGeometry, uint8_t ubContent)
+{
+    uint32_t ulAllBlank = (1UL << psGeometry->ubScanRate) - 1U;
+
+    memset(aulPayloadBlock, 0, sizeof(aulPayloadBlock));
+    for (uint8_t ubAddress = 0; ubAddress < psGeometry->ubScanRate; ubAddress++)
+    {
+        aptubPayloads[ubAddress] = (uint8_t *)aulPayloadBlock + (ubAddress * psGeometry->ulPayloadBytes);
+    }
+
+    if (ubContent == 1U)
+    {
+        aptubPayloads[2][psGeometry->ulPayloadBytes - 1U] = 0x18U;
+        return ulAllBlank & ~(1UL << 2);
+    }
+    if (ubContent == 2U)
+    {
+        memset(aulPayloadBlock, 0x5A, (size_t)psGeometry->ubScanRate * psGeometry->ulPayloadBytes);
+        return 0;
+    }
+    return ulAllBlank;
+}
@@ -0,0 +1,51 @@
+/**
+ * @file LEDBlankRowsBenchmark.h
+ * @brief Benchmark of the blank scan address detection (LEDBlankRows).
+ *
+ * Times LEDBlankRows_Find() on payloads of an empty, a one-line and a full frame for a
+ * few geometries, and gives the addresses shown and the refresh gain of each. The clock
+ * is passed in, so it runs on the host or on the target (DWT cycle counter).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_TEST_LEDBLANKROWSBENCHMARK_H_
+#define HAL_LEDDRIVERINTERFACE_TEST_LEDBLANKROWSBENCHMARK_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define LED_BLANK_BENCH_ITERATIONS  256U    // Detections timed per case
+#define LED_BLANK_BENCH_CASES       9U      // Geometries * contents
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief Free-running clock of the platform (cycles, ns, ...).
+ */
+typedef uint32_t (*pfnLEDBlankBenchClock_t)(void);
+
+/**
+ * @brief Result of one case.
+ */
+typedef struct {
+    uint8_t  ubScanRate;
+    uint32_t ulPayloadBytes;
+    uint8_t  ubLitAddresses;        // Addresses the content lights
+    uint8_t  ubShown;               // Addresses left after detection
+    uint8_t  ubCorrect;             // Detected mask matches the content
+    uint32_t ulTicksPerFind;        // Mean clock ticks of one LEDBlankRows_Find()
+    uint32_t ulRefreshGainX100;     // Refresh rate gain at constant brightness * 100
+} sLEDBlankBenchResult_t;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t LEDBlankRowsBenchmark_Run(pfnLEDBlankBenchClock_t pfnClock, sLEDBlankBenchResult_t *psResults);
+
+#endif /* HAL_LEDDRIVERINTERFACE_TEST_LEDBLANKROWSBENCHMARK_H_ */
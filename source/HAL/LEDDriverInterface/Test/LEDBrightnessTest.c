@@ -0,0 +1,201 @@
+/**
+ * @file LEDBrightnessTest.c
+ * @brief Table test of the gamma-corrected brightness (LEDBrightness).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/Test/LEDBrightnessTest.h"
+#include "HAL/LEDDriverInterface/LEDBrightness.h"
+#include "HAL/LEDDriverInterface/LEDBcm.h"
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+// Sequencer the duty is applied to: 16 gray levels, 10 us unit, 1/8 scan
+#define TEST_SCAN_RATE          8U
+#define TEST_PLANES             4U
+#define TEST_UNIT_NS            10000UL
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef struct {
+    uint16_t usGammaX100;
+    uint8_t  ubLowLimit;    // LED intensity limits of the INIT request
+    uint8_t  ubHighLimit;
+} sBrightnessCase_t;
+
+//-------------------------------------[ STATIC VARIABLE ] --------------------------//
+//
+static const sBrightnessCase_t asBrightnessCases[] = {
+    { LED_BRIGHTNESS_MIN_GAMMA_X100,     0U,   255U },  // Linear, no limits
+    { 180U,                              0U,   255U },
+    { LED_BRIGHTNESS_DEFAULT_GAMMA_X100, 0U,   255U },
+    { LED_BRIGHTNESS_DEFAULT_GAMMA_X100, 20U,  200U },  // Typical INIT limits
+    { 280U,                              1U,   254U },
+    { LED_BRIGHTNESS_MAX_GAMMA_X100,     64U,  128U },
+    { LED_BRIGHTNESS_MAX_GAMMA_X100,     0U,   1U },    // Darkest levels: rounding of powf
+    { LED_BRIGHTNESS_DEFAULT_GAMMA_X100, 100U, 100U },  // Fixed level
+};
+
+// Gammas SetGamma must reject, leaving the LUT as it was
+static const uint16_t ausRejectedGammasX100[] = {
+    0U, LED_BRIGHTNESS_MIN_GAMMA_X100 - 1U, LED_BRIGHTNESS_MAX_GAMMA_X100 + 1U,
+};
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static uint8_t CheckLut(const sLEDBrightness_t *psBrightness);
+static uint8_t CheckBrightnessCase(const sBrightnessCase_t *psCase);
+static uint8_t CheckRejections(void);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Runs the brightness table and the rejected parameters.
+ *
+ * @return Number of failing cases (0 - all passed).
+ */
+uint8_t LEDBrightnessTest_Run(void)
+{
+    uint8_t ubFailures = 0;
+
+    for (uint32_t ulCase = 0; ulCase < (sizeof(asBrightnessCases) / sizeof(asBrightnessCases[0])); ulCase++)
+    {
+        ubFailures += (CheckBrightnessCase(&asBrightnessCases[ulCase]) == 0) ? 1U : 0U;
+    }
+    ubFailures += (CheckRejections() == 0) ? 1U : 0U;
+    return ubFailures;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Checks the LUT: level 0 dark, every other level lit, non-decreasing, level 255 full; 1 if it passes.
+ *
+ * Steep gammas give the darkest levels the same smallest duty, so equal neighbours are allowed.
+ */
+static uint8_t CheckLut(const sLEDBrightness_t *psBrightness)
+{
+    if ((psBrightness->ausDutyLut[0] != 0U) ||
+        (psBrightness->ausDutyLut[LED_BRIGHTNESS_MAX_LEVEL] != LED_BRIGHTNESS_FULL_DUTY))
+    {
+        return 0;
+    }
+    for (uint16_t usLevel = 1; usLevel < LED_BRIGHTNESS_LEVELS; usLevel++)
+    {
+        if ((psBrightness->ausDutyLut[usLevel] == 0U) ||
+            (psBrightness->ausDutyLut[usLevel] < psBrightness->ausDutyLut[usLevel - 1U]))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Sweeps every requested level through the limits and the BCM OE times; 1 if it passes.
+ *
+ * The shown level is the request clamped to the limits, so it and every plane's OE time
+ * rise with the request and are flat outside the limits. No OE time exceeds its slot.
+ */
+static uint8_t CheckBrightnessCase(const sBrightnessCase_t *psCase)
+{
+    sLEDBrightness_t sBrightness;
+    sLEDBcm_t sBcm;
+    uint32_t aulPreviousOnNs[TEST_PLANES] = { 0 };
+    uint8_t ubPreviousLevel = 0;
+
+    LEDBrightness_Init(&sBrightness);
+    if ((LEDBrightness_SetGamma(&sBrightness, psCase->usGammaX100) == 0) ||
+        (sBrightness.usGammaX100 != psCase->usGammaX100) || (CheckLut(&sBrightness) == 0) ||
+        (LEDBrightness_SetLimits(&sBrightness, psCase->ubLowLimit, psCase->ubHighLimit) == 0) ||
+        (LEDBcm_Init(&sBcm, TEST_SCAN_RATE, TEST_PLANES, TEST_UNIT_NS) == 0))
+    {
+        return 0;
+    }
+
+    for (uint16_t usTarget = 0; usTarget < LED_BRIGHTNESS_LEVELS; usTarget++)
+    {
+        LEDBrightness_SetTarget(&sBrightness, (uint8_t)usTarget);
+        uint8_t ubLevel = LEDBrightness_GetLevel(&sBrightness);
+        uint16_t usDuty = LEDBrightness_GetDuty(&sBrightness);
+        uint8_t ubExpected = (uint8_t)usTarget;
+
+        if (ubExpected < psCase->ubLowLimit)
+        {
+            ubExpected = psCase->ubLowLimit;
+        }
+        if (ubExpected > psCase->ubHighLimit)
+        {
+            ubExpected = psCase->ubHighLimit;
+        }
+        if ((ubLevel != ubExpected) || (usDuty != sBrightness.ausDutyLut[ubLevel]) ||
+            ((usTarget != 0U) && (ubLevel < ubPreviousLevel)))
+        {
+            return 0;
+        }
+
+        LEDBcm_SetDuty(&sBcm, usDuty);
+        for (uint8_t ubPlane = 0; ubPlane < TEST_PLANES; ubPlane++)
+        {
+            uint32_t ulSlotNs = TEST_UNIT_NS << ubPlane;
+            uint32_t ulOnNs = sBcm.aulOnTimeNs[ubPlane];
+
+            // Rising with the request, flat where the limits clamp it
+            if ((ulOnNs > ulSlotNs) || ((usTarget != 0U) && (ulOnNs < aulPreviousOnNs[ubPlane])) ||
+                ((usTarget != 0U) && (ubLevel == ubPreviousLevel) && (ulOnNs != aulPreviousOnNs[ubPlane])))
+            {
+                return 0;
+            }
+            // Full duty fills the slot; the clamp bounds the OE time by the limits' duties
+            if (((usDuty == LED_BRIGHTNESS_FULL_DUTY) && (ulOnNs != ulSlotNs)) ||
+                (ulOnNs < LEDBrightness_ScaleOnTime(ulSlotNs, sBrightness.ausDutyLut[psCase->ubLowLimit])) ||
+                (ulOnNs > LEDBrightness_ScaleOnTime(ulSlotNs, sBrightness.ausDutyLut[psCase->ubHighLimit])))
+            {
+                return 0;
+            }
+            aulPreviousOnNs[ubPlane] = ulOnNs;
+        }
+        ubPreviousLevel = ubLevel;
+    }
+    return 1;
+}
+
+/**
+ * @brief Checks out-of-range gammas and inverted limits are rejected without effect; 1 if it passes.
+ */
+static uint8_t CheckRejections(void)
+{
+    sLEDBrightness_t sBrightness;
+    sLEDBrightness_t sBefore;
+
+    LEDBrightness_Init(&sBrightness);
+    sBefore = sBrightness;
+    for (uint32_t ulGamma = 0; ulGamma < (sizeof(ausRejectedGammasX100) / sizeof(ausRejectedGammasX100[0])); ulGamma++)
+    {
+        if (LEDBrightness_SetGamma(&sBrightness, ausRejectedGammasX100[ulGamma]) != 0)
+        {
+            return 0;
+        }
+    }
+    if (LEDBrightness_SetLimits(&sBrightness, 200U, 100U) != 0)
+    {
+        return 0;
+    }
+
+    for (uint16_t usLevel = 0; usLevel < LED_BRIGHTNESS_LEVELS; usLevel++)
+    {
+        if (sBrightness.ausDutyLut[usLevel] != sBefore.ausDutyLut[usLevel])
+        {
+            return 0;
+        }
+    }
+    return ((sBrightness.usGammaX100 == sBefore.usGammaX100) && (sBrightness.ubLowLimit == sBefore.ubLowLimit) &&
+            (sBrightness.ubHighLimit == sBefore.ubHighLimit)) ? 1U : 0U;
+}
@@ -0,0 +1,26 @@
+/**
+ * @file LEDBrightnessTest.h
+ * @brief Table test of the gamma-corrected brightness (LEDBrightness).
+ *
+ * Builds the duty LUT for several gammas and checks it, and the OE times the BCM
+ * sequencer derives from it, rise with the level and stay within the INIT limits. No
+ * hardware dependency: runs on the host or on the target.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_TEST_LEDBRIGHTNESSTEST_H_
+#define HAL_LEDDRIVERINTERFACE_TEST_LEDBRIGHTNESSTEST_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t LEDBrightnessTest_Run(void);
+
+#endif /* HAL_LEDDRIVERINTERFACE_TEST_LEDBRIGHTNESSTEST_H_ */
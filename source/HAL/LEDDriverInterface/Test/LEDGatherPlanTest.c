@@ -0,0 +1,306 @@
+/**
+ * @file LEDGatherPlanTest.c
+ * @brief Golden payload test of the LED driver's packing plan (gather table).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/Test/LEDGatherPlanTest.h"
+#include "HAL/LEDDriverInterface/LEDDriver.h"
+#include <string.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define TEST_MAX_ROWS           16U     // Frame byte (r, c) holds (r << 4) | c
+#define TEST_MAX_ROW_BYTES      16U
+#define TEST_PLANES             2U
+#define TEST_DIRTY_ROW          3U
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief Wiring on top of the default scan pattern.
+ */
+typedef struct {
+    uint8_t  ubZigzagBytes;
+    uint8_t  ubPanelsPerChainRow;
+    bool     bSerpentine;
+    uint32_t ulRotatedPanelMask;
+} sGatherWiring_t;
+
+typedef struct {
+    uint8_t  ubPanels;
+    uint16_t usPanelRows;
+    uint16_t usPanelColumns;
+    uint8_t  ubAddressBits;
+    sGatherWiring_t sWiring;
+    uint16_t usCopies;          // Gather entries: copies to pack one frame
+    const uint8_t *pubGolden;   // Payloads of every scan address, address 0 first
+} sGatherCase_t;
+
+//-------------------------------------[ STATIC VARIABLE ] --------------------------//
+//
+// Two 16x16 panels, 1/8 scan, default pattern: slot 0 is row n + 8, slot 1 row 7 - n,
+// each across both panels
+static const uint8_t aubDefaultGolden[] = {
+    0x80, 0x81, 0x82, 0x83, 0x70, 0x71, 0x72, 0x73,
+    0x90, 0x91, 0x92, 0x93, 0x60, 0x61, 0x62, 0x63,
+    0xA0, 0xA1, 0xA2, 0xA3, 0x50, 0x51, 0x52, 0x53,
+    0xB0, 0xB1, 0xB2, 0xB3, 0x40, 0x41, 0x42, 0x43,
+    0xC0, 0xC1, 0xC2, 0xC3, 0x30, 0x31, 0x32, 0x33,
+    0xD0, 0xD1, 0xD2, 0xD3, 0x20, 0x21, 0x22, 0x23,
+    0xE0, 0xE1, 0xE2, 0xE3, 0x10, 0x11, 0x12, 0x13,
+    0xF0, 0xF1, 0xF2, 0xF3, 0x00, 0x01, 0x02, 0x03,
+};
+
+// Two 16x8 panels, 1/4 scan, zigzag of one byte: per panel, column byte after column
+// byte, slot 0 (row n + 4) then slot 1 (row 3 - n)
+static const uint8_t aubZigzagGolden[] = {
+    0x40, 0x30, 0x41, 0x31, 0x42, 0x32, 0x43, 0x33,
+    0x50, 0x20, 0x51, 0x21, 0x52, 0x22, 0x53, 0x23,
+    0x60, 0x10, 0x61, 0x11, 0x62, 0x12, 0x63, 0x13,
+    0x70, 0x00, 0x71, 0x01, 0x72, 0x02, 0x73, 0x03,
+};
+
+// Two 16x8 panels, 1/4 scan, panel 1 rotated: it sends frame row 7 - r for panel row r,
+// its bytes last first and bit-mirrored (0x33 -> 0xCC)
+static const uint8_t aubRotatedGolden[] = {
+    0x40, 0x41, 0xCC, 0x4C, 0x30, 0x31, 0xC2, 0x42,
+    0x50, 0x51, 0xC4, 0x44, 0x20, 0x21, 0xCA, 0x4A,
+    0x60, 0x61, 0xC8, 0x48, 0x10, 0x11, 0xC6, 0x46,
+    0x70, 0x71, 0xC0, 0x40, 0x00, 0x01, 0xCE, 0x4E,
+};
+
+// Two 16x8 panels stacked, one per chain row: panel 1 sends frame rows 8 to 15
+static const uint8_t aubStackedGolden[] = {
+    0x40, 0x41, 0xC0, 0xC1, 0x30, 0x31, 0xB0, 0xB1,
+    0x50, 0x51, 0xD0, 0xD1, 0x20, 0x21, 0xA0, 0xA1,
+    0x60, 0x61, 0xE0, 0xE1, 0x10, 0x11, 0x90, 0x91,
+    0x70, 0x71, 0xF0, 0xF1, 0x00, 0x01, 0x80, 0x81,
+};
+
+// 2x2 grid of 16x4 panels, 1/2 scan, serpentine: the chain returns along the second
+// chain row right to left (panel 2 at column bytes 2-3), whose panels are rotated
+static const uint8_t aubSerpentineGolden[] = {
+    0x20, 0x21, 0x22, 0x23, 0xCA, 0x4A, 0x8A, 0x0A, 0x10, 0x11, 0x12, 0x13, 0xC6, 0x46, 0x86, 0x06,
+    0x30, 0x31, 0x32, 0x33, 0xC2, 0x42, 0x82, 0x02, 0x00, 0x01, 0x02, 0x03, 0xCE, 0x4E, 0x8E, 0x0E,
+};
+
+static const sGatherCase_t asGatherCases[] = {
+    // Default pattern, two panels merged into one copy per slot
+    { 2U, 16U, 16U, 3U, { 0U, 0U, false, 0x0U }, 16U, aubDefaultGolden },
+    // Zigzag: one copy per byte
+    { 2U, 8U,  16U, 2U, { 1U, 0U, false, 0x0U }, 32U, aubZigzagGolden },
+    // Rotated panel: one copy per panel and slot, the rotated one is not merged
+    { 2U, 8U,  16U, 2U, { 0U, 0U, false, 0x2U }, 16U, aubRotatedGolden },
+    // Multi-row chain: one copy per panel and slot
+    { 2U, 8U,  16U, 2U, { 0U, 1U, false, 0x0U }, 16U, aubStackedGolden },
+    // Serpentine grid: the first chain row merges, the rotated return row does not
+    { 4U, 4U,  16U, 1U, { 0U, 2U, true,  0xCU }, 12U, aubSerpentineGolden },
+};
+
+static uint8_t aaubFrame[TEST_MAX_ROWS][TEST_MAX_ROW_BYTES];
+static uint8_t *aptubFrame[TEST_MAX_ROWS];
+static uint8_t aaubPlanes[TEST_PLANES][TEST_MAX_ROWS * TEST_MAX_ROW_BYTES];
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static uint8_t CheckGatherCase(const sGatherCase_t *psCase);
+static uint8_t CheckDirtyRepack(void);
+static uint8_t Configure(const sGatherCase_t *psCase, uint16_t *pusRows, uint16_t *pusRowBytes);
+static void FillFrame(uint16_t usRows, uint16_t usRowBytes);
+static uint8_t CheckPayloads(const uint8_t *pubGolden, uint8_t ubAddressBits, uint8_t ubPlane, uint8_t ubInvert);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Runs the golden payload table and the dirty row repack.
+ *
+ * @return Number of failing cases (0 - all passed).
+ */
+uint8_t LEDGatherPlanTest_Run(void)
+{
+    uint8_t ubFailures = 0;
+
+    for (uint32_t ulCase = 0; ulCase < (sizeof(asGatherCases) / sizeof(asGatherCases[0])); ulCase++)
+    {
+        ubFailures += (CheckGatherCase(&asGatherCases[ulCase]) == 0) ? 1U : 0U;
+    }
+    ubFailures += (CheckDirtyRepack() == 0) ? 1U : 0U;
+
+    LEDDriver_ReleasePanel();
+    (void)LEDDriver_SetBitPlanes(1U, LED_BCM_DEFAULT_UNIT_NS);
+    return ubFailures;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Packs the test frame of one case as a frame and as bit-planes and compares the
+ *        payloads with the golden ones; 1 if they match.
+ *
+ * A 1bpp frame is shown on every plane. As bit-planes, plane 0 is the frame and plane 1
+ * its inverse, which rotated panels mirror alike.
+ */
+static uint8_t CheckGatherCase(const sGatherCase_t *psCase)
+{
+    sLEDBitPlaneSet_t sPlanes;
+    sLEDPackStats_t sStats;
+    uint16_t usRows, usRowBytes;
+
+    if (Configure(psCase, &usRows, &usRowBytes) == 0)
+    {
+        return 0;
+    }
+
+    FillFrame(usRows, usRowBytes);
+    LEDDriver_PrepareDisplayBuffer(aptubFrame, NULL);
+    LEDDriver_GetPackStatistics(&sStats);
+    if ((sStats.usRowsPacked != psCase->usCopies) || (sStats.usRowsSkipped != 0) ||
+        (CheckPayloads(psCase->pubGolden, psCase->ubAddressBits, 0U, 0U) == 0) ||
+        (CheckPayloads(psCase->pubGolden, psCase->ubAddressBits, 1U, 0U) == 0))
+    {
+        return 0;
+    }
+
+    memset(&sPlanes, 0, sizeof(sPlanes));
+    for (uint16_t usRow = 0; usRow < usRows; usRow++)
+    {
+        for (uint16_t usByte = 0; usByte < usRowBytes; usByte++)
+        {
+            aaubPlanes[0][(usRow * usRowBytes) + usByte] = aaubFrame[usRow][usByte];
+            aaubPlanes[1][(usRow * usRowBytes) + usByte] = (uint8_t)~aaubFrame[usRow][usByte];
+        }
+    }
+    sPlanes.apubPlanes[0] = aaubPlanes[0];
+    sPlanes.apubPlanes[1] = aaubPlanes[1];
+    sPlanes.ubPlanes = TEST_PLANES;
+    sPlanes.usStride = usRowBytes;
+    LEDDriver_PrepareBitPlanes(&sPlanes, NULL);
+    LEDDriver_GetPackStatistics(&sStats);
+
+    return ((sStats.usRowsPacked == (TEST_PLANES * psCase->usCopies)) && (sStats.ulStreamedFrames == 0) &&
+            (CheckPayloads(psCase->pubGolden, psCase->ubAddressBits, 0U, 0U) != 0) &&
+            (CheckPayloads(psCase->pubGolden, psCase->ubAddressBits, 1U, 1U) != 0)) ? 1U : 0U;
+}
+
+/**
+ * @brief Inverts one row of the default case's frame and repacks it alone; 1 if only its
+ *        bytes changed in the payloads.
+ */
+static uint8_t CheckDirtyRepack(void)
+{
+    const sGatherCase_t *psCase = &asGatherCases[0];
+    uint32_t aulDirtyRows[(TEST_MAX_ROWS + 31U) / 32U] = { 1UL << TEST_DIRTY_ROW };
+    uint8_t aubGolden[sizeof(aubDefaultGolden)];
+    sLEDPackStats_t sStats;
+    uint16_t usRows, usRowBytes;
+
+    if (Configure(psCase, &usRows, &usRowBytes) == 0)
+    {
+        return 0;
+    }
+    FillFrame(usRows, usRowBytes);
+    LEDDriver_PrepareDisplayBuffer(aptubFrame, NULL);
+
+    for (uint32_t ulByte = 0; ulByte < sizeof(aubGolden); ulByte++)
+    {
+        uint8_t ubGolden = psCase->pubGolden[ulByte];
+        aubGolden[ulByte] = ((ubGolden >> 4) == TEST_DIRTY_ROW) ? (uint8_t)~ubGolden : ubGolden;
+    }
+    for (uint16_t usRow = 0; usRow < usRows; usRow++)
+    {
+        for (uint16_t usByte = 0; usByte < usRowBytes; usByte++)
+        {
+            aaubFrame[usRow][usByte] = (uint8_t)~aaubFrame[usRow][usByte];
+        }
+    }
+
+    // Only the dirty row is copied, the other inverted rows stay as packed before
+    LEDDriver_PrepareDisplayBuffer(aptubFrame, aulDirtyRows);
+    LEDDriver_GetPackStatistics(&sStats);
+    return ((sStats.usRowsPacked == 1U) && (sStats.usRowsSkipped == (psCase->usCopies - 1U)) &&
+            (CheckPayloads(aubGolden, psCase->ubAddressBits, 0U, 0U) != 0)) ? 1U : 0U;
+}
+
+/**
+ * @brief Configures the driver for a case with TEST_PLANES planes; 1 on success.
+ *
+ * @param pusRows     Returns the frame rows.
+ * @param pusRowBytes Returns the bytes of a frame row.
+ */
+static uint8_t Configure(const sGatherCase_t *psCase, uint16_t *pusRows, uint16_t *pusRowBytes)
+{
+    sLEDScanPattern_t sPattern;
+    uint8_t ubAcross = (psCase->sWiring.ubPanelsPerChainRow != 0) ? psCase->sWiring.ubPanelsPerChainRow :
+                                                                    psCase->ubPanels;
+
+    LEDDriver_GetDefaultScanPattern(&sPattern, psCase->ubAddressBits);
+    sPattern.ubZigzagBytes = psCase->sWiring.ubZigzagBytes;
+    sPattern.ubPanelsPerChainRow = psCase->sWiring.ubPanelsPerChainRow;
+    sPattern.bSerpentine = psCase->sWiring.bSerpentine;
+    sPattern.ulRotatedPanelMask = psCase->sWiring.ulRotatedPanelMask;
+
+    *pusRows = (uint16_t)((psCase->ubPanels / ubAcross) * psCase->usPanelRows);
+    *pusRowBytes = (uint16_t)((ubAcross * psCase->usPanelColumns) / 8U);
+    if ((*pusRows > TEST_MAX_ROWS) || (*pusRowBytes > TEST_MAX_ROW_BYTES))
+    {
+        return 0;
+    }
+
+    LEDDriver_ReleasePanel();
+    return ((LEDDriver_SetBitPlanes(TEST_PLANES, LED_BCM_DEFAULT_UNIT_NS) != 0) &&
+            (LEDDriver_ConfigurePanelPattern(psCase->usPanelRows, psCase->usPanelColumns, 0U, 0U, psCase->ubPanels,
+                                             &sPattern) != 0)) ? 1U : 0U;
+}
+
+/**
+ * @brief Fills the test frame: byte c of row r is (r << 4) | c.
+ */
+static void FillFrame(uint16_t usRows, uint16_t usRowBytes)
+{
+    for (uint16_t usRow = 0; usRow < usRows; usRow++)
+    {
+        aptubFrame[usRow] = aaubFrame[usRow];
+        for (uint16_t usByte = 0; usByte < usRowBytes; usByte++)
+        {
+            aaubFrame[usRow][usByte] = (uint8_t)((usRow << 4) | usByte);
+        }
+    }
+}
+
+/**
+ * @brief Compares the payloads of one plane with golden payloads, inverted if ubInvert
+ *        is set; 1 if they match.
+ */
+static uint8_t CheckPayloads(const uint8_t *pubGolden, uint8_t ubAddressBits, uint8_t ubPlane, uint8_t ubInvert)
+{
+    uint16_t usScanRate = (uint16_t)(1U << ubAddressBits);
+    uint32_t ulPayloadBytes = 0;
+    uint8_t *const *ptubPayloads = LEDDriver_GetScanPayloads(0U, &ulPayloadBytes);
+
+    if ((ptubPayloads == NULL) || (ubPlane >= TEST_PLANES))
+    {
+        return 0;
+    }
+
+    for (uint16_t usAddress = 0; usAddress < usScanRate; usAddress++)
+    {
+        const uint8_t *pubPayload = ptubPayloads[(ubPlane * usScanRate) + usAddress];
+        for (uint32_t ulByte = 0; ulByte < ulPayloadBytes; ulByte++)
+        {
+            uint8_t ubGolden = pubGolden[(usAddress * ulPayloadBytes) + ulByte];
+            if (pubPayload[ulByte] != (ubInvert ? (uint8_t)~ubGolden : ubGolden))
+            {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
@@ -0,0 +1,30 @@
+/**
+ * @file LEDGatherPlanTest.h
+ * @brief Golden payload test of the LED driver's packing plan (gather table).
+ *
+ * Configures the driver for small geometries and scan patterns (default, zigzag, a
+ * rotated panel, a multi-row chain and a serpentine grid), packs a frame whose every
+ * byte tells its row and column, and compares the payloads of every scan address
+ * with hand-written golden payloads: as a 1bpp frame (all planes alike) and as two
+ * bit-planes. Also checks the copies per frame and that a frame with one dirty row
+ * repacks that row only. Needs the memory manager initialized; leaves the LED driver
+ * unconfigured. Runs on the host or on the target.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_TEST_LEDGATHERPLANTEST_H_
+#define HAL_LEDDRIVERINTERFACE_TEST_LEDGATHERPLANTEST_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t LEDGatherPlanTest_Run(void);
+
+#endif /* HAL_LEDDRIVERINTERFACE_TEST_LEDGATHERPLANTEST_H_ */
@@ -0,0 +1,745 @@
+/**
+ * @file LEDPanelEmulator.c
+ * @brief Host emulator of the LED panels driven by LEDDriver.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/Test/LEDPanelEmulator.h"
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+
+//-------------------------------------[ STATIC VARIABLE ] --------------------------//
+//
+// Emulator behind the scan HAL (the HAL operations carry no context)
+static sLEDPanelEmulator_t *psActiveEmu = NULL;
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static uint8_t IsConfigValid(const sLEDEmuConfig_t *psConfig);
+static uint8_t GetPanelsAcross(const sLEDEmuConfig_t *psConfig, const sLEDScanPattern_t *psPattern);
+static uint8_t GetCurrentAddress(const sLEDPanelEmulator_t *psEmu);
+static void OnPortChange(sLEDPanelEmulator_t *psEmu, uint32_t ulPrevious);
+static void Latch(sLEDPanelEmulator_t *psEmu);
+static void OnOutputEnabled(sLEDPanelEmulator_t *psEmu);
+static void LightPixels(sLEDPanelEmulator_t *psEmu, uint8_t ubChannel, uint8_t ubAddress, uint32_t ulNs);
+static uint32_t MapPayloadBit(const sLEDPanelEmulator_t *psEmu, uint8_t ubChannel, uint8_t ubAddress,
+                              uint32_t ulByte, uint8_t ubBit);
+static uint8_t GetPixelLevel(const sLEDPanelEmulator_t *psEmu, uint8_t ubChannel, uint32_t ulPixel);
+static void AdvanceTo(sLEDPanelEmulator_t *psEmu, uint64_t udTimeNs);
+static uint8_t RunScanUntil(sLEDPanelEmulator_t *psEmu, sLEDScan_t *psScan, uint32_t ulCycles);
+static const void *BusMap(const sLEDEmuBus_t *psBus, uint32_t ulAddress, uint32_t ulBytes);
+static uint8_t BusWrite(sLEDPanelEmulator_t *psEmu, const sLEDEmuBus_t *psBus, uint32_t ulAddress, uint32_t ulValue);
+static void EmuSelectAddress(uint8_t ubAddress);
+static void EmuSetLatch(bool bActive);
+static void EmuSetOutputEnable(bool bEnabled);
+static void EmuStartShift(uint8_t ubChannel, const uint8_t *pubData, uint32_t ulBytes);
+static void EmuStartTimer(uint32_t ulDelayNs);
+static uint32_t EmuGetTimeNs(void);
+
+static const sLEDScanHal_t sEmuScanHal = {
+    .pfnSelectAddress   = EmuSelectAddress,
+    .pfnSetLatch        = EmuSetLatch,
+    .pfnSetOutputEnable = EmuSetOutputEnable,
+    .pfnStartShift      = EmuStartShift,
+    .pfnStartTimer      = EmuStartTimer,
+    .pfnGetTimeNs       = EmuGetTimeNs,
+};
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Returns the size of the time buffer LEDEmu_Init() needs, in entries.
+ *
+ * @return Two entries per pixel of every channel, 0 if the configuration is invalid.
+ */
+uint32_t LEDEmu_GetPixelCount(const sLEDEmuConfig_t *psConfig)
+{
+    if (IsConfigValid(psConfig) == 0)
+    {
+        return 0;
+    }
+
+    uint8_t ubAcross = GetPanelsAcross(psConfig, &psConfig->asPattern[0]);
+    uint32_t ulWidth = (uint32_t)ubAcross * psConfig->usPanelColumns;
+    uint32_t ulHeight = (uint32_t)(psConfig->ubPanels / ubAcross) * psConfig->usPanelRows;
+    return ulWidth * ulHeight * psConfig->ubChannels * 2U;
+}
+
+/**
+ * @brief Initializes the emulator with the LEDs off and nothing shifted.
+ *
+ * @param pulOnTimeNs LEDEmu_GetPixelCount() entries for the lit and the selected time of
+ *                    the pixels.
+ *                    32-bit ns: keep a window under 4 s.
+ * @return 1 on success, 0 if the configuration is invalid.
+ */
+uint8_t LEDEmu_Init(sLEDPanelEmulator_t *psEmu, const sLEDEmuConfig_t *psConfig, uint32_t *pulOnTimeNs)
+{
+    if ((psEmu == NULL) || (pulOnTimeNs == NULL) || (IsConfigValid(psConfig) == 0))
+    {
+        return 0;
+    }
+
+    uint8_t ubAcross = GetPanelsAcross(psConfig, &psConfig->asPattern[0]);
+    uint8_t ubAddressBits = psConfig->asPattern[0].ubAddressBits;
+
+    memset(psEmu, 0, sizeof(*psEmu));
+    psEmu->sConfig = *psConfig;
+    psEmu->usWidth = (uint16_t)(ubAcross * psConfig->usPanelColumns);
+    psEmu->usHeight = (uint16_t)((psConfig->ubPanels / ubAcross) * psConfig->usPanelRows);
+    psEmu->ulPayloadBytes = ((uint32_t)psConfig->ubPanels * psConfig->usPanelColumns *
+                             (psConfig->usPanelRows >> ubAddressBits)) / 8U;
+    psEmu->pulOnTimeNs = pulOnTimeNs;
+    psEmu->pulSelectedTimeNs = pulOnTimeNs + ((uint32_t)psEmu->usWidth * psEmu->usHeight * psConfig->ubChannels);
+    (void)LEDRowAddress_BuildTable(psConfig->aulAddressMasks, ubAddressBits, psEmu->asAddressTable);
+
+    psEmu->ulPort = psConfig->ulOutputEnableMask;   // OE off
+    psEmu->swLastLitAddress = -1;
+    LEDEmu_ResetWindow(psEmu);
+    return 1;
+}
+
+/**
+ * @brief Starts a new snapshot and report window; the panel state is kept.
+ */
+void LEDEmu_ResetWindow(sLEDPanelEmulator_t *psEmu)
+{
+    // Lit and selected time are one buffer
+    memset(psEmu->pulOnTimeNs, 0, (size_t)psEmu->usWidth * psEmu->usHeight * psEmu->sConfig.ubChannels * 2U * sizeof(uint32_t));
+    memset(&psEmu->sReport, 0, sizeof(psEmu->sReport));
+    psEmu->udCycleSumNs = 0;
+    psEmu->ulCompleteCycles = 0;
+}
+
+/**
+ * @brief Shifts one byte into the chain of a channel, most significant bit first.
+ */
+void LEDEmu_ShiftByte(sLEDPanelEmulator_t *psEmu, uint8_t ubChannel, uint8_t ubByte)
+{
+    if (ubChannel >= psEmu->sConfig.ubChannels)
+    {
+        return;
+    }
+
+    psEmu->aaubShift[ubChannel][psEmu->aulShiftHead[ubChannel]] = ubByte;
+    psEmu->aulShiftHead[ubChannel] = (psEmu->aulShiftHead[ubChannel] + 1U) % psEmu->ulPayloadBytes;
+    psEmu->aulShiftedBytes[ubChannel]++;
+}
+
+/**
+ * @brief Writes the GPIO port as DR_SET then DR_CLEAR do; LE rising latches the chains.
+ */
+void LEDEmu_WritePort(sLEDPanelEmulator_t *psEmu, uint32_t ulSet, uint32_t ulClear)
+{
+    uint32_t ulPrevious = psEmu->ulPort;
+
+    psEmu->ulPort |= ulSet;
+    OnPortChange(psEmu, ulPrevious);
+
+    ulPrevious = psEmu->ulPort;
+    psEmu->ulPort &= ~ulClear;
+    OnPortChange(psEmu, ulPrevious);
+}
+
+/**
+ * @brief Lets time pass with the port as it is; lit pixels accumulate the time.
+ */
+void LEDEmu_AdvanceTime(sLEDPanelEmulator_t *psEmu, uint32_t ulNs)
+{
+    psEmu->udNowNs += ulNs;
+    psEmu->sReport.udElapsedNs += ulNs;
+
+    if ((psEmu->ulPort & psEmu->sConfig.ulOutputEnableMask) != 0U)
+    {
+        psEmu->sReport.udBlankNs += ulNs;
+        return;
+    }
+
+    uint8_t ubAddress = GetCurrentAddress(psEmu);
+    psEmu->sReport.udOnNs += ulNs;
+    for (uint8_t ubChannel = 0; ubChannel < psEmu->sConfig.ubChannels; ubChannel++)
+    {
+        LightPixels(psEmu, ubChannel, ubAddress, ulNs);
+    }
+}
+
+/**
+ * @brief Returns scan HAL operations that drive this emulator on a virtual clock.
+ *
+ * The address is written through the LEDRowAddress table as LEDDriver does. Shifts take
+ * ulShiftNsPerByte per byte. Only one emulator is driven through the HAL at a time.
+ */
+const sLEDScanHal_t *LEDEmu_GetScanHal(sLEDPanelEmulator_t *psEmu)
+{
+    psActiveEmu = psEmu;
+    return &sEmuScanHal;
+}
+
+/**
+ * @brief Runs a scan engine that uses LEDEmu_GetScanHal() until more scan cycles started.
+ *
+ * Start the engine with LEDScan_Start() first. Shift completions and timer expiries are
+ * delivered to the engine at their virtual time. Stops right at the start of the last cycle, so a window reset there and run for whole
+ * cycles gives every address and bit-plane the same OE time.
+ *
+ * @param ulCycles Cycle starts to run for (at least 1).
+ * @return 1 if the cycles ran, 0 if the scan went idle before.
+ */
+uint8_t LEDEmu_RunScanCycles(sLEDPanelEmulator_t *psEmu, sLEDScan_t *psScan, uint32_t ulCycles)
+{
+    if (ulCycles == 0)
+    {
+        return 0;
+    }
+    return RunScanUntil(psEmu, psScan, ulCycles);
+}
+
+/**
+ * @brief Runs an eDMA scatter-gather chain (LEDScanChain) once through to its last TCD.
+ *
+ * Every byte written to the SPI TDR is shifted on channel 0 and takes ulShiftNsPerByte;
+ * GPIO writes take no time.
+ *
+ * @param ulFirstTcdAddress Bus address of the first TCD.
+ * @return 1 if the chain ended, 0 if it read or wrote outside the bus or did not end
+ *         within LED_EMU_MAX_CHAIN_TCDS TCDs.
+ */
+uint8_t LEDEmu_RunChain(sLEDPanelEmulator_t *psEmu, const sLEDEmuBus_t *psBus, uint32_t ulFirstTcdAddress)
+{
+    uint32_t ulTcdAddress = ulFirstTcdAddress;
+
+    for (uint32_t ulCount = 0; ulCount < LED_EMU_MAX_CHAIN_TCDS; ulCount++)
+    {
+        const void *pvTcd = BusMap(psBus, ulTcdAddress, sizeof(sLEDChainTcd_t));
+        sLEDChainTcd_t sTcd;
+
+        if (pvTcd == NULL)
+        {
+            return 0;
+        }
+        memcpy(&sTcd, pvTcd, sizeof(sTcd));
+
+        uint32_t ulElement = 1UL << (sTcd.ATTR & 0x7U);
+        uint32_t ulSource = sTcd.SADDR;
+        uint32_t ulDest = sTcd.DADDR;
+        for (uint16_t usIteration = 0; usIteration < sTcd.CITER; usIteration++)
+        {
+            for (uint32_t ulByte = 0; ulByte < sTcd.NBYTES; ulByte += ulElement)
+            {
+                const void *pvSource = BusMap(psBus, ulSource, ulElement);
+                uint32_t ulValue = 0;
+
+                if ((pvSource == NULL) || (ulElement > sizeof(ulValue)))
+                {
+                    return 0;
+                }
+                memcpy(&ulValue, pvSource, ulElement);
+                if (BusWrite(psEmu, psBus, ulDest, ulValue) == 0)
+                {
+                    return 0;
+                }
+                ulSource += (uint32_t)(int32_t)sTcd.SOFF;
+                ulDest += (uint32_t)(int32_t)sTcd.DOFF;
+            }
+        }
+
+        if ((sTcd.CSR & LED_CHAIN_CSR_ESG) == 0U)
+        {
+            return 1;
+        }
+        ulTcdAddress = (uint32_t)sTcd.DLAST_SGA;
+    }
+    return 0;
+}
+
+/**
+ * @brief Gets the timing of the stream since the last LEDEmu_ResetWindow().
+ */
+void LEDEmu_GetReport(const sLEDPanelEmulator_t *psEmu, sLEDEmuReport_t *psReport)
+{
+    *psReport = psEmu->sReport;
+    if (psReport->udElapsedNs != 0)
+    {
+        psReport->usDutyPerMille = (uint16_t)((psReport->udOnNs * 1000U) / psReport->udElapsedNs);
+    }
+    if (psEmu->udCycleSumNs != 0)
+    {
+        psReport->ulRefreshMilliHz = (uint32_t)((1000000000000ULL * psEmu->ulCompleteCycles) / psEmu->udCycleSumNs);
+    }
+}
+
+/**
+ * @brief Reconstructs the image of a channel as seen by the eye.
+ *
+ * A pixel is 255 when it was lit for as long as OE was on for its rows, so the gray levels
+ * do not depend on the window or on the brightness duty (see the report for those).
+ *
+ * @param pubGray Returns usWidth * usHeight levels, row after row.
+ */
+void LEDEmu_GetImage(const sLEDPanelEmulator_t *psEmu, uint8_t ubChannel, uint8_t *pubGray)
+{
+    uint32_t ulPixels = (uint32_t)psEmu->usWidth * psEmu->usHeight;
+
+    for (uint32_t ulPixel = 0; ulPixel < ulPixels; ulPixel++)
+    {
+        pubGray[ulPixel] = GetPixelLevel(psEmu, ubChannel, ulPixel);
+    }
+}
+
+/**
+ * @brief Writes the image of a channel (LEDEmu_GetImage()) as a binary PGM file.
+ *
+ * @return 1 on success, 0 if the file could not be written.
+ */
+uint8_t LEDEmu_WritePgm(const sLEDPanelEmulator_t *psEmu, uint8_t ubChannel, const char *pcPath)
+{
+    uint32_t ulPixels = (uint32_t)psEmu->usWidth * psEmu->usHeight;
+    FILE *psFile = fopen(pcPath, "wb");
+
+    if (psFile == NULL)
+    {
+        return 0;
+    }
+
+    int lStatus = fprintf(psFile, "P5\n%u %u\n255\n", psEmu->usWidth, psEmu->usHeight);
+    for (uint32_t ulPixel = 0; (ulPixel < ulPixels) && (lStatus >= 0); ulPixel++)
+    {
+        lStatus = fputc(GetPixelLevel(psEmu, ubChannel, ulPixel), psFile);
+    }
+    if (fclose(psFile) != 0)
+    {
+        lStatus = -1;
+    }
+    return (lStatus >= 0) ? 1U : 0U;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Checks the geometry, the patterns and the pins.
+ */
+static uint8_t IsConfigValid(const sLEDEmuConfig_t *psConfig)
+{
+    if ((psConfig == NULL) || (psConfig->ubChannels == 0) || (psConfig->ubChannels > LED_EMU_MAX_CHANNELS) ||
+        (psConfig->ubPanels == 0) || ((psConfig->usPanelColumns % 8U) != 0) || (psConfig->usPanelColumns == 0))
+    {
+        return 0;
+    }
+
+    uint8_t ubAddressBits = psConfig->asPattern[0].ubAddressBits;
+    uint16_t usScan = (uint16_t)(1U << ubAddressBits);
+    uint16_t usPanelBytes = psConfig->usPanelColumns / 8U;
+    if ((ubAddressBits == 0) || (ubAddressBits > LED_ROW_ADDRESS_MAX_LINES) ||
+        (psConfig->usPanelRows == 0) || ((psConfig->usPanelRows % usScan) != 0) ||
+        ((psConfig->usPanelRows / usScan) > 32U) ||
+        ((((uint32_t)psConfig->ubPanels * usPanelBytes) * (psConfig->usPanelRows / usScan)) > LED_EMU_MAX_PAYLOAD_BYTES))
+    {
+        return 0;
+    }
+
+    for (uint8_t ubChannel = 0; ubChannel < psConfig->ubChannels; ubChannel++)
+    {
+        const sLEDScanPattern_t *psPattern = &psConfig->asPattern[ubChannel];
+        uint8_t ubAcross = GetPanelsAcross(psConfig, psPattern);
+
+        // Every face has the address lines and the grid of the first one
+        if ((psPattern->ubAddressBits != ubAddressBits) || ((psConfig->ubPanels % ubAcross) != 0) ||
+            (ubAcross != GetPanelsAcross(psConfig, &psConfig->asPattern[0])) ||
+            ((psPattern->ubZigzagBytes != 0) && ((usPanelBytes % psPattern->ubZigzagBytes) != 0)))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Returns the panels side by side in the image.
+ */
+static uint8_t GetPanelsAcross(const sLEDEmuConfig_t *psConfig, const sLEDScanPattern_t *psPattern)
+{
+    return (psPattern->ubPanelsPerChainRow != 0) ? psPattern->ubPanelsPerChainRow : psConfig->ubPanels;
+}
+
+/**
+ * @brief Decodes the Gray coded address lines of the port.
+ */
+static uint8_t GetCurrentAddress(const sLEDPanelEmulator_t *psEmu)
+{
+    uint8_t ubGray = 0;
+    uint8_t ubAddress = 0;
+
+    for (uint8_t ubLine = 0; ubLine < psEmu->sConfig.asPattern[0].ubAddressBits; ubLine++)
+    {
+        if ((psEmu->ulPort & psEmu->sConfig.aulAddressMasks[ubLine]) != 0U)
+        {
+            ubGray |= (uint8_t)(1U << ubLine);
+        }
+    }
+    for (; ubGray != 0; ubGray >>= 1)
+    {
+        ubAddress ^= ubGray;
+    }
+    return ubAddress;
+}
+
+/**
+ * @brief Reacts to a port write: LE rising copies the chains to the output latches.
+ */
+static void OnPortChange(sLEDPanelEmulator_t *psEmu, uint32_t ulPrevious)
+{
+    uint32_t ulLatch = psEmu->sConfig.ulLatchMask;
+    uint32_t ulOutputEnable = psEmu->sConfig.ulOutputEnableMask;
+
+    if (((ulPrevious & ulLatch) == 0U) && ((psEmu->ulPort & ulLatch) != 0U))
+    {
+        Latch(psEmu);
+    }
+    if (((ulPrevious & ulOutputEnable) != 0U) && ((psEmu->ulPort & ulOutputEnable) == 0U))
+    {
+        OnOutputEnabled(psEmu);
+    }
+}
+
+/**
+ * @brief Copies the chains to the output latches.
+ *
+ * Shifting more than one payload is harmless (the last payload is latched); less leaves
+ * stale data in the far end of the chain.
+ */
+static void Latch(sLEDPanelEmulator_t *psEmu)
+{
+    psEmu->sReport.ulLatches++;
+    if ((psEmu->ulPort & psEmu->sConfig.ulOutputEnableMask) == 0U)
+    {
+        psEmu->sReport.ulLatchesWhileLit++;
+    }
+
+    for (uint8_t ubChannel = 0; ubChannel < psEmu->sConfig.ubChannels; ubChannel++)
+    {
+        uint32_t ulHead = psEmu->aulShiftHead[ubChannel];
+
+        if (psEmu->aulShiftedBytes[ubChannel] < psEmu->ulPayloadBytes)
+        {
+            psEmu->sReport.ulIncompleteShifts++;
+        }
+        psEmu->aulShiftedBytes[ubChannel] = 0;
+
+        // Oldest byte first: it travelled furthest down the chain
+        for (uint32_t ulByte = 0; ulByte < psEmu->ulPayloadBytes; ulByte++)
+        {
+            psEmu->aaubLatched[ubChannel][ulByte] = psEmu->aaubShift[ubChannel][(ulHead + ulByte) % psEmu->ulPayloadBytes];
+        }
+    }
+}
+
+/**
+ * @brief Tracks the scan cycles when OE turns on: a cycle starts when address 0 is lit
+ *        after another address.
+ *
+ * The address is taken at OE on rather than at the latch: the lines may still be settling
+ * while LE is high.
+ */
+static void OnOutputEnabled(sLEDPanelEmulator_t *psEmu)
+{
+    uint8_t ubAddress = GetCurrentAddress(psEmu);
+
+    if ((ubAddress == 0) && (psEmu->swLastLitAddress != 0))
+    {
+        if (psEmu->bCycleStarted)
+        {
+            uint64_t udCycleNs = psEmu->udNowNs - psEmu->udCycleStartNs;
+            uint32_t ulCycleNs = (udCycleNs > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)udCycleNs;
+
+            if ((psEmu->ulCompleteCycles == 0) || (ulCycleNs < psEmu->sReport.ulMinCycleNs))
+            {
+                psEmu->sReport.ulMinCycleNs = ulCycleNs;
+            }
+            if (ulCycleNs > psEmu->sReport.ulMaxCycleNs)
+            {
+                psEmu->sReport.ulMaxCycleNs = ulCycleNs;
+            }
+            psEmu->udCycleSumNs += udCycleNs;
+            psEmu->ulCompleteCycles++;
+        }
+        psEmu->bCycleStarted = true;
+        psEmu->udCycleStartNs = psEmu->udNowNs;
+        psEmu->sReport.ulCycles++;
+    }
+    psEmu->swLastLitAddress = ubAddress;
+}
+
+/**
+ * @brief Adds the time to every pixel of the rows of an address: to the selected time of
+ *        all of them, to the lit time of the latched ones.
+ */
+static void LightPixels(sLEDPanelEmulator_t *psEmu, uint8_t ubChannel, uint8_t ubAddress, uint32_t ulNs)
+{
+    uint32_t ulBase = (uint32_t)ubChannel * psEmu->usWidth * psEmu->usHeight;
+    uint32_t *pulOnTimeNs = psEmu->pulOnTimeNs + ulBase;
+    uint32_t *pulSelectedTimeNs = psEmu->pulSelectedTimeNs + ulBase;
+    const uint8_t *pubLatched = psEmu->aaubLatched[ubChannel];
+
+    for (uint32_t ulByte = 0; ulByte < psEmu->ulPayloadBytes; ulByte++)
+    {
+        uint8_t ubData = pubLatched[ulByte];
+        for (uint8_t ubBit = 0; ubBit < 8U; ubBit++, ubData <<= 1)
+        {
+            uint32_t ulPixel = MapPayloadBit(psEmu, ubChannel, ubAddress, ulByte, ubBit);
+
+            pulSelectedTimeNs[ulPixel] += ulNs;
+            if ((ubData & 0x80U) != 0U)
+            {
+                pulOnTimeNs[ulPixel] += ulNs;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Returns the image pixel a latched payload bit drives while an address is selected.
+ *
+ * Follows the wiring of the channel's scan pattern: the payload is cut into row group
+ * slots and panels (or interleaved per panel with zigzag), the slot and address give the
+ * panel row, the chain position gives the place of the panel in the grid.
+ *
+ * @param ubBit Bit of the byte, 0 - most significant (leftmost pixel).
+ */
+static uint32_t MapPayloadBit(const sLEDPanelEmulator_t *psEmu, uint8_t ubChannel, uint8_t ubAddress,
+                              uint32_t ulByte, uint8_t ubBit)
+{
+    const sLEDEmuConfig_t *psConfig = &psEmu->sConfig;
+    const sLEDScanPattern_t *psPattern = &psConfig->asPattern[ubChannel];
+    uint16_t usScan = (uint16_t)(1U << psPattern->ubAddressBits);
+    uint16_t usGroups = psConfig->usPanelRows / usScan;
+    uint16_t usPanelBytes = psConfig->usPanelColumns / 8U;
+    uint8_t ubAcross = GetPanelsAcross(psConfig, psPattern);
+    uint16_t usSlot, usPanel, usColumnByte;
+
+    if (psPattern->ubZigzagBytes == 0)
+    {
+        uint32_t ulRowBytes = (uint32_t)psConfig->ubPanels * usPanelBytes;
+        usSlot = (uint16_t)(ulByte / ulRowBytes);
+        usPanel = (uint16_t)((ulByte % ulRowBytes) / usPanelBytes);
+        usColumnByte = (uint16_t)(ulByte % usPanelBytes);
+    }
+    else
+    {
+        uint32_t ulPanelBytes = (uint32_t)usPanelBytes * usGroups;
+        uint32_t ulBlock = (ulByte % ulPanelBytes) / psPattern->ubZigzagBytes;
+        usPanel = (uint16_t)(ulByte / ulPanelBytes);
+        usSlot = (uint16_t)(ulBlock % usGroups);
+        usColumnByte = (uint16_t)(((ulBlock / usGroups) * psPattern->ubZigzagBytes) + (ulByte % psPattern->ubZigzagBytes));
+    }
+
+    // Row of the panel the slot drives at this address
+    uint16_t usGroup = (psPattern->eGroupOrder == LED_ROW_GROUPS_DESCENDING) ? (usGroups - 1U - usSlot) : usSlot;
+    uint16_t usLine = (psPattern->ulGroupReverseMask & (1UL << usGroup)) ? (usScan - 1U - ubAddress) : ubAddress;
+    uint16_t usRow = (usGroup * usScan) + usLine;
+    uint16_t usColumn = (uint16_t)((usColumnByte * 8U) + ubBit);
+
+    // A rotated panel shows its pixel (r, c) at (rows - 1 - r, columns - 1 - c)
+    if ((usPanel < 32U) && (psPattern->ulRotatedPanelMask & (1UL << usPanel)))
+    {
+        usRow = psConfig->usPanelRows - 1U - usRow;
+        usColumn = psConfig->usPanelColumns - 1U - usColumn;
+    }
+
+    uint16_t usChainRow = usPanel / ubAcross;
+    uint16_t usGridColumn = usPanel % ubAcross;
+    if (psPattern->bSerpentine && (usChainRow & 1U))
+    {
+        usGridColumn = ubAcross - 1U - usGridColumn;
+    }
+    if (psPattern->bMirroredChain)
+    {
+        usGridColumn = ubAcross - 1U - usGridColumn;
+    }
+
+    return (((uint32_t)usChainRow * psConfig->usPanelRows + usRow) * psEmu->usWidth) +
+           ((uint32_t)usGridColumn * psConfig->usPanelColumns) + usColumn;
+}
+
+/**
+ * @brief Returns the perceived level of a pixel (see LEDEmu_GetImage()).
+ */
+static uint8_t GetPixelLevel(const sLEDPanelEmulator_t *psEmu, uint8_t ubChannel, uint32_t ulPixel)
+{
+    uint32_t ulIndex = ((uint32_t)ubChannel * psEmu->usWidth * psEmu->usHeight) + ulPixel;
+    uint32_t ulOnNs = psEmu->pulOnTimeNs[ulIndex];
+    uint32_t ulSelectedNs = psEmu->pulSelectedTimeNs[ulIndex];
+
+    if (ulSelectedNs == 0)
+    {
+        return 0;
+    }
+    return (uint8_t)((((uint64_t)ulOnNs * 255U) + (ulSelectedNs / 2U)) / ulSelectedNs);
+}
+
+/**
+ * @brief Delivers the scan events until ulCycles more cycles started.
+ */
+static uint8_t RunScanUntil(sLEDPanelEmulator_t *psEmu, sLEDScan_t *psScan, uint32_t ulCycles)
+{
+    uint32_t ulLastCycle = psEmu->sReport.ulCycles + ulCycles;
+
+    psActiveEmu = psEmu;
+    while (psEmu->sReport.ulCycles < ulLastCycle)
+    {
+        bool bShift = (psEmu->ubShiftsPending != 0);
+        uint64_t udDueNs;
+
+        if (!bShift && !psEmu->bTimerArmed)
+        {
+            return 0;
+        }
+        if (bShift && (!psEmu->bTimerArmed || (psEmu->udShiftDueNs <= psEmu->udTimerDueNs)))
+        {
+            udDueNs = psEmu->udShiftDueNs;
+        }
+        else
+        {
+            bShift = false;
+            udDueNs = psEmu->udTimerDueNs;
+        }
+        AdvanceTo(psEmu, udDueNs);
+
+        if (bShift)
+        {
+            uint8_t ubCompleted = psEmu->ubShiftsPending;
+            psEmu->ubShiftsPending = 0;
+            for (uint8_t ubIndex = 0; ubIndex < ubCompleted; ubIndex++)
+            {
+                LEDScan_OnShiftComplete(psScan);
+            }
+        }
+        else
+        {
+            psEmu->bTimerArmed = false;
+            LEDScan_OnTimerExpired(psScan);
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Advances the virtual time to an absolute time.
+ */
+static void AdvanceTo(sLEDPanelEmulator_t *psEmu, uint64_t udTimeNs)
+{
+    while (psEmu->udNowNs < udTimeNs)
+    {
+        uint64_t udStepNs = udTimeNs - psEmu->udNowNs;
+        LEDEmu_AdvanceTime(psEmu, (udStepNs > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)udStepNs);
+    }
+}
+
+/**
+ * @brief Returns the host copy of a bus range, or NULL if no region holds all of it.
+ */
+static const void *BusMap(const sLEDEmuBus_t *psBus, uint32_t ulAddress, uint32_t ulBytes)
+{
+    for (uint8_t ubRegion = 0; ubRegion < psBus->ubRegions; ubRegion++)
+    {
+        const sLEDEmuMemoryRegion_t *psRegion = &psBus->psRegions[ubRegion];
+        if ((ulAddress >= psRegion->ulAddress) && ((ulAddress - psRegion->ulAddress) + ulBytes <= psRegion->ulSize))
+        {
+            return (const uint8_t *)psRegion->pvHost + (ulAddress - psRegion->ulAddress);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Applies a chain write to a peripheral register.
+ *
+ * @return 1 on success, 0 if the address is not a known register.
+ */
+static uint8_t BusWrite(sLEDPanelEmulator_t *psEmu, const sLEDEmuBus_t *psBus, uint32_t ulAddress, uint32_t ulValue)
+{
+    if (ulAddress == psBus->ulSpiTdrAddress)
+    {
+        LEDEmu_ShiftByte(psEmu, 0, (uint8_t)ulValue);
+        LEDEmu_AdvanceTime(psEmu, psEmu->sConfig.ulShiftNsPerByte);
+    }
+    else if (ulAddress == psBus->ulGpioSetAddress)
+    {
+        LEDEmu_WritePort(psEmu, ulValue, 0);
+    }
+    else if (ulAddress == (psBus->ulGpioSetAddress + sizeof(uint32_t)))
+    {
+        LEDEmu_WritePort(psEmu, 0, ulValue);
+    }
+    else if (ulAddress != psBus->ulSpiTcrAddress)
+    {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Scan HAL: address lines through the Gray coded table, DR_SET then DR_CLEAR.
+ */
+static void EmuSelectAddress(uint8_t ubAddress)
+{
+    LEDEmu_WritePort(psActiveEmu, psActiveEmu->asAddressTable[ubAddress].ulSet, 0);
+    LEDEmu_WritePort(psActiveEmu, 0, psActiveEmu->asAddressTable[ubAddress].ulClear);
+}
+
+/**
+ * @brief Scan HAL: LE level.
+ */
+static void EmuSetLatch(bool bActive)
+{
+    uint32_t ulMask = psActiveEmu->sConfig.ulLatchMask;
+    LEDEmu_WritePort(psActiveEmu, bActive ? ulMask : 0U, bActive ? 0U : ulMask);
+}
+
+/**
+ * @brief Scan HAL: OE (active low).
+ */
+static void EmuSetOutputEnable(bool bEnabled)
+{
+    uint32_t ulMask = psActiveEmu->sConfig.ulOutputEnableMask;
+    LEDEmu_WritePort(psActiveEmu, bEnabled ? 0U : ulMask, bEnabled ? ulMask : 0U);
+}
+
+/**
+ * @brief Scan HAL: shifts a payload; it completes ulShiftNsPerByte per byte later.
+ *
+ * The bytes enter the chain at once: nothing latches before the shift completes.
+ */
+static void EmuStartShift(uint8_t ubChannel, const uint8_t *pubData, uint32_t ulBytes)
+{
+    for (uint32_t ulByte = 0; ulByte < ulBytes; ulByte++)
+    {
+        LEDEmu_ShiftByte(psActiveEmu, ubChannel, pubData[ulByte]);
+    }
+    psActiveEmu->ubShiftsPending++;
+    psActiveEmu->udShiftDueNs = psActiveEmu->udNowNs + ((uint64_t)ulBytes * psActiveEmu->sConfig.ulShiftNsPerByte);
+}
+
+/**
+ * @brief Scan HAL: arms the one-shot timer.
+ */
+static void EmuStartTimer(uint32_t ulDelayNs)
+{
+    psActiveEmu->bTimerArmed = true;
+    psActiveEmu->udTimerDueNs = psActiveEmu->udNowNs + ulDelayNs;
+}
+
+/**
+ * @brief Scan HAL: virtual time, wrapping at 2^32 ns.
+ */
+static uint32_t EmuGetTimeNs(void)
+{
+    return (uint32_t)psActiveEmu->udNowNs;
+}
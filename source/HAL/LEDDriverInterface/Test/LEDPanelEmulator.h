@@ -0,0 +1,156 @@
+/**
+ * @file LEDPanelEmulator.h
+ * @brief Host emulator of the LED panels driven by LEDDriver.
+ *
+ * Consumes the signals the driver puts on the panel connector: SPI payload bytes per
+ * channel (face), and writes to the GPIO port carrying the row address lines, LE and OE.
+ * The panels are modelled from the scan pattern the way the hardware behaves: bytes go
+ * through the chain shift register, LE copies it to the output latches, and while OE is
+ * on the latched pixels of the rows selected by the (Gray coded) address are lit. Every
+ * pixel accumulates its lit time, so the reconstructed image is weighted by OE time and
+ * shows BCM gray levels.
+ *
+ * The stream can come from the timed scan (LEDEmu_GetScanHal() and LEDEmu_RunScanCycles(),
+ * with a virtual clock) or from an eDMA chain of LEDScanChain (LEDEmu_RunChain()). Snapshots
+ * are written as PGM images; LEDEmu_GetReport() gives the timing of the stream.
+ *
+ * Host only: no hardware dependency, runs as fast as the host can step the scan.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_TEST_LEDPANELEMULATOR_H_
+#define HAL_LEDDRIVERINTERFACE_TEST_LEDPANELEMULATOR_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include "HAL/LEDDriverInterface/LEDScanPattern.h"
+#include "HAL/LEDDriverInterface/LEDRowAddress.h"
+#include "HAL/LEDDriverInterface/LEDScan.h"
+#include "HAL/LEDDriverInterface/LEDScanChain.h"
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define LED_EMU_MAX_CHANNELS        LED_SCAN_MAX_CHANNELS
+#define LED_EMU_MAX_PAYLOAD_BYTES   2048U   // Chain shift register length per channel
+#define LED_EMU_MAX_CHAIN_TCDS      2048U   // Guard against a chain that never ends
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief Panels and connector of the emulated unit.
+ */
+typedef struct {
+    uint16_t usPanelRows;                   // Rows of one panel
+    uint16_t usPanelColumns;                // Columns of one panel (multiple of 8)
+    uint8_t  ubPanels;                      // Panels in the chain of every channel
+    uint8_t  ubChannels;                    // Shift channels (faces), 1..LED_EMU_MAX_CHANNELS
+    sLEDScanPattern_t asPattern[LED_EMU_MAX_CHANNELS]; // Wiring of the panels of every channel
+    uint32_t ulShiftNsPerByte;              // SPI time of one byte
+    uint32_t aulAddressMasks[LED_ROW_ADDRESS_MAX_LINES]; // Port pin of address line A0, A1, ...
+    uint32_t ulLatchMask;                   // LE pin (active high)
+    uint32_t ulOutputEnableMask;            // OE pin (active low)
+} sLEDEmuConfig_t;
+
+/**
+ * @brief Timing of the stream since the last LEDEmu_ResetWindow().
+ */
+typedef struct {
+    uint64_t udElapsedNs;           // Time covered
+    uint64_t udOnNs;                // Time with OE on
+    uint64_t udBlankNs;             // Time with OE off
+    uint16_t usDutyPerMille;        // udOnNs / udElapsedNs
+    uint32_t ulCycles;              // Scan cycles started (address 0 lit after another address)
+    uint32_t ulRefreshMilliHz;      // Mean over the complete cycles (0 until two cycles started)
+    uint32_t ulMinCycleNs;
+    uint32_t ulMaxCycleNs;
+    uint32_t ulLatches;             // LE pulses
+    uint32_t ulLatchesWhileLit;     // LE pulses with OE on (ghosting)
+    uint32_t ulIncompleteShifts;    // Latches of a channel that had shifted less than one payload
+} sLEDEmuReport_t;
+
+/**
+ * @brief Emulator state.
+ */
+typedef struct {
+    sLEDEmuConfig_t sConfig;
+    uint16_t usWidth;               // Image of one channel, pixels
+    uint16_t usHeight;
+    uint32_t ulPayloadBytes;        // Bytes of one chain shift register
+    uint32_t *pulOnTimeNs;          // Lit time of every pixel, channel after channel (caller's buffer)
+    uint32_t *pulSelectedTimeNs;    // OE time of the rows of every pixel, same layout (caller's buffer)
+    sLEDRowAddressOutput_t asAddressTable[LED_ROW_ADDRESS_MAX_ENTRIES];
+
+    uint32_t ulPort;                // Level of the GPIO port
+    uint8_t  aaubShift[LED_EMU_MAX_CHANNELS][LED_EMU_MAX_PAYLOAD_BYTES]; // Ring, oldest byte at aulShiftHead
+    uint32_t aulShiftHead[LED_EMU_MAX_CHANNELS];
+    uint32_t aulShiftedBytes[LED_EMU_MAX_CHANNELS]; // Since the last latch
+    uint8_t  aaubLatched[LED_EMU_MAX_CHANNELS][LED_EMU_MAX_PAYLOAD_BYTES];
+    int16_t  swLastLitAddress;      // Address at the last OE on, -1 before the first
+
+    uint64_t udNowNs;               // Virtual time, never reset
+    uint64_t udCycleStartNs;
+    bool     bCycleStarted;
+    uint64_t udCycleSumNs;          // Complete cycles of the window
+    uint32_t ulCompleteCycles;
+    sLEDEmuReport_t sReport;
+
+    // Timed scan driven by LEDEmu_RunScanCycles()
+    bool     bTimerArmed;
+    uint64_t udTimerDueNs;
+    uint8_t  ubShiftsPending;
+    uint64_t udShiftDueNs;
+} sLEDPanelEmulator_t;
+
+/**
+ * @brief Bus view of the memory an eDMA chain reads (TCDs, GPIO words, payloads).
+ */
+typedef struct {
+    uint32_t ulAddress;             // Bus address of the region
+    uint32_t ulSize;
+    const void *pvHost;             // Host copy of the region
+} sLEDEmuMemoryRegion_t;
+
+/**
+ * @brief Peripheral registers an eDMA chain writes.
+ */
+typedef struct {
+    const sLEDEmuMemoryRegion_t *psRegions;
+    uint8_t  ubRegions;
+    uint32_t ulSpiTdrAddress;       // Bytes written here are shifted on channel 0
+    uint32_t ulSpiTcrAddress;       // Writes ignored
+    uint32_t ulGpioSetAddress;      // DR_SET; DR_CLEAR is the next register
+} sLEDEmuBus_t;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint32_t LEDEmu_GetPixelCount(const sLEDEmuConfig_t *psConfig);
+
+uint8_t LEDEmu_Init(sLEDPanelEmulator_t *psEmu, const sLEDEmuConfig_t *psConfig, uint32_t *pulOnTimeNs);
+
+void LEDEmu_ResetWindow(sLEDPanelEmulator_t *psEmu);
+
+void LEDEmu_ShiftByte(sLEDPanelEmulator_t *psEmu, uint8_t ubChannel, uint8_t ubByte);
+
+void LEDEmu_WritePort(sLEDPanelEmulator_t *psEmu, uint32_t ulSet, uint32_t ulClear);
+
+void LEDEmu_AdvanceTime(sLEDPanelEmulator_t *psEmu, uint32_t ulNs);
+
+const sLEDScanHal_t *LEDEmu_GetScanHal(sLEDPanelEmulator_t *psEmu);
+
+uint8_t LEDEmu_RunScanCycles(sLEDPanelEmulator_t *psEmu, sLEDScan_t *psScan, uint32_t ulCycles);
+
+uint8_t LEDEmu_RunChain(sLEDPanelEmulator_t *psEmu, const sLEDEmuBus_t *psBus, uint32_t ulFirstTcdAddress);
+
+void LEDEmu_GetReport(const sLEDPanelEmulator_t *psEmu, sLEDEmuReport_t *psReport);
+
+void LEDEmu_GetImage(const sLEDPanelEmulator_t *psEmu, uint8_t ubChannel, uint8_t *pubGray);
+
+uint8_t LEDEmu_WritePgm(const sLEDPanelEmulator_t *psEmu, uint8_t ubChannel, const char *pcPath);
+
+#endif /* HAL_LEDDRIVERINTERFACE_TEST_LEDPANELEMULATOR_H_ */
@@ -0,0 +1,552 @@
+/**
+ * @file LEDPanelEmulatorTest.c
+ * @brief Regression table of the timed scan on the panel emulator (LEDScan, LEDPanelEmulator).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/Test/LEDPanelEmulatorTest.h"
+#include "HAL/LEDDriverInterface/Test/LEDPanelEmulator.h"
+#include "HAL/LEDDriverInterface/LEDDriver.h"
+#include "HAL/LEDDriverInterface/LEDBrightness.h"
+#include "HAL/LEDDriverInterface/LEDScanChain.h"
+#include <stdio.h>
+#include <string.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define TEST_MAX_WIDTH          256U    // Four 64 column panels
+#define TEST_MAX_HEIGHT         32U
+#define TEST_MAX_ROW_BYTES      (TEST_MAX_WIDTH / 8U)
+#define TEST_MAX_SCAN_RATE      16U
+#define TEST_MAX_PAYLOAD_BYTES  128U
+
+// Connector timing: LPSPI byte at 9.6 MHz, LE pulse, OE off between steps
+#define TEST_SHIFT_NS_PER_BYTE  834U
+#define TEST_LATCH_NS           1000U
+#define TEST_BLANKING_NS        2000U
+
+#define TEST_WARMUP_CYCLES      2U
+#define TEST_CYCLES             4U
+
+// Bus addresses of the eDMA chain run on the emulator
+#define TEST_TCD_ADDRESS            0x20200000UL
+#define TEST_GPIO_WORDS_ADDRESS     0x20201000UL
+#define TEST_PAYLOAD_ADDRESS        0x20202000UL
+#define TEST_TCR_VALUE_ADDRESS      0x20203000UL
+#define TEST_SPI_TCR_ADDRESS        0x40394060UL    // LPSPI1 TCR
+#define TEST_SPI_TDR_ADDRESS        0x40394064UL    // LPSPI1 TDR
+#define TEST_GPIO_SET_ADDRESS       0x401B8084UL    // GPIO1 DR_SET
+#define TEST_MAX_TCDS               ((TEST_MAX_SCAN_RATE * LED_CHAIN_TCDS_PER_STEP) + LED_CHAIN_TAIL_TCDS)
+#define TEST_MAX_GPIO_WORDS         (((TEST_MAX_SCAN_RATE * LED_CHAIN_GPIO_WRITES_PER_STEP) + 1U) * LED_CHAIN_WORDS_PER_GPIO_WRITE)
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief How the driver gets the image and how its payloads reach the panels.
+ */
+typedef enum {
+    EMU_SOURCE_FRAME = 0,   // 1bpp frame, timed scan
+    EMU_SOURCE_PLANES,      // Bit-planes in frame row order, packed, timed scan
+    EMU_SOURCE_STREAMED,    // Bit-planes in the scan's row order, shifted in place
+    EMU_SOURCE_CHAIN        // 1bpp frame, eDMA chain
+} eEmuSource_t;
+
+/**
+ * @brief Wiring on top of the default scan pattern.
+ */
+typedef struct {
+    uint8_t  ubZigzagBytes;
+    uint8_t  ubPanelsPerChainRow;
+    bool     bSerpentine;
+    uint32_t ulRotatedPanelMask;
+} sEmuWiring_t;
+
+typedef struct {
+    uint8_t  ubPanels;
+    uint16_t usPanelRows;
+    uint16_t usPanelColumns;
+    uint8_t  ubAddressBits;
+    uint8_t  ubChannels;        // 2 - double sided, the rear chain mirrored
+    uint8_t  ubPlanes;
+    uint32_t ulUnitNs;
+    uint32_t ulSkipMask;        // Addresses left blank and skipped (never address 0)
+    uint16_t usDuty;
+    uint32_t ulCyclePeriodNs;   // 0 - as fast as possible
+    sEmuWiring_t sWiring;
+    eEmuSource_t eSource;
+} sEmuCase_t;
+
+//-------------------------------------[ STATIC VARIABLE ] --------------------------//
+//
+static const sEmuCase_t asEmuCases[] = {
+    // Installed: two 64x16 panels, 1/8 scan
+    { 2U, 16U, 64U, 3U, 1U, 1U, 100000U, 0x00U, LED_BRIGHTNESS_FULL_DUTY,      0U,
+      { 0U, 0U, false, 0x0U }, EMU_SOURCE_FRAME },
+    // Same at the built-in 120 Hz
+    { 2U, 16U, 64U, 3U, 1U, 1U, 100000U, 0x00U, LED_BRIGHTNESS_FULL_DUTY,      8333333U,
+      { 0U, 0U, false, 0x0U }, EMU_SOURCE_FRAME },
+    // Four panels, 1/4 scan, double sided: the rear chain enters from the other side
+    { 4U, 16U, 64U, 2U, 2U, 1U, 100000U, 0x00U, LED_BRIGHTNESS_FULL_DUTY,      0U,
+      { 0U, 0U, false, 0x0U }, EMU_SOURCE_FRAME },
+    // 16 gray levels, dimmed to half
+    { 2U, 16U, 64U, 3U, 1U, 4U, 10000U,  0x00U, LED_BRIGHTNESS_FULL_DUTY / 2U, 0U,
+      { 0U, 0U, false, 0x0U }, EMU_SOURCE_PLANES },
+    // 16 gray levels laid out as the payloads (FBM_SetScanRowOrder())
+    { 2U, 16U, 64U, 3U, 1U, 4U, 10000U,  0x00U, LED_BRIGHTNESS_FULL_DUTY,      0U,
+      { 0U, 0U, false, 0x0U }, EMU_SOURCE_STREAMED },
+    // Two addresses blank and skipped
+    { 2U, 16U, 64U, 3U, 1U, 1U, 100000U, 0x60U, LED_BRIGHTNESS_FULL_DUTY,      0U,
+      { 0U, 0U, false, 0x0U }, EMU_SOURCE_FRAME },
+    // One 64x32 panel, 1/16 scan, 8 gray levels
+    { 1U, 32U, 64U, 4U, 1U, 3U, 20000U,  0x00U, LED_BRIGHTNESS_FULL_DUTY,      0U,
+      { 0U, 0U, false, 0x0U }, EMU_SOURCE_PLANES },
+    // Outdoor modules: 1/4 scan, row groups interleaved a byte at a time
+    { 2U, 16U, 64U, 2U, 1U, 1U, 100000U, 0x00U, LED_BRIGHTNESS_FULL_DUTY,      0U,
+      { 1U, 0U, false, 0x0U }, EMU_SOURCE_FRAME },
+    // Second panel mounted upside down, 8 gray levels
+    { 2U, 16U, 64U, 3U, 1U, 3U, 20000U,  0x00U, LED_BRIGHTNESS_FULL_DUTY,      0U,
+      { 0U, 0U, false, 0x2U }, EMU_SOURCE_PLANES },
+    // 2x2 panels, the chain returning right to left on upside down panels
+    { 4U, 16U, 64U, 3U, 1U, 1U, 100000U, 0x00U, LED_BRIGHTNESS_FULL_DUTY,      0U,
+      { 0U, 2U, true,  0xCU }, EMU_SOURCE_FRAME },
+    // Installed, one eDMA chain per scan cycle
+    { 2U, 16U, 64U, 3U, 1U, 1U, 100000U, 0x00U, LED_BRIGHTNESS_FULL_DUTY,      0U,
+      { 0U, 0U, false, 0x0U }, EMU_SOURCE_CHAIN },
+};
+
+static sLEDPanelEmulator_t sEmu;
+static uint32_t aulTimeNs[TEST_MAX_WIDTH * TEST_MAX_HEIGHT * LED_EMU_MAX_CHANNELS * 2U];
+static uint8_t aaubLevels[LED_EMU_MAX_CHANNELS][TEST_MAX_WIDTH * TEST_MAX_HEIGHT];
+static uint8_t aubImage[TEST_MAX_WIDTH * TEST_MAX_HEIGHT];
+static uint8_t aaaubFrame[LED_EMU_MAX_CHANNELS][TEST_MAX_HEIGHT][TEST_MAX_ROW_BYTES];
+static uint8_t *aaptubFrame[LED_EMU_MAX_CHANNELS][TEST_MAX_HEIGHT];
+static uint8_t aaubPlanes[LED_BCM_MAX_PLANES][TEST_MAX_HEIGHT * TEST_MAX_ROW_BYTES];
+static uint8_t *const *aptubPayloads[LED_EMU_MAX_CHANNELS];
+static sLEDChainTcd_t asTcds[TEST_MAX_TCDS];
+static uint32_t aulGpioWords[TEST_MAX_GPIO_WORDS];
+static uint8_t aubChainPayloads[TEST_MAX_SCAN_RATE * TEST_MAX_PAYLOAD_BYTES];
+static uint32_t ulTcrValue;
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static uint8_t CheckEmuCase(const sEmuCase_t *psCase);
+static uint8_t RunTimedScan(const sEmuCase_t *psCase);
+static uint8_t RunChainScan(const sEmuCase_t *psCase);
+static void BuildConfig(const sEmuCase_t *psCase, sLEDEmuConfig_t *psConfig);
+static uint16_t GetPanelRow(const sLEDScanPattern_t *psPattern, uint16_t usGroup, uint8_t ubAddress);
+static void FillLevels(const sEmuCase_t *psCase, const sLEDScanPattern_t *psPattern, uint8_t ubChannel);
+static uint8_t PackWithDriver(const sEmuCase_t *psCase, const sLEDScanPattern_t *psPattern);
+static void SplitPlane(uint8_t ubChannel, uint8_t ubPlane, const uint16_t *pusRowOrder, uint8_t *pubDest,
+                       uint16_t usDestStride);
+static uint8_t CheckImage(const sEmuCase_t *psCase, uint8_t ubChannel);
+static uint32_t Difference(uint32_t ulA, uint32_t ulB);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Runs the emulator table.
+ *
+ * The LED driver is reconfigured by every case and released at the end.
+ *
+ * @return Number of failing cases (0 - all passed).
+ */
+uint8_t LEDPanelEmulatorTest_Run(void)
+{
+    uint8_t ubFailures = 0;
+
+    for (uint32_t ulCase = 0; ulCase < (sizeof(asEmuCases) / sizeof(asEmuCases[0])); ulCase++)
+    {
+        ubFailures += (CheckEmuCase(&asEmuCases[ulCase]) == 0) ? 1U : 0U;
+    }
+
+    LEDDriver_ReleasePanel();
+    (void)LEDDriver_SetBitPlanes(1U, LED_BCM_DEFAULT_UNIT_NS);
+    return ubFailures;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Packs one case with the LED driver, shows the driver's payloads on the emulator
+ *        and checks the stream and the image; 1 if it passes.
+ */
+static uint8_t CheckEmuCase(const sEmuCase_t *psCase)
+{
+    sLEDEmuConfig_t sConfig;
+
+    BuildConfig(psCase, &sConfig);
+    if ((LEDEmu_GetPixelCount(&sConfig) > (sizeof(aulTimeNs) / sizeof(aulTimeNs[0]))) ||
+        (LEDEmu_Init(&sEmu, &sConfig, aulTimeNs) == 0) || (sEmu.ulPayloadBytes > TEST_MAX_PAYLOAD_BYTES) ||
+        (sEmu.usHeight > TEST_MAX_HEIGHT))
+    {
+        return 0;
+    }
+
+    for (uint8_t ubChannel = 0; ubChannel < psCase->ubChannels; ubChannel++)
+    {
+        FillLevels(psCase, &sConfig.asPattern[ubChannel], ubChannel);
+    }
+    if (PackWithDriver(psCase, &sConfig.asPattern[0]) == 0)
+    {
+        return 0;
+    }
+
+    uint8_t ubRan = (psCase->eSource == EMU_SOURCE_CHAIN) ? RunChainScan(psCase) : RunTimedScan(psCase);
+    if (ubRan == 0)
+    {
+        return 0;
+    }
+
+    for (uint8_t ubChannel = 0; ubChannel < psCase->ubChannels; ubChannel++)
+    {
+        if (CheckImage(psCase, ubChannel) == 0)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Runs the timed scan over the driver's payloads and checks refresh, duty and
+ *        stream; 1 if they pass.
+ *
+ * The window starts at a cycle start after a warm-up and covers whole cycles, so every
+ * address and plane has had the same OE time. Free-running, a cycle takes the OE slots
+ * plus shift, latch and blanking per step, which is what the sequencer estimates.
+ */
+static uint8_t RunTimedScan(const sEmuCase_t *psCase)
+{
+    sLEDEmuReport_t sReport;
+    sLEDScanStats_t sStats;
+    sLEDScan_t sScan;
+    sLEDBcm_t sBcm;
+
+    if (LEDBcm_Init(&sBcm, (uint8_t)(1U << psCase->ubAddressBits), psCase->ubPlanes, psCase->ulUnitNs) == 0)
+    {
+        return 0;
+    }
+    LEDBcm_SetSkipMask(&sBcm, psCase->ulSkipMask);
+    LEDBcm_SetDuty(&sBcm, psCase->usDuty);
+
+    LEDScan_Init(&sScan, LEDEmu_GetScanHal(&sEmu), &sBcm, aptubPayloads[0], sEmu.ulPayloadBytes);
+    if ((psCase->ubChannels > 1U) && (LEDScan_SetChannelPayloads(&sScan, 1U, aptubPayloads[1]) == 0))
+    {
+        return 0;
+    }
+    LEDScan_SetTiming(&sScan, TEST_LATCH_NS, TEST_BLANKING_NS, psCase->ulCyclePeriodNs);
+    LEDScan_Start(&sScan);
+
+    uint8_t ubRan = ((LEDEmu_RunScanCycles(&sEmu, &sScan, TEST_WARMUP_CYCLES) != 0) ? 1U : 0U);
+    LEDEmu_ResetWindow(&sEmu);
+    ubRan &= ((LEDEmu_RunScanCycles(&sEmu, &sScan, TEST_CYCLES) != 0) ? 1U : 0U);
+    LEDScan_GetStatistics(&sScan, &sStats);
+    LEDScan_Stop(&sScan);
+    LEDEmu_GetReport(&sEmu, &sReport);
+
+    uint32_t ulStepOverheadNs = (sEmu.ulPayloadBytes * TEST_SHIFT_NS_PER_BYTE) + TEST_LATCH_NS + TEST_BLANKING_NS;
+    uint64_t udCycleNs = (psCase->ulCyclePeriodNs != 0) ? psCase->ulCyclePeriodNs :
+                         (LEDBcm_GetOnTimePerCycleNs(&sBcm) + ((uint64_t)LEDBcm_GetStepsPerCycle(&sBcm) * ulStepOverheadNs));
+    uint32_t ulRefreshMilliHz = (uint32_t)(1000000000000ULL / udCycleNs);
+    uint64_t udOnNs = 0;
+
+    for (uint8_t ubPlane = 0; ubPlane < psCase->ubPlanes; ubPlane++)
+    {
+        udOnNs += sBcm.aulOnTimeNs[ubPlane];
+    }
+    udOnNs *= LEDBcm_GetStepsPerCycle(&sBcm) / psCase->ubPlanes;
+
+    return ((ubRan != 0) && (sReport.ulCycles == TEST_CYCLES) && (sReport.ulLatchesWhileLit == 0) &&
+            (sReport.ulIncompleteShifts == 0) && (sStats.ulOverruns == 0) && (sStats.ulUnexpectedEvents == 0) &&
+            (Difference(sReport.ulRefreshMilliHz, ulRefreshMilliHz) <= 1U) &&
+            ((psCase->ulCyclePeriodNs != 0) ||
+             (Difference(sReport.ulRefreshMilliHz, LEDBcm_EstimateRefreshMilliHz(&sBcm, ulStepOverheadNs)) <= 1U)) &&
+            (Difference(sReport.usDutyPerMille, (uint32_t)((udOnNs * 1000U) / udCycleNs)) <= 1U)) ? 1U : 0U;
+}
+
+/**
+ * @brief Runs the eDMA chain of the driver's payloads cycle after cycle and checks the
+ *        stream; 1 if it passes.
+ *
+ * Every address is lit while the next payload shifts and the tail shifts the last one
+ * again, so a cycle is one payload shift more than the addresses, one of them dark.
+ */
+static uint8_t RunChainScan(const sEmuCase_t *psCase)
+{
+    sLEDChainConfig_t sChain;
+    sLEDEmuReport_t sReport;
+    uint8_t ubScanRate = (uint8_t)(1U << psCase->ubAddressBits);
+
+    // The chain shifts the payloads of one block, address after address
+    for (uint8_t ubAddress = 0; ubAddress < ubScanRate; ubAddress++)
+    {
+        memcpy(&aubChainPayloads[(uint32_t)ubAddress * sEmu.ulPayloadBytes], aptubPayloads[0][ubAddress],
+               sEmu.ulPayloadBytes);
+    }
+
+    memset(&sChain, 0, sizeof(sChain));
+    sChain.ulTcdAddress = TEST_TCD_ADDRESS;
+    sChain.ulGpioWordsAddress = TEST_GPIO_WORDS_ADDRESS;
+    sChain.ulPayloadAddress = TEST_PAYLOAD_ADDRESS;
+    sChain.ulPayloadBytes = sEmu.ulPayloadBytes;
+    sChain.ubScanRate = ubScanRate;
+    sChain.psAddressTable = sEmu.asAddressTable;
+    sChain.ulSpiTdrAddress = TEST_SPI_TDR_ADDRESS;
+    sChain.ulSpiTcrAddress = TEST_SPI_TCR_ADDRESS;
+    sChain.ulTcrValueAddress = TEST_TCR_VALUE_ADDRESS;
+    sChain.ulGpioSetAddress = TEST_GPIO_SET_ADDRESS;
+    sChain.ulLatchMask = sEmu.sConfig.ulLatchMask;
+    sChain.ulOutputEnableMask = sEmu.sConfig.ulOutputEnableMask;
+    if (LEDChain_Build(&sChain, asTcds, aulGpioWords) == 0)
+    {
+        return 0;
+    }
+
+    const sLEDEmuMemoryRegion_t asRegions[] = {
+        { TEST_TCD_ADDRESS,        LEDChain_GetTcdCount(ubScanRate) * sizeof(sLEDChainTcd_t), asTcds },
+        { TEST_GPIO_WORDS_ADDRESS, LEDChain_GetGpioWordCount(ubScanRate) * sizeof(uint32_t),  aulGpioWords },
+        { TEST_PAYLOAD_ADDRESS,    (uint32_t)ubScanRate * sEmu.ulPayloadBytes,                aubChainPayloads },
+        { TEST_TCR_VALUE_ADDRESS,  sizeof(ulTcrValue),                                        &ulTcrValue },
+    };
+    const sLEDEmuBus_t sBus = { asRegions, (uint8_t)(sizeof(asRegions) / sizeof(asRegions[0])),
+                                TEST_SPI_TDR_ADDRESS, TEST_SPI_TCR_ADDRESS, TEST_GPIO_SET_ADDRESS };
+
+    for (uint8_t ubCycle = 0; ubCycle < (TEST_WARMUP_CYCLES + TEST_CYCLES); ubCycle++)
+    {
+        if (ubCycle == TEST_WARMUP_CYCLES)
+        {
+            LEDEmu_ResetWindow(&sEmu);
+        }
+        if (LEDEmu_RunChain(&sEmu, &sBus, TEST_TCD_ADDRESS) == 0)
+        {
+            return 0;
+        }
+    }
+    LEDEmu_GetReport(&sEmu, &sReport);
+
+    uint64_t udCycleNs = ((uint64_t)ubScanRate + 1U) * sEmu.ulPayloadBytes * TEST_SHIFT_NS_PER_BYTE;
+    return ((sReport.ulCycles == TEST_CYCLES) && (sReport.ulLatchesWhileLit == 0) &&
+            (sReport.ulIncompleteShifts == 0) &&
+            (Difference(sReport.ulRefreshMilliHz, (uint32_t)(1000000000000ULL / udCycleNs)) <= 1U) &&
+            (Difference(sReport.usDutyPerMille, (ubScanRate * 1000U) / (ubScanRate + 1U)) <= 1U)) ? 1U : 0U;
+}
+
+/**
+ * @brief Emulated unit of a case: the case's wiring on every face, the rear chain mirrored
+ *        as the driver assumes, and arbitrary port pins for the address lines, LE and OE.
+ */
+static void BuildConfig(const sEmuCase_t *psCase, sLEDEmuConfig_t *psConfig)
+{
+    memset(psConfig, 0, sizeof(*psConfig));
+    psConfig->usPanelRows = psCase->usPanelRows;
+    psConfig->usPanelColumns = psCase->usPanelColumns;
+    psConfig->ubPanels = psCase->ubPanels;
+    psConfig->ubChannels = psCase->ubChannels;
+    for (uint8_t ubChannel = 0; ubChannel < psCase->ubChannels; ubChannel++)
+    {
+        sLEDScanPattern_t *psPattern = &psConfig->asPattern[ubChannel];
+
+        LEDDriver_GetDefaultScanPattern(psPattern, psCase->ubAddressBits);
+        psPattern->ubZigzagBytes = psCase->sWiring.ubZigzagBytes;
+        psPattern->ubPanelsPerChainRow = psCase->sWiring.ubPanelsPerChainRow;
+        psPattern->bSerpentine = psCase->sWiring.bSerpentine;
+        psPattern->ulRotatedPanelMask = psCase->sWiring.ulRotatedPanelMask;
+        psPattern->bMirroredChain = (ubChannel != 0);
+    }
+    psConfig->ulShiftNsPerByte = TEST_SHIFT_NS_PER_BYTE;
+    for (uint8_t ubLine = 0; ubLine < LED_ROW_ADDRESS_MAX_LINES; ubLine++)
+    {
+        psConfig->aulAddressMasks[ubLine] = 1UL << (16U + ubLine);
+    }
+    psConfig->ulLatchMask = 1UL << 2;
+    psConfig->ulOutputEnableMask = 1UL << 3;
+}
+
+/**
+ * @brief Panel row a scan address lights in a row group, as the pattern wires it
+ *        (one row of upright panels).
+ */
+static uint16_t GetPanelRow(const sLEDScanPattern_t *psPattern, uint16_t usGroup, uint8_t ubAddress)
+{
+    uint16_t usScan = (uint16_t)(1U << psPattern->ubAddressBits);
+    uint16_t usLine = ((psPattern->ulGroupReverseMask & (1UL << usGroup)) != 0U) ? (uint16_t)(usScan - 1U - ubAddress) :
+                                                                                  ubAddress;
+    return (uint16_t)((usGroup * usScan) + usLine);
+}
+
+/**
+ * @brief Fills the image of a face with pseudo-random levels; the rows of skipped
+ *        addresses are left dark.
+ */
+static void FillLevels(const sEmuCase_t *psCase, const sLEDScanPattern_t *psPattern, uint8_t ubChannel)
+{
+    uint16_t usScan = (uint16_t)(1U << psCase->ubAddressBits);
+    uint32_t ulSeed = 0x2545F491UL + ubChannel;
+
+    for (uint32_t ulPixel = 0; ulPixel < ((uint32_t)sEmu.usWidth * sEmu.usHeight); ulPixel++)
+    {
+        ulSeed = (ulSeed * 1664525UL) + 1013904223UL;
+        aaubLevels[ubChannel][ulPixel] = (uint8_t)((ulSeed >> 24) & ((1U << psCase->ubPlanes) - 1U));
+    }
+
+    for (uint8_t ubAddress = 0; ubAddress < usScan; ubAddress++)
+    {
+        if ((psCase->ulSkipMask & (1UL << ubAddress)) == 0U)
+        {
+            continue;
+        }
+        for (uint16_t usGroup = 0; usGroup < (psCase->usPanelRows / usScan); usGroup++)
+        {
+            memset(&aaubLevels[ubChannel][(uint32_t)GetPanelRow(psPattern, usGroup, ubAddress) * sEmu.usWidth], 0,
+                   sEmu.usWidth);
+        }
+    }
+}
+
+/**
+ * @brief Configures the LED driver for a case, has it pack the images of every face and
+ *        takes its payload tables; 1 on success.
+ *
+ * 1bpp images go in as frames, gray images as bit-planes, in frame row order or in the
+ * driver's stream row order. Streamed planes must be shifted in place.
+ */
+static uint8_t PackWithDriver(const sEmuCase_t *psCase, const sLEDScanPattern_t *psPattern)
+{
+    uint16_t ausRowOrder[TEST_MAX_HEIGHT];
+    sLEDBitPlaneSet_t sPlanes;
+    sLEDPackStats_t sStats;
+    uint16_t usRowBytes = sEmu.usWidth / 8U;
+    uint32_t ulPayloadBytes = 0;
+
+    LEDDriver_ReleasePanel();
+    if ((LEDDriver_SetBitPlanes(psCase->ubPlanes, psCase->ulUnitNs) == 0) ||
+        (LEDDriver_ConfigurePanelPattern(psCase->usPanelRows, psCase->usPanelColumns, (psCase->ubChannels > 1U) ? 1U : 0U,
+                                         0U, psCase->ubPanels, psPattern) == 0))
+    {
+        return 0;
+    }
+
+    if ((psCase->eSource == EMU_SOURCE_FRAME) || (psCase->eSource == EMU_SOURCE_CHAIN))
+    {
+        for (uint8_t ubChannel = 0; ubChannel < psCase->ubChannels; ubChannel++)
+        {
+            for (uint16_t usRow = 0; usRow < sEmu.usHeight; usRow++)
+            {
+                aaptubFrame[ubChannel][usRow] = aaaubFrame[ubChannel][usRow];
+            }
+            SplitPlane(ubChannel, 0U, NULL, &aaaubFrame[ubChannel][0][0], TEST_MAX_ROW_BYTES);
+        }
+        LEDDriver_PrepareDisplayBuffer(aaptubFrame[0], NULL);
+        LEDDriver_PrepareRearDisplayBuffer(aaptubFrame[1], NULL);
+    }
+    else
+    {
+        const uint16_t *pusRowOrder = NULL;
+        if (psCase->eSource == EMU_SOURCE_STREAMED)
+        {
+            if (LEDDriver_GetStreamRowOrder(ausRowOrder, sEmu.usHeight) == 0)
+            {
+                return 0;
+            }
+            pusRowOrder = ausRowOrder;
+        }
+
+        memset(&sPlanes, 0, sizeof(sPlanes));
+        for (uint8_t ubPlane = 0; ubPlane < psCase->ubPlanes; ubPlane++)
+        {
+            SplitPlane(0U, ubPlane, pusRowOrder, aaubPlanes[ubPlane], usRowBytes);
+            sPlanes.apubPlanes[ubPlane] = aaubPlanes[ubPlane];
+        }
+        sPlanes.ubPlanes = psCase->ubPlanes;
+        sPlanes.usStride = usRowBytes;
+        sPlanes.bStreamOrder = (pusRowOrder != NULL);
+        LEDDriver_PrepareBitPlanes(&sPlanes, NULL);
+    }
+
+    LEDDriver_GetPackStatistics(&sStats);
+    for (uint8_t ubChannel = 0; ubChannel < psCase->ubChannels; ubChannel++)
+    {
+        aptubPayloads[ubChannel] = LEDDriver_GetScanPayloads(ubChannel, &ulPayloadBytes);
+        if ((aptubPayloads[ubChannel] == NULL) || (ulPayloadBytes != sEmu.ulPayloadBytes))
+        {
+            return 0;
+        }
+    }
+    if (psCase->eSource == EMU_SOURCE_STREAMED)
+    {
+        return ((sStats.ulStreamedFrames == 1U) && (aptubPayloads[0][0] == aaubPlanes[0])) ? 1U : 0U;
+    }
+    return (sStats.ulStreamedFrames == 0U) ? 1U : 0U;
+}
+
+/**
+ * @brief Writes one bit-plane of a face's image, leftmost pixel in the most significant
+ *        bit, row position k holding image row pusRowOrder[k] (row k when NULL).
+ */
+static void SplitPlane(uint8_t ubChannel, uint8_t ubPlane, const uint16_t *pusRowOrder, uint8_t *pubDest,
+                       uint16_t usDestStride)
+{
+    uint16_t usRowBytes = sEmu.usWidth / 8U;
+
+    for (uint16_t usPosition = 0; usPosition < sEmu.usHeight; usPosition++)
+    {
+        uint16_t usRow = (pusRowOrder != NULL) ? pusRowOrder[usPosition] : usPosition;
+        const uint8_t *pubLevels = &aaubLevels[ubChannel][(uint32_t)usRow * sEmu.usWidth];
+        uint8_t *pubRow = pubDest + ((uint32_t)usPosition * usDestStride);
+
+        for (uint16_t usByte = 0; usByte < usRowBytes; usByte++)
+        {
+            uint8_t ubPacked = 0;
+            for (uint8_t ubBit = 0; ubBit < 8U; ubBit++)
+            {
+                if (((pubLevels[(usByte * 8U) + ubBit] >> ubPlane) & 1U) != 0U)
+                {
+                    ubPacked |= (uint8_t)(0x80U >> ubBit);
+                }
+            }
+            pubRow[usByte] = ubPacked;
+        }
+    }
+}
+
+/**
+ * @brief Checks the reconstructed image of a face shows every level, to the rounding of
+ *        the dimmed OE times; 1 if it does.
+ *
+ * A failing image is written next to the runner as a PGM snapshot.
+ */
+static uint8_t CheckImage(const sEmuCase_t *psCase, uint8_t ubChannel)
+{
+    uint32_t ulPixels = (uint32_t)sEmu.usWidth * sEmu.usHeight;
+    uint32_t ulMaxLevel = (1UL << psCase->ubPlanes) - 1U;
+
+    LEDEmu_GetImage(&sEmu, ubChannel, aubImage);
+    for (uint32_t ulPixel = 0; ulPixel < ulPixels; ulPixel++)
+    {
+        uint32_t ulExpected = ((aaubLevels[ubChannel][ulPixel] * 255UL) + (ulMaxLevel / 2U)) / ulMaxLevel;
+        if (Difference(aubImage[ulPixel], ulExpected) > 1U)
+        {
+            char acPath[48];
+            (void)snprintf(acPath, sizeof(acPath), "LEDPanelEmulatorTest_%u_%u.pgm",
+                           (unsigned int)(psCase - asEmuCases), (unsigned int)ubChannel);
+            (void)LEDEmu_WritePgm(&sEmu, ubChannel, acPath);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Absolute difference.
+ */
+static uint32_t Difference(uint32_t ulA, uint32_t ulB)
+{
+    return (ulA > ulB) ? (ulA - ulB) : (ulB - ulA);
+}
@@ -0,0 +1,31 @@
+/**
+ * @file LEDPanelEmulatorTest.h
+ * @brief Regression table of the timed scan on the panel emulator (LEDScan, LEDPanelEmulator).
+ *
+ * Packs a known image with the LED driver and shows the driver's own payloads on the
+ * emulator: through the scan engine on the emulator's scan HAL and through an eDMA chain
+ * run on the emulated bus. Covers the installed geometry, mono and BCM gray (packed and
+ * streamed bit-planes), a double-sided unit with its mirrored rear chain, blank addresses
+ * skipped, dimmed and at a fixed refresh period, and zigzag, rotated and serpentine
+ * wiring. The emulated refresh rate and OE duty must match the expected figures and the
+ * reconstructed image the packed one; a failing image is written as a PGM file. Host
+ * only, like the emulator; leaves the LED driver unconfigured.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_TEST_LEDPANELEMULATORTEST_H_
+#define HAL_LEDDRIVERINTERFACE_TEST_LEDPANELEMULATORTEST_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t LEDPanelEmulatorTest_Run(void);
+
+#endif /* HAL_LEDDRIVERINTERFACE_TEST_LEDPANELEMULATORTEST_H_ */
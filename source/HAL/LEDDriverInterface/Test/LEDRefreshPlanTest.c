@@ -0,0 +1,168 @@
+/**
+ * @file LEDRefreshPlanTest.c
+ * @brief Table test of the refresh budget planner (LEDRefreshPlan).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/Test/LEDRefreshPlanTest.h"
+#include "HAL/LEDDriverInterface/LEDRefreshPlan.h"
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+// Board timing, as LEDDriver plans it
+#define TEST_SPI_CLOCK_HZ       105600000UL
+#define TEST_MAX_BAUDRATE       10000000UL
+#define TEST_LATCH_NS           10000UL
+#define TEST_BLANKING_NS        100000UL
+#define TEST_STEP_SLACK_NS      2000UL
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef struct {
+    uint32_t ulSpiClockHz;
+    uint32_t ulMaxBaudRate;
+    uint8_t  ubResult;
+    uint8_t  ubPrescale;
+    uint8_t  ubSckDiv;
+    uint32_t ulBaudRate;
+} sDividerCase_t;
+
+typedef struct {
+    uint8_t  ubPanels;
+    uint16_t usPanelColumns;
+    uint8_t  ubRowsPerAddress;
+    uint8_t  ubScanRate;
+    uint8_t  ubPlanes;
+    uint32_t ulMinUnitNs;
+    uint32_t ulTargetRefreshHz;
+    // Expected
+    uint8_t  ubResult;
+    uint32_t ulShiftNs;
+    uint32_t ulUnitNs;
+    uint32_t ulCycleNs;
+    uint32_t ulMaxRefreshMilliHz;
+    uint32_t ulShortfallMilliHz;
+} sPlanCase_t;
+
+//-------------------------------------[ STATIC VARIABLE ] --------------------------//
+//
+// SCK = clock / (2^prescale * (sckdiv + 2)), fastest not above the limit
+static const sDividerCase_t asDividerCases[] = {
+    { TEST_SPI_CLOCK_HZ, TEST_MAX_BAUDRATE, 1U, 0U, 9U,   9600000UL },
+    { TEST_SPI_CLOCK_HZ, 500000UL,          1U, 0U, 210U, 498113UL },  // The former fixed 500 kHz
+    { TEST_SPI_CLOCK_HZ, 100000UL,          1U, 3U, 130U, 100000UL },  // Needs the prescaler
+    { TEST_SPI_CLOCK_HZ, 200000000UL,       1U, 0U, 0U,   52800000UL },// Limit above clock / 2
+    { TEST_SPI_CLOCK_HZ, 1000UL,            0U, 0U, 0U,   0UL },       // Below the slowest divider
+};
+
+// 64-column panels, 1/8 scan unless noted, target 120 Hz
+static const sPlanCase_t asPlanCases[] = {
+    // Installed: two 16-row panels, one plane
+    { 2U, 64U, 2U, 8U, 1U, 100000UL, 120U,   1U, 26667UL,  902999UL, 8333328UL,   523742UL, 0UL },
+    // Installed, free running: the shortest unit
+    { 2U, 64U, 2U, 8U, 1U, 100000UL, 0U,     1U, 26667UL,  100000UL, 1909336UL,   523742UL, 0UL },
+    // Installed, 16 gray levels with a 10 us unit
+    { 2U, 64U, 2U, 8U, 4U, 10000UL,  120U,   1U, 26667UL,  32466UL,  8333264UL,   177388UL, 0UL },
+    // Installed, 16 gray levels with the default 100 us unit: out of budget
+    { 2U, 64U, 2U, 8U, 4U, 100000UL, 120U,   0U, 26667UL,  100000UL, 16437344UL,  60837UL,  59163UL },
+    // Two 16-row panels, 1/4 scan
+    { 2U, 64U, 4U, 4U, 1U, 100000UL, 120U,   1U, 53334UL,  1917999UL, 8333332UL,  942208UL, 0UL },
+    // Sixteen 16-row panels, one plane
+    { 16U, 64U, 2U, 8U, 1U, 100000UL, 120U,  1U, 213334UL, 716332UL, 8333328UL,   293886UL, 0UL },
+    // Sixteen 16-row panels, 8 gray levels: just out of budget
+    { 16U, 64U, 2U, 8U, 3U, 10000UL, 120U,   0U, 213334UL, 10000UL,  8368016UL,   119502UL, 498UL },
+};
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static uint8_t CheckDividerCase(const sDividerCase_t *psCase);
+static uint8_t CheckPlanCase(const sPlanCase_t *psCase);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Runs the divider and planner tables.
+ *
+ * @return Number of failing cases (0 - all passed).
+ */
+uint8_t LEDRefreshPlanTest_Run(void)
+{
+    uint8_t ubFailures = 0;
+
+    for (uint32_t ulCase = 0; ulCase < (sizeof(asDividerCases) / sizeof(asDividerCases[0])); ulCase++)
+    {
+        ubFailures += (CheckDividerCase(&asDividerCases[ulCase]) == 0) ? 1U : 0U;
+    }
+    for (uint32_t ulCase = 0; ulCase < (sizeof(asPlanCases) / sizeof(asPlanCases[0])); ulCase++)
+    {
+        ubFailures += (CheckPlanCase(&asPlanCases[ulCase]) == 0) ? 1U : 0U;
+    }
+    return ubFailures;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Checks one divider case; 1 if it passes.
+ */
+static uint8_t CheckDividerCase(const sDividerCase_t *psCase)
+{
+    sLEDSpiDivider_t sDivider = { 0 };
+    uint8_t ubResult = LEDRefreshPlan_SelectSpiDivider(psCase->ulSpiClockHz, psCase->ulMaxBaudRate, &sDivider);
+
+    if (ubResult != psCase->ubResult)
+    {
+        return 0;
+    }
+    if (ubResult == 0)
+    {
+        return 1;
+    }
+    return ((sDivider.ubPrescale == psCase->ubPrescale) && (sDivider.ubSckDiv == psCase->ubSckDiv) &&
+            (sDivider.ulBaudRate == psCase->ulBaudRate) && (sDivider.ulBaudRate <= psCase->ulMaxBaudRate)) ? 1U : 0U;
+}
+
+/**
+ * @brief Checks one planner case against the table and the invariants; 1 if it passes.
+ */
+static uint8_t CheckPlanCase(const sPlanCase_t *psCase)
+{
+    sLEDRefreshBudget_t sBudget;
+    sLEDRefreshPlan_t sPlan;
+
+    sBudget.ubPanels = psCase->ubPanels;
+    sBudget.usPanelColumns = psCase->usPanelColumns;
+    sBudget.ubRowsPerAddress = psCase->ubRowsPerAddress;
+    sBudget.ubScanRate = psCase->ubScanRate;
+    sBudget.ubPlanes = psCase->ubPlanes;
+    sBudget.ulSpiClockHz = TEST_SPI_CLOCK_HZ;
+    sBudget.ulMaxBaudRate = TEST_MAX_BAUDRATE;
+    sBudget.ulMinUnitNs = psCase->ulMinUnitNs;
+    sBudget.ulLatchNs = TEST_LATCH_NS;
+    sBudget.ulBlankingNs = TEST_BLANKING_NS;
+    sBudget.ulStepSlackNs = TEST_STEP_SLACK_NS;
+    sBudget.ulTargetRefreshHz = psCase->ulTargetRefreshHz;
+
+    if ((LEDRefreshPlan_Compute(&sBudget, &sPlan) != psCase->ubResult) ||
+        (sPlan.ulShiftNs != psCase->ulShiftNs) || (sPlan.ulUnitNs != psCase->ulUnitNs) ||
+        (sPlan.ulCycleNs != psCase->ulCycleNs) || (sPlan.ulMaxRefreshMilliHz != psCase->ulMaxRefreshMilliHz) ||
+        (sPlan.ulShortfallMilliHz != psCase->ulShortfallMilliHz))
+    {
+        return 0;
+    }
+
+    // A reached target fits its period; the unit is never below the shortest one
+    if ((psCase->ubResult != 0) && (psCase->ulTargetRefreshHz != 0) &&
+        (sPlan.ulCycleNs > (1000000000UL / psCase->ulTargetRefreshHz)))
+    {
+        return 0;
+    }
+    return (sPlan.ulUnitNs >= psCase->ulMinUnitNs) ? 1U : 0U;
+}
@@ -0,0 +1,26 @@
+/**
+ * @file LEDRefreshPlanTest.h
+ * @brief Table test of the refresh budget planner (LEDRefreshPlan).
+ *
+ * Plans the geometries installed in the field and checks the SPI divider, OE unit,
+ * cycle time and shortfall against values worked out by hand. No hardware dependency:
+ * runs on the host or on the target.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_TEST_LEDREFRESHPLANTEST_H_
+#define HAL_LEDDRIVERINTERFACE_TEST_LEDREFRESHPLANTEST_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t LEDRefreshPlanTest_Run(void);
+
+#endif /* HAL_LEDDRIVERINTERFACE_TEST_LEDREFRESHPLANTEST_H_ */
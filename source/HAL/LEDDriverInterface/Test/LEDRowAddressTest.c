@@ -0,0 +1,179 @@
+/**
+ * @file LEDRowAddressTest.c
+ * @brief Table test of the row address output table (LEDRowAddress).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/Test/LEDRowAddressTest.h"
+#include "HAL/LEDDriverInterface/LEDRowAddress.h"
+#include <stddef.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define TEST_LAYOUTS            2U
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef struct {
+    uint8_t  ubAddressBits;
+    uint8_t  ubLayout;              // Index into aaulLineMasks
+} sRowAddressCase_t;
+
+//-------------------------------------[ STATIC VARIABLE ] --------------------------//
+//
+// A0..A4 on consecutive pins, and out of order on high pins as on the board
+static const uint32_t aaulLineMasks[TEST_LAYOUTS][LED_ROW_ADDRESS_MAX_LINES] = {
+    { 1UL << 0,  1UL << 1,  1UL << 2,  1UL << 3,  1UL << 4 },
+    { 1UL << 23, 1UL << 22, 1UL << 24, 1UL << 25, 1UL << 31 },
+};
+
+// Reflected Gray code of binary 0..31
+static const uint8_t aubGrayGolden[LED_ROW_ADDRESS_MAX_ENTRIES] = {
+    0x00, 0x01, 0x03, 0x02, 0x06, 0x07, 0x05, 0x04, 0x0C, 0x0D, 0x0F, 0x0E, 0x0A, 0x0B, 0x09, 0x08,
+    0x18, 0x19, 0x1B, 0x1A, 0x1E, 0x1F, 0x1D, 0x1C, 0x14, 0x15, 0x17, 0x16, 0x12, 0x13, 0x11, 0x10,
+};
+
+static const sRowAddressCase_t asRowAddressCases[] = {
+    { 1U, 0U }, { 2U, 0U }, { 3U, 0U }, { 4U, 0U }, { 5U, 0U },
+    { 1U, 1U }, { 2U, 1U }, { 3U, 1U }, { 4U, 1U }, { 5U, 1U },
+};
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static uint8_t CheckGrayCodes(void);
+static uint8_t CheckRowAddressCase(const sRowAddressCase_t *psCase);
+static uint8_t CheckRejected(void);
+static uint8_t CountBits(uint32_t ulValue);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Runs the Gray code check, the table cases and the rejected parameters.
+ *
+ * @return Number of failing cases (0 - all passed).
+ */
+uint8_t LEDRowAddressTest_Run(void)
+{
+    uint8_t ubFailures = 0;
+
+    ubFailures += (CheckGrayCodes() == 0) ? 1U : 0U;
+    for (uint32_t ulCase = 0; ulCase < (sizeof(asRowAddressCases) / sizeof(asRowAddressCases[0])); ulCase++)
+    {
+        ubFailures += (CheckRowAddressCase(&asRowAddressCases[ulCase]) == 0) ? 1U : 0U;
+    }
+    ubFailures += (CheckRejected() == 0) ? 1U : 0U;
+    return ubFailures;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Compares LEDRowAddress_BinaryToGray() with the golden codes; 1 if they match.
+ */
+static uint8_t CheckGrayCodes(void)
+{
+    for (uint8_t ubBin = 0; ubBin < LED_ROW_ADDRESS_MAX_ENTRIES; ubBin++)
+    {
+        if (LEDRowAddress_BinaryToGray(ubBin) != aubGrayGolden[ubBin])
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Builds the table of one case and checks every entry; 1 if it passes.
+ */
+static uint8_t CheckRowAddressCase(const sRowAddressCase_t *psCase)
+{
+    sLEDRowAddressOutput_t asTable[LED_ROW_ADDRESS_MAX_ENTRIES + 1U];
+    const uint32_t *pulMasks = aaulLineMasks[psCase->ubLayout];
+    uint32_t ulEntries = 1UL << psCase->ubAddressBits;
+    uint32_t ulAllLines = 0;
+    uint32_t ulSeen = 0;
+
+    for (uint8_t ubLine = 0; ubLine < psCase->ubAddressBits; ubLine++)
+    {
+        ulAllLines |= pulMasks[ubLine];
+    }
+
+    // The entry after the last one must stay untouched
+    asTable[ulEntries].ulSet = 0xDEADBEEFUL;
+    asTable[ulEntries].ulClear = 0xDEADBEEFUL;
+    if (LEDRowAddress_BuildTable(pulMasks, psCase->ubAddressBits, asTable) == 0)
+    {
+        return 0;
+    }
+
+    for (uint32_t ulAddress = 0; ulAddress < ulEntries; ulAddress++)
+    {
+        const sLEDRowAddressOutput_t *psEntry = &asTable[ulAddress];
+        const sLEDRowAddressOutput_t *psNext = &asTable[(ulAddress + 1U) % ulEntries];
+        uint32_t ulExpected = 0;
+        uint8_t ubLines = 0;
+
+        for (uint8_t ubLine = 0; ubLine < psCase->ubAddressBits; ubLine++)
+        {
+            if ((aubGrayGolden[ulAddress] & (1U << ubLine)) != 0U)
+            {
+                ulExpected |= pulMasks[ubLine];
+            }
+            // Line state read back as a code, to see every code used once
+            ubLines |= ((psEntry->ulSet & pulMasks[ubLine]) != 0U) ? (uint8_t)(1U << ubLine) : 0U;
+        }
+
+        uint32_t ulChanged = psEntry->ulSet ^ psNext->ulSet;
+        if ((psEntry->ulSet != ulExpected) || ((psEntry->ulSet & psEntry->ulClear) != 0U) ||
+            ((psEntry->ulSet | psEntry->ulClear) != ulAllLines) ||
+            (CountBits(ulChanged) != 1U) || ((ulChanged & ulAllLines) != ulChanged) ||
+            ((ulSeen & (1UL << ubLines)) != 0U))
+        {
+            return 0;
+        }
+        ulSeen |= 1UL << ubLines;
+    }
+
+    return ((asTable[ulEntries].ulSet == 0xDEADBEEFUL) && (asTable[ulEntries].ulClear == 0xDEADBEEFUL)) ? 1U : 0U;
+}
+
+/**
+ * @brief Checks the parameters the builder must reject, and the empty table of no
+ *        address lines; 1 if it behaves.
+ */
+static uint8_t CheckRejected(void)
+{
+    sLEDRowAddressOutput_t asTable[LED_ROW_ADDRESS_MAX_ENTRIES];
+
+    if ((LEDRowAddress_BuildTable(aaulLineMasks[0], LED_ROW_ADDRESS_MAX_LINES + 1U, asTable) != 0) ||
+        (LEDRowAddress_BuildTable(aaulLineMasks[0], 3U, NULL) != 0) ||
+        (LEDRowAddress_BuildTable(NULL, 3U, asTable) != 0))
+    {
+        return 0;
+    }
+
+    // A panel without address lines: one entry that writes nothing
+    asTable[0].ulSet = 0xFFFFFFFFUL;
+    asTable[0].ulClear = 0xFFFFFFFFUL;
+    return ((LEDRowAddress_BuildTable(NULL, 0U, asTable) != 0) && (asTable[0].ulSet == 0U) &&
+            (asTable[0].ulClear == 0U)) ? 1U : 0U;
+}
+
+static uint8_t CountBits(uint32_t ulValue)
+{
+    uint8_t ubBits = 0;
+
+    while (ulValue != 0U)
+    {
+        ulValue &= ulValue - 1U;
+        ubBits++;
+    }
+    return ubBits;
+}
@@ -0,0 +1,29 @@
+/**
+ * @file LEDRowAddressTest.h
+ * @brief Table test of the row address output table (LEDRowAddress).
+ *
+ * Builds the table for 1 to 5 address lines on two pin layouts and checks, for every
+ * scan address in binary order, that the lines carry its Gray code, that the set and
+ * clear masks are disjoint and together cover every line, that consecutive addresses
+ * (the last back to the first included) change exactly one line and that every line
+ * state is used once. Also checks the Gray codes and the rejected parameters. No
+ * hardware dependency: runs on the host or on the target.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_TEST_LEDROWADDRESSTEST_H_
+#define HAL_LEDDRIVERINTERFACE_TEST_LEDROWADDRESSTEST_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t LEDRowAddressTest_Run(void);
+
+#endif /* HAL_LEDDRIVERINTERFACE_TEST_LEDROWADDRESSTEST_H_ */
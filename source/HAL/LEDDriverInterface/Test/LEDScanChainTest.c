@@ -0,0 +1,263 @@
+/**
+ * @file LEDScanChainTest.c
+ * @brief Table test of the scan cycle eDMA chain (LEDScanChain).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/LEDDriverInterface/Test/LEDScanChainTest.h"
+#include "HAL/LEDDriverInterface/LEDScanChain.h"
+#include <stddef.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+// Bus addresses the chain is built for; it is only inspected, never installed
+#define TEST_TCD_ADDRESS            0x20200000UL
+#define TEST_GPIO_WORDS_ADDRESS     0x20201000UL
+#define TEST_PAYLOAD_ADDRESS        0x20202000UL
+#define TEST_TCR_VALUE_ADDRESS      0x20203000UL
+#define TEST_SPI_TCR_ADDRESS        0x40394060UL    // LPSPI1 TCR
+#define TEST_SPI_TDR_ADDRESS        0x40394064UL    // LPSPI1 TDR
+#define TEST_GPIO_SET_ADDRESS       0x401B8084UL    // GPIO1 DR_SET
+#define TEST_LATCH_MASK             (1UL << 2)
+#define TEST_OE_MASK                (1UL << 3)
+
+#define TEST_MAX_SCAN_RATE          16U
+#define TEST_MAX_TCDS               ((TEST_MAX_SCAN_RATE * LED_CHAIN_TCDS_PER_STEP) + LED_CHAIN_TAIL_TCDS)
+#define TEST_MAX_GPIO_WORDS         (((TEST_MAX_SCAN_RATE * LED_CHAIN_GPIO_WRITES_PER_STEP) + 1U) * LED_CHAIN_WORDS_PER_GPIO_WRITE)
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef struct {
+    uint8_t  ubAddressBits;     // Scan rate = 1 << ubAddressBits
+    uint32_t ulPayloadBytes;    // Bytes shifted per scan address
+    uint32_t ulTcdCount;        // Expected TCDs: 5 per address + 3 tail
+} sChainCase_t;
+
+//-------------------------------------[ STATIC VARIABLE ] --------------------------//
+//
+// Row address lines A0..A3 as routed on the board
+static const uint32_t aulAddressLines[] = { 1UL << 23, 1UL << 22, 1UL << 24, 1UL << 25 };
+
+static const sChainCase_t asChainCases[] = {
+    { 2U, 32U,  23U },  // 1/4 scan, two 16-row panels
+    { 3U, 16U,  43U },  // 1/8 scan, the installed geometry
+    { 4U, 256U, 83U },  // 1/16 scan, sixteen 64-row panels
+};
+
+static sLEDChainTcd_t asTcds[TEST_MAX_TCDS];
+static uint32_t aulGpioWords[TEST_MAX_GPIO_WORDS];
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static uint8_t CheckChainCase(const sChainCase_t *psCase);
+static uint8_t CheckPayloadTcd(const sLEDChainTcd_t *psTcd, uint32_t ulSource, uint32_t ulPayloadBytes);
+static uint8_t CheckBarrierTcd(const sLEDChainTcd_t *psTcd);
+static uint8_t CheckGpioTcd(const sLEDChainTcd_t *psTcd, uint32_t ulWord, uint32_t ulSet, uint32_t ulClear);
+static uint8_t CheckLinks(uint32_t ulTcdCount);
+static uint8_t CheckRejections(void);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Runs the chain table and the rejected parameters.
+ *
+ * @return Number of failing cases (0 - all passed).
+ */
+uint8_t LEDScanChainTest_Run(void)
+{
+    uint8_t ubFailures = 0;
+
+    for (uint32_t ulCase = 0; ulCase < (sizeof(asChainCases) / sizeof(asChainCases[0])); ulCase++)
+    {
+        ubFailures += (CheckChainCase(&asChainCases[ulCase]) == 0) ? 1U : 0U;
+    }
+    ubFailures += (CheckRejections() == 0) ? 1U : 0U;
+    return ubFailures;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Fills a chain configuration at the test addresses.
+ */
+static void SetConfig(sLEDChainConfig_t *psConfig, uint8_t ubScanRate, uint32_t ulPayloadBytes,
+                      const sLEDRowAddressOutput_t *psAddressTable)
+{
+    psConfig->ulTcdAddress = TEST_TCD_ADDRESS;
+    psConfig->ulGpioWordsAddress = TEST_GPIO_WORDS_ADDRESS;
+    psConfig->ulPayloadAddress = TEST_PAYLOAD_ADDRESS;
+    psConfig->ulPayloadBytes = ulPayloadBytes;
+    psConfig->ubScanRate = ubScanRate;
+    psConfig->psAddressTable = psAddressTable;
+    psConfig->ulSpiTdrAddress = TEST_SPI_TDR_ADDRESS;
+    psConfig->ulSpiTcrAddress = TEST_SPI_TCR_ADDRESS;
+    psConfig->ulTcrValueAddress = TEST_TCR_VALUE_ADDRESS;
+    psConfig->ulGpioSetAddress = TEST_GPIO_SET_ADDRESS;
+    psConfig->ulLatchMask = TEST_LATCH_MASK;
+    psConfig->ulOutputEnableMask = TEST_OE_MASK;
+}
+
+/**
+ * @brief Builds one chain and checks every TCD and GPIO word; 1 if it passes.
+ *
+ * Per scan address: payload -> TDR, TCR barrier, then blank (OE off), select (row
+ * address, LE high) and show (LE low, OE on), each one DR_SET then DR_CLEAR write. The
+ * tail shifts the last payload again, barriers and blanks.
+ */
+static uint8_t CheckChainCase(const sChainCase_t *psCase)
+{
+    sLEDRowAddressOutput_t asAddressTable[LED_ROW_ADDRESS_MAX_ENTRIES];
+    sLEDChainConfig_t sConfig;
+    uint8_t ubScanRate = (uint8_t)(1U << psCase->ubAddressBits);
+    uint32_t ulTcd = 0;
+
+    if ((LEDChain_GetTcdCount(ubScanRate) != psCase->ulTcdCount) ||
+        (LEDRowAddress_BuildTable(aulAddressLines, psCase->ubAddressBits, asAddressTable) == 0))
+    {
+        return 0;
+    }
+    SetConfig(&sConfig, ubScanRate, psCase->ulPayloadBytes, asAddressTable);
+    if (LEDChain_Build(&sConfig, asTcds, aulGpioWords) == 0)
+    {
+        return 0;
+    }
+
+    for (uint8_t ubStep = 0; ubStep < ubScanRate; ubStep++)
+    {
+        uint32_t ulWord = (uint32_t)ubStep * LED_CHAIN_GPIO_WRITES_PER_STEP * LED_CHAIN_WORDS_PER_GPIO_WRITE;
+
+        if ((CheckPayloadTcd(&asTcds[ulTcd++], TEST_PAYLOAD_ADDRESS + (ubStep * psCase->ulPayloadBytes), psCase->ulPayloadBytes) == 0) ||
+            (CheckBarrierTcd(&asTcds[ulTcd++]) == 0) ||
+            (CheckGpioTcd(&asTcds[ulTcd++], ulWord, TEST_OE_MASK, 0U) == 0) ||
+            (CheckGpioTcd(&asTcds[ulTcd++], ulWord + 2U, asAddressTable[ubStep].ulSet | TEST_LATCH_MASK,
+                          asAddressTable[ubStep].ulClear) == 0) ||
+            (CheckGpioTcd(&asTcds[ulTcd++], ulWord + 4U, 0U, TEST_LATCH_MASK | TEST_OE_MASK) == 0))
+        {
+            return 0;
+        }
+    }
+
+    uint32_t ulTailWord = (uint32_t)ubScanRate * LED_CHAIN_GPIO_WRITES_PER_STEP * LED_CHAIN_WORDS_PER_GPIO_WRITE;
+    if ((CheckPayloadTcd(&asTcds[ulTcd++], TEST_PAYLOAD_ADDRESS + ((ubScanRate - 1U) * psCase->ulPayloadBytes), psCase->ulPayloadBytes) == 0) ||
+        (CheckBarrierTcd(&asTcds[ulTcd++]) == 0) ||
+        (CheckGpioTcd(&asTcds[ulTcd++], ulTailWord, TEST_OE_MASK, 0U) == 0) ||
+        (ulTcd != psCase->ulTcdCount))
+    {
+        return 0;
+    }
+    return CheckLinks(psCase->ulTcdCount);
+}
+
+/**
+ * @brief Payload TCD: one byte per request into TDR, the whole payload in the major loop.
+ */
+static uint8_t CheckPayloadTcd(const sLEDChainTcd_t *psTcd, uint32_t ulSource, uint32_t ulPayloadBytes)
+{
+    return ((psTcd->SADDR == ulSource) && (psTcd->SOFF == 1) && (psTcd->ATTR == LED_CHAIN_ATTR_8BIT) &&
+            (psTcd->NBYTES == 1U) && (psTcd->DADDR == TEST_SPI_TDR_ADDRESS) && (psTcd->DOFF == 0) &&
+            (psTcd->CITER == ulPayloadBytes) && (psTcd->BITER == ulPayloadBytes)) ? 1U : 0U;
+}
+
+/**
+ * @brief Barrier TCD: the TCR value word rewritten once into TCR.
+ */
+static uint8_t CheckBarrierTcd(const sLEDChainTcd_t *psTcd)
+{
+    return ((psTcd->SADDR == TEST_TCR_VALUE_ADDRESS) && (psTcd->SOFF == 0) && (psTcd->ATTR == LED_CHAIN_ATTR_32BIT) &&
+            (psTcd->NBYTES == sizeof(uint32_t)) && (psTcd->DADDR == TEST_SPI_TCR_ADDRESS) && (psTcd->DOFF == 0) &&
+            (psTcd->CITER == 1U) && (psTcd->BITER == 1U)) ? 1U : 0U;
+}
+
+/**
+ * @brief GPIO TCD: two words from aulGpioWords[ulWord] to DR_SET then DR_CLEAR, and their values.
+ */
+static uint8_t CheckGpioTcd(const sLEDChainTcd_t *psTcd, uint32_t ulWord, uint32_t ulSet, uint32_t ulClear)
+{
+    return ((psTcd->SADDR == (TEST_GPIO_WORDS_ADDRESS + (ulWord * sizeof(uint32_t)))) &&
+            (psTcd->SOFF == (int16_t)sizeof(uint32_t)) && (psTcd->ATTR == LED_CHAIN_ATTR_32BIT) &&
+            (psTcd->NBYTES == (LED_CHAIN_WORDS_PER_GPIO_WRITE * sizeof(uint32_t))) &&
+            (psTcd->DADDR == TEST_GPIO_SET_ADDRESS) && (psTcd->DOFF == (int16_t)sizeof(uint32_t)) &&
+            (psTcd->CITER == 1U) && (psTcd->BITER == 1U) &&
+            (aulGpioWords[ulWord] == ulSet) && (aulGpioWords[ulWord + 1U] == ulClear)) ? 1U : 0U;
+}
+
+/**
+ * @brief Checks the scatter-gather links; 1 if they pass.
+ *
+ * Every TCD but the last links to the next one and only enables scatter-gather; the
+ * last one has no link, raises the major loop interrupt and clears the request. Walking
+ * the links from TCD 0 reaches every TCD once.
+ */
+static uint8_t CheckLinks(uint32_t ulTcdCount)
+{
+    uint32_t ulVisited = 0;
+    uint32_t ulAddress = TEST_TCD_ADDRESS;
+
+    if (sizeof(sLEDChainTcd_t) != LED_CHAIN_TCD_ALIGNMENT)
+    {
+        return 0;
+    }
+    for (uint32_t ulTcd = 0; (ulTcd + 1U) < ulTcdCount; ulTcd++)
+    {
+        if ((asTcds[ulTcd].DLAST_SGA != (int32_t)(TEST_TCD_ADDRESS + ((ulTcd + 1U) * sizeof(sLEDChainTcd_t)))) ||
+            (asTcds[ulTcd].CSR != LED_CHAIN_CSR_ESG))
+        {
+            return 0;
+        }
+    }
+    if ((asTcds[ulTcdCount - 1U].DLAST_SGA != 0) ||
+        (asTcds[ulTcdCount - 1U].CSR != (LED_CHAIN_CSR_INTMAJOR | LED_CHAIN_CSR_DREQ)))
+    {
+        return 0;
+    }
+
+    while (ulVisited <= ulTcdCount)
+    {
+        const sLEDChainTcd_t *psTcd = &asTcds[(ulAddress - TEST_TCD_ADDRESS) / sizeof(sLEDChainTcd_t)];
+
+        ulVisited++;
+        if ((psTcd->CSR & LED_CHAIN_CSR_ESG) == 0U)
+        {
+            break;
+        }
+        ulAddress = (uint32_t)psTcd->DLAST_SGA;
+    }
+    return (ulVisited == ulTcdCount) ? 1U : 0U;
+}
+
+/**
+ * @brief Checks invalid configurations are rejected; 1 if they are.
+ */
+static uint8_t CheckRejections(void)
+{
+    sLEDRowAddressOutput_t asAddressTable[LED_ROW_ADDRESS_MAX_ENTRIES];
+    sLEDChainConfig_t sConfig;
+    uint8_t ubRejected = 0;
+
+    (void)LEDRowAddress_BuildTable(aulAddressLines, 3U, asAddressTable);
+
+    SetConfig(&sConfig, 8U, 16U, asAddressTable);
+    sConfig.ulTcdAddress += 4U;                     // Scatter-gather TCDs must be 32 byte aligned
+    ubRejected += (LEDChain_Build(&sConfig, asTcds, aulGpioWords) == 0) ? 1U : 0U;
+
+    SetConfig(&sConfig, 8U, 0U, asAddressTable);    // Nothing to shift
+    ubRejected += (LEDChain_Build(&sConfig, asTcds, aulGpioWords) == 0) ? 1U : 0U;
+
+    SetConfig(&sConfig, 8U, 0x8000U, asAddressTable); // Beyond the major loop count
+    ubRejected += (LEDChain_Build(&sConfig, asTcds, aulGpioWords) == 0) ? 1U : 0U;
+
+    SetConfig(&sConfig, 0U, 16U, asAddressTable);   // No scan address
+    ubRejected += (LEDChain_Build(&sConfig, asTcds, aulGpioWords) == 0) ? 1U : 0U;
+
+    SetConfig(&sConfig, 8U, 16U, NULL);
+    ubRejected += (LEDChain_Build(&sConfig, asTcds, aulGpioWords) == 0) ? 1U : 0U;
+
+    return (ubRejected == 5U) ? 1U : 0U;
+}
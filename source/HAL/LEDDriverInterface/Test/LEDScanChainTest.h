@@ -0,0 +1,27 @@
+/**
+ * @file LEDScanChainTest.h
+ * @brief Table test of the scan cycle eDMA chain (LEDScanChain).
+ *
+ * Builds the TCD list for 1/4, 1/8 and 1/16 scan at made-up bus addresses and checks
+ * the TCD count, the payload -> TDR, TCR barrier, blank/select/show GPIO order of every
+ * step, the DLAST_SGA links and that only the last TCD raises the interrupt and stops
+ * the channel. No hardware dependency: runs on the host or on the target.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_LEDDRIVERINTERFACE_TEST_LEDSCANCHAINTEST_H_
+#define HAL_LEDDRIVERINTERFACE_TEST_LEDSCANCHAINTEST_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t LEDScanChainTest_Run(void);
+
+#endif /* HAL_LEDDRIVERINTERFACE_TEST_LEDSCANCHAINTEST_H_ */
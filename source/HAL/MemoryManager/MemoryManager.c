@@ -0,0 +1,635 @@
+/**
+ * @file MemoryManager.c
+ * @brief Region-aware arena allocator.
+ *
+ * Each region is one arena carved into blocks. A block starts with a header of
+ * MM_ALIGNMENT bytes followed by its payload; headers record the block size and the size
+ * of the previous block so that freeing coalesces with both neighbours in constant time.
+ * Allocation is first fit. Blocks are only allocated and freed during (re)configuration,
+ * never from interrupt context, so the allocator takes no locks.
+ *
+ * Define MM_HOST_SIMULATION to back the regions with plain static buffers instead of
+ * linker-placed arenas; tests may also hand in their own buffers via MM_RegisterRegion().
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <string.h>
+#include "HAL/MemoryManager/MemoryManager.h"
+#if !defined(MM_HOST_SIMULATION)
+#include "fsl_common.h"
+#endif
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define MM_BLOCK_USED           0x4D4D5553UL    // "MMUS"
+#define MM_BLOCK_FREE           0x4D4D4652UL    // "MMFR"
+#define MM_HEADER_SIZE          MM_ALIGNMENT
+#define MM_MIN_SPLIT_SIZE       (MM_HEADER_SIZE + MM_ALIGNMENT)
+#define MM_MAX_POLICY_REGIONS   MM_REGION_COUNT
+#define MM_PLAN_MAX_SPANS       64U     // Free spans tracked by MM_CheckPlan()
+
+#if defined(MM_HOST_SIMULATION)
+#define MM_DTCM_SECTION         __attribute__((aligned(MM_ALIGNMENT)))
+#define MM_OCRAM_NC_SECTION     __attribute__((aligned(MM_NONCACHEABLE_ARENA_SIZE)))
+#define MM_SDRAM_SECTION        __attribute__((aligned(MM_ALIGNMENT)))
+#else
+#define MM_DTCM_SECTION         __attribute__((section(".bss.$SRAM_DTC"), aligned(MM_ALIGNMENT)))
+#define MM_OCRAM_NC_SECTION     __attribute__((section(".bss.$SRAM_OC"), aligned(MM_NONCACHEABLE_ARENA_SIZE)))
+#define MM_SDRAM_SECTION        __attribute__((section(".noinit.$BOARD_SDRAM"), aligned(MM_ALIGNMENT)))
+#endif
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief Block header; padded to MM_HEADER_SIZE so payloads stay aligned.
+ */
+typedef union {
+    struct {
+        uint32_t ulSize;        // Whole block including header, multiple of MM_ALIGNMENT
+        uint32_t ulPrevSize;    // Size of the previous block, 0 for the first one
+        uint32_t ulTag;         // MM_BLOCK_USED or MM_BLOCK_FREE
+    } sInfo;
+    uint8_t aubPad[MM_HEADER_SIZE];
+} uMMBlockHeader_t;
+
+/**
+ * @brief Free block as seen by MM_CheckPlan().
+ */
+typedef struct {
+    uintptr_t   ulStart;        // Block (header) address
+    uint32_t    ulSize;         // Whole block including header
+    eMMRegion_t eRegion;
+} sMMPlanSpan_t;
+
+/**
+ * @brief One arena.
+ */
+typedef struct {
+    uint8_t          *pubBase;
+    uint8_t          *pubEnd;
+    sMMRegionStats_t  sStats;
+} sMMRegion_t;
+
+//-------------------------------------[ STATIC VARIABLES ] -------------------------//
+//
+static uint8_t aubDtcmArena[MM_DTCM_ARENA_SIZE] MM_DTCM_SECTION;
+static uint8_t aubOcramNcArena[MM_NONCACHEABLE_ARENA_SIZE] MM_OCRAM_NC_SECTION;
+#if defined(MM_SDRAM_AVAILABLE)
+static uint8_t aubSdramArena[MM_SDRAM_ARENA_SIZE] MM_SDRAM_SECTION;
+#endif
+
+static sMMRegion_t sRegions[MM_REGION_COUNT];
+
+/**
+ * @brief Placement policy: regions tried in order for each purpose.
+ *
+ * DMA sources go to non-cacheable OCRAM first so the CPU can write the next payload
+ * without cache maintenance; DTCM is the fallback since it is uncached as well. Render
+ * targets and tables prefer DTCM for zero wait state CPU access.
+ */
+static const eMMRegion_t aePolicy[MM_PURPOSE_COUNT][MM_MAX_POLICY_REGIONS] = {
+    [MM_PURPOSE_RENDER_TARGET] = { MM_REGION_DTCM,               MM_REGION_SDRAM, MM_REGION_OCRAM_NONCACHEABLE },
+    [MM_PURPOSE_DMA_SOURCE]    = { MM_REGION_OCRAM_NONCACHEABLE, MM_REGION_DTCM,  MM_REGION_NONE },
+    [MM_PURPOSE_LOOKUP_TABLE]  = { MM_REGION_DTCM,               MM_REGION_SDRAM, MM_REGION_OCRAM_NONCACHEABLE },
+    [MM_PURPOSE_GENERAL]       = { MM_REGION_SDRAM,              MM_REGION_OCRAM_NONCACHEABLE, MM_REGION_DTCM },
+};
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static uMMBlockHeader_t *NextBlock(const sMMRegion_t *psRegion, uMMBlockHeader_t *psBlock);
+static uMMBlockHeader_t *PrevBlock(const sMMRegion_t *psRegion, uMMBlockHeader_t *psBlock);
+static void SetSize(const sMMRegion_t *psRegion, uMMBlockHeader_t *psBlock, uint32_t ulSize);
+static void UpdateLargestFree(sMMRegion_t *psRegion);
+static bool PlaceInSpans(sMMPlanSpan_t *psSpans, uint8_t *pubSpans, eMMRegion_t eRegion,
+                         uint32_t ulSize, uint32_t ulAlignment);
+#if !defined(MM_HOST_SIMULATION)
+static void ConfigureNonCacheableWindow(void);
+#endif
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Initializes the allocator with the built-in arenas.
+ *
+ * On target this also programs the MPU so the OCRAM arena is non-cacheable; it must run
+ * after BOARD_ConfigMPU() and before any other MM_ call. Calling it again releases every
+ * block.
+ *
+ * @return 1 on success, 0 on failure.
+ */
+uint8_t MM_Init(void)
+{
+#if !defined(MM_HOST_SIMULATION)
+    ConfigureNonCacheableWindow();
+#endif
+
+    uint8_t ubStatus = MM_RegisterRegion(MM_REGION_DTCM, aubDtcmArena, sizeof(aubDtcmArena));
+    ubStatus &= MM_RegisterRegion(MM_REGION_OCRAM_NONCACHEABLE, aubOcramNcArena, sizeof(aubOcramNcArena));
+#if defined(MM_SDRAM_AVAILABLE)
+    ubStatus &= MM_RegisterRegion(MM_REGION_SDRAM, aubSdramArena, sizeof(aubSdramArena));
+#else
+    // SEMC is not initialized at boot on this board; keep SDRAM out of the policy
+    (void)MM_RegisterRegion(MM_REGION_SDRAM, NULL, 0U);
+#endif
+
+    return ubStatus;
+}
+
+/**
+ * @brief Backs a region with a caller supplied buffer (or disables it with size 0).
+ *
+ * Every block previously allocated from the region is discarded.
+ *
+ * @param eRegion Region to (re)define.
+ * @param pvBase  Start of the buffer; aligned up to MM_ALIGNMENT internally.
+ * @param ulSize  Size of the buffer in bytes.
+ * @return 1 on success, 0 on invalid parameters.
+ */
+uint8_t MM_RegisterRegion(eMMRegion_t eRegion, void *pvBase, uint32_t ulSize)
+{
+    if (eRegion >= MM_REGION_COUNT)
+    {
+        return 0;
+    }
+
+    sMMRegion_t *psRegion = &sRegions[eRegion];
+    (void)memset(psRegion, 0, sizeof(sMMRegion_t));
+
+    if ((NULL == pvBase) || (0U == ulSize))
+    {
+        return 1;
+    }
+
+    uintptr_t ulStart = ((uintptr_t)pvBase + MM_ALIGNMENT - 1U) & ~((uintptr_t)MM_ALIGNMENT - 1U);
+    uintptr_t ulEnd = ((uintptr_t)pvBase + ulSize) & ~((uintptr_t)MM_ALIGNMENT - 1U);
+    if ((ulEnd <= ulStart) || ((ulEnd - ulStart) < MM_MIN_SPLIT_SIZE))
+    {
+        return 0;
+    }
+
+    psRegion->pubBase = (uint8_t *)ulStart;
+    psRegion->pubEnd  = (uint8_t *)ulEnd;
+
+    uMMBlockHeader_t *psFirst = (uMMBlockHeader_t *)psRegion->pubBase;
+    psFirst->sInfo.ulSize     = (uint32_t)(ulEnd - ulStart);
+    psFirst->sInfo.ulPrevSize = 0U;
+    psFirst->sInfo.ulTag      = MM_BLOCK_FREE;
+
+    psRegion->sStats.ulTotalBytes = (uint32_t)(ulEnd - ulStart);
+    UpdateLargestFree(psRegion);
+    return 1;
+}
+
+/**
+ * @brief Allocates a block for a purpose, MM_ALIGNMENT aligned.
+ *
+ * @param ePurpose What the block is used for.
+ * @param ulSize   Payload size in bytes.
+ * @return Pointer to the block, or NULL if no region of the policy can hold it.
+ */
+void *MM_Alloc(eMMPurpose_t ePurpose, uint32_t ulSize)
+{
+    return MM_AllocAligned(ePurpose, ulSize, MM_ALIGNMENT);
+}
+
+/**
+ * @brief Allocates a block for a purpose with a stricter alignment.
+ *
+ * @param ePurpose    What the block is used for.
+ * @param ulSize      Payload size in bytes.
+ * @param ulAlignment Power of two; values below MM_ALIGNMENT are raised to it.
+ * @return Pointer to the block, or NULL if no region of the policy can hold it.
+ */
+void *MM_AllocAligned(eMMPurpose_t ePurpose, uint32_t ulSize, uint32_t ulAlignment)
+{
+    if (ePurpose >= MM_PURPOSE_COUNT)
+    {
+        return NULL;
+    }
+
+    for (uint8_t ubIndex = 0; ubIndex < MM_MAX_POLICY_REGIONS; ubIndex++)
+    {
+        eMMRegion_t eRegion = aePolicy[ePurpose][ubIndex];
+        if (MM_REGION_NONE == eRegion)
+        {
+            break;
+        }
+        if (NULL == sRegions[eRegion].pubBase)
+        {
+            continue;
+        }
+
+        void *pvBlock = MM_AllocInRegion(eRegion, ulSize, ulAlignment);
+        if (NULL != pvBlock)
+        {
+            return pvBlock;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Allocates a block from one specific region.
+ *
+ * @param eRegion     Region to allocate from.
+ * @param ulSize      Payload size in bytes.
+ * @param ulAlignment Power of two; values below MM_ALIGNMENT are raised to it.
+ * @return Pointer to the block, or NULL if the region cannot hold it.
+ */
+void *MM_AllocInRegion(eMMRegion_t eRegion, uint32_t ulSize, uint32_t ulAlignment)
+{
+    if ((eRegion >= MM_REGION_COUNT) || (0U == ulSize) ||
+        (0U != (ulAlignment & (ulAlignment - 1U))))
+    {
+        return NULL;
+    }
+
+    sMMRegion_t *psRegion = &sRegions[eRegion];
+    if (NULL == psRegion->pubBase)
+    {
+        return NULL;
+    }
+
+    if (ulAlignment < MM_ALIGNMENT)
+    {
+        ulAlignment = MM_ALIGNMENT;
+    }
+    uint32_t ulPayload = (ulSize + MM_ALIGNMENT - 1U) & ~(MM_ALIGNMENT - 1U);
+    if (ulPayload < ulSize)
+    {
+        psRegion->sStats.ulFailedAllocations++;
+        return NULL;
+    }
+
+    for (uMMBlockHeader_t *psBlock = (uMMBlockHeader_t *)psRegion->pubBase; NULL != psBlock;
+         psBlock = NextBlock(psRegion, psBlock))
+    {
+        if (MM_BLOCK_FREE != psBlock->sInfo.ulTag)
+        {
+            continue;
+        }
+
+        // Leading gap needed to align the payload; always a whole number of headers
+        uintptr_t ulPayloadAddress = (uintptr_t)psBlock + MM_HEADER_SIZE;
+        uintptr_t ulAligned = (ulPayloadAddress + ulAlignment - 1U) & ~((uintptr_t)ulAlignment - 1U);
+        uint32_t ulGap = (uint32_t)(ulAligned - ulPayloadAddress);
+
+        if (((uint64_t)ulGap + MM_HEADER_SIZE + ulPayload) > psBlock->sInfo.ulSize)
+        {
+            continue;
+        }
+
+        if (0U != ulGap)
+        {
+            uint32_t ulRemaining = psBlock->sInfo.ulSize - ulGap;
+            SetSize(psRegion, psBlock, ulGap);
+
+            uMMBlockHeader_t *psAligned = (uMMBlockHeader_t *)((uint8_t *)psBlock + ulGap);
+            psAligned->sInfo.ulPrevSize = ulGap;
+            psAligned->sInfo.ulTag      = MM_BLOCK_FREE;
+            SetSize(psRegion, psAligned, ulRemaining);
+            psBlock = psAligned;
+        }
+
+        uint32_t ulNeeded = MM_HEADER_SIZE + ulPayload;
+        if ((psBlock->sInfo.ulSize - ulNeeded) >= MM_MIN_SPLIT_SIZE)
+        {
+            uint32_t ulRemaining = psBlock->sInfo.ulSize - ulNeeded;
+            SetSize(psRegion, psBlock, ulNeeded);
+
+            uMMBlockHeader_t *psTail = (uMMBlockHeader_t *)((uint8_t *)psBlock + ulNeeded);
+            psTail->sInfo.ulPrevSize = ulNeeded;
+            psTail->sInfo.ulTag      = MM_BLOCK_FREE;
+            SetSize(psRegion, psTail, ulRemaining);
+        }
+
+        psBlock->sInfo.ulTag = MM_BLOCK_USED;
+
+        psRegion->sStats.ulUsedBytes += psBlock->sInfo.ulSize;
+        psRegion->sStats.ulLiveBlocks++;
+        if (psRegion->sStats.ulUsedBytes > psRegion->sStats.ulHighWaterBytes)
+        {
+            psRegion->sStats.ulHighWaterBytes = psRegion->sStats.ulUsedBytes;
+        }
+        UpdateLargestFree(psRegion);
+
+        return (uint8_t *)psBlock + MM_HEADER_SIZE;
+    }
+
+    psRegion->sStats.ulFailedAllocations++;
+    return NULL;
+}
+
+/**
+ * @brief Releases a block obtained from any MM_Alloc* function.
+ *
+ * NULL and pointers outside every region are ignored.
+ *
+ * @param pvBlock Block to release.
+ */
+void MM_Free(void *pvBlock)
+{
+    eMMRegion_t eRegion = MM_GetRegionOf(pvBlock);
+    if (MM_REGION_NONE == eRegion)
+    {
+        return;
+    }
+
+    sMMRegion_t *psRegion = &sRegions[eRegion];
+    uMMBlockHeader_t *psBlock = (uMMBlockHeader_t *)((uint8_t *)pvBlock - MM_HEADER_SIZE);
+    if (MM_BLOCK_USED != psBlock->sInfo.ulTag)
+    {
+        return;
+    }
+
+    psRegion->sStats.ulUsedBytes -= psBlock->sInfo.ulSize;
+    psRegion->sStats.ulLiveBlocks--;
+    psBlock->sInfo.ulTag = MM_BLOCK_FREE;
+
+    uMMBlockHeader_t *psNext = NextBlock(psRegion, psBlock);
+    if ((NULL != psNext) && (MM_BLOCK_FREE == psNext->sInfo.ulTag))
+    {
+        psNext->sInfo.ulTag = 0U;
+        SetSize(psRegion, psBlock, psBlock->sInfo.ulSize + psNext->sInfo.ulSize);
+    }
+
+    uMMBlockHeader_t *psPrev = PrevBlock(psRegion, psBlock);
+    if ((NULL != psPrev) && (MM_BLOCK_FREE == psPrev->sInfo.ulTag))
+    {
+        psBlock->sInfo.ulTag = 0U;
+        SetSize(psRegion, psPrev, psPrev->sInfo.ulSize + psBlock->sInfo.ulSize);
+    }
+
+    UpdateLargestFree(psRegion);
+}
+
+/**
+ * @brief Finds the region a block belongs to.
+ *
+ * @param pvBlock Any pointer.
+ * @return The region, or MM_REGION_NONE if the pointer is not inside any arena.
+ */
+eMMRegion_t MM_GetRegionOf(const void *pvBlock)
+{
+    const uint8_t *pubBlock = (const uint8_t *)pvBlock;
+
+    for (uint8_t ubRegion = 0; ubRegion < (uint8_t)MM_REGION_COUNT; ubRegion++)
+    {
+        if ((NULL != pubBlock) && (pubBlock >= sRegions[ubRegion].pubBase) &&
+            (pubBlock < sRegions[ubRegion].pubEnd))
+        {
+            return (eMMRegion_t)ubRegion;
+        }
+    }
+    return MM_REGION_NONE;
+}
+
+/**
+ * @brief Reads the usage statistics of a region.
+ *
+ * @param eRegion  Region to query.
+ * @param psStats  Destination.
+ * @return 1 on success, 0 on invalid parameters.
+ */
+uint8_t MM_GetRegionStats(eMMRegion_t eRegion, sMMRegionStats_t *psStats)
+{
+    if ((eRegion >= MM_REGION_COUNT) || (NULL == psStats))
+    {
+        return 0;
+    }
+    *psStats = sRegions[eRegion].sStats;
+    return 1;
+}
+
+/**
+ * @brief Tells how many blocks of a plan the free memory can take, without allocating.
+ *
+ * The blocks are placed in order the way MM_AllocAligned() would place them now: each
+ * purpose tries the regions of its policy, first fit, with block headers, alignment gaps
+ * and splitting taken into account. Fragmentation is therefore seen, not just free bytes.
+ *
+ * @param psEntries Blocks in the order they would be allocated.
+ * @param ubCount   Number of blocks.
+ * @return Number of leading blocks that fit (ubCount - the whole plan fits).
+ */
+uint8_t MM_CheckPlan(const sMMPlanEntry_t *psEntries, uint8_t ubCount)
+{
+    sMMPlanSpan_t asSpans[MM_PLAN_MAX_SPANS];
+    uint8_t ubSpans = 0;
+
+    if (NULL == psEntries)
+    {
+        return 0;
+    }
+
+    // Free blocks of every region, in address order. Beyond MM_PLAN_MAX_SPANS the rest
+    // is left out, which can only make the answer more cautious.
+    for (uint8_t ubRegion = 0; ubRegion < (uint8_t)MM_REGION_COUNT; ubRegion++)
+    {
+        const sMMRegion_t *psRegion = &sRegions[ubRegion];
+        if (NULL == psRegion->pubBase)
+        {
+            continue;
+        }
+        for (uMMBlockHeader_t *psBlock = (uMMBlockHeader_t *)psRegion->pubBase;
+             (NULL != psBlock) && (ubSpans < MM_PLAN_MAX_SPANS); psBlock = NextBlock(psRegion, psBlock))
+        {
+            if (MM_BLOCK_FREE == psBlock->sInfo.ulTag)
+            {
+                asSpans[ubSpans].ulStart = (uintptr_t)psBlock;
+                asSpans[ubSpans].ulSize  = psBlock->sInfo.ulSize;
+                asSpans[ubSpans].eRegion = (eMMRegion_t)ubRegion;
+                ubSpans++;
+            }
+        }
+    }
+
+    for (uint8_t ubEntry = 0; ubEntry < ubCount; ubEntry++)
+    {
+        const sMMPlanEntry_t *psEntry = &psEntries[ubEntry];
+        bool bPlaced = false;
+
+        if ((psEntry->ePurpose >= MM_PURPOSE_COUNT) || (0U == psEntry->ulSize) ||
+            (0U != (psEntry->ulAlignment & (psEntry->ulAlignment - 1U))))
+        {
+            return ubEntry;
+        }
+
+        for (uint8_t ubIndex = 0; (ubIndex < MM_MAX_POLICY_REGIONS) && !bPlaced; ubIndex++)
+        {
+            eMMRegion_t eRegion = aePolicy[psEntry->ePurpose][ubIndex];
+            if (MM_REGION_NONE == eRegion)
+            {
+                break;
+            }
+            bPlaced = PlaceInSpans(asSpans, &ubSpans, eRegion, psEntry->ulSize, psEntry->ulAlignment);
+        }
+        if (!bPlaced)
+        {
+            return ubEntry;
+        }
+    }
+    return ubCount;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Gets the block following psBlock, or NULL at the end of the arena.
+ */
+static uMMBlockHeader_t *NextBlock(const sMMRegion_t *psRegion, uMMBlockHeader_t *psBlock)
+{
+    uint8_t *pubNext = (uint8_t *)psBlock + psBlock->sInfo.ulSize;
+    return (pubNext < psRegion->pubEnd) ? (uMMBlockHeader_t *)pubNext : NULL;
+}
+
+/**
+ * @brief Gets the block preceding psBlock, or NULL for the first block.
+ */
+static uMMBlockHeader_t *PrevBlock(const sMMRegion_t *psRegion, uMMBlockHeader_t *psBlock)
+{
+    (void)psRegion;
+    if (0U == psBlock->sInfo.ulPrevSize)
+    {
+        return NULL;
+    }
+    return (uMMBlockHeader_t *)((uint8_t *)psBlock - psBlock->sInfo.ulPrevSize);
+}
+
+/**
+ * @brief Sets a block size and keeps the back link of the following block in sync.
+ */
+static void SetSize(const sMMRegion_t *psRegion, uMMBlockHeader_t *psBlock, uint32_t ulSize)
+{
+    psBlock->sInfo.ulSize = ulSize;
+
+    uMMBlockHeader_t *psNext = NextBlock(psRegion, psBlock);
+    if (NULL != psNext)
+    {
+        psNext->sInfo.ulPrevSize = ulSize;
+    }
+}
+
+/**
+ * @brief Recomputes the largest payload a single allocation can still obtain.
+ */
+static void UpdateLargestFree(sMMRegion_t *psRegion)
+{
+    uint32_t ulLargest = 0U;
+
+    for (uMMBlockHeader_t *psBlock = (uMMBlockHeader_t *)psRegion->pubBase; NULL != psBlock;
+         psBlock = NextBlock(psRegion, psBlock))
+    {
+        if ((MM_BLOCK_FREE == psBlock->sInfo.ulTag) &&
+            ((psBlock->sInfo.ulSize - MM_HEADER_SIZE) > ulLargest))
+        {
+            ulLargest = psBlock->sInfo.ulSize - MM_HEADER_SIZE;
+        }
+    }
+    psRegion->sStats.ulLargestFreeBytes = ulLargest;
+}
+
+/**
+ * @brief Places one block in the first free span of a region that holds it, as
+ *        MM_AllocInRegion() does, and updates the spans.
+ *
+ * @return true if the block was placed.
+ */
+static bool PlaceInSpans(sMMPlanSpan_t *psSpans, uint8_t *pubSpans, eMMRegion_t eRegion,
+                         uint32_t ulSize, uint32_t ulAlignment)
+{
+    if (ulAlignment < MM_ALIGNMENT)
+    {
+        ulAlignment = MM_ALIGNMENT;
+    }
+    uint32_t ulPayload = (ulSize + MM_ALIGNMENT - 1U) & ~(MM_ALIGNMENT - 1U);
+    if (ulPayload < ulSize)
+    {
+        return false;
+    }
+
+    for (uint8_t ubSpan = 0; ubSpan < *pubSpans; ubSpan++)
+    {
+        sMMPlanSpan_t *psSpan = &psSpans[ubSpan];
+        if (psSpan->eRegion != eRegion)
+        {
+            continue;
+        }
+
+        uintptr_t ulPayloadAddress = psSpan->ulStart + MM_HEADER_SIZE;
+        uintptr_t ulAligned = (ulPayloadAddress + ulAlignment - 1U) & ~((uintptr_t)ulAlignment - 1U);
+        uint32_t ulGap = (uint32_t)(ulAligned - ulPayloadAddress);
+        uint32_t ulNeeded = MM_HEADER_SIZE + ulPayload;
+
+        if (((uint64_t)ulGap + ulNeeded) > psSpan->ulSize)
+        {
+            continue;
+        }
+
+        // The alignment gap stays free in place of the span, the tail after the block
+        // only if it can be split off
+        uint32_t ulTail = psSpan->ulSize - ulGap - ulNeeded;
+        uintptr_t ulTailStart = psSpan->ulStart + ulGap + ulNeeded;
+        bool bKeepGap = (0U != ulGap);
+        bool bKeepTail = (ulTail >= MM_MIN_SPLIT_SIZE);
+
+        if (bKeepGap)
+        {
+            psSpan->ulSize = ulGap;
+        }
+        if (bKeepTail)
+        {
+            if (!bKeepGap)
+            {
+                psSpan->ulStart = ulTailStart;
+                psSpan->ulSize = ulTail;
+            }
+            else if (*pubSpans < MM_PLAN_MAX_SPANS)
+            {
+                (void)memmove(&psSpans[ubSpan + 2U], &psSpans[ubSpan + 1U],
+                              (size_t)(*pubSpans - ubSpan - 1U) * sizeof(sMMPlanSpan_t));
+                psSpans[ubSpan + 1U].ulStart = ulTailStart;
+                psSpans[ubSpan + 1U].ulSize = ulTail;
+                psSpans[ubSpan + 1U].eRegion = eRegion;
+                (*pubSpans)++;
+            }
+        }
+        if (!bKeepGap && !bKeepTail)
+        {
+            (void)memmove(&psSpans[ubSpan], &psSpans[ubSpan + 1U],
+                          (size_t)(*pubSpans - ubSpan - 1U) * sizeof(sMMPlanSpan_t));
+            (*pubSpans)--;
+        }
+        return true;
+    }
+    return false;
+}
+
+#if !defined(MM_HOST_SIMULATION)
+/**
+ * @brief Maps the OCRAM arena as normal, non-cacheable memory.
+ *
+ * The arena is aligned to its own (power of two) size, so one MPU region covers it
+ * exactly. Higher MPU region numbers take priority over the board's OCRAM region.
+ */
+static void ConfigureNonCacheableWindow(void)
+{
+    SCB_CleanInvalidateDCache_by_Addr(aubOcramNcArena, (int32_t)sizeof(aubOcramNcArena));
+
+    ARM_MPU_Disable();
+    MPU->RBAR = ARM_MPU_RBAR(MM_NONCACHEABLE_MPU_REGION, (uint32_t)aubOcramNcArena);
+    MPU->RASR = ARM_MPU_RASR(0, ARM_MPU_AP_FULL, 1, 0, 0, 0, 0, ARM_MPU_REGION_SIZE_64KB);
+    ARM_MPU_Enable(MPU_CTRL_PRIVDEFENA_Msk | MPU_CTRL_HFNMIENA_Msk);
+
+    __DSB();
+    __ISB();
+}
+#endif
@@ -0,0 +1,107 @@
+/**
+ * @file MemoryManager.h
+ * @brief Region-aware arena allocator for frame buffers, DMA buffers and lookup tables.
+ *
+ * Memory is requested by purpose rather than by region; a placement policy maps each
+ * purpose to an ordered list of regions (DTCM, non-cacheable OCRAM, SDRAM) and falls back
+ * to the next region when one is exhausted. Every block is aligned to at least
+ * MM_ALIGNMENT bytes (one Cortex-M7 cache line), so cache maintenance on one block never
+ * touches a neighbour.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_MEMORYMANAGER_MEMORYMANAGER_H_
+#define HAL_MEMORYMANAGER_MEMORYMANAGER_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define MM_ALIGNMENT                32U
+
+#ifndef MM_DTCM_ARENA_SIZE
+#define MM_DTCM_ARENA_SIZE          (32U * 1024U)
+#endif
+
+// Fixed: the arena is covered by one MPU region of exactly this size
+#define MM_NONCACHEABLE_ARENA_SIZE  (64U * 1024U)
+#define MM_NONCACHEABLE_MPU_REGION  13U
+
+#ifndef MM_SDRAM_ARENA_SIZE
+#define MM_SDRAM_ARENA_SIZE         (1024U * 1024U)
+#endif
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief Physical memory regions managed by the allocator.
+ */
+typedef enum {
+    MM_REGION_DTCM = 0,             // Tightly coupled, zero wait state, never cached
+    MM_REGION_OCRAM_NONCACHEABLE,   // OCRAM window made non-cacheable by the MPU
+    MM_REGION_SDRAM,                // Large, cacheable; only with MM_SDRAM_AVAILABLE
+    MM_REGION_COUNT,
+    MM_REGION_NONE = MM_REGION_COUNT
+} eMMRegion_t;
+
+/**
+ * @brief What a block is used for; selects the placement policy.
+ */
+typedef enum {
+    MM_PURPOSE_RENDER_TARGET = 0,   // Written by the CPU every frame
+    MM_PURPOSE_DMA_SOURCE,          // Read by eDMA while the CPU may write the next one
+    MM_PURPOSE_LOOKUP_TABLE,        // Built once, read on hot paths
+    MM_PURPOSE_GENERAL,             // Everything else
+    MM_PURPOSE_COUNT
+} eMMPurpose_t;
+
+/**
+ * @brief Usage statistics of one region.
+ */
+typedef struct {
+    uint32_t ulTotalBytes;          // Arena size
+    uint32_t ulUsedBytes;           // Bytes in live blocks, headers included
+    uint32_t ulHighWaterBytes;      // Peak of ulUsedBytes
+    uint32_t ulLargestFreeBytes;    // Largest payload a single allocation can still get
+    uint32_t ulLiveBlocks;          // Blocks currently allocated
+    uint32_t ulFailedAllocations;   // Requests this region could not satisfy
+} sMMRegionStats_t;
+
+/**
+ * @brief One block of an allocation plan, see MM_CheckPlan().
+ */
+typedef struct {
+    eMMPurpose_t ePurpose;
+    uint32_t     ulSize;            // Payload bytes
+    uint32_t     ulAlignment;       // As for MM_AllocAligned(), 0 for MM_ALIGNMENT
+} sMMPlanEntry_t;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t MM_Init(void);
+
+uint8_t MM_RegisterRegion(eMMRegion_t eRegion, void *pvBase, uint32_t ulSize);
+
+void *MM_Alloc(eMMPurpose_t ePurpose, uint32_t ulSize);
+
+void *MM_AllocAligned(eMMPurpose_t ePurpose, uint32_t ulSize, uint32_t ulAlignment);
+
+void *MM_AllocInRegion(eMMRegion_t eRegion, uint32_t ulSize, uint32_t ulAlignment);
+
+void MM_Free(void *pvBlock);
+
+eMMRegion_t MM_GetRegionOf(const void *pvBlock);
+
+uint8_t MM_GetRegionStats(eMMRegion_t eRegion, sMMRegionStats_t *psStats);
+
+uint8_t MM_CheckPlan(const sMMPlanEntry_t *psEntries, uint8_t ubCount);
+
+#endif /* HAL_MEMORYMANAGER_MEMORYMANAGER_H_ */
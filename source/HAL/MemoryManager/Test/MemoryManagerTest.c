@@ -0,0 +1,353 @@
+/**
+ * @file MemoryManagerTest.c
+ * @brief Table test of the region-aware arena allocator (MemoryManager).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "HAL/MemoryManager/Test/MemoryManagerTest.h"
+#include "HAL/MemoryManager/MemoryManager.h"
+#include <string.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define TEST_ARENA_BYTES        1024U
+#define TEST_ARENA_ALIGNMENT    1024U   // Alignment gaps depend on the arena base only
+#define TEST_BLOCK_PAYLOAD      64U     // Coalesce blocks: MM_ALIGNMENT header + 64
+#define TEST_BLOCK_BYTES        (MM_ALIGNMENT + TEST_BLOCK_PAYLOAD)
+#define TEST_BLOCKS             3U
+#define TEST_TAIL_BYTES         64U     // Free block after the three, just splittable
+#define TEST_MAX_PLAN           6U
+#define TEST_FRAGMENT_BLOCKS    4U
+#define TEST_REGION_BIT(r)      (1U << (r))
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef struct {
+    eMMPurpose_t ePurpose;
+    uint8_t      ubFullMask;        // Regions filled up before the allocation
+    uint8_t      ubAbsentMask;      // Regions registered with size 0 (e.g. no SDRAM)
+    eMMRegion_t  eRegion;           // Where the block lands, MM_REGION_NONE if refused
+} sMMPolicyCase_t;
+
+typedef struct {
+    uint32_t ulSize;
+    uint32_t ulAlignment;
+    uint8_t  ubAllocated;           // 0: the request is refused
+} sMMAlignCase_t;
+
+typedef struct {
+    uint8_t  aubFreeOrder[TEST_BLOCKS];
+    uint32_t aulLargestFree[TEST_BLOCKS];   // ulLargestFreeBytes after each free
+} sMMFreeCase_t;
+
+typedef struct {
+    sMMPlanEntry_t asEntries[TEST_MAX_PLAN];
+    uint8_t        ubCount;
+    uint8_t        ubFragmented;    // DTCM holds used and free blocks in turn first
+    uint8_t        ubFits;          // Leading entries MM_CheckPlan() must report
+} sMMPlanCase_t;
+
+//-------------------------------------[ STATIC VARIABLE ] --------------------------//
+//
+static const sMMPolicyCase_t asPolicyCases[] = {
+    { MM_PURPOSE_RENDER_TARGET, 0U, 0U, MM_REGION_DTCM },
+    { MM_PURPOSE_RENDER_TARGET, TEST_REGION_BIT(MM_REGION_DTCM), 0U, MM_REGION_SDRAM },
+    { MM_PURPOSE_RENDER_TARGET, TEST_REGION_BIT(MM_REGION_DTCM), TEST_REGION_BIT(MM_REGION_SDRAM),
+      MM_REGION_OCRAM_NONCACHEABLE },
+    { MM_PURPOSE_RENDER_TARGET, TEST_REGION_BIT(MM_REGION_DTCM) | TEST_REGION_BIT(MM_REGION_SDRAM) |
+      TEST_REGION_BIT(MM_REGION_OCRAM_NONCACHEABLE), 0U, MM_REGION_NONE },
+    { MM_PURPOSE_DMA_SOURCE, 0U, 0U, MM_REGION_OCRAM_NONCACHEABLE },
+    { MM_PURPOSE_DMA_SOURCE, TEST_REGION_BIT(MM_REGION_OCRAM_NONCACHEABLE), 0U, MM_REGION_DTCM },
+    // Never cacheable SDRAM, even with room left there
+    { MM_PURPOSE_DMA_SOURCE, TEST_REGION_BIT(MM_REGION_OCRAM_NONCACHEABLE) | TEST_REGION_BIT(MM_REGION_DTCM), 0U,
+      MM_REGION_NONE },
+    { MM_PURPOSE_LOOKUP_TABLE, 0U, 0U, MM_REGION_DTCM },
+    { MM_PURPOSE_LOOKUP_TABLE, TEST_REGION_BIT(MM_REGION_DTCM), 0U, MM_REGION_SDRAM },
+    { MM_PURPOSE_LOOKUP_TABLE, 0U, TEST_REGION_BIT(MM_REGION_DTCM) | TEST_REGION_BIT(MM_REGION_SDRAM),
+      MM_REGION_OCRAM_NONCACHEABLE },
+    { MM_PURPOSE_GENERAL, 0U, 0U, MM_REGION_SDRAM },
+    { MM_PURPOSE_GENERAL, 0U, TEST_REGION_BIT(MM_REGION_SDRAM), MM_REGION_OCRAM_NONCACHEABLE },
+    { MM_PURPOSE_GENERAL, TEST_REGION_BIT(MM_REGION_OCRAM_NONCACHEABLE), TEST_REGION_BIT(MM_REGION_SDRAM),
+      MM_REGION_DTCM },
+};
+
+static const sMMAlignCase_t asAlignCases[] = {
+    { 1U,   0U,    1U },            // 0 and anything below MM_ALIGNMENT mean MM_ALIGNMENT
+    { 1U,   16U,   1U },
+    { 100U, 64U,   1U },
+    { 40U,  256U,  1U },
+    { 64U,  512U,  1U },
+    { 10U,  48U,   0U },            // Not a power of two
+    { 0U,   32U,   0U },
+    { 2048U, 32U,  0U },            // Larger than the arena
+};
+
+// Blocks A, B, C then a free tail of TEST_TAIL_BYTES; payloads exclude the header
+static const sMMFreeCase_t asFreeCases[] = {
+    { { 1U, 0U, 2U }, { 64U, 160U, 320U } },    // B, then A merges forward, C both ways
+    { { 0U, 2U, 1U }, { 64U, 128U, 320U } },    // C merges with the tail, B both ways
+    { { 2U, 1U, 0U }, { 128U, 224U, 320U } },   // Each one merges backward
+    { { 0U, 1U, 2U }, { 64U, 160U, 320U } },
+};
+
+static const sMMPlanCase_t asPlanCases[] = {
+    // Fits where it is asked for
+    { { { MM_PURPOSE_RENDER_TARGET, 256U, 0U }, { MM_PURPOSE_DMA_SOURCE, 512U, 0U },
+        { MM_PURPOSE_GENERAL, 900U, 0U } }, 3U, 0U, 3U },
+    // DTCM overflows into SDRAM, then SDRAM into OCRAM, then nothing is left
+    { { { MM_PURPOSE_LOOKUP_TABLE, 600U, 0U }, { MM_PURPOSE_LOOKUP_TABLE, 600U, 0U },
+        { MM_PURPOSE_LOOKUP_TABLE, 600U, 0U }, { MM_PURPOSE_LOOKUP_TABLE, 600U, 0U } }, 4U, 0U, 3U },
+    // Alignment gaps: the second 512 aligned block goes to SDRAM, the gap in front of the
+    // first one still takes a DMA block, the DTCM tail is one header too small
+    { { { MM_PURPOSE_RENDER_TARGET, 64U, 512U }, { MM_PURPOSE_RENDER_TARGET, 64U, 512U },
+        { MM_PURPOSE_DMA_SOURCE, 448U, 0U }, { MM_PURPOSE_DMA_SOURCE, 448U, 0U },
+        { MM_PURPOSE_DMA_SOURCE, 448U, 0U }, { MM_PURPOSE_DMA_SOURCE, 448U, 0U } }, 6U, 0U, 5U },
+    // DTCM has free bytes for the last block only in holes of one small block
+    { { { MM_PURPOSE_DMA_SOURCE, 900U, 0U }, { MM_PURPOSE_DMA_SOURCE, 64U, 0U },
+        { MM_PURPOSE_DMA_SOURCE, 64U, 0U }, { MM_PURPOSE_DMA_SOURCE, 100U, 0U } }, 4U, 1U, 3U },
+    // Invalid entry stops the plan
+    { { { MM_PURPOSE_GENERAL, 64U, 0U }, { MM_PURPOSE_GENERAL, 64U, 48U },
+        { MM_PURPOSE_GENERAL, 64U, 0U } }, 3U, 0U, 1U },
+};
+
+static uint8_t aaubArenas[MM_REGION_COUNT][TEST_ARENA_BYTES] __attribute__((aligned(TEST_ARENA_ALIGNMENT)));
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static uint8_t CheckPolicy(const sMMPolicyCase_t *psCase);
+static uint8_t CheckAlignment(const sMMAlignCase_t *psCase);
+static uint8_t CheckFreeOrder(const sMMFreeCase_t *psCase);
+static uint8_t CheckPlan(const sMMPlanCase_t *psCase);
+static uint8_t RegisterArenas(uint8_t ubAbsentMask);
+static uint8_t CheckStats(eMMRegion_t eRegion, uint32_t ulUsedBytes, uint32_t ulLiveBlocks,
+                          uint32_t ulLargestFree, uint32_t ulHighWater);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Runs the policy, alignment, free order and plan tables.
+ *
+ * @return Number of failing cases (0 - all passed).
+ */
+uint8_t MemoryManagerTest_Run(void)
+{
+    uint8_t ubFailures = 0;
+
+    for (uint32_t ulCase = 0; ulCase < (sizeof(asPolicyCases) / sizeof(asPolicyCases[0])); ulCase++)
+    {
+        ubFailures += (CheckPolicy(&asPolicyCases[ulCase]) == 0) ? 1U : 0U;
+    }
+    for (uint32_t ulCase = 0; ulCase < (sizeof(asAlignCases) / sizeof(asAlignCases[0])); ulCase++)
+    {
+        ubFailures += (CheckAlignment(&asAlignCases[ulCase]) == 0) ? 1U : 0U;
+    }
+    for (uint32_t ulCase = 0; ulCase < (sizeof(asFreeCases) / sizeof(asFreeCases[0])); ulCase++)
+    {
+        ubFailures += (CheckFreeOrder(&asFreeCases[ulCase]) == 0) ? 1U : 0U;
+    }
+    for (uint32_t ulCase = 0; ulCase < (sizeof(asPlanCases) / sizeof(asPlanCases[0])); ulCase++)
+    {
+        ubFailures += (CheckPlan(&asPlanCases[ulCase]) == 0) ? 1U : 0U;
+    }
+
+    (void)MM_Init();
+    return ubFailures;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Fills the case's full regions, allocates one block for its purpose and checks
+ *        the region it lands in; 1 if it is the expected one.
+ */
+static uint8_t CheckPolicy(const sMMPolicyCase_t *psCase)
+{
+    sMMRegionStats_t sStats;
+
+    if (RegisterArenas(psCase->ubAbsentMask) == 0)
+    {
+        return 0;
+    }
+    for (uint8_t ubRegion = 0; ubRegion < (uint8_t)MM_REGION_COUNT; ubRegion++)
+    {
+        if (((psCase->ubFullMask & TEST_REGION_BIT(ubRegion)) != 0U) &&
+            ((MM_GetRegionStats((eMMRegion_t)ubRegion, &sStats) == 0) ||
+             (MM_AllocInRegion((eMMRegion_t)ubRegion, sStats.ulLargestFreeBytes, 0U) == NULL)))
+        {
+            return 0;
+        }
+    }
+
+    void *pvBlock = MM_Alloc(psCase->ePurpose, TEST_BLOCK_PAYLOAD);
+    if (psCase->eRegion == MM_REGION_NONE)
+    {
+        return (pvBlock == NULL) ? 1U : 0U;
+    }
+
+    // A full region tried first counts the request it refused
+    bool bRefused = false;
+    for (uint8_t ubRegion = 0; ubRegion < (uint8_t)MM_REGION_COUNT; ubRegion++)
+    {
+        bRefused |= (MM_GetRegionStats((eMMRegion_t)ubRegion, &sStats) != 0) && (sStats.ulFailedAllocations != 0U);
+    }
+    return ((pvBlock != NULL) && (MM_GetRegionOf(pvBlock) == psCase->eRegion) &&
+            (bRefused == (psCase->ubFullMask != 0U))) ? 1U : 0U;
+}
+
+/**
+ * @brief Allocates one block with the case's size and alignment from a fresh DTCM arena;
+ *        1 if it is refused or placed as asked.
+ */
+static uint8_t CheckAlignment(const sMMAlignCase_t *psCase)
+{
+    uint32_t ulAlignment = (psCase->ulAlignment < MM_ALIGNMENT) ? MM_ALIGNMENT : psCase->ulAlignment;
+
+    if (RegisterArenas(0U) == 0)
+    {
+        return 0;
+    }
+
+    uint8_t *pubBlock = (uint8_t *)MM_AllocInRegion(MM_REGION_DTCM, psCase->ulSize, psCase->ulAlignment);
+    if (psCase->ubAllocated == 0U)
+    {
+        return (pubBlock == NULL) ? 1U : 0U;
+    }
+    if ((pubBlock == NULL) || (((uintptr_t)pubBlock % ulAlignment) != 0U) ||
+        (MM_GetRegionOf(pubBlock) != MM_REGION_DTCM) ||
+        (MM_GetRegionOf(pubBlock + psCase->ulSize - 1U) != MM_REGION_DTCM))
+    {
+        return 0;
+    }
+
+    // The payload is writable end to end, and gone again once freed
+    memset(pubBlock, 0xA5, psCase->ulSize);
+    MM_Free(pubBlock);
+    return CheckStats(MM_REGION_DTCM, 0U, 0U, TEST_ARENA_BYTES - MM_ALIGNMENT,
+                      MM_ALIGNMENT + ((psCase->ulSize + MM_ALIGNMENT - 1U) & ~(MM_ALIGNMENT - 1U)));
+}
+
+/**
+ * @brief Allocates three blocks followed by a small free tail, frees them in the case's
+ *        order and checks the statistics after every free; 1 if they all match.
+ */
+static uint8_t CheckFreeOrder(const sMMFreeCase_t *psCase)
+{
+    uint8_t *apubBlocks[TEST_BLOCKS];
+    uint32_t ulTotal = (TEST_BLOCKS * TEST_BLOCK_BYTES) + TEST_TAIL_BYTES;
+
+    if ((MM_RegisterRegion(MM_REGION_DTCM, aaubArenas[MM_REGION_DTCM], ulTotal) == 0) ||
+        (CheckStats(MM_REGION_DTCM, 0U, 0U, ulTotal - MM_ALIGNMENT, 0U) == 0))
+    {
+        return 0;
+    }
+    for (uint8_t ubBlock = 0; ubBlock < TEST_BLOCKS; ubBlock++)
+    {
+        apubBlocks[ubBlock] = (uint8_t *)MM_AllocInRegion(MM_REGION_DTCM, TEST_BLOCK_PAYLOAD, 0U);
+        // First fit, back to back
+        if ((apubBlocks[ubBlock] == NULL) ||
+            ((ubBlock > 0U) && (apubBlocks[ubBlock] != (apubBlocks[ubBlock - 1U] + TEST_BLOCK_BYTES))))
+        {
+            return 0;
+        }
+    }
+    if (CheckStats(MM_REGION_DTCM, TEST_BLOCKS * TEST_BLOCK_BYTES, TEST_BLOCKS, TEST_TAIL_BYTES - MM_ALIGNMENT,
+                   TEST_BLOCKS * TEST_BLOCK_BYTES) == 0)
+    {
+        return 0;
+    }
+
+    for (uint8_t ubStep = 0; ubStep < TEST_BLOCKS; ubStep++)
+    {
+        uint32_t ulLive = TEST_BLOCKS - ubStep - 1U;
+
+        MM_Free(apubBlocks[psCase->aubFreeOrder[ubStep]]);
+        // A second free of the same block is ignored
+        MM_Free(apubBlocks[psCase->aubFreeOrder[ubStep]]);
+        if (CheckStats(MM_REGION_DTCM, ulLive * TEST_BLOCK_BYTES, ulLive, psCase->aulLargestFree[ubStep],
+                       TEST_BLOCKS * TEST_BLOCK_BYTES) == 0)
+        {
+            return 0;
+        }
+    }
+
+    // Everything coalesced back into one block
+    return (MM_AllocInRegion(MM_REGION_DTCM, ulTotal - MM_ALIGNMENT, 0U) == (void *)apubBlocks[0]) ? 1U : 0U;
+}
+
+/**
+ * @brief Asks MM_CheckPlan() about a plan, then allocates it for real; 1 if both place the
+ *        same number of leading entries and that number is the expected one.
+ */
+static uint8_t CheckPlan(const sMMPlanCase_t *psCase)
+{
+    void *apvFragments[TEST_FRAGMENT_BLOCKS];
+    uint8_t ubAllocated = 0;
+
+    if (RegisterArenas(0U) == 0)
+    {
+        return 0;
+    }
+    if (psCase->ubFragmented != 0U)
+    {
+        // Used and free blocks in turn, then the rest of DTCM used up
+        for (uint8_t ubBlock = 0; ubBlock < TEST_FRAGMENT_BLOCKS; ubBlock++)
+        {
+            apvFragments[ubBlock] = MM_AllocInRegion(MM_REGION_DTCM, TEST_BLOCK_PAYLOAD, 0U);
+        }
+        sMMRegionStats_t sStats;
+        if ((MM_GetRegionStats(MM_REGION_DTCM, &sStats) == 0) ||
+            (MM_AllocInRegion(MM_REGION_DTCM, sStats.ulLargestFreeBytes, 0U) == NULL))
+        {
+            return 0;
+        }
+        MM_Free(apvFragments[0]);
+        MM_Free(apvFragments[2]);
+    }
+
+    uint8_t ubPredicted = MM_CheckPlan(psCase->asEntries, psCase->ubCount);
+    while ((ubAllocated < psCase->ubCount) &&
+           (MM_AllocAligned(psCase->asEntries[ubAllocated].ePurpose, psCase->asEntries[ubAllocated].ulSize,
+                            psCase->asEntries[ubAllocated].ulAlignment) != NULL))
+    {
+        ubAllocated++;
+    }
+
+    return ((ubPredicted == psCase->ubFits) && (ubAllocated == psCase->ubFits)) ? 1U : 0U;
+}
+
+/**
+ * @brief Backs every region with a fresh test arena, or with nothing for the regions of
+ *        ubAbsentMask; 1 on success.
+ */
+static uint8_t RegisterArenas(uint8_t ubAbsentMask)
+{
+    uint8_t ubStatus = 1;
+
+    for (uint8_t ubRegion = 0; ubRegion < (uint8_t)MM_REGION_COUNT; ubRegion++)
+    {
+        bool bAbsent = ((ubAbsentMask & TEST_REGION_BIT(ubRegion)) != 0U);
+        ubStatus &= MM_RegisterRegion((eMMRegion_t)ubRegion, bAbsent ? NULL : aaubArenas[ubRegion],
+                                      bAbsent ? 0U : TEST_ARENA_BYTES);
+    }
+    return ubStatus;
+}
+
+/**
+ * @brief Compares the statistics of a region; 1 if they match.
+ */
+static uint8_t CheckStats(eMMRegion_t eRegion, uint32_t ulUsedBytes, uint32_t ulLiveBlocks,
+                          uint32_t ulLargestFree, uint32_t ulHighWater)
+{
+    sMMRegionStats_t sStats;
+
+    return ((MM_GetRegionStats(eRegion, &sStats) != 0) && (sStats.ulUsedBytes == ulUsedBytes) &&
+            (sStats.ulLiveBlocks == ulLiveBlocks) && (sStats.ulLargestFreeBytes == ulLargestFree) &&
+            (sStats.ulHighWaterBytes == ulHighWater)) ? 1U : 0U;
+}
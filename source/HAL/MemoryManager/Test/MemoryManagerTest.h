@@ -0,0 +1,30 @@
+/**
+ * @file MemoryManagerTest.h
+ * @brief Table test of the region-aware arena allocator (MemoryManager).
+ *
+ * Backs the regions with small test arenas and checks the placement policy of every
+ * purpose with its fallbacks (region full or absent), payload alignment and rejected
+ * requests, coalescing with both neighbours for several free orders with the used,
+ * largest free and high-water statistics, and that MM_CheckPlan() predicts exactly how
+ * many blocks of a plan MM_AllocAligned() then places, on fragmented arenas too. Host
+ * only: it discards every block and ends with MM_Init(), so it runs before anything is
+ * allocated (see Test/Host/README.txt).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef HAL_MEMORYMANAGER_TEST_MEMORYMANAGERTEST_H_
+#define HAL_MEMORYMANAGER_TEST_MEMORYMANAGERTEST_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t MemoryManagerTest_Run(void);
+
+#endif /* HAL_MEMORYMANAGER_TEST_MEMORYMANAGERTEST_H_ */
@@ -1,192 +1,282 @@
-/**
- * @file    main.c
- * @brief   Entry point for Ethernet communication stack using LwIP on i.MX RT1064.
- *
- *          Initializes board hardware, network interface, and protocol modules
- *          including TCP, UDP, and ICMP. Handles periodic tasks such as TCP
- *          message sending and input polling.
- *
- *  (C) Copyright Centum T&S Group 2025. All rights reserved.
- *  This computer program may not be used, copied, distributed, translated, transmitted or assigned
- *  without the prior written authorization of Centum T&S Group.
- */
-
-/* ---------------- LWIP Core ---------------- */
-#include "lwip/opt.h"
-#include "lwip/init.h"
-#include "lwip/timeouts.h"
-#include "lwip/tcp.h"
-#include "lwip/udp.h"
-#include "lwip/dhcp.h"
-#include "ping.h"
-
-#if LWIP_IPV4 && LWIP_RAW
-
-/* ---------------- Standard C ---------------- */
-#include <string.h>
-#include <stdio.h>
-#include<stdlib.h>
-
-/* ---------------- Board / Hardware ---------------- */
-#include "board.h"
-#include "app.h"
-#include "fsl_phy.h"
-
-
-/* ---------------- Network Interface ---------------- */
-#include "netif/ethernet.h"
-#include "ethernetif.h"
-
-/* ---------------- HAL: Ethernet & Protocols ---------------- */
-#include "HAL/EthernetInterface/Ethernet.h"
-#include "HAL/EthernetInterface/protocols/tcp.h"
-#include "HAL/EthernetInterface/protocols/udp.h"
-#include "HAL/EthernetInterface/protocols/icmp.h"
-#include "HAL/EthernetInterface/protocols/dhcp.h"
-#include "HAL/EthernetInterface/protocols/igmp.h"
-#include "HAL/EthernetInterface/protocols/TftpServer.h"
-#include "HAL/EthernetInterface/protocols/TftpClient.h"
-
-/* ---------------- HAL: Test Modules ---------------- */
-#include "HAL/EthernetInterface/Test/tcp_test.h"
-#include "HAL/EthernetInterface/Test/udp_test.h"
-#include "HAL/EthernetInterface/Test/igmp_test.h"
-#include "HAL/EthernetInterface/Test/tftp_test.h"
-#include "HAL/LEDDriverInterface/LEDDriverTest.h"
-
-/* ---------------- HAL: Timer ---------------- */
-#include "HAL/TimerModule/timer.h"
-#include "HAL/RTC/RTC_Driver.h"
-
-/* ---------------- HAL: LEDDriver ---------------- */
-#include "HAL/LEDDriverInterface/LEDDriver.h"
-#include "peripherals.h"
-
-/* ---------------- Middleware ---------------- */
-#include "Middleware/LogManager/LogManager.h"
-#include "Middleware/MessageLayerParser/MessageProtocolParser.h"
-#include "Middleware/MessageLayerParser/ReceivingMessageQueue.h"
-#include "Middleware/MessageLayerParser/MessageData.h"
-#include "Middleware/SessionManager/SessionManager.h"
-#include "Middleware/FrameBufferManager/FrameBufferManager.h"
-
-/* ---------------- Application ---------------- */
-#include "application/MessageHandler/ProcessCommand.h"
-#include "application/MessageHandler/InitializationCommand/InitializationRequest.h"
-#include "application/MessageHandler/InitializationCommand/InitializationResponce.h"
-#include "application/MessageHandler/MutualControlCommand/MutualControlRequest.h"
-#include "application/MessageHandler/MutualControlCommand/MutualControlResponse.h"
-
-
-#ifndef configMAC_ADDR
-#include "fsl_silicon_id.h"
-#endif
-
-#ifndef EXAMPLE_NETIF_INIT_FN
-#define EXAMPLE_NETIF_INIT_FN ethernetif0_init
-#endif
-
-
-/* ---------------- LVGL ---------------- */
-#include "../lvgl/lvgl.h"
-#include "../source/application/DisplayController/lv_conf.h"
-#include "application/DisplayController/lvgl_support.h"
-#include "../lvgl/src/Image/Image.h"
-
-
-
-/* ---------------- HARFBUZZ & FREETYPE ---------------- */
-//#include "lv_font_hb_freetype.h"
-#include "lv_hb_canvas_label.h"
-
-/**
- * @brief Initializes all application-level modules and resets EMP state.
- *
- * This function should be called once at device startup (after hardware
- * and network stack initialization) or whenever a full protocol reset
- * is required.
- */
-
-void Application_Init(void)
-{
-    /* Reset session manager state (session ID, timers, transaction counters) */
-    SessionManager_Init();
-
-    /* Reset the UDP receiving message queue */
-    ReceivingMessageQueue_Init();
-
-    /* Reset EMP message parser state */
-    MessageProtocolParser_Init();
-
-    /* Reset cached message layer data */
-    MessageData_Init();
-
-    /* Reset Initialization Request data */
-    InitializationRequest_Reset();
-
-    /* Reset Initialization Response data */
-    InitializationResponce_Reset();
-
-    /* Reset Initialization Request data */
-    MutualControlRequest_Reset();
-
-    /* Reset Initialization Response data */
-    MutualControlResponse_Reset();
-
-    COSLOG_INFO("Application_Init: All protocol modules reset.\r\n");
-}
-
-
-void SysTick_Handler(void)
-{
-    time_isr();
-}
-
-
-int main(void)
-{
-    BOARD_InitHardware();
-
-    BOARD_InitBootPeripherals();
-
-    Application_Init();
-
-    lv_port_disp_init();
-
-    LEDDriver_Init();
-
-    FBM_Init(ROWS_PER_PANEL, COLS_PER_PANEL, DOUBLE_SIDED_DISPLAY, LED_TYPE, NUM_PANELS);
-
-    LEDDriver_ConfigurePanel(ROWS_PER_PANEL, COLS_PER_PANEL, DOUBLE_SIDED_DISPLAY, LED_TYPE, NUM_PANELS, ROW_ADDR_BITS);
-
-//    font_display_init();
-//    lv_obj_t *label = lv_label_create(lv_scr_act());
-//    hb_label_set_text_shaped(label, "Vishal");
-
-    lv_obj_t * scr = lv_scr_act();
-
-   /* Debug label so we know LVGL works */
-//   lv_obj_t * label = lv_label_create(scr);
-//   lv_label_set_text(label, "TEST LABEL"); (*changed)
-//   lv_obj_set_style_text_color(label, lv_color_hex(0xFF0000), 0);
-//   lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 10);
-//   lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 0);
-
-   /* HarfBuzz + FreeType text */
-//   lv_hb_label_create(scr, "ശുഭ മധ്യാഹ്നം",      "fonts/Nirmala.ttc", 32, 20,  60);
-//   lv_hb_label_create(scr, "नमस्ते दुनिया", "fonts/Nirmala.ttc", 32, 20, 120);
-//   lv_hb_label_create(scr, "ಶುಭ ಮಧ್ಯಾನ", "fonts/Nirmala.ttc", 32, 20, 180);
-   //lv_hb_label_create(scr, "مرحبا بالعالم", "fonts/Nirmala.ttc", 32, 20, 180);
-   lv_hb_label_create(scr, "ഭ",   "fonts/MTCORSVA.ttf", 16, 0, 0); // 32, 20, 240 (*changed)
-
-   lv_obj_invalidate(scr);
-
-    while (1)
-    {
-        lv_tick_inc(1);
-        lv_timer_handler();
-        LEDDriver_DisplayOnLED();
-    }
-}
-
-#endif
+/**
+ * @file    main.c
+ * @brief   Entry point for Ethernet communication stack using LwIP on i.MX RT1064.
+ *
+ *          Initializes board hardware, network interface, and protocol modules
+ *          including TCP, UDP, and ICMP. Handles periodic tasks such as TCP
+ *          message sending and input polling.
+ *
+ *  (C) Copyright Centum T&S Group 2025. All rights reserved.
+ *  This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ *  without the prior written authorization of Centum T&S Group.
+ */
+
+/* ---------------- LWIP Core ---------------- */
+#include "lwip/opt.h"
+#include "lwip/init.h"
+#include "lwip/timeouts.h"
+#include "lwip/tcp.h"
+#include "lwip/udp.h"
+#include "lwip/dhcp.h"
+#include "ping.h"
+
+#if LWIP_IPV4 && LWIP_RAW
+
+/* ---------------- Standard C ---------------- */
+#include <string.h>
+#include <stdio.h>
+#include<stdlib.h>
+
+/* ---------------- Board / Hardware ---------------- */
+#include "board.h"
+#include "app.h"
+#include "fsl_phy.h"
+
+
+/* ---------------- Network Interface ---------------- */
+#include "netif/ethernet.h"
+#include "ethernetif.h"
+
+/* ---------------- HAL: Ethernet & Protocols ---------------- */
+#include "HAL/EthernetInterface/Ethernet.h"
+#include "HAL/EthernetInterface/protocols/tcp.h"
+#include "HAL/EthernetInterface/protocols/udp.h"
+#include "HAL/EthernetInterface/protocols/icmp.h"
+#include "HAL/EthernetInterface/protocols/dhcp.h"
+#include "HAL/EthernetInterface/protocols/igmp.h"
+#include "HAL/EthernetInterface/protocols/TftpServer.h"
+#include "HAL/EthernetInterface/protocols/TftpClient.h"
+
+/* ---------------- HAL: Test Modules ---------------- */
+#include "HAL/EthernetInterface/Test/tcp_test.h"
+#include "HAL/EthernetInterface/Test/udp_test.h"
+#include "HAL/EthernetInterface/Test/igmp_test.h"
+#include "HAL/EthernetInterface/Test/tftp_test.h"
+#include "HAL/LEDDriverInterface/LEDDriverTest.h"
+#include "application/DisplayController/Test/DisplayPathBenchmark.h"
+
+/* ---------------- HAL: Timer ---------------- */
+#include "HAL/TimerModule/timer.h"
+#include "HAL/RTC/RTC_Driver.h"
+#include "HAL/MemoryManager/MemoryManager.h"
+
+/* ---------------- HAL: LEDDriver ---------------- */
+#include "HAL/LEDDriverInterface/LEDDriver.h"
+#include "peripherals.h"
+
+/* ---------------- Middleware ---------------- */
+#include "Middleware/LogManager/LogManager.h"
+#include "Middleware/MessageLayerParser/MessageProtocolParser.h"
+#include "Middleware/MessageLayerParser/ReceivingMessageQueue.h"
+#include "Middleware/MessageLayerParser/MessageData.h"
+#include "Middleware/SessionManager/SessionManager.h"
+#include "Middleware/FrameBufferManager/FrameBufferManager.h"
+#include "Middleware/FrameBufferManager/FBMDelta.h"
+
+/* ---------------- Application ---------------- */
+#include "application/DisplayController/DisplayProfile.h"
+#include "application/DisplayController/FrameScheduler.h"
+#include "application/MessageHandler/ProcessCommand.h"
+#include "application/MessageHandler/InitializationCommand/InitializationRequest.h"
+#include "application/MessageHandler/InitializationCommand/InitializationResponce.h"
+#include "application/MessageHandler/MutualControlCommand/MutualControlRequest.h"
+#include "application/MessageHandler/MutualControlCommand/MutualControlResponse.h"
+
+
+#ifndef configMAC_ADDR
+#include "fsl_silicon_id.h"
+#endif
+
+#ifndef EXAMPLE_NETIF_INIT_FN
+#define EXAMPLE_NETIF_INIT_FN ethernetif0_init
+#endif
+
+
+/* ---------------- LVGL ---------------- */
+#include "../lvgl/lvgl.h"
+#include "../source/application/DisplayController/lv_conf.h"
+#include "application/DisplayController/lvgl_support.h"
+#include "../lvgl/src/Image/Image.h"
+
+
+
+/* ---------------- HARFBUZZ & FREETYPE ---------------- */
+//#include "lv_font_hb_freetype.h"
+#include "lv_hb_canvas_label.h"
+
+/**
+ * @brief Initializes all application-level modules and resets EMP state.
+ *
+ * This function should be called once at device startup (after hardware
+ * and network stack initialization) or whenever a full protocol reset
+ * is required.
+ */
+
+void Application_Init(void)
+{
+    /* Reset session manager state (session ID, timers, transaction counters) */
+    SessionManager_Init();
+
+    /* Reset the UDP receiving message queue */
+    ReceivingMessageQueue_Init();
+
+    /* Reset EMP message parser state */
+    MessageProtocolParser_Init();
+
+    /* Reset cached message layer data */
+    MessageData_Init();
+
+    /* Reset Initialization Request data */
+    InitializationRequest_Reset();
+
+    /* Reset Initialization Response data */
+    InitializationResponce_Reset();
+
+    /* Reset Initialization Request data */
+    MutualControlRequest_Reset();
+
+    /* Reset Initialization Response data */
+    MutualControlResponse_Reset();
+
+    COSLOG_INFO("Application_Init: All protocol modules reset.\r\n");
+}
+
+
+/* ---------------- Frame scheduling ---------------- */
+/* LVGL renders at the rate of its refresh period, on real time */
+#define DISPLAY_RENDER_HZ   (1000U / LV_DEF_REFR_PERIOD)
+
+/* Time base of GetTimeUs() */
+static uint32_t ulLastCycleCount = 0;
+static uint32_t ulTimeUs = 0;
+static uint32_t ulTimeRemainder = 0;
+static sFrameScheduler_t sFrameScheduler;
+
+static uint32_t GetTimeUs(void);
+static void OnScanCycleStart(void);
+
+static const sFrameSchedulerHal_t sFrameSchedulerHal = {
+    .pfnGetTimeUs          = GetTimeUs,
+    .pfnAdvanceTick        = lv_tick_inc,
+    .pfnRender             = lv_timer_handler,
+    .pfnGetCompletedFrames = lv_port_get_completed_frames,
+    .pfnPublish            = lv_port_publish,
+};
+
+/**
+ * @brief Free-running time in microseconds from the DWT cycle counter.
+ *
+ * Safe in interrupts and the main loop: the cycles since the last call are added under
+ * a critical section, so the time never steps back, whichever interrupt preempts which.
+ * The counter is started by LEDDriver_Init(); the SysTick tick reads the time every
+ * millisecond, well within one counter wrap.
+ */
+static uint32_t GetTimeUs(void)
+{
+    uint32_t ulPrimask = DisableGlobalIRQ();
+    uint32_t ulCount = DWT->CYCCNT;
+    uint64_t udScaled = ((uint64_t)(ulCount - ulLastCycleCount) * 1000000ULL) + ulTimeRemainder;
+
+    // Carry the fraction of a us so the time does not drift
+    ulTimeUs += (uint32_t)(udScaled / SystemCoreClock);
+    ulTimeRemainder = (uint32_t)(udScaled % SystemCoreClock);
+    ulLastCycleCount = ulCount;
+
+    uint32_t ulTime = ulTimeUs;
+    EnableGlobalIRQ(ulPrimask);
+    return ulTime;
+}
+
+#ifdef DISPLAY_PATH_BENCHMARK
+/* Benchmark clock: core cycles */
+static uint32_t GetCycleCount(void)
+{
+    return DWT->CYCCNT;
+}
+#endif
+
+/* Scan interrupt: vsync of the frame scheduler */
+static void OnScanCycleStart(void)
+{
+    FrameScheduler_OnScanCycleStart(&sFrameScheduler);
+}
+
+
+void SysTick_Handler(void)
+{
+    time_isr();
+
+    /* SysTick may be started by lwIP before the scheduler exists */
+    if (sFrameScheduler.psHal != NULL)
+    {
+        FrameScheduler_OnTick(&sFrameScheduler);
+    }
+}
+
+
+int main(void)
+{
+    BOARD_InitHardware();
+
+    /* Arenas must exist before any frame, DMA or table buffer is requested */
+    MM_Init();
+
+    BOARD_InitBootPeripherals();
+
+    Application_Init();
+
+    LEDDriver_Init();
+
+#ifdef DISPLAY_PATH_BENCHMARK
+    /* Sweeps display geometries and prints JSON results; leaves the display unconfigured.
+       Timed on the DWT cycle counter started by LEDDriver_Init(). */
+    (void)DisplayPathBenchmark_Run(GetCycleCount, SystemCoreClock);
+#endif
+
+    FBM_SetBufferMode(FBM_MODE_TRIPLE_BUFFER);
+
+    /* Frames, scan and LVGL display from one geometry and gray depth; the scan picks up
+       the latest complete frame published by the LVGL flush (gray frames as the
+       bit-planes FBM splits them into). No configuration storage on this board yet:
+       the built-in profile is used. */
+    DisplayProfile_Boot(NULL, 0);
+
+    /* 1 ms SysTick, as lwIP's time_init() sets it: real time for the LVGL tick. LVGL is
+       rendered, and its frames published on the scan cycle, by the frame scheduler. */
+    FrameScheduler_Init(&sFrameScheduler, &sFrameSchedulerHal, DISPLAY_RENDER_HZ);
+    SysTick_Config(SystemCoreClock / 1000U);
+    LEDDriver_SetCycleStartCallback(OnScanCycleStart);
+
+    /* Scan runs from the eDMA and timer interrupts from here on */
+    LEDDriver_StartScan();
+
+//    font_display_init();
+//    lv_obj_t *label = lv_label_create(lv_scr_act());
+//    hb_label_set_text_shaped(label, "Vishal");
+
+    lv_obj_t * scr = lv_scr_act();
+
+   /* Debug label so we know LVGL works */
+//   lv_obj_t * label = lv_label_create(scr);
+//   lv_label_set_text(label, "TEST LABEL"); (*changed)
+//   lv_obj_set_style_text_color(label, lv_color_hex(0xFF0000), 0);
+//   lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 10);
+//   lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 0);
+
+   /* HarfBuzz + FreeType text */
+//   lv_hb_label_create(scr, "ശുഭ മധ്യാഹ്നം",      "fonts/Nirmala.ttc", 32, 20,  60);
+//   lv_hb_label_create(scr, "नमस्ते दुनिया", "fonts/Nirmala.ttc", 32, 20, 120);
+//   lv_hb_label_create(scr, "ಶುಭ ಮಧ್ಯಾನ", "fonts/Nirmala.ttc", 32, 20, 180);
+   //lv_hb_label_create(scr, "مرحبا بالعالم", "fonts/Nirmala.ttc", 32, 20, 180);
+   lv_hb_label_create(scr, "ഭ",   "fonts/MTCORSVA.ttf", 16, 0, 0); // 32, 20, 240 (*changed)
+
+   lv_obj_invalidate(scr);
+
+    while (1)
+    {
+        FrameScheduler_Process(&sFrameScheduler);
+        FBMDelta_Process();
+    }
+}
+
+#endif
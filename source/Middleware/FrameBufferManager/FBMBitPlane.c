@@ -0,0 +1,278 @@
+/**
+ * @file FBMBitPlane.c
+ * @brief Bit-plane frame storage and packed 8bpp gray to bit-plane conversion.
+ *
+ * Frames that arrive as packed 8bpp gray are split into planes with a word-parallel
+ * 8x8 bit-matrix transpose: eight pixels are loaded as one 64-bit word and, after three
+ * masked shift/XOR steps, byte b of the word holds bit b of all eight pixels. A scalar
+ * reference path is kept for verification and benchmarking.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <string.h>
+#include "Middleware/FrameBufferManager/FBMBitPlane.h"
+#include "Middleware/FrameBufferManager/FrameBufferManager.h"
+#include "HAL/MemoryManager/MemoryManager.h"
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static inline uint64_t Load8BigEndian(const uint8_t *pubSource);
+static inline uint64_t Transpose8x8(uint64_t udMatrix);
+static inline uint16_t SourceRow(const sFBMBitPlaneFrame_t *psFrame, uint16_t usPosition);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Allocates a bit-plane frame.
+ *
+ * @param psFrame     Descriptor to fill.
+ * @param usWidth     Width in pixels (all panels).
+ * @param usHeight    Height in rows.
+ * @param ubPlanes    Number of planes (1..FBM_BITPLANE_MAX_PLANES).
+ * @param pusRowOrder Row position -> source row table with usHeight entries, in the
+ *                    order the LED driver streams rows, or NULL for identity. The table
+ *                    is referenced, not copied.
+ * @return 1 on success, 0 on invalid parameters or allocation failure.
+ */
+uint8_t FBM_BitPlaneInit(sFBMBitPlaneFrame_t *psFrame, uint16_t usWidth, uint16_t usHeight,
+                         uint8_t ubPlanes, const uint16_t *pusRowOrder)
+{
+    if ((NULL == psFrame) || (0U == usWidth) || (0U == usHeight) ||
+        (0U == ubPlanes) || (ubPlanes > FBM_BITPLANE_MAX_PLANES))
+    {
+        return 0;
+    }
+
+    (void)memset(psFrame, 0, sizeof(sFBMBitPlaneFrame_t));
+
+    uint16_t usStride = (uint16_t)((usWidth + 7U) / 8U);
+    uint32_t ulPlaneBytes = (uint32_t)usStride * usHeight;
+    size_t stDataBytes = (size_t)ulPlaneBytes * ubPlanes;
+
+    // Planes are streamed by SPI DMA straight out of this block
+    uint8_t *pubBlock = (uint8_t *)MM_AllocAligned(MM_PURPOSE_DMA_SOURCE, (uint32_t)stDataBytes, FBM_BUFFER_ALIGNMENT);
+    if (NULL == pubBlock)
+    {
+        return 0;
+    }
+
+    psFrame->pvBlock      = pubBlock;
+    psFrame->pubData      = pubBlock;
+    psFrame->pusRowOrder  = pusRowOrder;
+    psFrame->ulPlaneBytes = ulPlaneBytes;
+    psFrame->usStride     = usStride;
+    psFrame->usWidth      = usWidth;
+    psFrame->usHeight     = usHeight;
+    psFrame->ubPlanes     = ubPlanes;
+
+    FBM_BitPlaneClear(psFrame);
+    return 1;
+}
+
+/**
+ * @brief Frees a bit-plane frame allocated by FBM_BitPlaneInit().
+ *
+ * @param psFrame Descriptor of the frame.
+ */
+void FBM_BitPlaneFree(sFBMBitPlaneFrame_t *psFrame)
+{
+    if (NULL != psFrame)
+    {
+        MM_Free(psFrame->pvBlock);
+        (void)memset(psFrame, 0, sizeof(sFBMBitPlaneFrame_t));
+    }
+}
+
+/**
+ * @brief Gets the start of one plane.
+ *
+ * The payload of scan address n inside the plane starts at
+ * n * (rows per scan address) * usStride.
+ *
+ * @param psFrame Descriptor of the frame.
+ * @param ubPlane Plane index, 0 is the least significant displayed bit.
+ * @return Pointer to the plane, or NULL if out of range.
+ */
+uint8_t *FBM_BitPlaneGetPlane(const sFBMBitPlaneFrame_t *psFrame, uint8_t ubPlane)
+{
+    if ((NULL == psFrame) || (NULL == psFrame->pubData) || (ubPlane >= psFrame->ubPlanes))
+    {
+        return NULL;
+    }
+    return psFrame->pubData + ((uint32_t)ubPlane * psFrame->ulPlaneBytes);
+}
+
+/**
+ * @brief Clears every plane of a bit-plane frame.
+ *
+ * @param psFrame Descriptor of the frame.
+ */
+void FBM_BitPlaneClear(sFBMBitPlaneFrame_t *psFrame)
+{
+    if ((NULL != psFrame) && (NULL != psFrame->pubData))
+    {
+        (void)memset(psFrame->pubData, 0, psFrame->ulPlaneBytes * psFrame->ubPlanes);
+    }
+}
+
+/**
+ * @brief Converts a packed 8bpp gray frame into bit planes (word-parallel path).
+ *
+ * Only used when content arrives in packed form; content rendered per plane needs no
+ * conversion. Pixels are processed eight at a time with an 8x8 bit transpose, the tail of
+ * a row that is not a multiple of eight falls back to the scalar path.
+ *
+ * @param psFrame  Destination bit-plane frame.
+ * @param ptubGray Source rows, usWidth bytes each.
+ */
+void FBM_BitPlaneFromGray8(sFBMBitPlaneFrame_t *psFrame, uint8_t **ptubGray)
+{
+    FBM_BitPlaneFromGray8Rows(psFrame, ptubGray, NULL);
+}
+
+/**
+ * @brief Converts the changed rows of a packed 8bpp gray frame into bit planes.
+ *
+ * Same conversion as FBM_BitPlaneFromGray8(); the other rows of the planes are left as
+ * they are, so a frame that changes a few rows costs a few rows.
+ *
+ * @param psFrame  Destination bit-plane frame.
+ * @param ptubGray Source rows, usWidth bytes each.
+ * @param pulRows  Bitmap of the source rows to convert (row r is bit (r & 31) of word
+ *                 (r >> 5)), or NULL for every row.
+ */
+void FBM_BitPlaneFromGray8Rows(sFBMBitPlaneFrame_t *psFrame, uint8_t **ptubGray, const uint32_t *pulRows)
+{
+    if ((NULL == psFrame) || (NULL == psFrame->pubData) || (NULL == ptubGray))
+    {
+        return;
+    }
+
+    uint8_t ubFirstBit = (uint8_t)(8U - psFrame->ubPlanes);
+    uint16_t usFullBytes = (uint16_t)(psFrame->usWidth / 8U);
+
+    for (uint16_t usPosition = 0; usPosition < psFrame->usHeight; usPosition++)
+    {
+        uint16_t usRow = SourceRow(psFrame, usPosition);
+        if ((NULL != pulRows) && (0U == (pulRows[usRow >> 5] & (1UL << (usRow & 31U)))))
+        {
+            continue;
+        }
+
+        const uint8_t *pubSource = ptubGray[usRow];
+        uint8_t *pubDestination = psFrame->pubData + ((uint32_t)usPosition * psFrame->usStride);
+
+        for (uint16_t usByte = 0; usByte < usFullBytes; usByte++)
+        {
+            uint64_t udPlanes = Transpose8x8(Load8BigEndian(pubSource + ((uint32_t)usByte * 8U)));
+            uint8_t *pubPlane = pubDestination + usByte;
+
+            for (uint8_t ubPlane = 0; ubPlane < psFrame->ubPlanes; ubPlane++)
+            {
+                *pubPlane = (uint8_t)(udPlanes >> (8U * (ubFirstBit + ubPlane)));
+                pubPlane += psFrame->ulPlaneBytes;
+            }
+        }
+
+        // Remaining pixels of a width that is not a multiple of eight
+        if (usFullBytes < psFrame->usStride)
+        {
+            for (uint8_t ubPlane = 0; ubPlane < psFrame->ubPlanes; ubPlane++)
+            {
+                uint8_t ubBits = 0;
+                for (uint16_t usX = (uint16_t)(usFullBytes * 8U); usX < psFrame->usWidth; usX++)
+                {
+                    ubBits |= (uint8_t)(((pubSource[usX] >> (ubFirstBit + ubPlane)) & 0x01U) << (7U - (usX & 7U)));
+                }
+                pubDestination[usFullBytes + ((uint32_t)ubPlane * psFrame->ulPlaneBytes)] = ubBits;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Converts a packed 8bpp gray frame into bit planes, one pixel at a time.
+ *
+ * Reference implementation of FBM_BitPlaneFromGray8().
+ *
+ * @param psFrame  Destination bit-plane frame.
+ * @param ptubGray Source rows, usWidth bytes each.
+ */
+void FBM_BitPlaneFromGray8Scalar(sFBMBitPlaneFrame_t *psFrame, uint8_t **ptubGray)
+{
+    if ((NULL == psFrame) || (NULL == psFrame->pubData) || (NULL == ptubGray))
+    {
+        return;
+    }
+
+    uint8_t ubFirstBit = (uint8_t)(8U - psFrame->ubPlanes);
+    FBM_BitPlaneClear(psFrame);
+
+    for (uint16_t usPosition = 0; usPosition < psFrame->usHeight; usPosition++)
+    {
+        const uint8_t *pubSource = ptubGray[SourceRow(psFrame, usPosition)];
+
+        for (uint8_t ubPlane = 0; ubPlane < psFrame->ubPlanes; ubPlane++)
+        {
+            uint8_t *pubDestination = FBM_BitPlaneGetPlane(psFrame, ubPlane) +
+                                      ((uint32_t)usPosition * psFrame->usStride);
+            for (uint16_t usX = 0; usX < psFrame->usWidth; usX++)
+            {
+                if ((pubSource[usX] >> (ubFirstBit + ubPlane)) & 0x01U)
+                {
+                    pubDestination[usX >> 3] |= (uint8_t)(0x80U >> (usX & 7U));
+                }
+            }
+        }
+    }
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Loads eight bytes so that the first byte lands in the most significant byte.
+ */
+static inline uint64_t Load8BigEndian(const uint8_t *pubSource)
+{
+    uint64_t udValue;
+    (void)memcpy(&udValue, pubSource, sizeof(udValue));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    udValue = __builtin_bswap64(udValue);
+#endif
+    return udValue;
+}
+
+/**
+ * @brief Transposes an 8x8 bit matrix held in a 64-bit word (Hacker's Delight, 7-3).
+ *
+ * Input byte i (counted from the most significant byte) is pixel i. On return, the byte at
+ * bits [8b+7 : 8b] holds bit b of pixels 0..7, pixel 0 in the most significant bit.
+ */
+static inline uint64_t Transpose8x8(uint64_t udMatrix)
+{
+    uint64_t udTemp;
+
+    udTemp = (udMatrix ^ (udMatrix >> 7)) & 0x00AA00AA00AA00AAULL;
+    udMatrix = udMatrix ^ udTemp ^ (udTemp << 7);
+    udTemp = (udMatrix ^ (udMatrix >> 14)) & 0x0000CCCC0000CCCCULL;
+    udMatrix = udMatrix ^ udTemp ^ (udTemp << 14);
+    udTemp = (udMatrix ^ (udMatrix >> 28)) & 0x00000000F0F0F0F0ULL;
+    udMatrix = udMatrix ^ udTemp ^ (udTemp << 28);
+
+    return udMatrix;
+}
+
+/**
+ * @brief Gets the source row stored at a row position of the planes.
+ */
+static inline uint16_t SourceRow(const sFBMBitPlaneFrame_t *psFrame, uint16_t usPosition)
+{
+    return (NULL != psFrame->pusRowOrder) ? psFrame->pusRowOrder[usPosition] : usPosition;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file FBMBitPlane.h
+ * @brief Bit-plane frame layout for binary code modulation (BCM) grayscale.
+ *
+ * A bit-plane frame stores one 1bpp plane per brightness bit, already ordered the way the
+ * LED driver streams it: plane -> scan address -> row group -> column bytes. Each scan
+ * address of a plane is therefore one contiguous SPI payload and needs no packing.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef MIDDLEWARE_FRAMEBUFFERMANAGER_FBMBITPLANE_H_
+#define MIDDLEWARE_FRAMEBUFFERMANAGER_FBMBITPLANE_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+#include <stdbool.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define FBM_BITPLANE_MAX_PLANES     8U
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief Descriptor of one bit-plane frame.
+ *
+ * Row position k inside a plane (k = scan address * rows per address + row group) holds
+ * source row pusRowOrder[k]. Plane p holds bit (8 - ubPlanes + p) of an 8 bit gray value,
+ * so plane 0 is the least significant displayed bit.
+ */
+typedef struct {
+    uint8_t        *pubData;        // Planes back to back, FBM_BUFFER_ALIGNMENT aligned
+    void           *pvBlock;        // Allocation holding pubData
+    const uint16_t *pusRowOrder;    // Row position -> source row, NULL for identity
+    uint32_t        ulPlaneBytes;   // usStride * usHeight
+    uint16_t        usStride;       // Bytes per row of one plane
+    uint16_t        usWidth;        // Width in pixels
+    uint16_t        usHeight;       // Height in rows
+    uint8_t         ubPlanes;       // Number of planes (1..FBM_BITPLANE_MAX_PLANES)
+} sFBMBitPlaneFrame_t;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t FBM_BitPlaneInit(sFBMBitPlaneFrame_t *psFrame, uint16_t usWidth, uint16_t usHeight,
+                         uint8_t ubPlanes, const uint16_t *pusRowOrder);
+
+void FBM_BitPlaneFree(sFBMBitPlaneFrame_t *psFrame);
+
+uint8_t *FBM_BitPlaneGetPlane(const sFBMBitPlaneFrame_t *psFrame, uint8_t ubPlane);
+
+void FBM_BitPlaneClear(sFBMBitPlaneFrame_t *psFrame);
+
+void FBM_BitPlaneFromGray8(sFBMBitPlaneFrame_t *psFrame, uint8_t **ptubGray);
+
+void FBM_BitPlaneFromGray8Rows(sFBMBitPlaneFrame_t *psFrame, uint8_t **ptubGray, const uint32_t *pulRows);
+
+void FBM_BitPlaneFromGray8Scalar(sFBMBitPlaneFrame_t *psFrame, uint8_t **ptubGray);
+
+#endif /* MIDDLEWARE_FRAMEBUFFERMANAGER_FBMBITPLANE_H_ */
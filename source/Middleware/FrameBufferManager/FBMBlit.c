@@ -0,0 +1,484 @@
+/**
+ * @file FBMBlit.c
+ * @brief Word-wide bit-blit operations on 1bpp surfaces.
+ *
+ * Each destination row is walked in 32 pixel words aligned to the start of the row. For
+ * every word, the 32 matching source pixels are fetched at an arbitrary bit offset with
+ * one unaligned load and a funnel shift, combined with the destination and merged back
+ * under an edge mask. Overlapping blits within one surface (scrolling) walk rows and words
+ * in the direction that never reads already written pixels.
+ *
+ * With GCC the big-endian word loads use __builtin_bswap32 (a single REV on Cortex-M7);
+ * define FBM_BLIT_PORTABLE to use the plain byte-assembling fallback instead.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <string.h>
+#include "Middleware/FrameBufferManager/FBMBlit.h"
+#include "Middleware/FrameBufferManager/FrameBufferManager.h"
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define FBM_BLIT_WORD_BITS      32
+#define FBM_BLIT_ALL_ONES       0xFFFFFFFFUL
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static void BlitRect(const sFBMSurface_t *psDestination, int32_t lDestX, int32_t lDestY,
+                     const sFBMSurface_t *psSource, int32_t lSourceX, int32_t lSourceY,
+                     int32_t lWidth, int32_t lHeight, eFBMBlitOp_t eOp, uint32_t ulSolid);
+static void BlitRow(uint8_t *pubDestination, uint16_t usDestStride,
+                    const uint8_t *pubSource, uint16_t usSourceStride,
+                    int32_t lDestX, int32_t lSourceX, int32_t lWidth,
+                    eFBMBlitOp_t eOp, uint32_t ulSolid, bool bReverse);
+static inline void BlitWord(uint8_t *pubDestination, uint16_t usDestStride,
+                            const uint8_t *pubSource, uint16_t usSourceStride,
+                            int32_t lWordStart, int32_t lFirst, int32_t lEnd, int32_t lDelta,
+                            eFBMBlitOp_t eOp, uint32_t ulSolid);
+static inline uint32_t FetchBits(const uint8_t *pubRow, uint16_t usStride, int32_t lBit);
+static inline uint32_t ApplyOp(eFBMBlitOp_t eOp, uint32_t ulDestination, uint32_t ulSource);
+static inline uint32_t LoadBigEndian32(const uint8_t *pubSource);
+static inline void StoreBigEndian32(uint8_t *pubDestination, uint32_t ulValue);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Describes an FBM frame as a blit surface.
+ *
+ * @param psSurface  Surface to fill.
+ * @param ptubBuffer Frame returned by one of the FBM buffer functions.
+ * @return 1 on success, 0 if the frame is unknown or not FBM_FORMAT_MONO_1BPP.
+ */
+uint8_t FBM_BlitSurfaceFromFrame(sFBMSurface_t *psSurface, uint8_t **ptubBuffer)
+{
+    const sFBMFrame_t *psFrame = FBM_GetFrame(ptubBuffer);
+
+    if ((NULL == psSurface) || (NULL == psFrame) || (FBM_FORMAT_MONO_1BPP != psFrame->eFormat))
+    {
+        return 0;
+    }
+
+    psSurface->ptubRows = psFrame->pptubRows;
+    psSurface->usStride = psFrame->usStride;
+    psSurface->usWidth  = psFrame->usWidth;
+    psSurface->usHeight = psFrame->usHeight;
+    return 1;
+}
+
+/**
+ * @brief Combines a rectangle of one surface into another.
+ *
+ * Source and destination may be the same surface, with overlapping rectangles.
+ *
+ * @param psDestination Destination surface.
+ * @param sDestX        Destination left column (may be negative, clipped).
+ * @param sDestY        Destination top row (may be negative, clipped).
+ * @param psSource      Source surface.
+ * @param sSourceX      Source left column.
+ * @param sSourceY      Source top row.
+ * @param usWidth       Rectangle width in pixels.
+ * @param usHeight      Rectangle height in rows.
+ * @param eOp           Raster operation.
+ */
+void FBM_Blit(const sFBMSurface_t *psDestination, int16_t sDestX, int16_t sDestY,
+              const sFBMSurface_t *psSource, int16_t sSourceX, int16_t sSourceY,
+              uint16_t usWidth, uint16_t usHeight, eFBMBlitOp_t eOp)
+{
+    if ((NULL == psSource) || (eOp >= FBM_BLIT_OP_COUNT))
+    {
+        return;
+    }
+
+    BlitRect(psDestination, sDestX, sDestY, psSource, sSourceX, sSourceY,
+             usWidth, usHeight, eOp, 0U);
+}
+
+/**
+ * @brief Combines a span of one bitmap row into another.
+ *
+ * For rows outside a surface, such as a graphics library draw buffer: the span is clipped
+ * to both strides only, and no row is marked dirty.
+ *
+ * @param pubDestination Destination row.
+ * @param usDestStride   Bytes of the destination row.
+ * @param sDestX         Destination first column (may be negative, clipped).
+ * @param pubSource      Source row.
+ * @param usSourceStride Bytes of the source row.
+ * @param sSourceX       Source first column.
+ * @param usWidth        Span width in pixels.
+ * @param eOp            Raster operation.
+ */
+void FBM_BlitRow(uint8_t *pubDestination, uint16_t usDestStride, int16_t sDestX,
+                 const uint8_t *pubSource, uint16_t usSourceStride, int16_t sSourceX,
+                 uint16_t usWidth, eFBMBlitOp_t eOp)
+{
+    int32_t lDestX = sDestX;
+    int32_t lSourceX = sSourceX;
+    int32_t lWidth = usWidth;
+
+    if ((NULL == pubDestination) || (NULL == pubSource) || (eOp >= FBM_BLIT_OP_COUNT))
+    {
+        return;
+    }
+
+    if (lDestX < 0)   { lSourceX -= lDestX; lWidth += lDestX; lDestX = 0; }
+    if (lSourceX < 0) { lDestX -= lSourceX; lWidth += lSourceX; lSourceX = 0; }
+    if ((lSourceX + lWidth) > ((int32_t)usSourceStride * 8)) { lWidth = ((int32_t)usSourceStride * 8) - lSourceX; }
+    if ((lDestX + lWidth) > ((int32_t)usDestStride * 8))     { lWidth = ((int32_t)usDestStride * 8) - lDestX; }
+
+    if (lWidth <= 0)
+    {
+        return;
+    }
+
+    BlitRow(pubDestination, usDestStride, pubSource, usSourceStride, lDestX, lSourceX, lWidth,
+            eOp, 0U, (pubSource == pubDestination) && (lDestX > lSourceX));
+}
+
+/**
+ * @brief Sets or clears every pixel of a rectangle.
+ *
+ * @param psDestination Destination surface.
+ * @param sX            Left column.
+ * @param sY            Top row.
+ * @param usWidth       Width in pixels.
+ * @param usHeight      Height in rows.
+ * @param bPixelOn      true to set the pixels, false to clear them.
+ */
+void FBM_BlitFillRect(const sFBMSurface_t *psDestination, int16_t sX, int16_t sY,
+                      uint16_t usWidth, uint16_t usHeight, bool bPixelOn)
+{
+    BlitRect(psDestination, sX, sY, NULL, 0, 0, usWidth, usHeight,
+             FBM_BLIT_COPY, bPixelOn ? FBM_BLIT_ALL_ONES : 0U);
+}
+
+/**
+ * @brief Inverts every pixel of a rectangle.
+ *
+ * @param psDestination Destination surface.
+ * @param sX            Left column.
+ * @param sY            Top row.
+ * @param usWidth       Width in pixels.
+ * @param usHeight      Height in rows.
+ */
+void FBM_BlitInvertRect(const sFBMSurface_t *psDestination, int16_t sX, int16_t sY,
+                        uint16_t usWidth, uint16_t usHeight)
+{
+    BlitRect(psDestination, sX, sY, NULL, 0, 0, usWidth, usHeight,
+             FBM_BLIT_XOR, FBM_BLIT_ALL_ONES);
+}
+
+/**
+ * @brief Scrolls the content of a rectangle by a number of pixels.
+ *
+ * Pixels shifted out of the rectangle are lost; the vacated columns and rows are cleared.
+ *
+ * @param psSurface Surface to scroll.
+ * @param sX        Left column of the rectangle.
+ * @param sY        Top row of the rectangle.
+ * @param usWidth   Width of the rectangle in pixels.
+ * @param usHeight  Height of the rectangle in rows.
+ * @param sShiftX   Pixels to move right (negative: left).
+ * @param sShiftY   Rows to move down (negative: up).
+ */
+void FBM_BlitScroll(const sFBMSurface_t *psSurface, int16_t sX, int16_t sY,
+                    uint16_t usWidth, uint16_t usHeight, int16_t sShiftX, int16_t sShiftY)
+{
+    if ((NULL == psSurface) || (NULL == psSurface->ptubRows))
+    {
+        return;
+    }
+
+    // Scroll within the visible part of the rectangle only
+    int32_t lX0 = (sX < 0) ? 0 : sX;
+    int32_t lY0 = (sY < 0) ? 0 : sY;
+    int32_t lX1 = (int32_t)sX + usWidth;
+    int32_t lY1 = (int32_t)sY + usHeight;
+    if (lX1 > psSurface->usWidth)  { lX1 = psSurface->usWidth; }
+    if (lY1 > psSurface->usHeight) { lY1 = psSurface->usHeight; }
+
+    int32_t lWidth = lX1 - lX0;
+    int32_t lHeight = lY1 - lY0;
+    if ((lWidth <= 0) || (lHeight <= 0))
+    {
+        return;
+    }
+
+    int32_t lShiftX = sShiftX;
+    int32_t lShiftY = sShiftY;
+    int32_t lAbsX = (lShiftX < 0) ? -lShiftX : lShiftX;
+    int32_t lAbsY = (lShiftY < 0) ? -lShiftY : lShiftY;
+
+    if ((lAbsX >= lWidth) || (lAbsY >= lHeight))
+    {
+        BlitRect(psSurface, lX0, lY0, NULL, 0, 0, lWidth, lHeight, FBM_BLIT_COPY, 0U);
+        return;
+    }
+
+    BlitRect(psSurface, lX0 + ((lShiftX > 0) ? lShiftX : 0), lY0 + ((lShiftY > 0) ? lShiftY : 0),
+             psSurface, lX0 + ((lShiftX < 0) ? lAbsX : 0), lY0 + ((lShiftY < 0) ? lAbsY : 0),
+             lWidth - lAbsX, lHeight - lAbsY, FBM_BLIT_COPY, 0U);
+
+    // Clear what the move uncovered
+    if (0 != lShiftX)
+    {
+        BlitRect(psSurface, (lShiftX > 0) ? lX0 : (lX1 - lAbsX), lY0, NULL, 0, 0,
+                 lAbsX, lHeight, FBM_BLIT_COPY, 0U);
+    }
+    if (0 != lShiftY)
+    {
+        BlitRect(psSurface, lX0, (lShiftY > 0) ? lY0 : (lY1 - lAbsY), NULL, 0, 0,
+                 lWidth, lAbsY, FBM_BLIT_COPY, 0U);
+    }
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Clips a rectangle against both surfaces and blits it row by row.
+ *
+ * psSource NULL combines the destination with the constant ulSolid instead.
+ */
+static void BlitRect(const sFBMSurface_t *psDestination, int32_t lDestX, int32_t lDestY,
+                     const sFBMSurface_t *psSource, int32_t lSourceX, int32_t lSourceY,
+                     int32_t lWidth, int32_t lHeight, eFBMBlitOp_t eOp, uint32_t ulSolid)
+{
+    if ((NULL == psDestination) || (NULL == psDestination->ptubRows) ||
+        ((NULL != psSource) && (NULL == psSource->ptubRows)))
+    {
+        return;
+    }
+
+    // Clip the left/top edges against the destination, then the source
+    if (lDestX < 0) { lSourceX -= lDestX; lWidth += lDestX; lDestX = 0; }
+    if (lDestY < 0) { lSourceY -= lDestY; lHeight += lDestY; lDestY = 0; }
+    if (NULL != psSource)
+    {
+        if (lSourceX < 0) { lDestX -= lSourceX; lWidth += lSourceX; lSourceX = 0; }
+        if (lSourceY < 0) { lDestY -= lSourceY; lHeight += lSourceY; lSourceY = 0; }
+        if ((lSourceX + lWidth) > psSource->usWidth)   { lWidth = psSource->usWidth - lSourceX; }
+        if ((lSourceY + lHeight) > psSource->usHeight) { lHeight = psSource->usHeight - lSourceY; }
+    }
+    if ((lDestX + lWidth) > psDestination->usWidth)   { lWidth = psDestination->usWidth - lDestX; }
+    if ((lDestY + lHeight) > psDestination->usHeight) { lHeight = psDestination->usHeight - lDestY; }
+
+    if ((lWidth <= 0) || (lHeight <= 0))
+    {
+        return;
+    }
+
+    // Within one surface, walk away from the rows/words still to be read
+    bool bSameSurface = (NULL != psSource) && (psSource->ptubRows == psDestination->ptubRows);
+    bool bReverseRows = bSameSurface && (lDestY > lSourceY);
+    bool bReverseWords = bSameSurface && (lDestY == lSourceY) && (lDestX > lSourceX);
+
+    for (int32_t lIndex = 0; lIndex < lHeight; lIndex++)
+    {
+        int32_t lRow = bReverseRows ? (lHeight - 1 - lIndex) : lIndex;
+        const uint8_t *pubSource = NULL;
+        uint16_t usSourceStride = 0U;
+
+        if (NULL != psSource)
+        {
+            pubSource = psSource->ptubRows[lSourceY + lRow];
+            usSourceStride = psSource->usStride;
+        }
+
+        BlitRow(psDestination->ptubRows[lDestY + lRow], psDestination->usStride,
+                pubSource, usSourceStride, lDestX, lSourceX, lWidth, eOp, ulSolid, bReverseWords);
+    }
+
+    // No-op unless the destination is an FBM render/reserve buffer
+    FBM_MarkRowsDirty(psDestination->ptubRows, (uint16_t)lDestY, (uint16_t)(lDestY + lHeight - 1));
+}
+
+/**
+ * @brief Blits one row span, one destination word at a time.
+ */
+static void BlitRow(uint8_t *pubDestination, uint16_t usDestStride,
+                    const uint8_t *pubSource, uint16_t usSourceStride,
+                    int32_t lDestX, int32_t lSourceX, int32_t lWidth,
+                    eFBMBlitOp_t eOp, uint32_t ulSolid, bool bReverse)
+{
+    int32_t lEnd = lDestX + lWidth;
+    int32_t lDelta = lSourceX - lDestX;
+
+    if (!bReverse)
+    {
+        int32_t lX = lDestX;
+        while (lX < lEnd)
+        {
+            int32_t lWordStart = lX & ~(FBM_BLIT_WORD_BITS - 1);
+            int32_t lChunkEnd = lWordStart + FBM_BLIT_WORD_BITS;
+            if (lChunkEnd > lEnd)
+            {
+                lChunkEnd = lEnd;
+            }
+            BlitWord(pubDestination, usDestStride, pubSource, usSourceStride,
+                     lWordStart, lX, lChunkEnd, lDelta, eOp, ulSolid);
+            lX = lChunkEnd;
+        }
+    }
+    else
+    {
+        int32_t lX = lEnd;
+        while (lX > lDestX)
+        {
+            int32_t lWordStart = (lX - 1) & ~(FBM_BLIT_WORD_BITS - 1);
+            int32_t lChunkStart = (lWordStart > lDestX) ? lWordStart : lDestX;
+            BlitWord(pubDestination, usDestStride, pubSource, usSourceStride,
+                     lWordStart, lChunkStart, lX, lDelta, eOp, ulSolid);
+            lX = lChunkStart;
+        }
+    }
+}
+
+/**
+ * @brief Updates pixels [lFirst, lEnd) of the destination word starting at lWordStart.
+ */
+static inline void BlitWord(uint8_t *pubDestination, uint16_t usDestStride,
+                            const uint8_t *pubSource, uint16_t usSourceStride,
+                            int32_t lWordStart, int32_t lFirst, int32_t lEnd, int32_t lDelta,
+                            eFBMBlitOp_t eOp, uint32_t ulSolid)
+{
+    uint32_t ulHead = (uint32_t)(lFirst - lWordStart);
+    uint32_t ulTail = (uint32_t)(lEnd - lWordStart);
+    uint32_t ulMask = (FBM_BLIT_ALL_ONES >> ulHead) &
+                      ((ulTail >= 32U) ? FBM_BLIT_ALL_ONES : ~(FBM_BLIT_ALL_ONES >> ulTail));
+
+    uint32_t ulSource = (NULL != pubSource) ?
+                        FetchBits(pubSource, usSourceStride, lWordStart + lDelta) : ulSolid;
+
+    uint8_t *pubWord = pubDestination + (lWordStart >> 3);
+    int32_t lAvailable = (int32_t)usDestStride - (lWordStart >> 3);
+
+    if ((lAvailable >= 4) && (FBM_BLIT_ALL_ONES == ulMask) &&
+        ((FBM_BLIT_COPY == eOp) || (FBM_BLIT_INVERT_COPY == eOp)))
+    {
+        // Whole word replaced: no need to read the destination
+        StoreBigEndian32(pubWord, ApplyOp(eOp, 0U, ulSource));
+    }
+    else if (lAvailable >= 4)
+    {
+        uint32_t ulDestination = LoadBigEndian32(pubWord);
+        uint32_t ulResult = ApplyOp(eOp, ulDestination, ulSource);
+        StoreBigEndian32(pubWord, (ulDestination & ~ulMask) | (ulResult & ulMask));
+    }
+    else
+    {
+        // Last word of a row whose stride is not a multiple of four bytes
+        uint32_t ulDestination = 0U;
+        for (int32_t lByte = 0; lByte < lAvailable; lByte++)
+        {
+            ulDestination |= (uint32_t)pubWord[lByte] << (24 - (8 * lByte));
+        }
+
+        uint32_t ulResult = ApplyOp(eOp, ulDestination, ulSource);
+        ulResult = (ulDestination & ~ulMask) | (ulResult & ulMask);
+
+        for (int32_t lByte = 0; lByte < lAvailable; lByte++)
+        {
+            pubWord[lByte] = (uint8_t)(ulResult >> (24 - (8 * lByte)));
+        }
+    }
+}
+
+/**
+ * @brief Reads 32 pixels starting at any bit position, MSB first.
+ *
+ * Bytes outside [0, usStride) read as zero; callers mask those pixels off anyway.
+ */
+static inline uint32_t FetchBits(const uint8_t *pubRow, uint16_t usStride, int32_t lBit)
+{
+    int32_t lByte = (lBit >= 0) ? (lBit / 8) : -((7 - lBit) / 8);
+    uint32_t ulShift = (uint32_t)(lBit - (lByte * 8));
+    uint32_t ulHigh;
+    uint32_t ulLow;
+
+    if ((lByte >= 0) && ((lByte + 5) <= (int32_t)usStride))
+    {
+        ulHigh = LoadBigEndian32(pubRow + lByte);
+        ulLow = pubRow[lByte + 4];
+    }
+    else
+    {
+        ulHigh = 0U;
+        ulLow = 0U;
+        for (int32_t lIndex = 0; lIndex < 5; lIndex++)
+        {
+            int32_t lPosition = lByte + lIndex;
+            if ((lPosition >= 0) && (lPosition < (int32_t)usStride))
+            {
+                if (lIndex < 4)
+                {
+                    ulHigh |= (uint32_t)pubRow[lPosition] << (24 - (8 * lIndex));
+                }
+                else
+                {
+                    ulLow = pubRow[lPosition];
+                }
+            }
+        }
+    }
+
+    return (0U == ulShift) ? ulHigh : ((ulHigh << ulShift) | (ulLow >> (8U - ulShift)));
+}
+
+/**
+ * @brief Applies a raster operation to 32 pixels.
+ */
+static inline uint32_t ApplyOp(eFBMBlitOp_t eOp, uint32_t ulDestination, uint32_t ulSource)
+{
+    switch (eOp)
+    {
+        case FBM_BLIT_OR:          return ulDestination | ulSource;
+        case FBM_BLIT_AND:         return ulDestination & ulSource;
+        case FBM_BLIT_XOR:         return ulDestination ^ ulSource;
+        case FBM_BLIT_INVERT_COPY: return ~ulSource;
+        case FBM_BLIT_COPY:
+        default:                   return ulSource;
+    }
+}
+
+/**
+ * @brief Loads four bytes as a big-endian word (first byte = leftmost pixels).
+ */
+static inline uint32_t LoadBigEndian32(const uint8_t *pubSource)
+{
+#if defined(__GNUC__) && !defined(FBM_BLIT_PORTABLE)
+    uint32_t ulValue;
+    (void)memcpy(&ulValue, pubSource, sizeof(ulValue));
+#if (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    ulValue = __builtin_bswap32(ulValue);
+#endif
+    return ulValue;
+#else
+    return ((uint32_t)pubSource[0] << 24) | ((uint32_t)pubSource[1] << 16) |
+           ((uint32_t)pubSource[2] << 8)  |  (uint32_t)pubSource[3];
+#endif
+}
+
+/**
+ * @brief Stores a word as four big-endian bytes.
+ */
+static inline void StoreBigEndian32(uint8_t *pubDestination, uint32_t ulValue)
+{
+#if defined(__GNUC__) && !defined(FBM_BLIT_PORTABLE)
+#if (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    ulValue = __builtin_bswap32(ulValue);
+#endif
+    (void)memcpy(pubDestination, &ulValue, sizeof(ulValue));
+#else
+    pubDestination[0] = (uint8_t)(ulValue >> 24);
+    pubDestination[1] = (uint8_t)(ulValue >> 16);
+    pubDestination[2] = (uint8_t)(ulValue >> 8);
+    pubDestination[3] = (uint8_t)ulValue;
+#endif
+}
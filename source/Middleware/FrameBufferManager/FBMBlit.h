@@ -0,0 +1,69 @@
+/**
+ * @file FBMBlit.h
+ * @brief Word-wide bit-blit operations on 1bpp surfaces.
+ *
+ * Pixels are stored MSB first: pixel x of a row is bit (7 - (x & 7)) of byte (x >> 3).
+ * Source and destination may start at any bit offset; rows are processed 32 pixels at a
+ * time with shift/merge masks. Rectangles are clipped to both surfaces, and when the
+ * destination is an FBM frame the touched rows are marked dirty.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef MIDDLEWARE_FRAMEBUFFERMANAGER_FBMBLIT_H_
+#define MIDDLEWARE_FRAMEBUFFERMANAGER_FBMBLIT_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+#include <stdbool.h>
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief Raster operation applied between source (S) and destination (D) pixels.
+ */
+typedef enum {
+    FBM_BLIT_COPY = 0,      // D = S
+    FBM_BLIT_OR,            // D = D | S
+    FBM_BLIT_AND,           // D = D & S
+    FBM_BLIT_XOR,           // D = D ^ S
+    FBM_BLIT_INVERT_COPY,   // D = ~S
+    FBM_BLIT_OP_COUNT
+} eFBMBlitOp_t;
+
+/**
+ * @brief A 1bpp surface: an FBM frame or any caller owned bitmap.
+ */
+typedef struct {
+    uint8_t  **ptubRows;    // Row view, one pointer per row
+    uint16_t   usStride;    // Readable/writable bytes per row
+    uint16_t   usWidth;     // Width in pixels
+    uint16_t   usHeight;    // Height in rows
+} sFBMSurface_t;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t FBM_BlitSurfaceFromFrame(sFBMSurface_t *psSurface, uint8_t **ptubBuffer);
+
+void FBM_Blit(const sFBMSurface_t *psDestination, int16_t sDestX, int16_t sDestY,
+              const sFBMSurface_t *psSource, int16_t sSourceX, int16_t sSourceY,
+              uint16_t usWidth, uint16_t usHeight, eFBMBlitOp_t eOp);
+
+void FBM_BlitFillRect(const sFBMSurface_t *psDestination, int16_t sX, int16_t sY,
+                      uint16_t usWidth, uint16_t usHeight, bool bPixelOn);
+
+void FBM_BlitRow(uint8_t *pubDestination, uint16_t usDestStride, int16_t sDestX,
+                 const uint8_t *pubSource, uint16_t usSourceStride, int16_t sSourceX,
+                 uint16_t usWidth, eFBMBlitOp_t eOp);
+
+void FBM_BlitInvertRect(const sFBMSurface_t *psDestination, int16_t sX, int16_t sY,
+                        uint16_t usWidth, uint16_t usHeight);
+
+void FBM_BlitScroll(const sFBMSurface_t *psSurface, int16_t sX, int16_t sY,
+                    uint16_t usWidth, uint16_t usHeight, int16_t sShiftX, int16_t sShiftY);
+
+#endif /* MIDDLEWARE_FRAMEBUFFERMANAGER_FBMBLIT_H_ */
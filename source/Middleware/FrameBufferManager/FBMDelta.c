@@ -0,0 +1,434 @@
+/**
+ * @file FBMDelta.c
+ * @brief Frame delta encoder for remote display mirroring.
+ *
+ * FBMDelta_OnFramePublished() runs in the render context right after a publish, while the
+ * published frame cannot be reused for rendering. It builds the delta, updates the
+ * reference frame and compresses the result in one pass. FBMDelta_Process() then sends at
+ * most one datagram per call from the main loop, so network work is spread out and never
+ * holds up the scan. Frames published while a previous one is still queued are not
+ * encoded; the next encoded delta covers their changes because it is taken against the
+ * last frame actually sent. When the frame geometry changes (a new display profile),
+ * frames are dropped and counted until FBMDelta_Process() re-arms the encoder for the new
+ * geometry, which starts again with a keyframe.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <string.h>
+#include "Middleware/FrameBufferManager/FBMDelta.h"
+#include "Middleware/FrameBufferManager/FrameBufferManager.h"
+#include "Middleware/LogManager/LogManager.h"
+#include "HAL/MemoryManager/MemoryManager.h"
+#include "../lvgl/src/libs/lz4/lz4.h"
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define FBM_DELTA_MAGIC_0           ((uint8_t)'F')
+#define FBM_DELTA_MAGIC_1           ((uint8_t)'D')
+#define FBM_DELTA_MAX_RETRIES       3U
+#define FBM_DELTA_LZ4_ACCELERATION  1
+
+//-------------------------------------[ STATIC VARIABLES ] -------------------------//
+//
+static bool bIsRunning = false;
+static pfnFBMDeltaSend_t pfnSender = NULL;
+static void *pvSenderContext = NULL;
+
+static uint8_t *pubReference = NULL;    // Last frame sent, as the receiver should have it
+static uint8_t *pubDelta = NULL;        // Delta or keyframe of the frame being encoded
+static uint8_t *pubEncoded = NULL;      // LZ4 output
+static uint8_t *pubDatagram = NULL;     // Header + chunk being sent
+static void *pvLz4State = NULL;
+
+static uint32_t ulFrameBytes = 0U;
+static uint16_t usFrameWidth = 0U;
+static uint16_t usFrameHeight = 0U;
+static eFBMPixelFormat_t eFrameFormat = FBM_FORMAT_MONO_1BPP;
+static uint32_t ulEncodedCapacity = 0U;
+static uint16_t usMaxDatagramBytes = 0U;
+static uint16_t usMaxChunkPayload = 0U;
+static uint16_t usKeyframeEvery = 0U;
+static uint16_t usFramesSinceKeyframe = 0U;
+static bool bKeyframeRequested = true;
+
+// Queued frame
+static const uint8_t *pubPayload = NULL;
+static uint32_t ulPayloadBytes = 0U;
+static uint16_t usChunkCount = 0U;
+static uint16_t usNextChunk = 0U;
+static uint8_t ubPayloadFlags = 0U;
+static uint8_t ubRetries = 0U;
+static uint16_t usFrameSequence = 0U;
+
+static sFBMDeltaStats_t sStats;
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static uint8_t AllocateBuffers(void);
+static void ReleaseBuffers(void);
+static void Rearm(void);
+static bool IsEncoderGeometry(uint32_t ulBytes, uint16_t usWidth, eFBMPixelFormat_t eFormat);
+static void PutUint16(uint8_t *pubDestination, uint16_t usValue);
+static void PutUint32(uint8_t *pubDestination, uint32_t ulValue);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Starts mirroring published frames.
+ *
+ * Must be called after FBM_Init(); the buffers are sized for the current frame geometry.
+ *
+ * @param usKeyframeInterval Send a keyframe every this many published frames (min 1).
+ * @param usMaxDatagram      Largest datagram to hand to the transport, header included;
+ *                           0 selects FBM_DELTA_MAX_DATAGRAM.
+ * @param pfnSend            Transport for one datagram.
+ * @param pvContext          Passed unchanged to pfnSend.
+ * @return 1 on success, 0 on invalid parameters or if memory is not available.
+ */
+uint8_t FBMDelta_Start(uint16_t usKeyframeInterval, uint16_t usMaxDatagram,
+                       pfnFBMDeltaSend_t pfnSend, void *pvContext)
+{
+    FBMDelta_Stop();
+
+    if (0U == usMaxDatagram)
+    {
+        usMaxDatagram = FBM_DELTA_MAX_DATAGRAM;
+    }
+
+    uint32_t ulBytes = (uint32_t)FBM_GetStride() * FBM_GetHeight();
+    if ((NULL == pfnSend) || (0U == ulBytes) || (usMaxDatagram <= FBM_DELTA_HEADER_SIZE))
+    {
+        COSLOG_ERROR("FBMDelta_Start: Invalid parameters or FBM not initialized.\n");
+        return 0;
+    }
+
+    usMaxDatagramBytes = usMaxDatagram;
+    if (0U == AllocateBuffers())
+    {
+        COSLOG_ERROR("FBMDelta_Start: Out of memory.\n");
+        return 0;
+    }
+
+    (void)memset(&sStats, 0, sizeof(sStats));
+
+    pfnSender             = pfnSend;
+    pvSenderContext       = pvContext;
+    usMaxChunkPayload     = (uint16_t)(usMaxDatagram - FBM_DELTA_HEADER_SIZE);
+    usKeyframeEvery       = (0U == usKeyframeInterval) ? 1U : usKeyframeInterval;
+    usFramesSinceKeyframe = 0U;
+    bKeyframeRequested    = true;
+    pubPayload            = NULL;
+    bIsRunning            = true;
+
+    COSLOG_INFO("FBMDelta: Mirroring %u byte frames, keyframe every %u.\n",
+                (unsigned)ulFrameBytes, (unsigned)usKeyframeEvery);
+    return 1;
+}
+
+/**
+ * @brief Stops mirroring and releases the encoder buffers.
+ */
+void FBMDelta_Stop(void)
+{
+    bIsRunning = false;
+    pubPayload = NULL;
+    ReleaseBuffers();
+}
+
+/**
+ * @brief Tells whether mirroring is active.
+ * @return true after a successful FBMDelta_Start().
+ */
+bool FBMDelta_IsRunning(void)
+{
+    return bIsRunning;
+}
+
+/**
+ * @brief Encodes a frame that has just been published.
+ *
+ * Call from the render context right after FBM_PublishBuffer() with the buffer that was
+ * published. Does nothing when mirroring is stopped or the previous frame is still queued,
+ * and drops the frame if its geometry is not the encoder's (re-armed by FBMDelta_Process()).
+ *
+ * @param ptubFrame Row view of the published frame.
+ */
+void FBMDelta_OnFramePublished(uint8_t **ptubFrame)
+{
+    if (!bIsRunning)
+    {
+        return;
+    }
+
+    const sFBMFrame_t *psFrame = FBM_GetFrame(ptubFrame);
+    if (NULL == psFrame)
+    {
+        return;
+    }
+
+    if (!IsEncoderGeometry(psFrame->ulSizeBytes, psFrame->usWidth, psFrame->eFormat))
+    {
+        sStats.ulGeometryDrops++;
+        return;
+    }
+
+    if (NULL != pubPayload)
+    {
+        sStats.ulBusyFrames++;
+        return;
+    }
+
+    bool bKeyframe = bKeyframeRequested || (usFramesSinceKeyframe >= usKeyframeEvery);
+    bool bChanged = false;
+
+    // Delta against the reference word by word; frame blocks are cache line aligned
+    const uint32_t *pulFrame = (const uint32_t *)psFrame->pubData;
+    uint32_t *pulReference = (uint32_t *)pubReference;
+    uint32_t *pulDelta = (uint32_t *)pubDelta;
+    uint32_t ulWords = ulFrameBytes / sizeof(uint32_t);
+
+    for (uint32_t ulIndex = 0; ulIndex < ulWords; ulIndex++)
+    {
+        uint32_t ulNew = pulFrame[ulIndex];
+        uint32_t ulDiff = ulNew ^ pulReference[ulIndex];
+        bChanged |= (0U != ulDiff);
+        pulDelta[ulIndex] = bKeyframe ? ulNew : ulDiff;
+        pulReference[ulIndex] = ulNew;
+    }
+    for (uint32_t ulIndex = ulWords * sizeof(uint32_t); ulIndex < ulFrameBytes; ulIndex++)
+    {
+        uint8_t ubNew = psFrame->pubData[ulIndex];
+        uint8_t ubDiff = ubNew ^ pubReference[ulIndex];
+        bChanged |= (0U != ubDiff);
+        pubDelta[ulIndex] = bKeyframe ? ubNew : ubDiff;
+        pubReference[ulIndex] = ubNew;
+    }
+
+    usFramesSinceKeyframe++;
+    if (!bKeyframe && !bChanged)
+    {
+        sStats.ulUnchangedFrames++;
+        return;
+    }
+
+    int iCompressed = LZ4_compress_fast_extState(pvLz4State, (const char *)pubDelta, (char *)pubEncoded,
+                                                 (int)ulFrameBytes, (int)ulEncodedCapacity,
+                                                 FBM_DELTA_LZ4_ACCELERATION);
+
+    ubPayloadFlags = bKeyframe ? FBM_DELTA_FLAG_KEYFRAME : 0U;
+    if ((iCompressed > 0) && ((uint32_t)iCompressed < ulFrameBytes))
+    {
+        pubPayload = pubEncoded;
+        ulPayloadBytes = (uint32_t)iCompressed;
+        ubPayloadFlags |= FBM_DELTA_FLAG_LZ4;
+    }
+    else
+    {
+        pubPayload = pubDelta;
+        ulPayloadBytes = ulFrameBytes;
+    }
+
+    if (bKeyframe)
+    {
+        bKeyframeRequested = false;
+        usFramesSinceKeyframe = 0U;
+        sStats.ulKeyframes++;
+    }
+
+    usChunkCount = (uint16_t)((ulPayloadBytes + usMaxChunkPayload - 1U) / usMaxChunkPayload);
+    usNextChunk = 0U;
+    ubRetries = 0U;
+    usFrameSequence++;
+
+    sStats.ulFramesEncoded++;
+    sStats.ulRawBytes += ulFrameBytes;
+    sStats.ulEncodedBytes += ulPayloadBytes;
+}
+
+/**
+ * @brief Sends the next datagram of the queued frame, if any.
+ *
+ * Call once per main loop iteration. Re-arms the encoder instead once the frame buffers
+ * have a new geometry; mirroring stops if its buffers no longer fit in memory.
+ */
+void FBMDelta_Process(void)
+{
+    if (!bIsRunning)
+    {
+        return;
+    }
+
+    uint32_t ulBytes = (uint32_t)FBM_GetStride() * FBM_GetHeight();
+    if ((0U != ulBytes) && !IsEncoderGeometry(ulBytes, FBM_GetWidth(), FBM_GetPixelFormat()))
+    {
+        Rearm();
+        return;
+    }
+
+    if (NULL == pubPayload)
+    {
+        return;
+    }
+
+    uint32_t ulOffset = (uint32_t)usNextChunk * usMaxChunkPayload;
+    uint32_t ulChunkBytes = ulPayloadBytes - ulOffset;
+    if (ulChunkBytes > usMaxChunkPayload)
+    {
+        ulChunkBytes = usMaxChunkPayload;
+    }
+
+    pubDatagram[0] = FBM_DELTA_MAGIC_0;
+    pubDatagram[1] = FBM_DELTA_MAGIC_1;
+    pubDatagram[2] = ubPayloadFlags;
+    pubDatagram[3] = (uint8_t)eFrameFormat;
+    PutUint16(&pubDatagram[4], usFrameSequence);
+    PutUint16(&pubDatagram[6], usNextChunk);
+    PutUint16(&pubDatagram[8], usChunkCount);
+    PutUint16(&pubDatagram[10], usFrameWidth);
+    PutUint16(&pubDatagram[12], usFrameHeight);
+    PutUint32(&pubDatagram[14], ulPayloadBytes);
+    (void)memcpy(&pubDatagram[FBM_DELTA_HEADER_SIZE], pubPayload + ulOffset, ulChunkBytes);
+
+    if (0U != pfnSender(pubDatagram, (uint16_t)(FBM_DELTA_HEADER_SIZE + ulChunkBytes), pvSenderContext))
+    {
+        sStats.ulDatagramsSent++;
+        ubRetries = 0U;
+        usNextChunk++;
+        if (usNextChunk >= usChunkCount)
+        {
+            pubPayload = NULL;
+        }
+    }
+    else if (++ubRetries >= FBM_DELTA_MAX_RETRIES)
+    {
+        // The receiver cannot apply a partial delta; resynchronise with a keyframe
+        sStats.ulAbortedFrames++;
+        pubPayload = NULL;
+        bKeyframeRequested = true;
+    }
+}
+
+/**
+ * @brief Forces the next encoded frame to be a keyframe (e.g. a new receiver joined).
+ */
+void FBMDelta_RequestKeyframe(void)
+{
+    bKeyframeRequested = true;
+}
+
+/**
+ * @brief Reads the encoder statistics.
+ *
+ * @param psStats Destination.
+ * @return 1 on success, 0 if psStats is NULL.
+ */
+uint8_t FBMDelta_GetStatistics(sFBMDeltaStats_t *psStats)
+{
+    if (NULL == psStats)
+    {
+        return 0;
+    }
+    *psStats = sStats;
+    return 1;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Allocates the encoder buffers for the current frame geometry and clears the
+ *        reference frame.
+ *
+ * @return 1 on success, 0 if memory is not available (nothing stays allocated).
+ */
+static uint8_t AllocateBuffers(void)
+{
+    ulFrameBytes = (uint32_t)FBM_GetStride() * FBM_GetHeight();
+    usFrameWidth = FBM_GetWidth();
+    usFrameHeight = FBM_GetHeight();
+    eFrameFormat = FBM_GetPixelFormat();
+    ulEncodedCapacity = (uint32_t)LZ4_compressBound((int)ulFrameBytes);
+
+    pubReference = (uint8_t *)MM_Alloc(MM_PURPOSE_GENERAL, ulFrameBytes);
+    pubDelta     = (uint8_t *)MM_Alloc(MM_PURPOSE_GENERAL, ulFrameBytes);
+    pubEncoded   = (uint8_t *)MM_Alloc(MM_PURPOSE_GENERAL, ulEncodedCapacity);
+    pubDatagram  = (uint8_t *)MM_Alloc(MM_PURPOSE_GENERAL, usMaxDatagramBytes);
+    pvLz4State   = MM_Alloc(MM_PURPOSE_GENERAL, (uint32_t)LZ4_sizeofState());
+
+    if ((NULL == pubReference) || (NULL == pubDelta) || (NULL == pubEncoded) ||
+        (NULL == pubDatagram) || (NULL == pvLz4State))
+    {
+        ReleaseBuffers();
+        return 0;
+    }
+
+    (void)memset(pubReference, 0, ulFrameBytes);
+    return 1;
+}
+
+/**
+ * @brief Resizes the encoder for a new frame geometry: drops the queued frame and starts
+ *        again with a keyframe. Stops mirroring if the buffers cannot be allocated.
+ */
+static void Rearm(void)
+{
+    pubPayload = NULL;
+    ReleaseBuffers();
+
+    if (0U == AllocateBuffers())
+    {
+        COSLOG_ERROR("FBMDelta: Out of memory for the new frame geometry, mirroring stopped.\n");
+        bIsRunning = false;
+        return;
+    }
+
+    bKeyframeRequested = true;
+    usFramesSinceKeyframe = 0U;
+    sStats.ulRearms++;
+    COSLOG_INFO("FBMDelta: Re-armed for %u byte frames after dropping %u.\n",
+                (unsigned)ulFrameBytes, (unsigned)sStats.ulGeometryDrops);
+}
+
+/**
+ * @brief Tells whether a frame geometry is the one the encoder buffers were sized for.
+ */
+static bool IsEncoderGeometry(uint32_t ulBytes, uint16_t usWidth, eFBMPixelFormat_t eFormat)
+{
+    return (ulBytes == ulFrameBytes) && (usWidth == usFrameWidth) && (eFormat == eFrameFormat);
+}
+
+/**
+ * @brief Frees every encoder buffer.
+ */
+static void ReleaseBuffers(void)
+{
+    MM_Free(pubReference);
+    MM_Free(pubDelta);
+    MM_Free(pubEncoded);
+    MM_Free(pubDatagram);
+    MM_Free(pvLz4State);
+
+    pubReference = NULL;
+    pubDelta = NULL;
+    pubEncoded = NULL;
+    pubDatagram = NULL;
+    pvLz4State = NULL;
+}
+
+static void PutUint16(uint8_t *pubDestination, uint16_t usValue)
+{
+    pubDestination[0] = (uint8_t)usValue;
+    pubDestination[1] = (uint8_t)(usValue >> 8);
+}
+
+static void PutUint32(uint8_t *pubDestination, uint32_t ulValue)
+{
+    PutUint16(pubDestination, (uint16_t)ulValue);
+    PutUint16(pubDestination + 2, (uint16_t)(ulValue >> 16));
+}
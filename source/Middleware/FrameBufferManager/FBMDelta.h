@@ -0,0 +1,81 @@
+/**
+ * @file FBMDelta.h
+ * @brief Frame delta encoder for remote display mirroring.
+ *
+ * Every published frame is XORed against the last frame sent, the delta is LZ4 compressed
+ * and queued as datagrams of at most one MTU. A keyframe (the frame itself) is sent every
+ * N frames so a receiver can join or recover from loss. All buffers are allocated once in
+ * FBMDelta_Start(); encoding and sending never allocate.
+ *
+ * Datagram layout (little endian):
+ *   [0..1]  'F' 'D'            [2]  flags (FBM_DELTA_FLAG_*)      [3]  eFBMPixelFormat_t
+ *   [4..5]  frame sequence     [6..7] chunk index                 [8..9] chunk count
+ *   [10..11] width             [12..13] height                    [14..17] encoded size
+ *   [18..]  chunk of the encoded frame (chunk index * max chunk payload onwards)
+ * A receiver decodes the reassembled payload, then replaces its frame with it (keyframe)
+ * or XORs it into its frame (delta).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef MIDDLEWARE_FRAMEBUFFERMANAGER_FBMDELTA_H_
+#define MIDDLEWARE_FRAMEBUFFERMANAGER_FBMDELTA_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+#include <stdbool.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define FBM_DELTA_HEADER_SIZE       18U
+
+// Largest UDP payload that fits a 1500 byte Ethernet MTU without IP fragmentation
+#define FBM_DELTA_MAX_DATAGRAM      1472U
+
+#define FBM_DELTA_FLAG_KEYFRAME     0x01U   // Payload is the frame, not a delta
+#define FBM_DELTA_FLAG_LZ4          0x02U   // Payload is an LZ4 block, otherwise raw
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief Transport used to send one datagram.
+ *
+ * @return 1 if the datagram was handed to the network stack, 0 to retry it later.
+ */
+typedef uint8_t (*pfnFBMDeltaSend_t)(const uint8_t *pubDatagram, uint16_t usLength, void *pvContext);
+
+typedef struct {
+    uint32_t ulFramesEncoded;       // Frames turned into a delta or keyframe
+    uint32_t ulKeyframes;           // Of which keyframes
+    uint32_t ulUnchangedFrames;     // Frames identical to the last one sent, nothing queued
+    uint32_t ulBusyFrames;          // Frames published while the previous one was still queued
+    uint32_t ulRawBytes;            // Sum of frame sizes encoded
+    uint32_t ulEncodedBytes;        // Sum of encoded payload sizes
+    uint32_t ulDatagramsSent;       // Datagrams accepted by the transport
+    uint32_t ulAbortedFrames;       // Frames dropped after repeated send failures
+    uint32_t ulGeometryDrops;       // Frames of a new geometry dropped before the re-arm
+    uint32_t ulRearms;              // Times the encoder was resized for a new geometry
+} sFBMDeltaStats_t;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t FBMDelta_Start(uint16_t usKeyframeInterval, uint16_t usMaxDatagram,
+                       pfnFBMDeltaSend_t pfnSend, void *pvContext);
+
+void FBMDelta_Stop(void);
+
+bool FBMDelta_IsRunning(void);
+
+void FBMDelta_OnFramePublished(uint8_t **ptubFrame);
+
+void FBMDelta_Process(void);
+
+void FBMDelta_RequestKeyframe(void);
+
+uint8_t FBMDelta_GetStatistics(sFBMDeltaStats_t *psStats);
+
+#endif /* MIDDLEWARE_FRAMEBUFFERMANAGER_FBMDELTA_H_ */
@@ -1,335 +1,1182 @@
-/**
- * @file FrameBufferManager.c
- * @brief Manages dynamic 2D frame buffers (Active and Reserve) for flicker-free display updates.
- *
- * Implements double-buffering, memory allocation/deallocation, and atomic swapping
- * of buffer pointers to synchronize LED display routines.
- *
- * (C) Copyright Centum T&S Group 2025. All rights reserved.
- * This computer program may not be used, copied, distributed, translated,
- * transmitted or assigned without the prior written authorization of
- * Centum T&S Group.
- */
-
-//------------------------------------ [ INCLUDE FILES ] ----------------------------//
-//
-
-#include "fsl_debug_console.h"
-#include "Middleware/FrameBufferManager/FrameBufferManager.h"
-#include "Middleware/LogManager/LogManager.h"
-//-------------------------------------[ STATIC VARIABLE ] --------------------------//
-//
-static uint8_t **ptubActiveFrontBuffer = NULL;
-static uint8_t **ptubReserveFrontBuffer = NULL;
-static uint8_t **ptubActiveRearBuffer = NULL;
-static uint8_t **ptubReserveRearBuffer = NULL;
-static bool     bIsInitialised = false;
-
-static int isDoubleSidedDisplay = 0;
-
-//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
-//
-static uint8_t **AllocateBuffer(uint8_t ubHeight, uint16_t usWidth);
-
-//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
-//
-
-/**
- * @brief Initializes the frame buffer system by allocating Active and Reserve buffers.
- *
- * This function must be called once before any other FBM function.
- *
- * @param usDisplayRows 		Number of rows in one LED panel.
- * @param usDisplayColumns 		Number of columns in one LED panel.
- * @param ubDoubleSidedDisplay  0 - Single sided display, 1 - Double sided display
- * @param ubLedType				0 - Monochrome LED, 1 - RGB LED
- * @param ubNumPanels           Number of LED panels connected serially
- * @return 1 on successful allocation and initialization, 0 on failure or if already initialized.
- */
-uint8_t FBM_Init(uint16_t usDisplayRows, uint16_t usDisplayColumns, uint8_t  ubDoubleSidedDisplay, uint8_t  ubLedType, uint8_t ubNumPanels)
-{
-    if (bIsInitialised)
-    {
-        COSLOG_INFO("FBM_InitManager: Manager already initialized. Call FBM_DeinitializeSystem first.\n");
-        return 0;
-    }
-
-    if (usDisplayRows == 0 || usDisplayColumns == 0)
-    {
-    	return 0;
-    }
-
-    if (ubLedType)
-    {
-    	//TODO: Allocate Buffer of appropriate size for color LED
-    	return 1;
-    }
-
-    //Buffer allocation for monochrome Buffer
-    // Allocate Active Buffer using AllocateBuffer
-    ptubActiveFrontBuffer = AllocateBuffer(usDisplayRows, usDisplayColumns*ubNumPanels);
-    if (NULL == ptubActiveFrontBuffer)
-    {
-        COSLOG_ERROR("FBM_InitManager: Failed to allocate Active Buffer.\n");
-        return 0;
-    }
-    // Allocate Reserve Buffer using AllocateBuffer
-    ptubReserveFrontBuffer = AllocateBuffer(usDisplayRows, usDisplayColumns*ubNumPanels);
-    if (NULL == ptubReserveFrontBuffer)
-    {
-        COSLOG_ERROR("FBM_InitManager: Failed to allocate Reserve Buffer. Cleaning up Active Buffer.\n");
-        // Use the unmodified FBM_FreeBuffer for cleanup
-        FBM_FreeBuffer(ptubActiveFrontBuffer, usDisplayRows);
-        ptubActiveFrontBuffer = NULL;
-        return 0;
-    }
-
-    //Allocation of Active and reserve buffers if Double sided display
-    if (ubDoubleSidedDisplay)
-    {
-    	isDoubleSidedDisplay = 1;
-    	// Allocate Active Buffer using AllocateBuffer
-		ptubActiveRearBuffer = AllocateBuffer(usDisplayRows, usDisplayColumns*ubNumPanels);
-		if (NULL == ptubActiveRearBuffer)
-		{
-			COSLOG_ERROR("FBM_InitManager: Failed to allocate Active Buffer for back panel.\n");
-			return 0;
-		}
-		// Allocate Reserve Buffer using AllocateBuffer
-		ptubReserveRearBuffer = AllocateBuffer(usDisplayRows, usDisplayColumns*ubNumPanels);
-		if (NULL == ptubReserveRearBuffer)
-		{
-			COSLOG_ERROR("FBM_InitManager: Failed to allocate Reserve Buffer. Cleaning up Active Buffer for back panel.\n");
-			// Use the unmodified FBM_FreeBuffer for cleanup
-			FBM_FreeBuffer(ptubActiveRearBuffer, usDisplayRows);
-			ptubActiveFrontBuffer = NULL;
-			return 0;
-		}
-    }
-
-    bIsInitialised = true;
-    return 1;
-}
-
-
-/**
- * @brief Frees all memory allocated for the Active and Reserve buffers and resets state.
- *
- * @param usDisplayRows 		Number of rows in one LED panel.
- */
-void FBM_DeinitializeSystem(uint16_t usDisplayRows)
-{
-    if (!bIsInitialised)
-    {
-        return;
-    }
-    // Free Active Buffer using the unmodified FBM_FreeBuffer
-    FBM_FreeBuffer(ptubActiveFrontBuffer, usDisplayRows);
-    // Free Reserve Buffer using the unmodified FBM_FreeBuffer
-    FBM_FreeBuffer(ptubReserveFrontBuffer, usDisplayRows);
-
-    if (isDoubleSidedDisplay)
-    {
-        // Free Active Buffer using the unmodified FBM_FreeBuffer
-        FBM_FreeBuffer(ptubActiveRearBuffer, usDisplayRows);
-        // Free Reserve Buffer using the unmodified FBM_FreeBuffer
-        FBM_FreeBuffer(ptubReserveRearBuffer, usDisplayRows);
-
-        // Reset static state
-        ptubActiveRearBuffer = NULL;
-        ptubReserveRearBuffer = NULL;
-    }
-    // Reset static state
-    ptubActiveFrontBuffer = NULL;
-    ptubReserveFrontBuffer = NULL;
-    bIsInitialised = false;
-}
-
-
-/**
- * @brief Gets the pointer to the currently active buffer.
- * @return Pointer to the Active Buffer (uint8_t **), or NULL if not initialized.
- */
-uint8_t **FBM_GetActiveFrontBuffer(void)
-{
-    if (!bIsInitialised)
-    {
-        COSLOG_INFO("FBM_GetActiveBuffer: Manager not initialized.\n");
-        return NULL;
-    }
-    return ptubActiveFrontBuffer;
-}
-
-/**
- * @brief Gets the pointer to the currently active buffer for rear LED panel.
- * @return Pointer to the Active Buffer (uint8_t **) for rear LED panel, or NULL if not initialized.
- */
-uint8_t **FBM_GetActiveRearBuffer(void)
-{
-    if (!bIsInitialised)
-    {
-        COSLOG_INFO("FBM_GetActiveBuffer: Manager not initialized.\n");
-        return NULL;
-    }
-
-    //If not a double sided display, ptubActiveRearBuffer is NULL
-    return ptubActiveRearBuffer;
-}
-
-
-/**
- * @brief Gets the pointer to the currently reserve buffer.
- * @return Pointer to the Reserve Buffer (uint8_t **), or NULL if not initialized.
- */
-uint8_t **FBM_GetReserveFrontBuffer(void)
-{
-    if (!bIsInitialised) {
-        COSLOG_INFO("FBM_GetReserveBuffer: Manager not initialized.\n");
-        return NULL;
-    }
-    return ptubReserveFrontBuffer;
-}
-
-/**
- * @brief Gets the pointer to the current reserve buffer for rear LED panel.
- * @return Pointer to the Reserve Buffer (uint8_t **), or NULL if not initialized.
- */
-uint8_t **FBM_GetReserveRearBuffer(void)
-{
-    if (!bIsInitialised) {
-        COSLOG_INFO("FBM_GetReserveBuffer: Manager not initialized.\n");
-        return NULL;
-    }
-
-    //If not a double sided display, ptubReserveRearBuffer is NULL
-    return ptubReserveRearBuffer;
-}
-
-/**
- * @brief Atomically swaps the Active and Reserve buffer pointers.
- *
- * This action makes the newly drawn Reserve buffer visible to the LED driver.
- */
-void FBM_SwapBuffers(void)
-{
-    if (!bIsInitialised) {
-        COSLOG_INFO("FBM_SwapBuffers: Manager not initialized. Cannot swap.\n");
-        return;
-    }
-    // Use a temporary pointer to swap the two static pointers
-    //Swap Front Buffers
-    uint8_t **ptubTemp = ptubActiveFrontBuffer;
-    ptubActiveFrontBuffer = ptubReserveFrontBuffer;
-    ptubReserveFrontBuffer = ptubTemp;
-
-    if (isDoubleSidedDisplay)
-    {
-    //Swap rear buffers
-    ptubActiveRearBuffer = ptubReserveRearBuffer;
-    ptubReserveRearBuffer = ptubTemp;
-    }
-}
-
-/**
- * @brief Frees the memory allocated for a 2D buffer.
- *
- * Cleans up both the individual row memory and the array of row pointers.
- *
- * @param ptubBuffer Pointer to the 2D buffer structure to free.
- * @param usHeight The height of the buffer (number of rows) used for iteration.
- */
-void FBM_FreeBuffer(uint8_t **ptubBuffer, uint8_t ubHeight)
-{
-    // Now takes the double pointer directly.
-    if (NULL != ptubBuffer)
-    {
-        for (uint8_t ubRow = 0; ubRow < ubHeight; ubRow++)
-        {
-            // Note: We check if the row pointer is NULL before freeing.
-            if (NULL != ptubBuffer[ubRow])
-            {
-                free(ptubBuffer[ubRow]);
-            }
-        }
-        free(ptubBuffer);
-
-        // **The calling code must now set its own pointer to NULL.**
-
-    }
-}
-
-
-/**
- * @brief Clears a 2D buffer by setting all its data bytes to zero.
- *
- * @param ptubBuffer Pointer to the 2D buffer structure to clear.
- * @param usHeight The height of the buffer.
- * @param usWidth The width of the buffer in columns.
- */
-void FBM_ClearBuffer(uint8_t **ptubBuffer, uint8_t ubHeight, uint16_t usWidth)
-{
-    if (NULL != ptubBuffer)
-    {
-        uint16_t usBytesPerRow = (usWidth + 7U) / 8U;
-        for (uint8_t ubRow = 0; ubRow < ubHeight; ubRow++)
-        {
-            if (NULL != ptubBuffer[ubRow])
-            {
-                (void)memset(ptubBuffer[ubRow], 0, usBytesPerRow);
-            }
-        }
-    }
-}
-
-//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
-//
-/**
- * @brief Allocates memory for a 2D buffer structure (array of row pointers).
- *
- * This function performs a two-level memory allocation: first for the row pointers,
- * then for each row's data.
- *
- * @param usHeight The height of the buffer (number of rows).
- * @param usWidth The width of the buffer in columns (used to calculate bytes per row).
- * @return A pointer to the newly allocated 2D buffer (uint8_t **), or NULL on failure.
- */
-static uint8_t **AllocateBuffer(uint8_t ubHeight, uint16_t usWidth)
-{
-
-    uint8_t **ptubBuffer = NULL;
-
-    uint16_t usBytesPerRow = (usWidth + 7U) / 8U;
-
-    // 1. Allocate memory for the array of row pointers (Level 2).
-    ptubBuffer = (uint8_t **)malloc(ubHeight * sizeof(uint8_t *));
-
-    if (NULL != ptubBuffer)
-    {
-        uint8_t ubRow = 0;
-        // The success check is implied by returning NULL or the valid pointer.
-        // We initialize the entire array to NULL to simplify cleanup on failure.
-        (void)memset(ptubBuffer, 0, ubHeight * sizeof(uint8_t *));
-
-        while (ubRow < ubHeight)
-        {
-            // 2. Allocate memory for the current row's data (Level 1).
-            ptubBuffer[ubRow] = (uint8_t *)calloc(usBytesPerRow, sizeof(uint8_t));
-
-            if (NULL == ptubBuffer[ubRow])
-            {
-                // Allocation for a row failed. Call Free to clean up the partially allocated structure.
-                FBM_FreeBuffer(ptubBuffer, ubRow); // We pass ubRow as height to clean up only allocated rows.
-
-                // Set our local pointer to NULL before returning failure.
-                ptubBuffer = NULL;
-                break;
-            }
-            ubRow++;
-        }
-    }
-
-    // Return the allocated buffer pointer (or NULL on failure).
-    return ptubBuffer;
-}
-
-
+/**
+ * @file FrameBufferManager.c
+ * @brief Manages dynamic 2D frame buffers (Active and Reserve) for flicker-free display updates.
+ *
+ * Implements double- and triple-buffering, memory allocation/deallocation, and lock-free
+ * hand-over of complete frames between the renderer and the LED scan. Every frame is stored as one
+ * contiguous, cache-line aligned block with a row pointer view for legacy callers.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+
+#include "fsl_debug_console.h"
+#include "Middleware/FrameBufferManager/FrameBufferManager.h"
+#include "HAL/MemoryManager/MemoryManager.h"
+#include "Middleware/LogManager/LogManager.h"
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+// Layout of the word shared between renderer and scan in triple buffer mode
+#define FBM_SHARED_SLOT_MASK    0x03U   // Index of the latest published slot
+#define FBM_SHARED_FRESH_FLAG   0x04U   // Set while the published slot has not been scanned yet
+
+//-------------------------------------[ STATIC VARIABLE ] --------------------------//
+//
+// Row views of every slot, per display face
+static uint8_t **aptubFrontSlots[FBM_MAX_SLOTS] = {NULL};
+static uint8_t **aptubRearSlots[FBM_MAX_SLOTS] = {NULL};
+static bool     bIsInitialised = false;
+
+static int isDoubleSidedDisplay = 0;
+
+// Descriptors of all allocated frames. A frame is free when pptubRows is NULL.
+static sFBMFrame_t sFrames[FBM_MAX_FRAMES];
+
+// Buffering mode and slot ownership.
+// ubRenderSlot is owned by the renderer, ubScanSlot by the scan. In triple buffer mode the
+// third slot is handed over through ulSharedState using atomic exchanges only.
+static eFBMBufferMode_t eBufferMode = FBM_MODE_DOUBLE_BUFFER;
+static uint8_t ubNumSlots = 0;
+static uint8_t ubRenderSlot = 0;
+static uint8_t ubScanSlot = 0;
+static uint8_t ubLastPublishedSlot = 0;
+static bool    bRenderInProgress = false;
+static volatile uint32_t ulSharedState = 0;
+
+// Sequence counters. Every published frame gets the next sequence number, which the scan
+// compares with the last frame it acquired to detect dropped and duplicated frames.
+static uint32_t ulPublishSequence = 0;
+static volatile uint32_t aulSlotSequence[FBM_MAX_SLOTS] = {0};
+static volatile uint32_t ulLastScanSequence = 0;
+static sFBMFrameStats_t sFrameStats;
+
+// Dirty-row bitmaps per slot (front and rear faces share the bitmaps of their slot).
+// aulRenderDirty : rows written since the slot was acquired for rendering.
+// aulScanDirty   : rows that differ from the frame the scan had before taking this slot.
+// aulStaleRows   : rows changed by later publishes that the slot does not hold yet.
+// aulPendingScan : rows published since the last frame known to be scanned.
+static uint32_t aulRenderDirty[FBM_MAX_SLOTS][FBM_DIRTY_WORDS];
+static uint32_t aulScanDirty[FBM_MAX_SLOTS][FBM_DIRTY_WORDS];
+static uint32_t aulStaleRows[FBM_MAX_SLOTS][FBM_DIRTY_WORDS];
+static uint32_t aulPendingScan[FBM_DIRTY_WORDS];
+static uint16_t usFrameRows = 0;
+
+// Pixel format and geometry of every frame
+static eFBMPixelFormat_t ePixelFormat = FBM_FORMAT_MONO_1BPP;
+static bool    bIsFormatSelected = false;
+static uint16_t usFrameWidth = 0;
+static uint16_t usFrameStride = 0;
+static uint16_t usFrameHeaderBytes = 0;
+
+// Bit-planes of every slot when the format is FBM_FORMAT_GRAY_8BPP, in source row order or
+// the order the LED driver streams rows (pusScanRowOrder). aulPlaneStale holds the rows of a slot's frame
+// not yet converted into its planes; they are converted when the slot is published.
+static uint8_t ubGrayPlanes = 1U;
+static sFBMBitPlaneFrame_t asSlotPlanes[FBM_MAX_SLOTS];
+static uint32_t aulPlaneStale[FBM_MAX_SLOTS][FBM_DIRTY_WORDS];
+static uint16_t *pusScanRowOrder = NULL;
+
+// Bits per pixel of each eFBMPixelFormat_t
+static const uint8_t aubBitsPerPixel[FBM_FORMAT_COUNT] = { 1U, 4U, 8U, 16U, 24U };
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static uint8_t **AllocateBuffer(uint16_t usHeight, uint16_t usWidth, eFBMPixelFormat_t eFormat);
+static size_t ComputeBlockBytes(uint16_t usHeight, uint16_t usStride, size_t *pstRowTableBytes);
+static sFBMFrame_t *FindFrame(uint8_t **ptubBuffer);
+static void ReleaseAllSlots(void);
+static void SyncRenderSlot(void);
+static int8_t FindSlot(uint8_t **ptubBuffer);
+static void CopyRows(uint8_t **ptubDestination, uint8_t **ptubSource, const uint32_t *pulRows);
+static void ConvertRenderPlanes(void);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Selects double or triple buffering.
+ *
+ * Must be called before FBM_Init(). Triple buffering lets the renderer publish frames
+ * without waiting for the scan, while the scan always picks up the latest complete frame.
+ *
+ * @param eMode FBM_MODE_DOUBLE_BUFFER or FBM_MODE_TRIPLE_BUFFER.
+ * @return 1 on success, 0 if the manager is already initialized or the mode is unknown.
+ */
+uint8_t FBM_SetBufferMode(eFBMBufferMode_t eMode)
+{
+    if (bIsInitialised)
+    {
+        COSLOG_INFO("FBM_SetBufferMode: Manager already initialized.\n");
+        return 0;
+    }
+
+    if ((eMode != FBM_MODE_DOUBLE_BUFFER) && (eMode != FBM_MODE_TRIPLE_BUFFER))
+    {
+        return 0;
+    }
+
+    eBufferMode = eMode;
+    return 1;
+}
+
+/**
+ * @brief Selects the pixel format of the frame buffers.
+ *
+ * Must be called before FBM_Init(). Without it, FBM_Init() uses FBM_FORMAT_MONO_1BPP for
+ * monochrome LEDs and FBM_FORMAT_RGB888 for RGB LEDs.
+ *
+ * @param eFormat One of eFBMPixelFormat_t.
+ * @return 1 on success, 0 if the manager is already initialized or the format is unknown.
+ */
+uint8_t FBM_SetPixelFormat(eFBMPixelFormat_t eFormat)
+{
+    if (bIsInitialised)
+    {
+        COSLOG_INFO("FBM_SetPixelFormat: Manager already initialized.\n");
+        return 0;
+    }
+
+    if (eFormat >= FBM_FORMAT_COUNT)
+    {
+        return 0;
+    }
+
+    ePixelFormat = eFormat;
+    bIsFormatSelected = true;
+    return 1;
+}
+
+/**
+ * @brief Reserves a header in front of the pixel data of every frame.
+ *
+ * Must be called before FBM_Init(). Lets a renderer use a frame as its own draw buffer
+ * when that buffer starts with a header, e.g. the palette of an LVGL indexed buffer: the
+ * header ends where the (still FBM_BUFFER_ALIGNMENT aligned) pixel data starts.
+ *
+ * @param usBytes Header size, 0 for none (default).
+ * @return 1 on success, 0 if the manager is already initialized or the header is too large.
+ */
+uint8_t FBM_SetFrameHeader(uint16_t usBytes)
+{
+    if (bIsInitialised)
+    {
+        COSLOG_INFO("FBM_SetFrameHeader: Manager already initialized.\n");
+        return 0;
+    }
+
+    if (usBytes > FBM_MAX_HEADER_BYTES)
+    {
+        return 0;
+    }
+
+    usFrameHeaderBytes = usBytes;
+    return 1;
+}
+
+/**
+ * @brief Selects the number of bit-planes gray frames are split into for the scan.
+ *
+ * Must be called before FBM_Init(). Used with FBM_FORMAT_GRAY_8BPP only: FBM_Init() then
+ * gives every slot a bit-plane frame, filled when the slot is published and handed to the
+ * scan by FBM_AcquireScanBitPlanes(). Plane p holds bit (8 - ubPlanes + p) of every pixel.
+ *
+ * @param ubPlanes Number of planes (1..FBM_BITPLANE_MAX_PLANES), 1 by default.
+ * @return 1 on success, 0 if the manager is already initialized or the count is invalid.
+ */
+uint8_t FBM_SetGrayPlanes(uint8_t ubPlanes)
+{
+    if (bIsInitialised)
+    {
+        COSLOG_INFO("FBM_SetGrayPlanes: Manager already initialized.\n");
+        return 0;
+    }
+
+    if ((ubPlanes == 0U) || (ubPlanes > FBM_BITPLANE_MAX_PLANES))
+    {
+        return 0;
+    }
+
+    ubGrayPlanes = ubPlanes;
+    return 1;
+}
+
+/**
+ * @brief Initializes the frame buffer system by allocating Active and Reserve buffers.
+ *
+ * This function must be called once before any other FBM function. In triple buffer mode
+ * a third buffer is allocated per display face.
+ *
+ * @param usDisplayRows 		Number of rows in one LED panel.
+ * @param usDisplayColumns 		Number of columns in one LED panel.
+ * @param ubDoubleSidedDisplay  0 - Single sided display, 1 - Double sided display
+ * @param ubLedType				0 - Monochrome LED, 1 - RGB LED (selects the default pixel format)
+ * @param ubNumPanels           Number of LED panels connected serially
+ * @return 1 on successful allocation and initialization, 0 on failure or if already initialized.
+ */
+uint8_t FBM_Init(uint16_t usDisplayRows, uint16_t usDisplayColumns, uint8_t  ubDoubleSidedDisplay, uint8_t  ubLedType, uint8_t ubNumPanels)
+{
+    if (bIsInitialised)
+    {
+        COSLOG_INFO("FBM_InitManager: Manager already initialized. Call FBM_DeinitializeSystem first.\n");
+        return 0;
+    }
+
+    if (usDisplayRows == 0 || usDisplayColumns == 0 || usDisplayRows > FBM_MAX_ROWS)
+    {
+    	return 0;
+    }
+
+    if (!bIsFormatSelected)
+    {
+        ePixelFormat = ubLedType ? FBM_FORMAT_RGB888 : FBM_FORMAT_MONO_1BPP;
+    }
+
+    ubNumSlots = (eBufferMode == FBM_MODE_TRIPLE_BUFFER) ? 3U : 2U;
+    isDoubleSidedDisplay = ubDoubleSidedDisplay ? 1 : 0;
+
+    usFrameWidth = usDisplayColumns*ubNumPanels;
+    usFrameStride = FBM_ComputeStride(ePixelFormat, usFrameWidth);
+
+    for (uint8_t ubSlot = 0; ubSlot < ubNumSlots; ubSlot++)
+    {
+        aptubFrontSlots[ubSlot] = AllocateBuffer(usDisplayRows, usFrameWidth, ePixelFormat);
+        if (NULL == aptubFrontSlots[ubSlot])
+        {
+            COSLOG_ERROR("FBM_InitManager: Failed to allocate front buffer %d.\n", ubSlot);
+            ReleaseAllSlots();
+            return 0;
+        }
+
+        //Allocation of rear buffers if Double sided display
+        if (isDoubleSidedDisplay)
+        {
+            aptubRearSlots[ubSlot] = AllocateBuffer(usDisplayRows, usFrameWidth, ePixelFormat);
+            if (NULL == aptubRearSlots[ubSlot])
+            {
+                COSLOG_ERROR("FBM_InitManager: Failed to allocate rear buffer %d.\n", ubSlot);
+                ReleaseAllSlots();
+                return 0;
+            }
+        }
+    }
+
+    // Gray frames reach the scan as bit-planes, one set per slot, in source row order
+    // until FBM_SetScanRowOrder()
+    if (ePixelFormat == FBM_FORMAT_GRAY_8BPP)
+    {
+        pusScanRowOrder = (uint16_t *)MM_Alloc(MM_PURPOSE_LOOKUP_TABLE, (uint32_t)usDisplayRows * sizeof(uint16_t));
+        if (NULL == pusScanRowOrder)
+        {
+            COSLOG_ERROR("FBM_InitManager: Failed to allocate the scan row order.\n");
+            ReleaseAllSlots();
+            return 0;
+        }
+
+        for (uint8_t ubSlot = 0; ubSlot < ubNumSlots; ubSlot++)
+        {
+            if (FBM_BitPlaneInit(&asSlotPlanes[ubSlot], usFrameWidth, usDisplayRows, ubGrayPlanes, NULL) == 0)
+            {
+                COSLOG_ERROR("FBM_InitManager: Failed to allocate the bit-planes of slot %d.\n", ubSlot);
+                ReleaseAllSlots();
+                return 0;
+            }
+        }
+    }
+
+    // Slot 0 is scanned first, slot 1 is rendered first, slot 2 (triple mode) is the
+    // initial published slot. Nothing has been published yet, so it is not fresh.
+    ubScanSlot = 0;
+    ubRenderSlot = 1;
+    ubLastPublishedSlot = 0;
+    ulSharedState = (ubNumSlots == 3U) ? 2U : 0U;
+    bRenderInProgress = false;
+    ulPublishSequence = 0;
+    ulLastScanSequence = 0;
+    (void)memset((void *)aulSlotSequence, 0, sizeof(aulSlotSequence));
+    (void)memset(&sFrameStats, 0, sizeof(sFrameStats));
+    (void)memset(aulRenderDirty, 0, sizeof(aulRenderDirty));
+    (void)memset(aulScanDirty, 0, sizeof(aulScanDirty));
+    (void)memset(aulStaleRows, 0, sizeof(aulStaleRows));
+    (void)memset(aulPendingScan, 0, sizeof(aulPendingScan));
+    (void)memset(aulPlaneStale, 0, sizeof(aulPlaneStale));
+    usFrameRows = usDisplayRows;
+
+    bIsInitialised = true;
+    return 1;
+}
+
+
+/**
+ * @brief Computes the memory FBM_Init() would allocate for a geometry.
+ *
+ * Uses the buffer mode, pixel format and frame header selected so far, so it gives the
+ * cost of the next FBM_Init(). Memory manager block headers are not included.
+ *
+ * @param usDisplayRows 		Number of rows in one LED panel.
+ * @param usDisplayColumns 		Number of columns in one LED panel.
+ * @param ubDoubleSidedDisplay  0 - Single sided display, 1 - Double sided display
+ * @param ubLedType				0 - Monochrome LED, 1 - RGB LED (selects the default pixel format)
+ * @param ubNumPanels           Number of LED panels connected serially
+ * @return Bytes, or 0 if FBM_Init() would reject the geometry.
+ */
+uint32_t FBM_ComputeFootprint(uint16_t usDisplayRows, uint16_t usDisplayColumns, uint8_t ubDoubleSidedDisplay,
+                              uint8_t ubLedType, uint8_t ubNumPanels)
+{
+    sMMPlanEntry_t asEntries[FBM_MAX_PLAN_ENTRIES];
+    eFBMPixelFormat_t eFormat = bIsFormatSelected ? ePixelFormat :
+                                (ubLedType ? FBM_FORMAT_RGB888 : FBM_FORMAT_MONO_1BPP);
+    uint8_t ubEntries = FBM_GetAllocationPlan(usDisplayRows, usDisplayColumns, ubDoubleSidedDisplay,
+                                              eFormat, ubNumPanels, ubGrayPlanes, asEntries);
+    uint32_t ulBytes = 0;
+
+    for (uint8_t ubEntry = 0; ubEntry < ubEntries; ubEntry++)
+    {
+        ulBytes += asEntries[ubEntry].ulSize;
+    }
+    return ulBytes;
+}
+
+/**
+ * @brief Lists the blocks FBM_Init() would allocate for a geometry, in allocation order.
+ *
+ * Uses the buffer mode and frame header selected so far; the pixel format and gray planes
+ * are given, so a caller can plan the settings it is about to select. Lets a caller check
+ * the plan against the memory manager with MM_CheckPlan() before anything is allocated.
+ *
+ * @param usDisplayRows 		Number of rows in one LED panel.
+ * @param usDisplayColumns 		Number of columns in one LED panel.
+ * @param ubDoubleSidedDisplay  0 - Single sided display, 1 - Double sided display
+ * @param eFormat               Pixel format of the frames.
+ * @param ubNumPanels           Number of LED panels connected serially
+ * @param ubPlanes              Bit-planes per slot with FBM_FORMAT_GRAY_8BPP, ignored otherwise.
+ * @param psEntries             Returns the blocks; room for FBM_MAX_PLAN_ENTRIES.
+ * @return Number of blocks, or 0 if FBM_Init() would reject the geometry.
+ */
+uint8_t FBM_GetAllocationPlan(uint16_t usDisplayRows, uint16_t usDisplayColumns, uint8_t ubDoubleSidedDisplay,
+                              eFBMPixelFormat_t eFormat, uint8_t ubNumPanels, uint8_t ubPlanes,
+                              sMMPlanEntry_t *psEntries)
+{
+    if (usDisplayRows == 0 || usDisplayColumns == 0 || usDisplayRows > FBM_MAX_ROWS || ubNumPanels == 0 ||
+        eFormat >= FBM_FORMAT_COUNT || psEntries == NULL ||
+        ((eFormat == FBM_FORMAT_GRAY_8BPP) && ((ubPlanes == 0U) || (ubPlanes > FBM_BITPLANE_MAX_PLANES))))
+    {
+        return 0;
+    }
+
+    uint8_t ubSlots = (eBufferMode == FBM_MODE_TRIPLE_BUFFER) ? 3U : 2U;
+    uint8_t ubFrames = (uint8_t)(ubSlots * (ubDoubleSidedDisplay ? 2U : 1U));
+    uint16_t usWidth = (uint16_t)(usDisplayColumns * ubNumPanels);
+    size_t stRowTableBytes;
+    size_t stBlockBytes = ComputeBlockBytes(usDisplayRows, FBM_ComputeStride(eFormat, usWidth), &stRowTableBytes);
+    uint8_t ubEntries = 0;
+
+    for (; ubEntries < ubFrames; ubEntries++)
+    {
+        psEntries[ubEntries].ePurpose = MM_PURPOSE_RENDER_TARGET;
+        psEntries[ubEntries].ulSize = (uint32_t)stBlockBytes;
+        psEntries[ubEntries].ulAlignment = FBM_BUFFER_ALIGNMENT;
+    }
+
+    if (eFormat == FBM_FORMAT_GRAY_8BPP)
+    {
+        psEntries[ubEntries].ePurpose = MM_PURPOSE_LOOKUP_TABLE;
+        psEntries[ubEntries].ulSize = (uint32_t)usDisplayRows * sizeof(uint16_t);
+        psEntries[ubEntries].ulAlignment = 0U;
+        ubEntries++;
+
+        for (uint8_t ubSlot = 0; ubSlot < ubSlots; ubSlot++)
+        {
+            psEntries[ubEntries].ePurpose = MM_PURPOSE_DMA_SOURCE;
+            psEntries[ubEntries].ulSize = (uint32_t)ubPlanes * ((usWidth + 7U) / 8U) * usDisplayRows;
+            psEntries[ubEntries].ulAlignment = FBM_BUFFER_ALIGNMENT;
+            ubEntries++;
+        }
+    }
+    return ubEntries;
+}
+
+
+/**
+ * @brief Frees all memory allocated for the Active and Reserve buffers and resets state.
+ *
+ * @param usDisplayRows 		Number of rows in one LED panel.
+ */
+void FBM_DeinitializeSystem(uint16_t usDisplayRows)
+{
+    (void)usDisplayRows;
+
+    if (!bIsInitialised)
+    {
+        return;
+    }
+
+    ReleaseAllSlots();
+    bIsInitialised = false;
+}
+
+
+/**
+ * @brief Gets the pointer to the currently active buffer.
+ *
+ * This is the buffer last handed to the scan by FBM_AcquireScanBuffer().
+ *
+ * @return Pointer to the Active Buffer (uint8_t **), or NULL if not initialized.
+ */
+uint8_t **FBM_GetActiveFrontBuffer(void)
+{
+    if (!bIsInitialised)
+    {
+        COSLOG_INFO("FBM_GetActiveBuffer: Manager not initialized.\n");
+        return NULL;
+    }
+    return aptubFrontSlots[ubScanSlot];
+}
+
+/**
+ * @brief Gets the pointer to the currently active buffer for rear LED panel.
+ * @return Pointer to the Active Buffer (uint8_t **) for rear LED panel, or NULL if not initialized.
+ */
+uint8_t **FBM_GetActiveRearBuffer(void)
+{
+    if (!bIsInitialised)
+    {
+        COSLOG_INFO("FBM_GetActiveBuffer: Manager not initialized.\n");
+        return NULL;
+    }
+
+    //If not a double sided display, rear slots are NULL
+    return aptubRearSlots[ubScanSlot];
+}
+
+
+/**
+ * @brief Gets the pointer to the currently reserve buffer.
+ *
+ * This is the buffer owned by the renderer. Prefer FBM_AcquireRenderBuffer(), which also
+ * brings the buffer up to date with the last published frame.
+ *
+ * @return Pointer to the Reserve Buffer (uint8_t **), or NULL if not initialized.
+ */
+uint8_t **FBM_GetReserveFrontBuffer(void)
+{
+    if (!bIsInitialised) {
+        COSLOG_INFO("FBM_GetReserveBuffer: Manager not initialized.\n");
+        return NULL;
+    }
+    return aptubFrontSlots[ubRenderSlot];
+}
+
+/**
+ * @brief Gets the pointer to the current reserve buffer for rear LED panel.
+ * @return Pointer to the Reserve Buffer (uint8_t **), or NULL if not initialized.
+ */
+uint8_t **FBM_GetReserveRearBuffer(void)
+{
+    if (!bIsInitialised) {
+        COSLOG_INFO("FBM_GetReserveBuffer: Manager not initialized.\n");
+        return NULL;
+    }
+
+    //If not a double sided display, rear slots are NULL
+    return aptubRearSlots[ubRenderSlot];
+}
+
+/**
+ * @brief Publishes the reserve buffer(s) to the scan.
+ *
+ * Kept for existing callers, equivalent to FBM_PublishBuffer(). Front and rear faces are
+ * always published together.
+ */
+void FBM_SwapBuffers(void)
+{
+    if (!bIsInitialised) {
+        COSLOG_INFO("FBM_SwapBuffers: Manager not initialized. Cannot swap.\n");
+        return;
+    }
+
+    FBM_PublishBuffer();
+}
+
+/**
+ * @brief Acquires the front buffer to render the next frame into.
+ *
+ * The first call after a publish brings the buffer up to date with the last published
+ * frame (copying only the rows changed since the slot last held it), so callers only need
+ * to redraw what changed and mark those rows with FBM_MarkRowsDirty(). Further calls before the next
+ * FBM_PublishBuffer() return the same buffer. The rear buffer of the same frame is
+ * available through FBM_GetReserveRearBuffer(). Never blocks.
+ *
+ * @return Pointer to the render buffer (uint8_t **), or NULL if not initialized.
+ */
+uint8_t **FBM_AcquireRenderBuffer(void)
+{
+    if (!bIsInitialised) {
+        COSLOG_INFO("FBM_AcquireRenderBuffer: Manager not initialized.\n");
+        return NULL;
+    }
+
+    if (!bRenderInProgress)
+    {
+        SyncRenderSlot();
+        bRenderInProgress = true;
+    }
+    return aptubFrontSlots[ubRenderSlot];
+}
+
+/**
+ * @brief Publishes the completed render buffer as the latest frame.
+ *
+ * Double buffer mode swaps the active and reserve slots. Triple buffer mode exchanges the
+ * render slot with the shared slot; if the scan has not picked up the previously published
+ * frame, that frame is dropped and its slot is reused for rendering. Never blocks.
+ *
+ * With FBM_FORMAT_GRAY_8BPP the rows of the slot changed since its planes were last
+ * filled are split into its bit-planes here, in the caller's context, so the scan takes
+ * the planes ready to stream.
+ */
+void FBM_PublishBuffer(void)
+{
+    if (!bIsInitialised) {
+        COSLOG_INFO("FBM_PublishBuffer: Manager not initialized.\n");
+        return;
+    }
+
+    // If the scan has taken the previous frame, it only needs the rows of this one;
+    // otherwise the rows of every frame it has not seen are carried along.
+    if (__atomic_load_n(&ulLastScanSequence, __ATOMIC_ACQUIRE) == ulPublishSequence)
+    {
+        (void)memset(aulPendingScan, 0, sizeof(aulPendingScan));
+    }
+
+    for (uint8_t ubWord = 0; ubWord < FBM_DIRTY_WORDS; ubWord++)
+    {
+        uint32_t ulDirty = aulRenderDirty[ubRenderSlot][ubWord];
+
+        aulPendingScan[ubWord] |= ulDirty;
+        aulScanDirty[ubRenderSlot][ubWord] = aulPendingScan[ubWord];
+        for (uint8_t ubSlot = 0; ubSlot < ubNumSlots; ubSlot++)
+        {
+            if (ubSlot != ubRenderSlot)
+            {
+                aulStaleRows[ubSlot][ubWord] |= ulDirty;
+            }
+        }
+    }
+
+    ConvertRenderPlanes();
+
+    aulSlotSequence[ubRenderSlot] = ++ulPublishSequence;
+    ubLastPublishedSlot = ubRenderSlot;
+    bRenderInProgress = false;
+    sFrameStats.ulPublishedFrames++;
+
+    if (eBufferMode == FBM_MODE_TRIPLE_BUFFER)
+    {
+        uint32_t ulPrevious = __atomic_exchange_n(&ulSharedState,
+                                                  (uint32_t)ubRenderSlot | FBM_SHARED_FRESH_FLAG,
+                                                  __ATOMIC_ACQ_REL);
+        ubRenderSlot = (uint8_t)(ulPrevious & FBM_SHARED_SLOT_MASK);
+    }
+    else
+    {
+        uint8_t ubTemp = ubScanSlot;
+        ubScanSlot = ubRenderSlot;
+        ubRenderSlot = ubTemp;
+    }
+}
+
+/**
+ * @brief Acquires the latest complete frame for scanning.
+ *
+ * Called by the scan once per scan cycle. In triple buffer mode the scan only ever sees
+ * slots that were fully rendered and published. If no new frame was published since the
+ * last call, the current frame is kept and counted as duplicated; frames published but
+ * never acquired are counted as dropped. Never blocks.
+ *
+ * @param pbIsNewFrame  Optional, set to true if a frame not seen before is returned.
+ * @param ppulDirtyRows Optional, set to the bitmap (FBM_DIRTY_WORDS words) of rows that
+ *                      differ from the previously acquired frame, or NULL if no new frame.
+ * @return Pointer to the front buffer to scan, or NULL if not initialized. The rear buffer
+ *         of the same frame is available through FBM_GetActiveRearBuffer().
+ */
+uint8_t **FBM_AcquireScanBuffer(bool *pbIsNewFrame, const uint32_t **ppulDirtyRows)
+{
+    if (NULL != pbIsNewFrame)
+    {
+        *pbIsNewFrame = false;
+    }
+    if (NULL != ppulDirtyRows)
+    {
+        *ppulDirtyRows = NULL;
+    }
+
+    if (!bIsInitialised) {
+        return NULL;
+    }
+
+    if (eBufferMode == FBM_MODE_TRIPLE_BUFFER)
+    {
+        if (0U != (__atomic_load_n(&ulSharedState, __ATOMIC_ACQUIRE) & FBM_SHARED_FRESH_FLAG))
+        {
+            uint32_t ulPrevious = __atomic_exchange_n(&ulSharedState, (uint32_t)ubScanSlot,
+                                                      __ATOMIC_ACQ_REL);
+            ubScanSlot = (uint8_t)(ulPrevious & FBM_SHARED_SLOT_MASK);
+        }
+    }
+
+    uint32_t ulSequence = aulSlotSequence[ubScanSlot];
+    if (ulSequence != ulLastScanSequence)
+    {
+        if (0U != ulLastScanSequence)
+        {
+            sFrameStats.ulDroppedFrames += (ulSequence - ulLastScanSequence - 1U);
+        }
+        __atomic_store_n(&ulLastScanSequence, ulSequence, __ATOMIC_RELEASE);
+        sFrameStats.ulScannedFrames++;
+
+        if (NULL != pbIsNewFrame)
+        {
+            *pbIsNewFrame = true;
+        }
+        if (NULL != ppulDirtyRows)
+        {
+            *ppulDirtyRows = aulScanDirty[ubScanSlot];
+        }
+    }
+    else
+    {
+        sFrameStats.ulDuplicatedFrames++;
+    }
+
+    return aptubFrontSlots[ubScanSlot];
+}
+
+/**
+ * @brief Acquires the latest complete gray frame as bit-planes for the scan.
+ *
+ * Same hand-over as FBM_AcquireScanBuffer(); the planes travel with their slot and were
+ * filled when it was published, so nothing is converted here. Only the front face has
+ * planes.
+ *
+ * @param pbIsNewFrame  Set to true when the frame differs from the previous one; may be NULL.
+ * @param ppulDirtyRows Set to the bitmap of the rows of a new frame that differ from the
+ *                      previous one, or NULL if no new frame; may be NULL.
+ * @return Bit-plane frame, or NULL if not initialized or the format is not FBM_FORMAT_GRAY_8BPP.
+ */
+const sFBMBitPlaneFrame_t *FBM_AcquireScanBitPlanes(bool *pbIsNewFrame, const uint32_t **ppulDirtyRows)
+{
+    if (!bIsInitialised || (NULL == pusScanRowOrder))
+    {
+        if (NULL != pbIsNewFrame)
+        {
+            *pbIsNewFrame = false;
+        }
+        if (NULL != ppulDirtyRows)
+        {
+            *ppulDirtyRows = NULL;
+        }
+        return NULL;
+    }
+
+    (void)FBM_AcquireScanBuffer(pbIsNewFrame, ppulDirtyRows);
+    return &asSlotPlanes[ubScanSlot];
+}
+
+/**
+ * @brief Lays the bit-planes of every slot out in the order the LED driver streams rows.
+ *
+ * Row position k of every plane then holds source row pusRowOrder[k], so each scan
+ * address of a plane is one SPI payload (see LEDDriver_GetStreamRowOrder()); the order
+ * is copied and the planes carry it in pusRowOrder. The planes of every slot are
+ * converted again; call it with the scan stopped.
+ *
+ * @param pusRowOrder Row position -> source row, FBM_GetHeight() entries, each row once;
+ *                    NULL for source row order.
+ * @return 1 on success, 0 if the format is not FBM_FORMAT_GRAY_8BPP or the order is invalid.
+ */
+uint8_t FBM_SetScanRowOrder(const uint16_t *pusRowOrder)
+{
+    uint32_t aulSeen[FBM_DIRTY_WORDS] = {0};
+
+    if (!bIsInitialised || (NULL == pusScanRowOrder))
+    {
+        return 0;
+    }
+
+    for (uint16_t usPosition = 0; (NULL != pusRowOrder) && (usPosition < usFrameRows); usPosition++)
+    {
+        uint16_t usRow = pusRowOrder[usPosition];
+        if ((usRow >= usFrameRows) || (0U != (aulSeen[usRow >> 5] & (1UL << (usRow & 31U)))))
+        {
+            return 0;
+        }
+        aulSeen[usRow >> 5] |= (1UL << (usRow & 31U));
+    }
+
+    if (NULL != pusRowOrder)
+    {
+        (void)memcpy(pusScanRowOrder, pusRowOrder, (size_t)usFrameRows * sizeof(uint16_t));
+    }
+    for (uint8_t ubSlot = 0; ubSlot < ubNumSlots; ubSlot++)
+    {
+        asSlotPlanes[ubSlot].pusRowOrder = (NULL != pusRowOrder) ? pusScanRowOrder : NULL;
+        FBM_BitPlaneFromGray8(&asSlotPlanes[ubSlot], aptubFrontSlots[ubSlot]);
+        (void)memset(aulPlaneStale[ubSlot], 0, sizeof(aulPlaneStale[ubSlot]));
+    }
+    return 1;
+}
+
+/**
+ * @brief Gets the frame hand-over statistics.
+ *
+ * @param psStats Pointer to store the published, scanned, dropped and duplicated counts.
+ */
+void FBM_GetFrameStatistics(sFBMFrameStats_t *psStats)
+{
+    if (NULL != psStats)
+    {
+        *psStats = sFrameStats;
+    }
+}
+
+/**
+ * @brief Frees the memory allocated for a 2D buffer.
+ *
+ * The row pointer table and the pixel data share one allocation (see AllocateBuffer()),
+ * so a single free releases the whole frame.
+ *
+ * @param ptubBuffer Pointer to the 2D buffer structure to free.
+ * @param usHeight The height of the buffer (number of rows). Kept for API compatibility.
+ */
+void FBM_FreeBuffer(uint8_t **ptubBuffer, uint8_t ubHeight)
+{
+    (void)ubHeight;
+
+    if (NULL != ptubBuffer)
+    {
+        sFBMFrame_t *psFrame = FindFrame(ptubBuffer);
+        if (NULL != psFrame)
+        {
+            (void)memset(psFrame, 0, sizeof(sFBMFrame_t));
+        }
+        MM_Free(ptubBuffer);
+
+        // **The calling code must now set its own pointer to NULL.**
+    }
+}
+
+
+/**
+ * @brief Clears a 2D buffer by setting all its data bytes to zero.
+ *
+ * Frames allocated by FBM are cleared with a single memset over the contiguous block.
+ *
+ * @param ptubBuffer Pointer to the 2D buffer structure to clear.
+ * @param usHeight The height of the buffer.
+ * @param usWidth The width of the buffer in columns.
+ */
+void FBM_ClearBuffer(uint8_t **ptubBuffer, uint8_t ubHeight, uint16_t usWidth)
+{
+    if (NULL != ptubBuffer)
+    {
+        sFBMFrame_t *psFrame = FindFrame(ptubBuffer);
+        if (NULL != psFrame)
+        {
+            (void)memset(psFrame->pubData, 0, psFrame->ulSizeBytes);
+            FBM_MarkRowsDirty(ptubBuffer, 0, psFrame->usHeight - 1U);
+            return;
+        }
+
+        uint16_t usBytesPerRow = (usWidth + 7U) / 8U;
+        for (uint8_t ubRow = 0; ubRow < ubHeight; ubRow++)
+        {
+            if (NULL != ptubBuffer[ubRow])
+            {
+                (void)memset(ptubBuffer[ubRow], 0, usBytesPerRow);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Gets the descriptor (data block, stride, size and format) of a frame buffer.
+ *
+ * @param ptubBuffer Row view of a buffer returned by one of the FBM_Get*Buffer() functions.
+ * @return Pointer to the frame descriptor, or NULL if the buffer is not managed by FBM.
+ */
+const sFBMFrame_t *FBM_GetFrame(uint8_t **ptubBuffer)
+{
+    return FindFrame(ptubBuffer);
+}
+
+/**
+ * @brief Copies a whole frame into another frame of the same geometry.
+ *
+ * @param ptubDestination Frame to copy into.
+ * @param ptubSource      Frame to copy from.
+ * @return 1 on success, 0 if a frame is unknown or the geometries differ.
+ */
+uint8_t FBM_CopyBuffer(uint8_t **ptubDestination, uint8_t **ptubSource)
+{
+    sFBMFrame_t *psDestination = FindFrame(ptubDestination);
+    sFBMFrame_t *psSource = FindFrame(ptubSource);
+
+    if ((NULL == psDestination) || (NULL == psSource) ||
+        (psDestination->ulSizeBytes != psSource->ulSizeBytes))
+    {
+        return 0;
+    }
+
+    (void)memcpy(psDestination->pubData, psSource->pubData, psSource->ulSizeBytes);
+    FBM_MarkRowsDirty(ptubDestination, 0, psDestination->usHeight - 1U);
+    return 1;
+}
+
+/**
+ * @brief Compares the content of two frames of the same geometry.
+ *
+ * @param ptubFirst  First frame.
+ * @param ptubSecond Second frame.
+ * @return 1 if both frames hold identical pixels, 0 otherwise (or if a frame is unknown).
+ */
+uint8_t FBM_CompareBuffer(uint8_t **ptubFirst, uint8_t **ptubSecond)
+{
+    sFBMFrame_t *psFirst = FindFrame(ptubFirst);
+    sFBMFrame_t *psSecond = FindFrame(ptubSecond);
+
+    if ((NULL == psFirst) || (NULL == psSecond) ||
+        (psFirst->ulSizeBytes != psSecond->ulSizeBytes))
+    {
+        return 0;
+    }
+
+    return (0 == memcmp(psFirst->pubData, psSecond->pubData, psFirst->ulSizeBytes)) ? 1 : 0;
+}
+
+/**
+ * @brief Gets the pixel format of the frame buffers.
+ * @return Pixel format selected at FBM_Init().
+ */
+eFBMPixelFormat_t FBM_GetPixelFormat(void)
+{
+    return ePixelFormat;
+}
+
+/**
+ * @brief Gets the number of bits used by one pixel of a format.
+ *
+ * @param eFormat Pixel format.
+ * @return Bits per pixel, or 0 for an unknown format.
+ */
+uint8_t FBM_GetBitsPerPixel(eFBMPixelFormat_t eFormat)
+{
+    return (eFormat < FBM_FORMAT_COUNT) ? aubBitsPerPixel[eFormat] : 0U;
+}
+
+/**
+ * @brief Computes the number of bytes of one row of a given format and width.
+ *
+ * @param eFormat Pixel format.
+ * @param usWidth Width in pixels.
+ * @return Bytes per row, rounded up to a whole byte, or 0 for an unknown format.
+ */
+uint16_t FBM_ComputeStride(eFBMPixelFormat_t eFormat, uint16_t usWidth)
+{
+    return (uint16_t)(((uint32_t)usWidth * FBM_GetBitsPerPixel(eFormat) + 7U) / 8U);
+}
+
+/**
+ * @brief Gets the number of bytes per row of the frame buffers.
+ * @return Stride in bytes, or 0 if not initialized.
+ */
+uint16_t FBM_GetStride(void)
+{
+    return bIsInitialised ? usFrameStride : 0U;
+}
+
+/**
+ * @brief Gets the width of the frame buffers (all panels).
+ * @return Width in pixels, or 0 if not initialized.
+ */
+uint16_t FBM_GetWidth(void)
+{
+    return bIsInitialised ? usFrameWidth : 0U;
+}
+
+/**
+ * @brief Gets the height of the frame buffers.
+ * @return Height in rows, or 0 if not initialized.
+ */
+uint16_t FBM_GetHeight(void)
+{
+    return bIsInitialised ? usFrameRows : 0U;
+}
+
+/**
+ * @brief Marks a range of rows of a frame as changed.
+ *
+ * Must be called by every writer of a render buffer (FBM write APIs do it themselves) so
+ * that only changed rows are synchronised between slots and re-packed by the LED driver.
+ *
+ * @param ptubBuffer Frame (front or rear) that was written.
+ * @param usFirstRow First changed row.
+ * @param usLastRow  Last changed row (inclusive), clipped to the frame height.
+ */
+void FBM_MarkRowsDirty(uint8_t **ptubBuffer, uint16_t usFirstRow, uint16_t usLastRow)
+{
+    int8_t bySlot = FindSlot(ptubBuffer);
+
+    if ((bySlot < 0) || (usFirstRow > usLastRow) || (usFirstRow >= usFrameRows))
+    {
+        return;
+    }
+
+    if (usLastRow >= usFrameRows)
+    {
+        usLastRow = usFrameRows - 1U;
+    }
+
+    for (uint16_t usRow = usFirstRow; usRow <= usLastRow; usRow++)
+    {
+        aulRenderDirty[bySlot][usRow >> 5] |= (1UL << (usRow & 31U));
+    }
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Allocates one frame as a single block and registers its descriptor.
+ *
+ * Block layout: [row pointer table][padding][header][pixel data]. The pixel data starts on an
+ * FBM_BUFFER_ALIGNMENT boundary and its size is rounded up to a whole number of cache
+ * lines. Each row pointer points into the pixel data, so legacy uint8_t ** callers keep
+ * working while the frame can be cleared, copied or DMA'd as one block.
+ *
+ * @param usHeight The height of the buffer (number of rows).
+ * @param usWidth The width of the buffer in columns (used to calculate bytes per row).
+ * @param eFormat Pixel format of the buffer.
+ * @return A pointer to the newly allocated 2D buffer (uint8_t **), or NULL on failure.
+ */
+static uint8_t **AllocateBuffer(uint16_t usHeight, uint16_t usWidth, eFBMPixelFormat_t eFormat)
+{
+    sFBMFrame_t *psFrame = NULL;
+
+    for (uint8_t ubSlot = 0; ubSlot < FBM_MAX_FRAMES; ubSlot++)
+    {
+        if (NULL == sFrames[ubSlot].pptubRows)
+        {
+            psFrame = &sFrames[ubSlot];
+            break;
+        }
+    }
+
+    if (NULL == psFrame)
+    {
+        COSLOG_ERROR("FBM: No free frame descriptor.\n");
+        return NULL;
+    }
+
+    uint16_t usStride = FBM_ComputeStride(eFormat, usWidth);
+    uint32_t ulSizeBytes = (uint32_t)usStride * usHeight;
+    size_t stRowTableBytes;
+    size_t stBlockBytes = ComputeBlockBytes(usHeight, usStride, &stRowTableBytes);
+    size_t stDataBytes = stBlockBytes - stRowTableBytes;
+
+    // Block start is aligned by the memory manager, so the data after the padded row table is too
+    uint8_t *pubBlock = (uint8_t *)MM_AllocAligned(MM_PURPOSE_RENDER_TARGET, (uint32_t)stBlockBytes,
+                                                   FBM_BUFFER_ALIGNMENT);
+    if (NULL == pubBlock)
+    {
+        COSLOG_ERROR("FBM: Out of render target memory.\n");
+        return NULL;
+    }
+
+    uintptr_t ulDataAddress = (uintptr_t)pubBlock + stRowTableBytes;
+
+    psFrame->pptubRows   = (uint8_t **)pubBlock;
+    psFrame->pubData     = (uint8_t *)ulDataAddress;
+    psFrame->ulSizeBytes = ulSizeBytes;
+    psFrame->usStride    = usStride;
+    psFrame->usWidth     = usWidth;
+    psFrame->usHeight    = usHeight;
+    psFrame->eFormat     = eFormat;
+    psFrame->usHeaderBytes = usFrameHeaderBytes;
+
+    (void)memset(psFrame->pubData - usFrameHeaderBytes, 0, stDataBytes + usFrameHeaderBytes);
+    for (uint16_t usRow = 0; usRow < usHeight; usRow++)
+    {
+        psFrame->pptubRows[usRow] = psFrame->pubData + ((uint32_t)usRow * usStride);
+    }
+
+    return psFrame->pptubRows;
+}
+
+/**
+ * @brief Computes the size of the block of one frame, see AllocateBuffer().
+ *
+ * @param usHeight         Rows of the frame.
+ * @param usStride         Bytes per row.
+ * @param pstRowTableBytes Returns the bytes in front of the pixel data (row table, padding, header).
+ * @return Block size in bytes.
+ */
+static size_t ComputeBlockBytes(uint16_t usHeight, uint16_t usStride, size_t *pstRowTableBytes)
+{
+    size_t stDataBytes = (((size_t)usStride * usHeight) + FBM_BUFFER_ALIGNMENT - 1U) &
+                         ~((size_t)FBM_BUFFER_ALIGNMENT - 1U);
+
+    *pstRowTableBytes = ((size_t)usHeight * sizeof(uint8_t *) + usFrameHeaderBytes + FBM_BUFFER_ALIGNMENT - 1U) &
+                        ~((size_t)FBM_BUFFER_ALIGNMENT - 1U);
+    return *pstRowTableBytes + stDataBytes;
+}
+
+/**
+ * @brief Looks up the descriptor of a frame from its row view.
+ *
+ * @param ptubBuffer Row view of the frame.
+ * @return Pointer to the descriptor, or NULL if the buffer was not allocated by FBM.
+ */
+static sFBMFrame_t *FindFrame(uint8_t **ptubBuffer)
+{
+    if (NULL == ptubBuffer)
+    {
+        return NULL;
+    }
+
+    for (uint8_t ubSlot = 0; ubSlot < FBM_MAX_FRAMES; ubSlot++)
+    {
+        if (sFrames[ubSlot].pptubRows == ptubBuffer)
+        {
+            return &sFrames[ubSlot];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Frees every allocated slot of both faces and their bit-planes.
+ */
+static void ReleaseAllSlots(void)
+{
+    for (uint8_t ubSlot = 0; ubSlot < FBM_MAX_SLOTS; ubSlot++)
+    {
+        FBM_FreeBuffer(aptubFrontSlots[ubSlot], 0);
+        FBM_FreeBuffer(aptubRearSlots[ubSlot], 0);
+        aptubFrontSlots[ubSlot] = NULL;
+        aptubRearSlots[ubSlot] = NULL;
+        FBM_BitPlaneFree(&asSlotPlanes[ubSlot]);
+    }
+    if (NULL != pusScanRowOrder)
+    {
+        MM_Free(pusScanRowOrder);
+        pusScanRowOrder = NULL;
+    }
+    isDoubleSidedDisplay = 0;
+    ubNumSlots = 0;
+}
+
+/**
+ * @brief Brings the render slot up to date with the last published frame.
+ *
+ * The last published slot is either waiting for the scan or being scanned; both only read
+ * it, so it can safely be used as the copy source.
+ */
+static void SyncRenderSlot(void)
+{
+    (void)memset(aulRenderDirty[ubRenderSlot], 0, sizeof(aulRenderDirty[ubRenderSlot]));
+
+    if ((0U == ulPublishSequence) || (ubLastPublishedSlot == ubRenderSlot))
+    {
+        return;
+    }
+
+    CopyRows(aptubFrontSlots[ubRenderSlot], aptubFrontSlots[ubLastPublishedSlot], aulStaleRows[ubRenderSlot]);
+    if (isDoubleSidedDisplay)
+    {
+        CopyRows(aptubRearSlots[ubRenderSlot], aptubRearSlots[ubLastPublishedSlot], aulStaleRows[ubRenderSlot]);
+    }
+    // The copied rows are not in the slot's planes yet
+    for (uint8_t ubWord = 0; ubWord < FBM_DIRTY_WORDS; ubWord++)
+    {
+        aulPlaneStale[ubRenderSlot][ubWord] |= aulStaleRows[ubRenderSlot][ubWord];
+    }
+    (void)memset(aulStaleRows[ubRenderSlot], 0, sizeof(aulStaleRows[ubRenderSlot]));
+}
+
+/**
+ * @brief Splits the rows of the render slot not yet in its bit-planes (gray frames only).
+ *
+ * Those are the rows copied in by SyncRenderSlot() and the rows rendered since.
+ */
+static void ConvertRenderPlanes(void)
+{
+    if (NULL == pusScanRowOrder)
+    {
+        return;
+    }
+
+    for (uint8_t ubWord = 0; ubWord < FBM_DIRTY_WORDS; ubWord++)
+    {
+        aulPlaneStale[ubRenderSlot][ubWord] |= aulRenderDirty[ubRenderSlot][ubWord];
+    }
+    FBM_BitPlaneFromGray8Rows(&asSlotPlanes[ubRenderSlot], aptubFrontSlots[ubRenderSlot], aulPlaneStale[ubRenderSlot]);
+    (void)memset(aulPlaneStale[ubRenderSlot], 0, sizeof(aulPlaneStale[ubRenderSlot]));
+}
+
+/**
+ * @brief Gets the slot index a frame (front or rear) belongs to.
+ *
+ * @param ptubBuffer Row view of the frame.
+ * @return Slot index, or -1 if the buffer is not a slot of this manager.
+ */
+static int8_t FindSlot(uint8_t **ptubBuffer)
+{
+    if (NULL == ptubBuffer)
+    {
+        return -1;
+    }
+
+    for (uint8_t ubSlot = 0; ubSlot < ubNumSlots; ubSlot++)
+    {
+        if ((aptubFrontSlots[ubSlot] == ptubBuffer) || (aptubRearSlots[ubSlot] == ptubBuffer))
+        {
+            return (int8_t)ubSlot;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Copies the rows flagged in a dirty-row bitmap from one frame to another.
+ *
+ * @param ptubDestination Frame to copy into.
+ * @param ptubSource      Frame to copy from, same geometry.
+ * @param pulRows         Bitmap of rows to copy.
+ */
+static void CopyRows(uint8_t **ptubDestination, uint8_t **ptubSource, const uint32_t *pulRows)
+{
+    const sFBMFrame_t *psFrame = FindFrame(ptubSource);
+
+    if ((NULL == psFrame) || (NULL == ptubDestination))
+    {
+        return;
+    }
+
+    for (uint8_t ubWord = 0; ubWord < FBM_DIRTY_WORDS; ubWord++)
+    {
+        uint32_t ulBits = pulRows[ubWord];
+        while (0U != ulBits)
+        {
+            uint16_t usRow = (uint16_t)((ubWord << 5) + (uint16_t)__builtin_ctz(ulBits));
+            ulBits &= (ulBits - 1U);
+            if (usRow < psFrame->usHeight)
+            {
+                (void)memcpy(ptubDestination[usRow], ptubSource[usRow], psFrame->usStride);
+            }
+        }
+    }
+}
@@ -1,49 +1,167 @@
-/**
- * @file FrameBufferManager.h
- * @brief Public interface for the Frame Buffer Manager module.
- *
- * This header defines the functions used to initialize, manage, and access
- * the double-buffered display memory, ensuring atomic updates for flicker-free
- * rendering on the LED matrix.
- *
- * (C) Copyright Centum T&S Group 2025. All rights reserved.
- * This computer program may not be used, copied, distributed, translated,
- * transmitted or assigned without the prior written authorization of
- * Centum T&S Group.
- */
-
-
-#ifndef MIDDLEWARE_FRAMEBUFFERMANAGER_FRAMEBUFFERMANAGER_H_
-#define MIDDLEWARE_FRAMEBUFFERMANAGER_FRAMEBUFFERMANAGER_H_
-
-//------------------------------------ [ INCLUDE FILES ] ----------------------------//
-//
-#include <stdint.h>
-#include <string.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <stdbool.h>
-
-//-------------------------------------[ PROTOTYPES ] -------------------------------//
-//
-
-
-uint8_t FBM_Init(uint16_t usDisplayRows, uint16_t usDisplayColumns, uint8_t  ubDoubleSidedDisplay, uint8_t  ubLedType, uint8_t ubNumPanels);
-
-void FBM_DeinitializeSystem(uint16_t usDisplayRows);
-
-uint8_t **FBM_GetActiveFrontBuffer(void);
-
-uint8_t **FBM_GetReserveFrontBuffer(void);
-
-uint8_t **FBM_GetActiveRearBuffer(void);
-
-uint8_t **FBM_GetReserveRearBuffer(void);
-
-void FBM_SwapBuffers(void);
-
-void FBM_FreeBuffer(uint8_t **ptubBuffer, uint8_t usHeight);
-
-void FBM_ClearBuffer(uint8_t **ptubBuffer, uint8_t usHeight, uint16_t usWidth);
-
-#endif /* MIDDLEWARE_FRAMEBUFFERMANAGER_FRAMEBUFFERMANAGER_H_ */
+/**
+ * @file FrameBufferManager.h
+ * @brief Public interface for the Frame Buffer Manager module.
+ *
+ * This header defines the functions used to initialize, manage, and access
+ * the double- or triple-buffered display memory, ensuring atomic updates for flicker-free
+ * rendering on the LED matrix.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+
+#ifndef MIDDLEWARE_FRAMEBUFFERMANAGER_FRAMEBUFFERMANAGER_H_
+#define MIDDLEWARE_FRAMEBUFFERMANAGER_FRAMEBUFFERMANAGER_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "Middleware/FrameBufferManager/FBMBitPlane.h"
+#include "HAL/MemoryManager/MemoryManager.h"
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+// Alignment of every frame data block. Matches the Cortex-M7 D-cache line so a frame can be
+// cleaned/invalidated or handed to eDMA without touching neighbouring data.
+#define FBM_BUFFER_ALIGNMENT    32U
+
+// Maximum number of buffers per display face (triple buffering)
+#define FBM_MAX_SLOTS           3U
+
+// Maximum number of frames managed at once (front/rear x slots)
+#define FBM_MAX_FRAMES          (2U * FBM_MAX_SLOTS)
+
+// Blocks FBM_Init() allocates at most: every frame, the scan row order and the bit-planes
+// of every slot
+#define FBM_MAX_PLAN_ENTRIES    (FBM_MAX_FRAMES + 1U + FBM_MAX_SLOTS)
+
+// Maximum number of rows per frame and size of a dirty-row bitmap.
+// Row r is dirty when bit (r & 31) of word (r >> 5) is set.
+#define FBM_MAX_ROWS            256U
+#define FBM_DIRTY_WORDS         (FBM_MAX_ROWS / 32U)
+
+// Largest header that can be reserved in front of the pixel data of a frame
+#define FBM_MAX_HEADER_BYTES    64U
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef enum {
+    FBM_MODE_DOUBLE_BUFFER = 0,     // Active/Reserve pair, swapped on publish
+    FBM_MODE_TRIPLE_BUFFER,         // Render/Ready/Scan slots, latest complete frame wins
+} eFBMBufferMode_t;
+
+typedef enum {
+    FBM_FORMAT_MONO_1BPP = 0,       // 1 bit per pixel, MSB first
+    FBM_FORMAT_GRAY_4BPP,           // 4 bit gray, two pixels per byte, high nibble first
+    FBM_FORMAT_GRAY_8BPP,           // 8 bit gray, one byte per pixel
+    FBM_FORMAT_RGB565,              // 16 bit colour, little endian R5G6B5
+    FBM_FORMAT_RGB888,              // 24 bit colour, bytes R, G, B
+    FBM_FORMAT_COUNT
+} eFBMPixelFormat_t;
+
+/**
+ * @brief Descriptor of one frame buffer.
+ *
+ * The pixels live in a single contiguous, FBM_BUFFER_ALIGNMENT aligned block (pubData).
+ * pptubRows is the legacy row view used by the uint8_t ** API: pptubRows[y] points to
+ * pubData + (y * usStride). The usHeaderBytes in front of pubData belong to the frame too,
+ * for a renderer that keeps a header with its pixels (see FBM_SetFrameHeader()).
+ */
+typedef struct {
+    uint8_t          *pubData;      // Start of the contiguous pixel block
+    uint8_t         **pptubRows;    // Row pointers into pubData
+    uint32_t          ulSizeBytes;  // usStride * usHeight
+    uint16_t          usStride;     // Bytes per row
+    uint16_t          usWidth;      // Width in pixels
+    uint16_t          usHeight;     // Height in rows
+    eFBMPixelFormat_t eFormat;      // Pixel format of pubData
+    uint16_t          usHeaderBytes;// Bytes reserved right in front of pubData
+} sFBMFrame_t;
+
+/**
+ * @brief Frame hand-over statistics between renderer and scan.
+ */
+typedef struct {
+    uint32_t ulPublishedFrames;     // Frames published by the renderer
+    uint32_t ulScannedFrames;       // Distinct frames acquired by the scan
+    uint32_t ulDroppedFrames;       // Published frames replaced before the scan saw them
+    uint32_t ulDuplicatedFrames;    // Scan cycles that reused the previous frame
+} sFBMFrameStats_t;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t FBM_SetBufferMode(eFBMBufferMode_t eMode);
+
+uint8_t FBM_SetPixelFormat(eFBMPixelFormat_t eFormat);
+
+uint8_t FBM_SetFrameHeader(uint16_t usBytes);
+
+uint8_t FBM_SetGrayPlanes(uint8_t ubPlanes);
+
+
+
+uint8_t FBM_Init(uint16_t usDisplayRows, uint16_t usDisplayColumns, uint8_t  ubDoubleSidedDisplay, uint8_t  ubLedType, uint8_t ubNumPanels);
+
+uint32_t FBM_ComputeFootprint(uint16_t usDisplayRows, uint16_t usDisplayColumns, uint8_t ubDoubleSidedDisplay,
+                              uint8_t ubLedType, uint8_t ubNumPanels);
+
+uint8_t FBM_GetAllocationPlan(uint16_t usDisplayRows, uint16_t usDisplayColumns, uint8_t ubDoubleSidedDisplay,
+                              eFBMPixelFormat_t eFormat, uint8_t ubNumPanels, uint8_t ubPlanes,
+                              sMMPlanEntry_t *psEntries);
+
+void FBM_DeinitializeSystem(uint16_t usDisplayRows);
+
+uint8_t **FBM_GetActiveFrontBuffer(void);
+
+uint8_t **FBM_GetReserveFrontBuffer(void);
+
+uint8_t **FBM_GetActiveRearBuffer(void);
+
+uint8_t **FBM_GetReserveRearBuffer(void);
+
+void FBM_SwapBuffers(void);
+
+uint8_t **FBM_AcquireRenderBuffer(void);
+
+void FBM_PublishBuffer(void);
+
+uint8_t **FBM_AcquireScanBuffer(bool *pbIsNewFrame, const uint32_t **ppulDirtyRows);
+
+const sFBMBitPlaneFrame_t *FBM_AcquireScanBitPlanes(bool *pbIsNewFrame, const uint32_t **ppulDirtyRows);
+
+uint8_t FBM_SetScanRowOrder(const uint16_t *pusRowOrder);
+
+void FBM_GetFrameStatistics(sFBMFrameStats_t *psStats);
+
+void FBM_FreeBuffer(uint8_t **ptubBuffer, uint8_t usHeight);
+
+void FBM_ClearBuffer(uint8_t **ptubBuffer, uint8_t usHeight, uint16_t usWidth);
+
+const sFBMFrame_t *FBM_GetFrame(uint8_t **ptubBuffer);
+
+uint8_t FBM_CopyBuffer(uint8_t **ptubDestination, uint8_t **ptubSource);
+
+uint8_t FBM_CompareBuffer(uint8_t **ptubFirst, uint8_t **ptubSecond);
+
+eFBMPixelFormat_t FBM_GetPixelFormat(void);
+
+uint8_t FBM_GetBitsPerPixel(eFBMPixelFormat_t eFormat);
+
+uint16_t FBM_ComputeStride(eFBMPixelFormat_t eFormat, uint16_t usWidth);
+
+uint16_t FBM_GetStride(void);
+
+uint16_t FBM_GetWidth(void);
+
+uint16_t FBM_GetHeight(void);
+
+void FBM_MarkRowsDirty(uint8_t **ptubBuffer, uint16_t usFirstRow, uint16_t usLastRow);
+
+#endif /* MIDDLEWARE_FRAMEBUFFERMANAGER_FRAMEBUFFERMANAGER_H_ */
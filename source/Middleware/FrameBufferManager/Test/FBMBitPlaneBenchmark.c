@@ -0,0 +1,168 @@
+/**
+ * @file FBMBitPlaneBenchmark.c
+ * @brief Benchmark of the packed 8bpp gray to bit-plane conversion (FBMBitPlane).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "Middleware/FrameBufferManager/Test/FBMBitPlaneBenchmark.h"
+#include "Middleware/FrameBufferManager/FBMBitPlane.h"
+#include <stddef.h>
+#include <string.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define BENCH_MAX_WIDTH         512U
+#define BENCH_MAX_HEIGHT        64U
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef struct {
+    uint16_t usWidth;
+    uint16_t usHeight;
+    uint8_t  ubPlanes;
+    uint8_t  ubRowOrder;
+} sBenchCase_t;
+
+//-------------------------------------[ STATIC VARIABLE ] --------------------------//
+//
+// 64-column panels: 2 panels of 16 rows at 1 and 4 planes, 8 panels of 32 rows at 8 planes,
+// a width that is not a multiple of eight, and a row order with row groups interleaved
+static const sBenchCase_t asCases[FBM_BITPLANE_BENCH_CASES] = {
+    { 128U, 16U, 1U, 0U },
+    { 128U, 16U, 4U, 0U },
+    { 128U, 16U, 8U, 0U },
+    { 512U, 32U, 8U, 0U },
+    { 100U, 16U, 6U, 0U },
+    { 256U, 64U, 4U, 1U },
+};
+
+static uint8_t aubGray[BENCH_MAX_HEIGHT][BENCH_MAX_WIDTH];
+static uint8_t *aptubGrayRows[BENCH_MAX_HEIGHT];
+static uint16_t ausRowOrder[BENCH_MAX_HEIGHT];
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static void FillGray(uint16_t usWidth, uint16_t usHeight, uint32_t ulSeed);
+static void FillRowOrder(uint16_t usHeight);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Runs every case through both conversion paths.
+ *
+ * The bit-plane frames come from the memory manager, so MM_Init() must have run.
+ *
+ * @param pfnClock  Free-running clock; NULL to check the conversion without timing.
+ * @param psResults Returns FBM_BITPLANE_BENCH_CASES results.
+ * @return Number of cases that could not be allocated or whose planes differ (0 - all correct).
+ */
+uint8_t FBMBitPlaneBenchmark_Run(pfnFBMBitPlaneBenchClock_t pfnClock, sFBMBitPlaneBenchResult_t *psResults)
+{
+    uint8_t ubFailures = 0;
+
+    for (uint8_t ubCase = 0; ubCase < FBM_BITPLANE_BENCH_CASES; ubCase++)
+    {
+        const sBenchCase_t *psCase = &asCases[ubCase];
+        sFBMBitPlaneBenchResult_t *psResult = &psResults[ubCase];
+        sFBMBitPlaneFrame_t sWord;
+        sFBMBitPlaneFrame_t sScalar;
+        const uint16_t *pusRowOrder = NULL;
+
+        memset(psResult, 0, sizeof(*psResult));
+        psResult->usWidth = psCase->usWidth;
+        psResult->usHeight = psCase->usHeight;
+        psResult->ubPlanes = psCase->ubPlanes;
+        psResult->ubRowOrder = psCase->ubRowOrder;
+
+        if (psCase->ubRowOrder != 0U)
+        {
+            FillRowOrder(psCase->usHeight);
+            pusRowOrder = ausRowOrder;
+        }
+        FillGray(psCase->usWidth, psCase->usHeight, 0x1234U + ubCase);
+
+        if (FBM_BitPlaneInit(&sWord, psCase->usWidth, psCase->usHeight, psCase->ubPlanes, pusRowOrder) == 0U)
+        {
+            ubFailures++;
+            continue;
+        }
+        if (FBM_BitPlaneInit(&sScalar, psCase->usWidth, psCase->usHeight, psCase->ubPlanes, pusRowOrder) == 0U)
+        {
+            FBM_BitPlaneFree(&sWord);
+            ubFailures++;
+            continue;
+        }
+        psResult->ubAllocated = 1U;
+
+        // The word path writes every byte: start it from garbage, not from a cleared frame
+        memset(sWord.pubData, 0xA5, (size_t)sWord.ulPlaneBytes * sWord.ubPlanes);
+        FBM_BitPlaneFromGray8(&sWord, aptubGrayRows);
+        FBM_BitPlaneFromGray8Scalar(&sScalar, aptubGrayRows);
+        psResult->ubCorrect = (memcmp(sWord.pubData, sScalar.pubData,
+                                      (size_t)sWord.ulPlaneBytes * sWord.ubPlanes) == 0) ? 1U : 0U;
+        ubFailures += (psResult->ubCorrect == 0U) ? 1U : 0U;
+
+        if (pfnClock != NULL)
+        {
+            uint32_t ulStart = pfnClock();
+            for (uint32_t ulIteration = 0; ulIteration < FBM_BITPLANE_BENCH_ITERATIONS; ulIteration++)
+            {
+                FBM_BitPlaneFromGray8(&sWord, aptubGrayRows);
+            }
+            psResult->ulTicksWord = (pfnClock() - ulStart) / FBM_BITPLANE_BENCH_ITERATIONS;
+
+            ulStart = pfnClock();
+            for (uint32_t ulIteration = 0; ulIteration < FBM_BITPLANE_BENCH_ITERATIONS; ulIteration++)
+            {
+                FBM_BitPlaneFromGray8Scalar(&sScalar, aptubGrayRows);
+            }
+            psResult->ulTicksScalar = (pfnClock() - ulStart) / FBM_BITPLANE_BENCH_ITERATIONS;
+        }
+
+        FBM_BitPlaneFree(&sScalar);
+        FBM_BitPlaneFree(&sWord);
+    }
+    return ubFailures;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Fills the gray frame with pseudo-random levels (LCG) and sets its row pointers.
+ */
+static void FillGray(uint16_t usWidth, uint16_t usHeight, uint32_t ulSeed)
+{
+    uint32_t ulState = ulSeed;
+
+    for (uint16_t usRow = 0; usRow < usHeight; usRow++)
+    {
+        aptubGrayRows[usRow] = aubGray[usRow];
+        for (uint16_t usX = 0; usX < usWidth; usX++)
+        {
+            ulState = (ulState * 1664525UL) + 1013904223UL;
+            aubGray[usRow][usX] = (uint8_t)(ulState >> 24);
+        }
+    }
+}
+
+/**
+ * @brief Row order of a 1/16 scan with four row groups: position k holds row
+ *        (k % 4) * 16 + k / 4.
+ */
+static void FillRowOrder(uint16_t usHeight)
+{
+    uint16_t usGroups = 4U;
+    uint16_t usAddresses = (uint16_t)(usHeight / usGroups);
+
+    for (uint16_t usPosition = 0; usPosition < usHeight; usPosition++)
+    {
+        ausRowOrder[usPosition] = (uint16_t)(((usPosition % usGroups) * usAddresses) + (usPosition / usGroups));
+    }
+}
@@ -0,0 +1,53 @@
+/**
+ * @file FBMBitPlaneBenchmark.h
+ * @brief Benchmark of the packed 8bpp gray to bit-plane conversion (FBMBitPlane).
+ *
+ * Converts a pseudo-random gray frame with the word-parallel FBM_BitPlaneFromGray8() and
+ * the scalar FBM_BitPlaneFromGray8Scalar() for a few geometries and plane counts, checks
+ * both give the same planes and gives the time of each. The clock is passed in, so it
+ * runs on the host or on the target (DWT cycle counter).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef MIDDLEWARE_FRAMEBUFFERMANAGER_TEST_FBMBITPLANEBENCHMARK_H_
+#define MIDDLEWARE_FRAMEBUFFERMANAGER_TEST_FBMBITPLANEBENCHMARK_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define FBM_BITPLANE_BENCH_ITERATIONS   32U     // Conversions timed per path and case
+#define FBM_BITPLANE_BENCH_CASES        6U      // Geometries * plane counts
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief Free-running clock of the platform (cycles, ns, ...).
+ */
+typedef uint32_t (*pfnFBMBitPlaneBenchClock_t)(void);
+
+/**
+ * @brief Result of one case.
+ */
+typedef struct {
+    uint16_t usWidth;
+    uint16_t usHeight;
+    uint8_t  ubPlanes;
+    uint8_t  ubRowOrder;            // 1 - planes stored in a non-identity row order
+    uint8_t  ubAllocated;           // Both bit-plane frames could be allocated
+    uint8_t  ubCorrect;             // Word-parallel planes match the scalar ones
+    uint32_t ulTicksWord;           // Mean clock ticks of one FBM_BitPlaneFromGray8()
+    uint32_t ulTicksScalar;         // Mean clock ticks of one FBM_BitPlaneFromGray8Scalar()
+} sFBMBitPlaneBenchResult_t;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t FBMBitPlaneBenchmark_Run(pfnFBMBitPlaneBenchClock_t pfnClock, sFBMBitPlaneBenchResult_t *psResults);
+
+#endif /* MIDDLEWARE_FRAMEBUFFERMANAGER_TEST_FBMBITPLANEBENCHMARK_H_ */
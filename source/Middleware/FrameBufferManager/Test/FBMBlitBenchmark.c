@@ -0,0 +1,337 @@
+/**
+ * @file FBMBlitBenchmark.c
+ * @brief Benchmark of the word-wide 1bpp bit-blit operations (FBMBlit).
+ *
+ * The destination is eight 32x32 panels' worth of pixels, 256x32; the source is 200x24,
+ * so its rows are not a whole number of words. Both hold a pseudo-random picture that is
+ * restored before every check. The reference reads and writes one pixel at a time and
+ * clips every pixel against both surfaces.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "Middleware/FrameBufferManager/Test/FBMBlitBenchmark.h"
+#include "Middleware/FrameBufferManager/FBMBlit.h"
+#include <stddef.h>
+#include <string.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define BENCH_DEST_WIDTH        256U
+#define BENCH_DEST_HEIGHT       32U
+#define BENCH_DEST_STRIDE       (BENCH_DEST_WIDTH / 8U)
+#define BENCH_SOURCE_WIDTH      200U
+#define BENCH_SOURCE_HEIGHT     24U
+#define BENCH_SOURCE_STRIDE     (BENCH_SOURCE_WIDTH / 8U)
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief Rectangle of a case: destination, source (blits) and shift (scroll).
+ */
+typedef struct {
+    int16_t  sDestX;
+    int16_t  sDestY;
+    int16_t  sSourceX;
+    int16_t  sSourceY;
+    uint16_t usWidth;
+    uint16_t usHeight;
+    int16_t  sShiftX;
+    int16_t  sShiftY;
+} sBenchRect_t;
+
+//-------------------------------------[ STATIC VARIABLE ] --------------------------//
+//
+// Word aligned on both surfaces, unaligned, and clipped on the left and the bottom
+static const sBenchRect_t asRects[] = {
+    { 0,  0,  0,  0,  192U, 24U, 32,  0 },
+    { 3,  2,  13, 5,  150U, 17U, -5,  3 },
+    { -7, 20, 40, 0,  100U, 20U, 37, -4 },
+};
+
+static uint8_t aubDestination[BENCH_DEST_HEIGHT][BENCH_DEST_STRIDE];
+static uint8_t aubReference[BENCH_DEST_HEIGHT][BENCH_DEST_STRIDE];
+static uint8_t aubSnapshot[BENCH_DEST_HEIGHT][BENCH_DEST_STRIDE];
+static uint8_t aubPicture[BENCH_DEST_HEIGHT][BENCH_DEST_STRIDE];
+static uint8_t aubSource[BENCH_SOURCE_HEIGHT][BENCH_SOURCE_STRIDE];
+
+static uint8_t *aptubDestinationRows[BENCH_DEST_HEIGHT];
+static uint8_t *aptubReferenceRows[BENCH_DEST_HEIGHT];
+static uint8_t *aptubSourceRows[BENCH_SOURCE_HEIGHT];
+
+static sFBMSurface_t sDestination;
+static sFBMSurface_t sReference;
+static sFBMSurface_t sSource;
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static void SetUpSurfaces(void);
+static void RunBlit(eFBMBlitBenchOp_t eOp, const sBenchRect_t *psRect);
+static uint32_t RunReference(eFBMBlitBenchOp_t eOp, const sBenchRect_t *psRect);
+static void ScrollReference(const sBenchRect_t *psRect);
+static uint32_t MPixelsPerSec(uint32_t ulPixels, uint32_t ulTicks, uint32_t ulClockHz);
+static inline uint8_t GetPixel(const sFBMSurface_t *psSurface, int32_t lX, int32_t lY);
+static inline void SetPixel(const sFBMSurface_t *psSurface, int32_t lX, int32_t lY, uint8_t ubPixel);
+static inline bool IsInside(const sFBMSurface_t *psSurface, int32_t lX, int32_t lY);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Runs every operation over every rectangle.
+ *
+ * @param pfnClock  Free-running clock; NULL to check the operations without timing.
+ * @param ulClockHz Ticks per second of pfnClock, for the throughput (0 - not computed).
+ * @param psResults Returns FBM_BLIT_BENCH_CASES results.
+ * @return Number of cases whose surface differs from the reference (0 - all correct).
+ */
+uint8_t FBMBlitBenchmark_Run(pfnFBMBlitBenchClock_t pfnClock, uint32_t ulClockHz, sFBMBlitBenchResult_t *psResults)
+{
+    uint8_t ubFailures = 0;
+    uint8_t ubCase = 0;
+
+    SetUpSurfaces();
+
+    for (uint8_t ubOp = 0; ubOp < FBM_BLIT_BENCH_OPERATIONS; ubOp++)
+    {
+        eFBMBlitBenchOp_t eOp = (eFBMBlitBenchOp_t)ubOp;
+
+        for (uint8_t ubRect = 0; ubRect < (sizeof(asRects) / sizeof(asRects[0])); ubRect++, ubCase++)
+        {
+            const sBenchRect_t *psRect = &asRects[ubRect];
+            sFBMBlitBenchResult_t *psResult = &psResults[ubCase];
+
+            memset(psResult, 0, sizeof(*psResult));
+            psResult->eOp = eOp;
+            psResult->sX = psRect->sDestX;
+            psResult->sY = psRect->sDestY;
+            psResult->usWidth = psRect->usWidth;
+            psResult->usHeight = psRect->usHeight;
+
+            memcpy(aubDestination, aubPicture, sizeof(aubDestination));
+            memcpy(aubReference, aubPicture, sizeof(aubReference));
+            RunBlit(eOp, psRect);
+            psResult->ulPixels = RunReference(eOp, psRect);
+            psResult->ubCorrect = (memcmp(aubDestination, aubReference, sizeof(aubDestination)) == 0) ? 1U : 0U;
+            ubFailures += (psResult->ubCorrect == 0U) ? 1U : 0U;
+
+            if (pfnClock != NULL)
+            {
+                uint32_t ulStart = pfnClock();
+                for (uint32_t ulIteration = 0; ulIteration < FBM_BLIT_BENCH_ITERATIONS; ulIteration++)
+                {
+                    (void)RunReference(eOp, psRect);
+                }
+                uint32_t ulMiddle = pfnClock();
+                for (uint32_t ulIteration = 0; ulIteration < FBM_BLIT_BENCH_ITERATIONS; ulIteration++)
+                {
+                    RunBlit(eOp, psRect);
+                }
+                psResult->ulReferenceTicks = (ulMiddle - ulStart) / FBM_BLIT_BENCH_ITERATIONS;
+                psResult->ulBlitTicks = (pfnClock() - ulMiddle) / FBM_BLIT_BENCH_ITERATIONS;
+                psResult->ulReferenceMPixelsPerSec = MPixelsPerSec(psResult->ulPixels, psResult->ulReferenceTicks,
+                                                                   ulClockHz);
+                psResult->ulBlitMPixelsPerSec = MPixelsPerSec(psResult->ulPixels, psResult->ulBlitTicks, ulClockHz);
+            }
+        }
+    }
+    return ubFailures;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Sets the row views of the surfaces and draws the pseudo-random pictures (LCG).
+ */
+static void SetUpSurfaces(void)
+{
+    uint32_t ulSeed = 0x2468ACE1UL;
+
+    for (uint16_t usRow = 0; usRow < BENCH_DEST_HEIGHT; usRow++)
+    {
+        aptubDestinationRows[usRow] = aubDestination[usRow];
+        aptubReferenceRows[usRow] = aubReference[usRow];
+        for (uint16_t usByte = 0; usByte < BENCH_DEST_STRIDE; usByte++)
+        {
+            ulSeed = (ulSeed * 1664525UL) + 1013904223UL;
+            aubPicture[usRow][usByte] = (uint8_t)(ulSeed >> 24);
+        }
+    }
+    for (uint16_t usRow = 0; usRow < BENCH_SOURCE_HEIGHT; usRow++)
+    {
+        aptubSourceRows[usRow] = aubSource[usRow];
+        for (uint16_t usByte = 0; usByte < BENCH_SOURCE_STRIDE; usByte++)
+        {
+            ulSeed = (ulSeed * 1664525UL) + 1013904223UL;
+            aubSource[usRow][usByte] = (uint8_t)(ulSeed >> 24);
+        }
+    }
+
+    sDestination = (sFBMSurface_t){ aptubDestinationRows, BENCH_DEST_STRIDE, BENCH_DEST_WIDTH, BENCH_DEST_HEIGHT };
+    sReference = (sFBMSurface_t){ aptubReferenceRows, BENCH_DEST_STRIDE, BENCH_DEST_WIDTH, BENCH_DEST_HEIGHT };
+    sSource = (sFBMSurface_t){ aptubSourceRows, BENCH_SOURCE_STRIDE, BENCH_SOURCE_WIDTH, BENCH_SOURCE_HEIGHT };
+}
+
+/**
+ * @brief Runs one operation on the destination with FBMBlit.
+ */
+static void RunBlit(eFBMBlitBenchOp_t eOp, const sBenchRect_t *psRect)
+{
+    switch (eOp)
+    {
+        case FBM_BLIT_BENCH_FILL_RECT:
+            FBM_BlitFillRect(&sDestination, psRect->sDestX, psRect->sDestY, psRect->usWidth, psRect->usHeight, true);
+            break;
+
+        case FBM_BLIT_BENCH_SCROLL:
+            FBM_BlitScroll(&sDestination, psRect->sDestX, psRect->sDestY, psRect->usWidth, psRect->usHeight,
+                           psRect->sShiftX, psRect->sShiftY);
+            break;
+
+        default:
+            // The first benchmark operations are the eFBMBlitOp_t raster operations
+            FBM_Blit(&sDestination, psRect->sDestX, psRect->sDestY, &sSource, psRect->sSourceX, psRect->sSourceY,
+                     psRect->usWidth, psRect->usHeight, (eFBMBlitOp_t)eOp);
+            break;
+    }
+}
+
+/**
+ * @brief Runs one operation on the reference surface, one pixel at a time.
+ *
+ * @return Pixels of the destination the operation updated.
+ */
+static uint32_t RunReference(eFBMBlitBenchOp_t eOp, const sBenchRect_t *psRect)
+{
+    uint32_t ulPixels = 0;
+
+    if (eOp == FBM_BLIT_BENCH_SCROLL)
+    {
+        ScrollReference(psRect);
+        for (int32_t lY = psRect->sDestY; lY < (psRect->sDestY + psRect->usHeight); lY++)
+        {
+            for (int32_t lX = psRect->sDestX; lX < (psRect->sDestX + psRect->usWidth); lX++)
+            {
+                ulPixels += IsInside(&sReference, lX, lY) ? 1U : 0U;
+            }
+        }
+        return ulPixels;
+    }
+
+    for (int32_t lRow = 0; lRow < psRect->usHeight; lRow++)
+    {
+        for (int32_t lColumn = 0; lColumn < psRect->usWidth; lColumn++)
+        {
+            int32_t lDestX = psRect->sDestX + lColumn;
+            int32_t lDestY = psRect->sDestY + lRow;
+            int32_t lSourceX = psRect->sSourceX + lColumn;
+            int32_t lSourceY = psRect->sSourceY + lRow;
+
+            if (!IsInside(&sReference, lDestX, lDestY) ||
+                ((eOp != FBM_BLIT_BENCH_FILL_RECT) && !IsInside(&sSource, lSourceX, lSourceY)))
+            {
+                continue;
+            }
+
+            uint8_t ubDestination = GetPixel(&sReference, lDestX, lDestY);
+            uint8_t ubSource = (eOp != FBM_BLIT_BENCH_FILL_RECT) ? GetPixel(&sSource, lSourceX, lSourceY) : 1U;
+            uint8_t ubPixel;
+
+            switch (eOp)
+            {
+                case FBM_BLIT_BENCH_OR:          ubPixel = ubDestination | ubSource; break;
+                case FBM_BLIT_BENCH_AND:         ubPixel = ubDestination & ubSource; break;
+                case FBM_BLIT_BENCH_XOR:         ubPixel = ubDestination ^ ubSource; break;
+                case FBM_BLIT_BENCH_INVERT_COPY: ubPixel = ubSource ^ 1U;            break;
+                default:                         ubPixel = ubSource;                 break;
+            }
+            SetPixel(&sReference, lDestX, lDestY, ubPixel);
+            ulPixels++;
+        }
+    }
+    return ulPixels;
+}
+
+/**
+ * @brief Scrolls the visible part of the rectangle on the reference surface.
+ *
+ * Every pixel takes the one sShiftX/sShiftY before it, or 0 when that one lies outside
+ * the visible rectangle.
+ */
+static void ScrollReference(const sBenchRect_t *psRect)
+{
+    int32_t lX0 = (psRect->sDestX < 0) ? 0 : psRect->sDestX;
+    int32_t lY0 = (psRect->sDestY < 0) ? 0 : psRect->sDestY;
+    int32_t lX1 = psRect->sDestX + psRect->usWidth;
+    int32_t lY1 = psRect->sDestY + psRect->usHeight;
+
+    if (lX1 > (int32_t)BENCH_DEST_WIDTH)  { lX1 = (int32_t)BENCH_DEST_WIDTH; }
+    if (lY1 > (int32_t)BENCH_DEST_HEIGHT) { lY1 = (int32_t)BENCH_DEST_HEIGHT; }
+
+    memcpy(aubSnapshot, aubReference, sizeof(aubSnapshot));
+    for (int32_t lY = lY0; lY < lY1; lY++)
+    {
+        for (int32_t lX = lX0; lX < lX1; lX++)
+        {
+            int32_t lFromX = lX - psRect->sShiftX;
+            int32_t lFromY = lY - psRect->sShiftY;
+            uint8_t ubPixel = 0U;
+
+            if ((lFromX >= lX0) && (lFromX < lX1) && (lFromY >= lY0) && (lFromY < lY1))
+            {
+                ubPixel = (aubSnapshot[lFromY][lFromX >> 3] >> (7U - (lFromX & 7))) & 0x01U;
+            }
+            SetPixel(&sReference, lX, lY, ubPixel);
+        }
+    }
+}
+
+/**
+ * @brief Converts the ticks of one operation into millions of pixels per second.
+ */
+static uint32_t MPixelsPerSec(uint32_t ulPixels, uint32_t ulTicks, uint32_t ulClockHz)
+{
+    if ((ulTicks == 0U) || (ulClockHz == 0U))
+    {
+        return 0;
+    }
+    return (uint32_t)(((uint64_t)ulPixels * ulClockHz) / ((uint64_t)ulTicks * 1000000U));
+}
+
+/**
+ * @brief Reads pixel (lX, lY), MSB first.
+ */
+static inline uint8_t GetPixel(const sFBMSurface_t *psSurface, int32_t lX, int32_t lY)
+{
+    return (psSurface->ptubRows[lY][lX >> 3] >> (7U - (lX & 7))) & 0x01U;
+}
+
+/**
+ * @brief Writes pixel (lX, lY), MSB first.
+ */
+static inline void SetPixel(const sFBMSurface_t *psSurface, int32_t lX, int32_t lY, uint8_t ubPixel)
+{
+    uint8_t ubBit = (uint8_t)(0x80U >> (lX & 7));
+
+    if (ubPixel != 0U)
+    {
+        psSurface->ptubRows[lY][lX >> 3] |= ubBit;
+    }
+    else
+    {
+        psSurface->ptubRows[lY][lX >> 3] &= (uint8_t)~ubBit;
+    }
+}
+
+/**
+ * @brief Tells whether pixel (lX, lY) lies on the surface.
+ */
+static inline bool IsInside(const sFBMSurface_t *psSurface, int32_t lX, int32_t lY)
+{
+    return (lX >= 0) && (lY >= 0) && (lX < psSurface->usWidth) && (lY < psSurface->usHeight);
+}
@@ -0,0 +1,70 @@
+/**
+ * @file FBMBlitBenchmark.h
+ * @brief Benchmark of the word-wide 1bpp bit-blit operations (FBMBlit).
+ *
+ * Runs copy, OR, AND, XOR, invert-copy, fill-rect and scroll over aligned, unaligned and
+ * clipped rectangles, once with FBMBlit and once pixel by pixel, checks both give the
+ * same surface and gives the throughput of each. The clock is passed in, so it runs on
+ * the host or on the target (DWT cycle counter).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef MIDDLEWARE_FRAMEBUFFERMANAGER_TEST_FBMBLITBENCHMARK_H_
+#define MIDDLEWARE_FRAMEBUFFERMANAGER_TEST_FBMBLITBENCHMARK_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define FBM_BLIT_BENCH_ITERATIONS   64U     // Operations timed per path and case
+#define FBM_BLIT_BENCH_OPERATIONS   7U      // Copy, OR, AND, XOR, invert-copy, fill-rect, scroll
+#define FBM_BLIT_BENCH_CASES        21U     // Operations * rectangles
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief Free-running clock of the platform (cycles, ns, ...).
+ */
+typedef uint32_t (*pfnFBMBlitBenchClock_t)(void);
+
+/**
+ * @brief Operations of the benchmark.
+ */
+typedef enum {
+    FBM_BLIT_BENCH_COPY = 0,
+    FBM_BLIT_BENCH_OR,
+    FBM_BLIT_BENCH_AND,
+    FBM_BLIT_BENCH_XOR,
+    FBM_BLIT_BENCH_INVERT_COPY,
+    FBM_BLIT_BENCH_FILL_RECT,
+    FBM_BLIT_BENCH_SCROLL,
+} eFBMBlitBenchOp_t;
+
+/**
+ * @brief Result of one case.
+ */
+typedef struct {
+    eFBMBlitBenchOp_t eOp;
+    int16_t  sX;                    // Destination rectangle, before clipping
+    int16_t  sY;
+    uint16_t usWidth;
+    uint16_t usHeight;
+    uint32_t ulPixels;              // Destination pixels one operation updates
+    uint8_t  ubCorrect;             // FBMBlit matches the per-pixel reference
+    uint32_t ulReferenceTicks;      // Mean clock ticks of one per-pixel operation
+    uint32_t ulBlitTicks;           // Mean clock ticks of one FBMBlit operation
+    uint32_t ulReferenceMPixelsPerSec;
+    uint32_t ulBlitMPixelsPerSec;
+} sFBMBlitBenchResult_t;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t FBMBlitBenchmark_Run(pfnFBMBlitBenchClock_t pfnClock, uint32_t ulClockHz, sFBMBlitBenchResult_t *psResults);
+
+#endif /* MIDDLEWARE_FRAMEBUFFERMANAGER_TEST_FBMBLITBENCHMARK_H_ */
@@ -0,0 +1,378 @@
+/**
+ * @file FBMDeltaTest.c
+ * @brief Round trip test of the frame delta encoder (FBMDelta).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "Middleware/FrameBufferManager/Test/FBMDeltaTest.h"
+#include "Middleware/FrameBufferManager/FBMDelta.h"
+#include "Middleware/FrameBufferManager/FrameBufferManager.h"
+#include "../lvgl/src/libs/lz4/lz4.h"
+#include <stdbool.h>
+#include <string.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define TEST_ROWS               16U
+#define TEST_COLUMNS            64U     // One panel: 8 byte rows, 128 byte frames
+#define TEST_MAX_PANELS         2U
+#define TEST_MAX_FRAME_BYTES    ((TEST_ROWS * TEST_COLUMNS * TEST_MAX_PANELS) / 8U)
+#define TEST_CHUNK_PAYLOAD      32U     // A raw one panel frame takes 4 datagrams
+#define TEST_MAX_DATAGRAM       (FBM_DELTA_HEADER_SIZE + TEST_CHUNK_PAYLOAD)
+#define TEST_KEYFRAME_INTERVAL  6U
+#define TEST_DRAIN_CALLS        32U     // FBMDelta_Process() calls after each step
+#define TEST_NOT_SENT           0xFFU   // No datagram of the step's frame expected
+#define TEST_NOISE_SEED         0x2545F491UL
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef enum {
+    FILL_NOISE = 0,                     // New pseudo-random frame
+    FILL_STRIPES,                       // Rows of 0xF0 and 0x0F, compresses well
+    FILL_TOUCH,                         // One byte changed
+    FILL_SAME,                          // Nothing changed
+    FILL_RESIZE                         // FBM re-initialized with two panels, new noise
+} eDeltaFill_t;
+
+typedef struct {
+    eDeltaFill_t eFill;
+    uint8_t  ubFailSends;               // Sends the transport refuses before accepting
+    bool     bBusy;                     // Touch and publish again before draining
+    uint8_t  ubFlags;                   // Flags of the frame sent, or TEST_NOT_SENT
+    uint16_t usDatagrams;               // Datagrams the transport accepted
+    bool     bMatch;                    // Receiver frame equals the last one published
+} sDeltaStep_t;
+
+/**
+ * @brief Receiving end: reassembles one frame at a time and applies it.
+ */
+typedef struct {
+    uint8_t  aubFrame[TEST_MAX_FRAME_BYTES];
+    uint8_t  aubPayload[TEST_MAX_FRAME_BYTES * 2U];  // Reassembled encoded frame
+    uint8_t  aubDecoded[TEST_MAX_FRAME_BYTES];
+    uint16_t usWidth;
+    uint16_t usHeight;
+    uint32_t ulFrameBytes;
+    bool     bSynced;                   // A keyframe has been applied
+    uint16_t usSequence;                // Frame being reassembled
+    uint16_t usNextChunk;               // Chunk expected next
+    uint16_t usDatagrams;               // Datagrams received in the step
+    uint8_t  ubFlags;                   // Flags of the last datagram received
+    uint16_t usErrors;                  // Malformed or undecodable frames
+} sDeltaReceiver_t;
+
+//-------------------------------------[ STATIC VARIABLE ] --------------------------//
+//
+static const sDeltaStep_t asDeltaSteps[] = {
+    // First frame is a keyframe; noise does not compress, 128 bytes in 4 chunks
+    { FILL_NOISE,   0U, false, FBM_DELTA_FLAG_KEYFRAME,                      4U, true  },
+    { FILL_TOUCH,   0U, false, FBM_DELTA_FLAG_LZ4,                           1U, true  },
+    { FILL_SAME,    0U, false, TEST_NOT_SENT,                                0U, true  },
+    // The second touch is published while the first is queued: not encoded
+    { FILL_TOUCH,   0U, true,  FBM_DELTA_FLAG_LZ4,                           1U, false },
+    // ...the next delta, against the last frame sent, carries both
+    { FILL_TOUCH,   0U, false, FBM_DELTA_FLAG_LZ4,                           1U, true  },
+    // Three refused sends abort the frame and request a keyframe
+    { FILL_TOUCH,   3U, false, TEST_NOT_SENT,                                0U, false },
+    { FILL_STRIPES, 0U, false, FBM_DELTA_FLAG_KEYFRAME | FBM_DELTA_FLAG_LZ4, 1U, true  },
+    // Two refused sends are retried
+    { FILL_TOUCH,   2U, false, FBM_DELTA_FLAG_LZ4,                           1U, true  },
+    // A raw delta split into chunks
+    { FILL_NOISE,   0U, false, 0U,                                           4U, true  },
+    { FILL_TOUCH,   0U, false, FBM_DELTA_FLAG_LZ4,                           1U, true  },
+    { FILL_TOUCH,   0U, false, FBM_DELTA_FLAG_LZ4,                           1U, true  },
+    { FILL_TOUCH,   0U, false, FBM_DELTA_FLAG_LZ4,                           1U, true  },
+    { FILL_TOUCH,   0U, false, FBM_DELTA_FLAG_LZ4,                           1U, true  },
+    // Sixth frame since the keyframe
+    { FILL_NOISE,   0U, false, FBM_DELTA_FLAG_KEYFRAME,                      4U, true  },
+    // Frame of the new geometry is dropped, FBMDelta_Process() re-arms the encoder
+    { FILL_RESIZE,  0U, false, TEST_NOT_SENT,                                0U, false },
+    { FILL_TOUCH,   0U, false, FBM_DELTA_FLAG_KEYFRAME,                      8U, true  },
+    { FILL_TOUCH,   0U, false, FBM_DELTA_FLAG_LZ4,                           1U, true  },
+};
+
+static sDeltaReceiver_t sReceiver;
+static uint8_t aubTruth[TEST_MAX_FRAME_BYTES];  // Last frame published
+static uint32_t ulTruthBytes;
+static uint32_t ulNoise;
+static uint32_t ulTouches;
+static uint8_t ubRefusals;                      // Sends left to refuse
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static uint8_t CheckStep(const sDeltaStep_t *psStep);
+static uint8_t CheckStatistics(void);
+static void Fill(eDeltaFill_t eFill);
+static void Publish(void);
+static uint8_t Send(const uint8_t *pubDatagram, uint16_t usLength, void *pvContext);
+static void ApplyFrame(uint8_t ubFlags, uint16_t usWidth, uint16_t usHeight, uint32_t ulEncodedBytes);
+static uint16_t GetUint16(const uint8_t *pubSource);
+static uint32_t GetUint32(const uint8_t *pubSource);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Runs the step table through the encoder and the receiver.
+ *
+ * @return Number of failing steps, plus one if the statistics are off (0 - all passed).
+ */
+uint8_t FBMDeltaTest_Run(void)
+{
+    uint8_t ubFailures = 0;
+
+    memset(&sReceiver, 0, sizeof(sReceiver));
+    ulNoise = TEST_NOISE_SEED;
+    ulTouches = 0;
+    ubRefusals = 0;
+
+    if ((FBM_SetPixelFormat(FBM_FORMAT_MONO_1BPP) == 0) ||
+        (FBM_Init(TEST_ROWS, TEST_COLUMNS, 0U, 0U, 1U) == 0))
+    {
+        return 1;
+    }
+    ulTruthBytes = (uint32_t)FBM_GetStride() * FBM_GetHeight();
+    memset(aubTruth, 0, sizeof(aubTruth));
+
+    if (FBMDelta_Start(TEST_KEYFRAME_INTERVAL, TEST_MAX_DATAGRAM, Send, &sReceiver) == 0)
+    {
+        FBM_DeinitializeSystem(TEST_ROWS);
+        return 1;
+    }
+
+    for (uint32_t ulStep = 0; ulStep < (sizeof(asDeltaSteps) / sizeof(asDeltaSteps[0])); ulStep++)
+    {
+        ubFailures += (CheckStep(&asDeltaSteps[ulStep]) == 0) ? 1U : 0U;
+    }
+    ubFailures += (CheckStatistics() == 0) ? 1U : 0U;
+
+    FBMDelta_Stop();
+    FBM_DeinitializeSystem(TEST_ROWS);
+    return ubFailures;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Publishes the frame of one step, drains the encoder and checks what the
+ *        receiver got; 1 if it is what the step expects.
+ */
+static uint8_t CheckStep(const sDeltaStep_t *psStep)
+{
+    sReceiver.usDatagrams = 0;
+    sReceiver.ubFlags = TEST_NOT_SENT;
+    sReceiver.usErrors = 0;
+
+    Fill(psStep->eFill);
+    Publish();
+    if (psStep->bBusy)
+    {
+        Fill(FILL_TOUCH);
+        Publish();
+    }
+
+    ubRefusals = psStep->ubFailSends;
+    for (uint32_t ulCall = 0; ulCall < TEST_DRAIN_CALLS; ulCall++)
+    {
+        FBMDelta_Process();
+    }
+
+    bool bMatch = (sReceiver.ulFrameBytes == ulTruthBytes) && (sReceiver.usWidth == FBM_GetWidth()) &&
+                  (memcmp(sReceiver.aubFrame, aubTruth, ulTruthBytes) == 0);
+
+    return ((sReceiver.usErrors == 0) && (sReceiver.ubFlags == psStep->ubFlags) &&
+            (sReceiver.usDatagrams == psStep->usDatagrams) && (bMatch == psStep->bMatch)) ? 1U : 0U;
+}
+
+/**
+ * @brief Checks the encoder counters against the step table; 1 if they agree.
+ */
+static uint8_t CheckStatistics(void)
+{
+    sFBMDeltaStats_t sStats;
+    uint32_t ulDatagrams = 0;
+
+    if (FBMDelta_GetStatistics(&sStats) == 0)
+    {
+        return 0;
+    }
+    for (uint32_t ulStep = 0; ulStep < (sizeof(asDeltaSteps) / sizeof(asDeltaSteps[0])); ulStep++)
+    {
+        ulDatagrams += asDeltaSteps[ulStep].usDatagrams;
+    }
+
+    // Every step encodes one frame but the unchanged one and the dropped one
+    return ((sStats.ulFramesEncoded == 15U) && (sStats.ulKeyframes == 4U) && (sStats.ulUnchangedFrames == 1U) &&
+            (sStats.ulBusyFrames == 1U) && (sStats.ulAbortedFrames == 1U) && (sStats.ulDatagramsSent == ulDatagrams) &&
+            (sStats.ulGeometryDrops == 1U) && (sStats.ulRearms == 1U)) ? 1U : 0U;
+}
+
+/**
+ * @brief Changes the published frame as a step asks.
+ */
+static void Fill(eDeltaFill_t eFill)
+{
+    if (eFill == FILL_RESIZE)
+    {
+        FBM_DeinitializeSystem(TEST_ROWS);
+        (void)FBM_Init(TEST_ROWS, TEST_COLUMNS, 0U, 0U, TEST_MAX_PANELS);
+        ulTruthBytes = (uint32_t)FBM_GetStride() * FBM_GetHeight();
+    }
+
+    for (uint32_t ulByte = 0; ulByte < ulTruthBytes; ulByte++)
+    {
+        switch (eFill)
+        {
+        case FILL_NOISE:
+        case FILL_RESIZE:
+            // xorshift32
+            ulNoise ^= ulNoise << 13;
+            ulNoise ^= ulNoise >> 17;
+            ulNoise ^= ulNoise << 5;
+            aubTruth[ulByte] = (uint8_t)ulNoise;
+            break;
+        case FILL_STRIPES:
+            aubTruth[ulByte] = (((ulByte / FBM_GetStride()) & 1U) != 0U) ? 0x0FU : 0xF0U;
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (eFill == FILL_TOUCH)
+    {
+        ulTouches++;
+        aubTruth[(ulTouches * 7U) % ulTruthBytes] ^= 0x5AU;
+    }
+}
+
+/**
+ * @brief Renders the test frame into the FBM, publishes it and hands it to the encoder as
+ *        the LVGL flush does.
+ */
+static void Publish(void)
+{
+    uint8_t **ptubBuffer = FBM_AcquireRenderBuffer();
+    const sFBMFrame_t *psFrame = FBM_GetFrame(ptubBuffer);
+
+    if (psFrame == NULL)
+    {
+        return;
+    }
+    memcpy(psFrame->pubData, aubTruth, psFrame->ulSizeBytes);
+    FBM_MarkRowsDirty(ptubBuffer, 0U, (uint16_t)(psFrame->usHeight - 1U));
+    FBM_PublishBuffer();
+    FBMDelta_OnFramePublished(ptubBuffer);
+}
+
+/**
+ * @brief Transport: refuses the first sends of a step if asked, otherwise reassembles the
+ *        datagram into the receiver's frame.
+ */
+static uint8_t Send(const uint8_t *pubDatagram, uint16_t usLength, void *pvContext)
+{
+    sDeltaReceiver_t *psReceiver = (sDeltaReceiver_t *)pvContext;
+
+    if (ubRefusals > 0U)
+    {
+        ubRefusals--;
+        return 0;
+    }
+
+    uint16_t usSequence = GetUint16(&pubDatagram[4]);
+    uint16_t usChunk = GetUint16(&pubDatagram[6]);
+    uint16_t usChunks = GetUint16(&pubDatagram[8]);
+    uint32_t ulEncodedBytes = GetUint32(&pubDatagram[14]);
+    uint32_t ulOffset = (uint32_t)usChunk * TEST_CHUNK_PAYLOAD;
+    uint32_t ulChunkBytes = (uint32_t)usLength - FBM_DELTA_HEADER_SIZE;
+
+    psReceiver->usDatagrams++;
+    psReceiver->ubFlags = pubDatagram[2];
+
+    // Chunks come in order; a new sequence starts a new frame
+    if (usChunk == 0U)
+    {
+        psReceiver->usSequence = usSequence;
+        psReceiver->usNextChunk = 0;
+    }
+    if ((pubDatagram[0] != 'F') || (pubDatagram[1] != 'D') || (pubDatagram[3] != (uint8_t)FBM_FORMAT_MONO_1BPP) ||
+        (usLength > TEST_MAX_DATAGRAM) || (usSequence != psReceiver->usSequence) ||
+        (usChunk != psReceiver->usNextChunk) || (usChunk >= usChunks) ||
+        ((ulOffset + ulChunkBytes) > ulEncodedBytes) || (ulEncodedBytes > sizeof(psReceiver->aubPayload)))
+    {
+        psReceiver->usErrors++;
+        return 1;
+    }
+
+    memcpy(&psReceiver->aubPayload[ulOffset], &pubDatagram[FBM_DELTA_HEADER_SIZE], ulChunkBytes);
+    psReceiver->usNextChunk++;
+    if (psReceiver->usNextChunk == usChunks)
+    {
+        ApplyFrame(pubDatagram[2], GetUint16(&pubDatagram[10]), GetUint16(&pubDatagram[12]), ulEncodedBytes);
+    }
+    return 1;
+}
+
+/**
+ * @brief Decodes the reassembled frame and replaces (keyframe) or XORs (delta) the
+ *        receiver's frame with it.
+ */
+static void ApplyFrame(uint8_t ubFlags, uint16_t usWidth, uint16_t usHeight, uint32_t ulEncodedBytes)
+{
+    uint32_t ulFrameBytes = (((uint32_t)usWidth + 7U) / 8U) * usHeight;
+    const uint8_t *pubDecoded = sReceiver.aubPayload;
+
+    if (ulFrameBytes > TEST_MAX_FRAME_BYTES)
+    {
+        sReceiver.usErrors++;
+        return;
+    }
+    if ((ubFlags & FBM_DELTA_FLAG_LZ4) != 0U)
+    {
+        int iBytes = LZ4_decompress_safe((const char *)sReceiver.aubPayload, (char *)sReceiver.aubDecoded,
+                                         (int)ulEncodedBytes, (int)sizeof(sReceiver.aubDecoded));
+        pubDecoded = sReceiver.aubDecoded;
+        ulEncodedBytes = (iBytes > 0) ? (uint32_t)iBytes : 0U;
+    }
+    if (ulEncodedBytes != ulFrameBytes)
+    {
+        sReceiver.usErrors++;
+        return;
+    }
+
+    if ((ubFlags & FBM_DELTA_FLAG_KEYFRAME) != 0U)
+    {
+        memcpy(sReceiver.aubFrame, pubDecoded, ulFrameBytes);
+        sReceiver.usWidth = usWidth;
+        sReceiver.usHeight = usHeight;
+        sReceiver.ulFrameBytes = ulFrameBytes;
+        sReceiver.bSynced = true;
+    }
+    else if (sReceiver.bSynced && (usWidth == sReceiver.usWidth) && (usHeight == sReceiver.usHeight))
+    {
+        for (uint32_t ulByte = 0; ulByte < ulFrameBytes; ulByte++)
+        {
+            sReceiver.aubFrame[ulByte] ^= pubDecoded[ulByte];
+        }
+    }
+    else
+    {
+        sReceiver.usErrors++;
+    }
+}
+
+static uint16_t GetUint16(const uint8_t *pubSource)
+{
+    return (uint16_t)(pubSource[0] | (pubSource[1] << 8));
+}
+
+static uint32_t GetUint32(const uint8_t *pubSource)
+{
+    return GetUint16(pubSource) | ((uint32_t)GetUint16(pubSource + 2) << 16);
+}
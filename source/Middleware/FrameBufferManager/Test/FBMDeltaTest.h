@@ -0,0 +1,31 @@
+/**
+ * @file FBMDeltaTest.h
+ * @brief Round trip test of the frame delta encoder (FBMDelta).
+ *
+ * Publishes a table of frames (noise, stripes, single byte changes, an unchanged frame, a
+ * geometry change) into small FBM frames and feeds every datagram the encoder sends to a
+ * receiver that reassembles the chunks, decodes raw or LZ4 payloads and applies keyframes
+ * and XOR deltas. Checks after each step the flags and datagram count of the frame sent
+ * and whether the receiver's frame matches the published one, with MTU sized chunks,
+ * failed sends (retried and aborted), a frame published while the previous one is queued
+ * and a periodic keyframe. Needs the memory manager initialized; leaves the FBM and the
+ * encoder stopped. Runs on the host or on the target.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef MIDDLEWARE_FRAMEBUFFERMANAGER_TEST_FBMDELTATEST_H_
+#define MIDDLEWARE_FRAMEBUFFERMANAGER_TEST_FBMDELTATEST_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t FBMDeltaTest_Run(void);
+
+#endif /* MIDDLEWARE_FRAMEBUFFERMANAGER_TEST_FBMDELTATEST_H_ */
@@ -0,0 +1,198 @@
+/**
+ * @file FBMTearingTest.c
+ * @brief Two-thread tearing test of the triple buffer hand-over (FrameBufferManager).
+ *
+ * Frame n carries n in its first word and the byte (n & 0xFF) everywhere else, so a
+ * frame mixed from two publishes shows as a byte that differs from the number. The scan
+ * thread also follows the numbers: a new frame must be later than the previous one, a
+ * repeated frame the same one, and the gaps are the frames the renderer replaced before
+ * the scan saw them.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#if defined(MM_HOST_SIMULATION)
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "Middleware/FrameBufferManager/Test/FBMTearingTest.h"
+#include "Middleware/FrameBufferManager/FrameBufferManager.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <string.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+// Installed geometry: two 16-row panels of 64 columns
+#define TEST_ROWS               16U
+#define TEST_COLUMNS            64U
+#define TEST_PANELS             2U
+
+// Busy loop between publishes, so the scan thread gets frames at both faster and slower rates
+#define TEST_RENDER_SPIN        200U
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+/**
+ * @brief What the scan thread saw.
+ */
+typedef struct {
+    uint32_t ulTornFrames;      // Frames mixed from two publishes
+    uint32_t ulOutOfOrder;      // New frames not later than the previous one, or repeats that changed
+    uint32_t ulNewFrames;       // Acquires that returned a new frame
+    uint32_t ulRepeatedFrames;  // Acquires that returned the previous frame
+    uint32_t ulSkippedFrames;   // Frame numbers between two new frames
+    uint32_t ulFirstFrame;      // Number of the first frame seen (0 - none yet)
+    uint32_t ulLastFrame;       // Number of the last frame seen
+} sScanObservations_t;
+
+//-------------------------------------[ STATIC VARIABLE ] --------------------------//
+//
+static volatile bool bRenderDone;
+static sScanObservations_t sSeen;
+
+//-------------------------------------[ LOCAL PROTOTYPES ] -------------------------//
+//
+static void *RenderThread(void *pvArgument);
+static void *ScanThread(void *pvArgument);
+static void ScanOnce(void);
+
+//-------------------------------------[ GLOBAL FUNCTIONS ] -------------------------//
+//
+
+/**
+ * @brief Runs the renderer and scan threads and checks what the scan saw.
+ *
+ * Checks no frame tore, the frame numbers never went back, and the FBM counters match the
+ * scan thread: scanned = new frames, duplicated = repeats, dropped = skipped numbers, and
+ * every frame published from the first one seen was either scanned or dropped.
+ *
+ * @return Number of failed checks (0 - all passed).
+ */
+uint8_t FBMTearingTest_Run(void)
+{
+    uint8_t ubFailures = 0;
+    pthread_t sRender;
+    pthread_t sScan;
+    sFBMFrameStats_t sStats;
+
+    memset(&sSeen, 0, sizeof(sSeen));
+    bRenderDone = false;
+    if ((FBM_SetBufferMode(FBM_MODE_TRIPLE_BUFFER) == 0) ||
+        (FBM_Init(TEST_ROWS, TEST_COLUMNS, 0U, 0U, TEST_PANELS) == 0))
+    {
+        return 1;
+    }
+
+    if ((pthread_create(&sScan, NULL, ScanThread, NULL) != 0) ||
+        (pthread_create(&sRender, NULL, RenderThread, NULL) != 0))
+    {
+        FBM_DeinitializeSystem(TEST_ROWS);
+        return 1;
+    }
+    (void)pthread_join(sRender, NULL);
+    (void)pthread_join(sScan, NULL);
+    // The last frame published is scanned by the next cycle
+    ScanOnce();
+
+    FBM_GetFrameStatistics(&sStats);
+    FBM_DeinitializeSystem(TEST_ROWS);
+
+    ubFailures += (sSeen.ulTornFrames != 0U) ? 1U : 0U;
+    ubFailures += (sSeen.ulOutOfOrder != 0U) ? 1U : 0U;
+    ubFailures += (sSeen.ulLastFrame != FBM_TEARING_TEST_FRAMES) ? 1U : 0U;
+    ubFailures += (sStats.ulPublishedFrames != FBM_TEARING_TEST_FRAMES) ? 1U : 0U;
+    ubFailures += (sStats.ulScannedFrames != sSeen.ulNewFrames) ? 1U : 0U;
+    ubFailures += (sStats.ulDuplicatedFrames != sSeen.ulRepeatedFrames) ? 1U : 0U;
+    ubFailures += (sStats.ulDroppedFrames != sSeen.ulSkippedFrames) ? 1U : 0U;
+    // Frames published before the first one scanned are not counted as dropped
+    ubFailures += ((sStats.ulScannedFrames + sStats.ulDroppedFrames) !=
+                   (sStats.ulPublishedFrames - (sSeen.ulFirstFrame - 1U))) ? 1U : 0U;
+    // Both threads ran at once: some frames were replaced unseen, some cycles repeated
+    ubFailures += ((sStats.ulDroppedFrames == 0U) || (sStats.ulDuplicatedFrames == 0U)) ? 1U : 0U;
+    return ubFailures;
+}
+
+//-------------------------------------[ LOCAL FUNCTIONS ] -------------------------//
+//
+/**
+ * @brief Renderer: publishes frames 1..FBM_TEARING_TEST_FRAMES.
+ */
+static void *RenderThread(void *pvArgument)
+{
+    (void)pvArgument;
+
+    for (uint32_t ulFrame = 1; ulFrame <= FBM_TEARING_TEST_FRAMES; ulFrame++)
+    {
+        const sFBMFrame_t *psFrame = FBM_GetFrame(FBM_AcquireRenderBuffer());
+
+        memset(psFrame->pubData, (int)(ulFrame & 0xFFU), psFrame->ulSizeBytes);
+        memcpy(psFrame->pubData, &ulFrame, sizeof(ulFrame));
+        FBM_PublishBuffer();
+
+        for (volatile uint32_t ulSpin = 0; ulSpin < (ulFrame % TEST_RENDER_SPIN); ulSpin++)
+        {
+        }
+    }
+    bRenderDone = true;
+    return NULL;
+}
+
+/**
+ * @brief Scan: acquires frames until the renderer is done.
+ */
+static void *ScanThread(void *pvArgument)
+{
+    (void)pvArgument;
+
+    while (!bRenderDone)
+    {
+        ScanOnce();
+    }
+    return NULL;
+}
+
+/**
+ * @brief One scan cycle: acquires a frame, checks it is whole and follows its number.
+ */
+static void ScanOnce(void)
+{
+    bool bIsNewFrame = false;
+    const uint32_t *pulDirtyRows = NULL;
+    const sFBMFrame_t *psFrame = FBM_GetFrame(FBM_AcquireScanBuffer(&bIsNewFrame, &pulDirtyRows));
+    uint32_t ulFrame;
+
+    memcpy(&ulFrame, psFrame->pubData, sizeof(ulFrame));
+    for (uint32_t ulByte = sizeof(ulFrame); ulByte < psFrame->ulSizeBytes; ulByte++)
+    {
+        if (psFrame->pubData[ulByte] != (uint8_t)(ulFrame & 0xFFU))
+        {
+            sSeen.ulTornFrames++;
+            break;
+        }
+    }
+
+    if (!bIsNewFrame)
+    {
+        sSeen.ulRepeatedFrames++;
+        sSeen.ulOutOfOrder += (ulFrame != sSeen.ulLastFrame) ? 1U : 0U;
+        return;
+    }
+
+    sSeen.ulNewFrames++;
+    if (sSeen.ulFirstFrame == 0U)
+    {
+        sSeen.ulFirstFrame = ulFrame;
+    }
+    else if (ulFrame > sSeen.ulLastFrame)
+    {
+        sSeen.ulSkippedFrames += ulFrame - sSeen.ulLastFrame - 1U;
+    }
+    sSeen.ulOutOfOrder += (ulFrame <= sSeen.ulLastFrame) ? 1U : 0U;
+    sSeen.ulLastFrame = ulFrame;
+}
+
+#endif /* MM_HOST_SIMULATION */
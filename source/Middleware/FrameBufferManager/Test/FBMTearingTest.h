@@ -0,0 +1,31 @@
+/**
+ * @file FBMTearingTest.h
+ * @brief Two-thread tearing test of the triple buffer hand-over (FrameBufferManager).
+ *
+ * A renderer thread publishes numbered frames as fast as it can while a scan thread
+ * acquires them, checks every frame it gets is whole and checks the published, scanned,
+ * dropped and duplicated counters against what it saw. Host only: built with
+ * MM_HOST_SIMULATION and POSIX threads (see Test/Host/README.txt).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef MIDDLEWARE_FRAMEBUFFERMANAGER_TEST_FBMTEARINGTEST_H_
+#define MIDDLEWARE_FRAMEBUFFERMANAGER_TEST_FBMTEARINGTEST_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define FBM_TEARING_TEST_FRAMES     200000U     // Frames published by the renderer thread
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint8_t FBMTearingTest_Run(void);
+
+#endif /* MIDDLEWARE_FRAMEBUFFERMANAGER_TEST_FBMTEARINGTEST_H_ */
@@ -0,0 +1,46 @@
+/**
+ * @file DisplayPathBenchmarkMain.c
+ * @brief Host entry point of the display path benchmark.
+ *
+ * Sweeps 1..32 panels, 16/32/64 rows and the scan rates (DisplayPathBenchmark_Run())
+ * with CLOCK_MONOTONIC as the clock and prints the JSON lines on stdout. Build as given
+ * in README.txt.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#if defined(MM_HOST_SIMULATION)
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <time.h>
+#include "application/DisplayController/Test/DisplayPathBenchmark.h"
+#include "HAL/MemoryManager/MemoryManager.h"
+#include "HAL/LEDDriverInterface/LEDDriver.h"
+
+//------------------------------------ [ LOCAL FUNCTIONS ] --------------------------//
+//
+/**
+ * @brief Host clock in nanoseconds (wraps every 4.3 s, the benchmark only takes differences).
+ */
+static uint32_t HostClockNs(void)
+{
+    struct timespec sNow;
+
+    clock_gettime(CLOCK_MONOTONIC, &sNow);
+    return (uint32_t)(((uint64_t)sNow.tv_sec * 1000000000ULL) + (uint64_t)sNow.tv_nsec);
+}
+
+//------------------------------------ [ GLOBAL FUNCTIONS ] -------------------------//
+//
+int main(void)
+{
+    MM_Init();
+    LEDDriver_Init();
+    return (DisplayPathBenchmark_Run(HostClockNs, 1000000000UL) == 0U) ? 0 : 1;
+}
+
+#endif /* MM_HOST_SIMULATION */
@@ -0,0 +1,232 @@
+/**
+ * @file HostStubs.c
+ * @brief Host definitions of the SDK symbols the display path links against.
+ *
+ * Register blocks are plain structs and the driver calls do nothing, so LEDDriver,
+ * LEDScanChain, the FBM and the DisplayController sources build and run on a Linux host
+ * for the tests and benchmarks (see README.txt). The LVGL port is replaced as well: the
+ * host has no LVGL, the display profile only needs its buffer size and set-up calls. Of
+ * LVGL itself only the bundled LZ4 is built, for FBMDelta, on the libc memory functions.
+ * Only built with MM_HOST_SIMULATION.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#if defined(MM_HOST_SIMULATION)
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdarg.h>
+#include <stdio.h>
+#include "fsl_common.h"
+#include "fsl_lpspi_edma.h"
+#include "fsl_gpt.h"
+#include "fsl_dmamux.h"
+#include "peripherals.h"
+#include "Middleware/LogManager/LogManager.h"
+#include "HAL/MemoryManager/MemoryManager.h"
+#include "application/DisplayController/lvgl_support.h"
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define HOST_CORE_CLOCK_HZ      600000000UL     // RT1064 core clock
+#define HOST_PERCLK_HZ          37500000UL      // GPT2 clock of the board setup
+#define HOST_I1_PALETTE_BYTES   8U              // LVGL I1 palette: two 32-bit colours
+#define HOST_STRIP_DIVIDER      8U              // LV_PORT_STRIP_DIVIDER of lvgl_support.c
+
+//-------------------------------------[ GLOBALS ] ----------------------------------//
+//
+static GPIO_Type sGpio1;
+static DWT_Type sDwt;
+static CoreDebug_Type sCoreDebug;
+static LPSPI_Type sLpspi1;
+static LPSPI_Type sLpspi3;
+static DMA_Type sDma0;
+static GPT_Type sGpt2;
+static DMAMUX_Type sDmaMux;
+static void *pvHostDrawBuffer;      // LVGL port draw buffer
+
+GPIO_Type *GPIO1 = &sGpio1;
+DWT_Type *DWT = &sDwt;
+CoreDebug_Type *CoreDebug = &sCoreDebug;
+LPSPI_Type *LPSPI1 = &sLpspi1;
+LPSPI_Type *LPSPI3 = &sLpspi3;
+DMA_Type *DMA0 = &sDma0;
+GPT_Type *GPT2 = &sGpt2;
+DMAMUX_Type *DMAMUX = &sDmaMux;
+uint32_t SystemCoreClock = HOST_CORE_CLOCK_HZ;
+
+GPIO_HANDLE_DEFINE(BOARD_LPSPI1_LED_PINS_LED_LE_handle);
+GPIO_HANDLE_DEFINE(BOARD_LPSPI1_LED_PINS_LED_OE_handle);
+
+//------------------------------------[ CLOCK / IRQ ] -------------------------------//
+//
+uint32_t CLOCK_GetFreq(clock_name_t eName)
+{
+    return (eName == kCLOCK_PerClk) ? HOST_PERCLK_HZ : HOST_CORE_CLOCK_HZ;
+}
+
+void CLOCK_SetMux(clock_name_t eMux, uint32_t ulValue) { (void)eMux; (void)ulValue; }
+void CLOCK_SetDiv(clock_name_t eDivider, uint32_t ulValue) { (void)eDivider; (void)ulValue; }
+uint32_t DisableGlobalIRQ(void) { return 0U; }
+void EnableGlobalIRQ(uint32_t ulPrimask) { (void)ulPrimask; }
+status_t EnableIRQ(IRQn_Type eIrq) { (void)eIrq; return kStatus_Success; }
+void NVIC_SetPriority(IRQn_Type eIrq, uint32_t ulPriority) { (void)eIrq; (void)ulPriority; }
+
+//------------------------------------[ GPIO ] --------------------------------------//
+//
+int HAL_GpioSetOutput(void *pvHandle, uint8_t ubLevel) { (void)pvHandle; (void)ubLevel; return 0; }
+
+//------------------------------------[ LPSPI / EDMA ] ------------------------------//
+//
+void LPSPI_MasterGetDefaultConfig(lpspi_master_config_t *psConfig) { memset(psConfig, 0, sizeof(*psConfig)); }
+void LPSPI_MasterInit(LPSPI_Type *psBase, const lpspi_master_config_t *psConfig, uint32_t ulSourceClockHz)
+{
+    (void)psBase; (void)psConfig; (void)ulSourceClockHz;
+}
+void LPSPI_SetFifoWatermarks(LPSPI_Type *psBase, uint32_t ulTxWater, uint32_t ulRxWater)
+{
+    (void)psBase; (void)ulTxWater; (void)ulRxWater;
+}
+uint32_t LPSPI_GetTxRegisterAddress(LPSPI_Type *psBase) { return (uint32_t)(uintptr_t)&psBase->TDR; }
+void LPSPI_EnableDMA(LPSPI_Type *psBase, uint32_t ulMask) { (void)psBase; (void)ulMask; }
+
+void LPSPI_MasterTransferCreateHandleEDMA(LPSPI_Type *psBase, lpspi_master_edma_handle_t *psHandle,
+                                          lpspi_master_edma_transfer_callback_t pfnCallback, void *pvUserData,
+                                          edma_handle_t *psRxHandle, edma_handle_t *psTxHandle)
+{
+    (void)psBase; (void)psRxHandle; (void)psTxHandle;
+    psHandle->callback = pfnCallback;
+    psHandle->userData = pvUserData;
+}
+void LPSPI_MasterTransferPrepareEDMALite(LPSPI_Type *psBase, lpspi_master_edma_handle_t *psHandle,
+                                         uint32_t ulConfigFlags)
+{
+    (void)psBase; (void)psHandle; (void)ulConfigFlags;
+}
+status_t LPSPI_MasterTransferEDMALite(LPSPI_Type *psBase, lpspi_master_edma_handle_t *psHandle,
+                                      lpspi_transfer_t *psTransfer)
+{
+    (void)psBase; (void)psHandle; (void)psTransfer;
+    return kStatus_Success;
+}
+void LPSPI_MasterTransferAbortEDMA(LPSPI_Type *psBase, lpspi_master_edma_handle_t *psHandle)
+{
+    (void)psBase; (void)psHandle;
+}
+
+void EDMA_GetDefaultConfig(edma_config_t *psConfig) { memset(psConfig, 0, sizeof(*psConfig)); }
+void EDMA_Init(DMA_Type *psBase, const edma_config_t *psConfig) { (void)psBase; (void)psConfig; }
+void EDMA_EnableMinorLoopMapping(DMA_Type *psBase, bool bEnable) { (void)psBase; (void)bEnable; }
+void EDMA_CreateHandle(edma_handle_t *psHandle, DMA_Type *psBase, uint32_t ulChannel)
+{
+    memset(psHandle, 0, sizeof(*psHandle));
+    psHandle->base = psBase;
+    psHandle->channel = ulChannel;
+}
+void EDMA_SetCallback(edma_handle_t *psHandle, edma_callback pfnCallback, void *pvUserData)
+{
+    psHandle->callback = pfnCallback;
+    psHandle->userData = pvUserData;
+}
+void EDMA_InstallTCD(DMA_Type *psBase, uint32_t ulChannel, edma_tcd_t *psTcd)
+{
+    (void)psBase; (void)ulChannel; (void)psTcd;
+}
+void EDMA_EnableChannelRequest(DMA_Type *psBase, uint32_t ulChannel) { (void)psBase; (void)ulChannel; }
+void EDMA_AbortTransfer(edma_handle_t *psHandle) { (void)psHandle; }
+
+void DMAMUX_Init(DMAMUX_Type *psBase) { (void)psBase; }
+void DMAMUX_SetSource(DMAMUX_Type *psBase, uint32_t ulChannel, int32_t lSource)
+{
+    (void)psBase; (void)ulChannel; (void)lSource;
+}
+void DMAMUX_EnableChannel(DMAMUX_Type *psBase, uint32_t ulChannel) { (void)psBase; (void)ulChannel; }
+
+//------------------------------------[ GPT ] ---------------------------------------//
+//
+void GPT_GetDefaultConfig(gpt_config_t *psConfig) { memset(psConfig, 0, sizeof(*psConfig)); }
+void GPT_Init(GPT_Type *psBase, const gpt_config_t *psConfig) { (void)psBase; (void)psConfig; }
+void GPT_EnableInterrupts(GPT_Type *psBase, uint32_t ulMask) { (void)psBase; (void)ulMask; }
+void GPT_StartTimer(GPT_Type *psBase) { (void)psBase; }
+void GPT_StopTimer(GPT_Type *psBase) { (void)psBase; }
+void GPT_ClearStatusFlags(GPT_Type *psBase, uint32_t ulMask) { (void)psBase; (void)ulMask; }
+void GPT_SetOutputCompareValue(GPT_Type *psBase, gpt_output_compare_channel_t eChannel, uint32_t ulValue)
+{
+    (void)psBase; (void)eChannel; (void)ulValue;
+}
+
+//------------------------------------[ LOG MANAGER ] -------------------------------//
+//
+/**
+ * @brief Host LogManager: every message to stderr, so stdout stays the test report.
+ */
+void LogManager_Log(uint8_t eLevel, const char *pcFile, int lLine, const char *pcFmt, ...)
+{
+    va_list vaArgs;
+
+    fprintf(stderr, "[%u] %s:%d: ", eLevel, pcFile, lLine);
+    va_start(vaArgs, pcFmt);
+    vfprintf(stderr, pcFmt, vaArgs);
+    va_end(vaArgs);
+    fputc('\n', stderr);
+}
+
+//------------------------------------[ LVGL ] --------------------------------------//
+//
+void *lv_memcpy(void *pvDestination, const void *pvSource, size_t ulBytes)
+{
+    return memcpy(pvDestination, pvSource, ulBytes);
+}
+
+void *lv_memmove(void *pvDestination, const void *pvSource, size_t ulBytes)
+{
+    return memmove(pvDestination, pvSource, ulBytes);
+}
+
+void lv_memset(void *pvDestination, uint8_t ubValue, size_t ulBytes)
+{
+    (void)memset(pvDestination, ubValue, ulBytes);
+}
+
+//------------------------------------[ LVGL PORT ] ---------------------------------//
+//
+void lv_port_pre_init(void) { }
+
+/**
+ * @brief Draw buffer of the partial render mode the port builds with: the I1 palette
+ *        and a strip of 1/HOST_STRIP_DIVIDER of the screen rows.
+ */
+uint32_t lv_port_get_buffer_bytes(uint16_t width, uint16_t height)
+{
+    uint32_t ulRows = ((uint32_t)height + HOST_STRIP_DIVIDER - 1U) / HOST_STRIP_DIVIDER;
+
+    return HOST_I1_PALETTE_BYTES + ((((uint32_t)width + 7U) / 8U) * ulRows);
+}
+
+uint8_t lv_port_get_buffer_plan(uint16_t width, uint16_t height, sMMPlanEntry_t *entries)
+{
+    entries[0] = (sMMPlanEntry_t){ MM_PURPOSE_RENDER_TARGET, lv_port_get_buffer_bytes(width, height), 0U };
+    return 1U;
+}
+
+/**
+ * @brief Allocates the draw buffer as the port does, so memory budgets see it.
+ */
+bool lv_port_disp_init(uint16_t width, uint16_t height)
+{
+    lv_port_disp_deinit();
+    pvHostDrawBuffer = MM_Alloc(MM_PURPOSE_RENDER_TARGET, lv_port_get_buffer_bytes(width, height));
+    return (pvHostDrawBuffer != NULL);
+}
+
+void lv_port_disp_deinit(void)
+{
+    MM_Free(pvHostDrawBuffer);
+    pvHostDrawBuffer = NULL;
+}
+
+#endif /* MM_HOST_SIMULATION */
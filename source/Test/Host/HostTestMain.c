@@ -0,0 +1,89 @@
+/**
+ * @file HostTestMain.c
+ * @brief Host runner of the display path tests.
+ *
+ * Runs every table test and every benchmark in check mode (no clock) and prints the
+ * failures of each. Exits non-zero if any test fails. Build as given in README.txt.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#if defined(MM_HOST_SIMULATION)
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdio.h>
+#include "HAL/MemoryManager/MemoryManager.h"
+#include "HAL/MemoryManager/Test/MemoryManagerTest.h"
+#include "HAL/LEDDriverInterface/LEDDriver.h"
+#include "HAL/LEDDriverInterface/Test/LEDRefreshPlanTest.h"
+#include "HAL/LEDDriverInterface/Test/LEDBlankRowsBenchmark.h"
+#include "HAL/LEDDriverInterface/Test/LEDBrightnessTest.h"
+#include "HAL/LEDDriverInterface/Test/LEDBcmTest.h"
+#include "HAL/LEDDriverInterface/Test/LEDRowAddressTest.h"
+#include "HAL/LEDDriverInterface/Test/LEDScanChainTest.h"
+#include "HAL/LEDDriverInterface/Test/LEDGatherPlanTest.h"
+#include "HAL/LEDDriverInterface/Test/LEDPanelEmulatorTest.h"
+#include "Middleware/FrameBufferManager/Test/FBMTearingTest.h"
+#include "Middleware/FrameBufferManager/Test/FBMBitPlaneBenchmark.h"
+#include "Middleware/FrameBufferManager/Test/FBMBlitBenchmark.h"
+#include "Middleware/FrameBufferManager/Test/FBMDeltaTest.h"
+#include "application/DisplayController/Test/FlushConvertBenchmark.h"
+#include "application/DisplayController/Test/RenderModeBenchmark.h"
+#include "application/DisplayController/Test/FrameSchedulerTest.h"
+#include "application/DisplayController/Test/DisplayProfileTest.h"
+
+//-------------------------------------[ GLOBALS ] ----------------------------------//
+//
+static sLEDBlankBenchResult_t asBlankResults[LED_BLANK_BENCH_CASES];
+static sFBMBitPlaneBenchResult_t asBitPlaneResults[FBM_BITPLANE_BENCH_CASES];
+static sFBMBlitBenchResult_t asBlitResults[FBM_BLIT_BENCH_CASES];
+static sFlushBenchResult_t asFlushResults[FLUSH_BENCH_CASES];
+static sRenderBenchResult_t asRenderResults[RENDER_BENCH_CASES];
+
+//------------------------------------ [ LOCAL FUNCTIONS ] --------------------------//
+//
+/**
+ * @brief Prints the result of one test and adds its failures to the total.
+ */
+static uint32_t Report(const char *pcName, uint8_t ubFailures)
+{
+    printf("%-24s %s (%u failures)\n", pcName, (ubFailures == 0U) ? "PASS" : "FAIL", ubFailures);
+    return ubFailures;
+}
+
+//------------------------------------ [ GLOBAL FUNCTIONS ] -------------------------//
+//
+int main(void)
+{
+    uint32_t ulFailures = 0;
+
+    MM_Init();
+    // Re-registers every region: runs before anything is allocated
+    ulFailures += Report("MemoryManagerTest", MemoryManagerTest_Run());
+    LEDDriver_Init();
+
+    ulFailures += Report("LEDRefreshPlanTest", LEDRefreshPlanTest_Run());
+    ulFailures += Report("LEDBrightnessTest", LEDBrightnessTest_Run());
+    ulFailures += Report("LEDBcmTest", LEDBcmTest_Run());
+    ulFailures += Report("LEDRowAddressTest", LEDRowAddressTest_Run());
+    ulFailures += Report("LEDScanChainTest", LEDScanChainTest_Run());
+    ulFailures += Report("LEDGatherPlanTest", LEDGatherPlanTest_Run());
+    ulFailures += Report("LEDPanelEmulatorTest", LEDPanelEmulatorTest_Run());
+    ulFailures += Report("LEDBlankRowsBenchmark", LEDBlankRowsBenchmark_Run(NULL, asBlankResults));
+    ulFailures += Report("FBMTearingTest", FBMTearingTest_Run());
+    ulFailures += Report("FBMBitPlaneBenchmark", FBMBitPlaneBenchmark_Run(NULL, asBitPlaneResults));
+    ulFailures += Report("FBMBlitBenchmark", FBMBlitBenchmark_Run(NULL, 0, asBlitResults));
+    ulFailures += Report("FBMDeltaTest", FBMDeltaTest_Run());
+    ulFailures += Report("FlushConvertBenchmark", FlushConvertBenchmark_Run(NULL, asFlushResults));
+    ulFailures += Report("RenderModeBenchmark", RenderModeBenchmark_Run(NULL, asRenderResults));
+    ulFailures += Report("FrameSchedulerTest", FrameSchedulerTest_Run());
+    ulFailures += Report("DisplayProfileTest", DisplayProfileTest_Run());
+
+    return (ulFailures == 0U) ? 0 : 1;
+}
+
+#endif /* MM_HOST_SIMULATION */
@@ -0,0 +1,14 @@
+/**
+ * @file app.h
+ * @brief Host stand-in for the board application header (no PHY on the host).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef TEST_HOST_APP_H_
+#define TEST_HOST_APP_H_
+
+#endif /* TEST_HOST_APP_H_ */
@@ -0,0 +1,99 @@
+/**
+ * @file fsl_common.h
+ * @brief Host stand-in for the MCUXpresso SDK common header.
+ *
+ * Only what the display path sources use: status codes, clock queries, the GPIO, DWT and
+ * CoreDebug register blocks (plain structs in HostStubs.c), interrupt control as no-ops
+ * and the section/alignment macros.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef TEST_HOST_FSL_COMMON_H_
+#define TEST_HOST_FSL_COMMON_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define kStatus_Success                 0
+
+#define SDK_ALIGN(var, alignbytes)                      var __attribute__((aligned(alignbytes)))
+#define AT_NONCACHEABLE_SECTION(var)                    var
+#define AT_NONCACHEABLE_SECTION_ALIGN(var, alignbytes)  var __attribute__((aligned(alignbytes)))
+#define AT_QUICKACCESS_SECTION_DATA(var)                var
+#define AT_QUICKACCESS_SECTION_DATA_ALIGN(var, alignbytes) var __attribute__((aligned(alignbytes)))
+#define SDK_ISR_EXIT_BARRIER
+
+#define __DSB()
+#define __ISB()
+
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL << 0)
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef int32_t status_t;
+
+typedef enum {
+    kCLOCK_LpspiMux = 0,
+    kCLOCK_LpspiDiv,
+    kCLOCK_PerClk,
+} clock_name_t;
+
+typedef enum {
+    GPT2_IRQn = 101,
+} IRQn_Type;
+
+typedef struct {
+    volatile uint32_t DR;
+    volatile uint32_t GDIR;
+    volatile uint32_t PSR;
+    volatile uint32_t ICR1;
+    volatile uint32_t ICR2;
+    volatile uint32_t IMR;
+    volatile uint32_t ISR;
+    volatile uint32_t EDGE_SEL;
+    uint32_t          RESERVED_0[25];
+    volatile uint32_t DR_SET;
+    volatile uint32_t DR_CLEAR;
+    volatile uint32_t DR_TOGGLE;
+} GPIO_Type;
+
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+    volatile uint32_t LAR;
+} DWT_Type;
+
+typedef struct {
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+//-------------------------------------[ GLOBALS ] ----------------------------------//
+//
+extern GPIO_Type *GPIO1;
+extern DWT_Type *DWT;
+extern CoreDebug_Type *CoreDebug;
+extern uint32_t SystemCoreClock;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+uint32_t CLOCK_GetFreq(clock_name_t eName);
+void CLOCK_SetMux(clock_name_t eMux, uint32_t ulValue);
+void CLOCK_SetDiv(clock_name_t eDivider, uint32_t ulValue);
+
+uint32_t DisableGlobalIRQ(void);
+void EnableGlobalIRQ(uint32_t ulPrimask);
+status_t EnableIRQ(IRQn_Type eIrq);
+void NVIC_SetPriority(IRQn_Type eIrq, uint32_t ulPriority);
+
+#endif /* TEST_HOST_FSL_COMMON_H_ */
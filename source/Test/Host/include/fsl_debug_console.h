@@ -0,0 +1,18 @@
+/**
+ * @file fsl_debug_console.h
+ * @brief Host stand-in for the SDK debug console: PRINTF goes to stdout.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef TEST_HOST_FSL_DEBUG_CONSOLE_H_
+#define TEST_HOST_FSL_DEBUG_CONSOLE_H_
+
+#include <stdio.h>
+
+#define PRINTF  printf
+
+#endif /* TEST_HOST_FSL_DEBUG_CONSOLE_H_ */
@@ -0,0 +1,34 @@
+/**
+ * @file fsl_dmamux.h
+ * @brief Host stand-in for the SDK DMAMUX driver: no-op calls.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef TEST_HOST_FSL_DMAMUX_H_
+#define TEST_HOST_FSL_DMAMUX_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "fsl_common.h"
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef struct {
+    volatile uint32_t CHCFG[32];
+} DMAMUX_Type;
+
+//-------------------------------------[ GLOBALS ] ----------------------------------//
+//
+extern DMAMUX_Type *DMAMUX;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+void DMAMUX_Init(DMAMUX_Type *psBase);
+void DMAMUX_SetSource(DMAMUX_Type *psBase, uint32_t ulChannel, int32_t lSource);
+void DMAMUX_EnableChannel(DMAMUX_Type *psBase, uint32_t ulChannel);
+
+#endif /* TEST_HOST_FSL_DMAMUX_H_ */
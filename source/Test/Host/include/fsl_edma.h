@@ -0,0 +1,71 @@
+/**
+ * @file fsl_edma.h
+ * @brief Host stand-in for the SDK eDMA driver: types and no-op calls.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef TEST_HOST_FSL_EDMA_H_
+#define TEST_HOST_FSL_EDMA_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "fsl_common.h"
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef struct {
+    volatile uint32_t CR;
+} DMA_Type;
+
+typedef struct {
+    bool enableContinuousLinkMode;
+    bool enableHaltOnError;
+    bool enableRoundRobinArbitration;
+    bool enableDebugMode;
+} edma_config_t;
+
+typedef struct {
+    volatile uint32_t SADDR;
+    volatile uint16_t SOFF;
+    volatile uint16_t ATTR;
+    volatile uint32_t NBYTES;
+    volatile uint32_t SLAST;
+    volatile uint32_t DADDR;
+    volatile uint16_t DOFF;
+    volatile uint16_t CITER;
+    volatile uint32_t DLAST_SGA;
+    volatile uint16_t CSR;
+    volatile uint16_t BITER;
+} edma_tcd_t;
+
+typedef struct _edma_handle edma_handle_t;
+
+typedef void (*edma_callback)(edma_handle_t *handle, void *userData, bool transferDone, uint32_t tcds);
+
+struct _edma_handle {
+    edma_callback callback;
+    void *userData;
+    DMA_Type *base;
+    uint32_t channel;
+};
+
+//-------------------------------------[ GLOBALS ] ----------------------------------//
+//
+extern DMA_Type *DMA0;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+void EDMA_GetDefaultConfig(edma_config_t *psConfig);
+void EDMA_Init(DMA_Type *psBase, const edma_config_t *psConfig);
+void EDMA_EnableMinorLoopMapping(DMA_Type *psBase, bool bEnable);
+void EDMA_CreateHandle(edma_handle_t *psHandle, DMA_Type *psBase, uint32_t ulChannel);
+void EDMA_SetCallback(edma_handle_t *psHandle, edma_callback pfnCallback, void *pvUserData);
+void EDMA_InstallTCD(DMA_Type *psBase, uint32_t ulChannel, edma_tcd_t *psTcd);
+void EDMA_EnableChannelRequest(DMA_Type *psBase, uint32_t ulChannel);
+void EDMA_AbortTransfer(edma_handle_t *psHandle);
+
+#endif /* TEST_HOST_FSL_EDMA_H_ */
@@ -0,0 +1,63 @@
+/**
+ * @file fsl_gpt.h
+ * @brief Host stand-in for the SDK GPT driver: types and no-op calls.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef TEST_HOST_FSL_GPT_H_
+#define TEST_HOST_FSL_GPT_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "fsl_common.h"
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef struct {
+    volatile uint32_t CR;
+} GPT_Type;
+
+typedef enum {
+    kGPT_ClockSource_Off = 0,
+    kGPT_ClockSource_Periph,
+} gpt_clock_source_t;
+
+typedef struct {
+    gpt_clock_source_t clockSource;
+    uint32_t divider;
+    bool enableFreeRun;
+    bool enableRunInWait;
+    bool enableRunInStop;
+    bool enableRunInDoze;
+    bool enableRunInDbg;
+    bool enableMode;
+} gpt_config_t;
+
+enum {
+    kGPT_OutputCompare1InterruptEnable = (1U << 0),
+    kGPT_OutputCompare1Flag            = (1U << 0),
+};
+
+typedef enum {
+    kGPT_OutputCompare_Channel1 = 0,
+} gpt_output_compare_channel_t;
+
+//-------------------------------------[ GLOBALS ] ----------------------------------//
+//
+extern GPT_Type *GPT2;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+void GPT_GetDefaultConfig(gpt_config_t *psConfig);
+void GPT_Init(GPT_Type *psBase, const gpt_config_t *psConfig);
+void GPT_EnableInterrupts(GPT_Type *psBase, uint32_t ulMask);
+void GPT_StartTimer(GPT_Type *psBase);
+void GPT_StopTimer(GPT_Type *psBase);
+void GPT_ClearStatusFlags(GPT_Type *psBase, uint32_t ulMask);
+void GPT_SetOutputCompareValue(GPT_Type *psBase, gpt_output_compare_channel_t eChannel, uint32_t ulValue);
+
+#endif /* TEST_HOST_FSL_GPT_H_ */
@@ -0,0 +1,73 @@
+/**
+ * @file fsl_lpspi.h
+ * @brief Host stand-in for the SDK LPSPI driver: types and no-op calls.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef TEST_HOST_FSL_LPSPI_H_
+#define TEST_HOST_FSL_LPSPI_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "fsl_common.h"
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define LPSPI_TCR_RXMSK_MASK    (1UL << 19)
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef struct {
+    volatile uint32_t TCR;
+    volatile uint32_t TDR;
+    volatile uint32_t FCR;
+} LPSPI_Type;
+
+enum {
+    kLPSPI_TxDmaEnable = (1U << 0),
+    kLPSPI_RxDmaEnable = (1U << 1),
+};
+
+typedef enum {
+    kLPSPI_Pcs0 = 0,
+} lpspi_which_pcs_t;
+
+enum {
+    kLPSPI_MasterPcs0          = 0U,
+    kLPSPI_MasterPcsContinuous = (1U << 20),
+};
+
+typedef struct {
+    uint32_t baudRate;
+    uint32_t bitsPerFrame;
+    lpspi_which_pcs_t whichPcs;
+    uint32_t pcsToSckDelayInNanoSec;
+    uint32_t lastSckToPcsDelayInNanoSec;
+    uint32_t betweenTransferDelayInNanoSec;
+} lpspi_master_config_t;
+
+typedef struct {
+    uint8_t *txData;
+    uint8_t *rxData;
+    volatile size_t dataSize;
+    uint32_t configFlags;
+} lpspi_transfer_t;
+
+//-------------------------------------[ GLOBALS ] ----------------------------------//
+//
+extern LPSPI_Type *LPSPI1;
+extern LPSPI_Type *LPSPI3;
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+void LPSPI_MasterGetDefaultConfig(lpspi_master_config_t *psConfig);
+void LPSPI_MasterInit(LPSPI_Type *psBase, const lpspi_master_config_t *psConfig, uint32_t ulSourceClockHz);
+void LPSPI_SetFifoWatermarks(LPSPI_Type *psBase, uint32_t ulTxWater, uint32_t ulRxWater);
+uint32_t LPSPI_GetTxRegisterAddress(LPSPI_Type *psBase);
+void LPSPI_EnableDMA(LPSPI_Type *psBase, uint32_t ulMask);
+
+#endif /* TEST_HOST_FSL_LPSPI_H_ */
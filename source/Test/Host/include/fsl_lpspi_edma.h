@@ -0,0 +1,44 @@
+/**
+ * @file fsl_lpspi_edma.h
+ * @brief Host stand-in for the SDK LPSPI eDMA transfer layer.
+ *
+ * Transfers are accepted and dropped; the host tests drive the scan through their own HAL.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef TEST_HOST_FSL_LPSPI_EDMA_H_
+#define TEST_HOST_FSL_LPSPI_EDMA_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "fsl_lpspi.h"
+#include "fsl_edma.h"
+
+//-------------------------------------[ TYPEDEF ] ----------------------------------//
+//
+typedef struct _lpspi_master_edma_handle lpspi_master_edma_handle_t;
+
+typedef void (*lpspi_master_edma_transfer_callback_t)(LPSPI_Type *base, lpspi_master_edma_handle_t *handle,
+                                                      status_t status, void *userData);
+
+struct _lpspi_master_edma_handle {
+    lpspi_master_edma_transfer_callback_t callback;
+    void *userData;
+};
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+void LPSPI_MasterTransferCreateHandleEDMA(LPSPI_Type *psBase, lpspi_master_edma_handle_t *psHandle,
+                                          lpspi_master_edma_transfer_callback_t pfnCallback, void *pvUserData,
+                                          edma_handle_t *psRxHandle, edma_handle_t *psTxHandle);
+void LPSPI_MasterTransferPrepareEDMALite(LPSPI_Type *psBase, lpspi_master_edma_handle_t *psHandle,
+                                         uint32_t ulConfigFlags);
+status_t LPSPI_MasterTransferEDMALite(LPSPI_Type *psBase, lpspi_master_edma_handle_t *psHandle,
+                                      lpspi_transfer_t *psTransfer);
+void LPSPI_MasterTransferAbortEDMA(LPSPI_Type *psBase, lpspi_master_edma_handle_t *psHandle);
+
+#endif /* TEST_HOST_FSL_LPSPI_EDMA_H_ */
@@ -0,0 +1,47 @@
+/**
+ * @file peripherals.h
+ * @brief Host stand-in for the board peripherals: the LED connector pins.
+ *
+ * LE, OE and all five row address lines are on GPIO1, at the pins the panel emulator
+ * (LEDPanelEmulator) is given, so every scan rate up to 1/32 can be run on the host.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated,
+ * transmitted or assigned without the prior written authorization of
+ * Centum T&S Group.
+ */
+
+#ifndef TEST_HOST_PERIPHERALS_H_
+#define TEST_HOST_PERIPHERALS_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------//
+//
+#include "fsl_common.h"
+
+//-------------------------------------[ DEFINES ] ----------------------------------//
+//
+#define GPIO_HANDLE_DEFINE(name)    uint32_t name[4]
+
+#define BOARD_LPSPI1_LED_PINS_LED_LE_GPIO               GPIO1
+#define BOARD_LPSPI1_LED_PINS_LED_LE_GPIO_PIN_MASK      (1U << 2U)
+#define BOARD_LPSPI1_LED_PINS_LED_OE_GPIO               GPIO1
+#define BOARD_LPSPI1_LED_PINS_LED_OE_GPIO_PIN_MASK      (1U << 3U)
+#define BOARD_LPSPI1_LED_PINS_A0_GPIO                   GPIO1
+#define BOARD_LPSPI1_LED_PINS_A0_GPIO_PIN_MASK          (1U << 23U)
+#define BOARD_LPSPI1_LED_PINS_A1_GPIO_PIN_MASK          (1U << 22U)
+#define BOARD_LPSPI1_LED_PINS_A2_GPIO_PIN_MASK          (1U << 24U)
+#define BOARD_LPSPI1_LED_PINS_A3_GPIO_PIN_MASK          (1U << 25U)
+#define BOARD_LPSPI1_LED_PINS_A4_GPIO_PIN_MASK          (1U << 4U)
+#define BOARD_LPSPI1_LED_PINS_A3_PIN_DIRECTION          1U
+#define BOARD_LPSPI1_LED_PINS_A4_PIN_DIRECTION          1U
+
+//-------------------------------------[ GLOBALS ] ----------------------------------//
+//
+extern GPIO_HANDLE_DEFINE(BOARD_LPSPI1_LED_PINS_LED_LE_handle);
+extern GPIO_HANDLE_DEFINE(BOARD_LPSPI1_LED_PINS_LED_OE_handle);
+
+//-------------------------------------[ PROTOTYPES ] -------------------------------//
+//
+int HAL_GpioSetOutput(void *pvHandle, uint8_t ubLevel);
+
+#endif /* TEST_HOST_PERIPHERALS_H_ */
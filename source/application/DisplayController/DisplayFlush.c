@@ -0,0 +1,99 @@
+/**
+ * @file    DisplayFlush.c
+ * @brief   Conversion of rendered 1bpp areas into FBM frames.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+
+#include "application/DisplayController/DisplayFlush.h"
+#include "Middleware/FrameBufferManager/FrameBufferManager.h"
+#include "Middleware/FrameBufferManager/FBMBlit.h"
+
+//------------------------------------ [ GLOBAL FUNCTIONS ] -------------------------
+
+/**
+ * @brief Rounds the columns of an area out to whole FBM words.
+ *
+ * Used as the LVGL invalidate-area rounder: LVGL then merges the rounded areas and,
+ * in partial mode, renders them into strips that start on a word.
+ *
+ * @param psArea        Area to round, in place.
+ * @param usScreenWidth Screen width; the area is clipped to it.
+ */
+void DisplayFlush_RoundArea(sDisplayArea_t *psArea, uint16_t usScreenWidth)
+{
+    psArea->lX1 &= ~(int32_t)(DISPLAY_FLUSH_ALIGN_COLUMNS - 1);
+    psArea->lX2 |= (DISPLAY_FLUSH_ALIGN_COLUMNS - 1);
+
+    if (psArea->lX1 < 0)
+    {
+        psArea->lX1 = 0;
+    }
+    if (psArea->lX2 >= (int32_t)usScreenWidth)
+    {
+        psArea->lX2 = (int32_t)usScreenWidth - 1;
+    }
+}
+
+/**
+ * @brief Writes an area into a frame, inverted (index 0 lights the LED).
+ *
+ * Only the columns of the area are rewritten; the rows are marked dirty.
+ *
+ * @param ptubFrame     FBM render frame.
+ * @param usFrameStride Bytes per frame row.
+ * @param pubRowMap     Physical row of each screen row, NULL for the identity.
+ * @param psArea        Screen area to convert.
+ * @param psSource      Rendered pixels covering the area.
+ */
+void DisplayFlush_ConvertArea(uint8_t **ptubFrame, uint16_t usFrameStride, const uint8_t *pubRowMap,
+                              const sDisplayArea_t *psArea, const sDisplaySource_t *psSource)
+{
+    uint16_t usWidth = (uint16_t)(psArea->lX2 - psArea->lX1 + 1);
+    int16_t sSourceX = (int16_t)(psArea->lX1 - psSource->lX0);
+
+    for (int32_t lY = psArea->lY1; lY <= psArea->lY2; lY++)
+    {
+        uint16_t usRow = (NULL != pubRowMap) ? pubRowMap[lY] : (uint16_t)lY;
+        const uint8_t *pubSourceRow = psSource->pubPixels + ((uint32_t)(lY - psSource->lY0) * psSource->usStride);
+
+        // Only rows marked dirty are synchronised and re-packed by the LED driver
+        FBM_MarkRowsDirty(ptubFrame, usRow, usRow);
+        FBM_BlitRow(ptubFrame[usRow], usFrameStride, (int16_t)psArea->lX1,
+                    pubSourceRow, psSource->usStride, sSourceX, usWidth, FBM_BLIT_INVERT_COPY);
+    }
+}
+
+/**
+ * @brief Writes an area into an 8bpp gray frame, inverted (index 0 is full brightness).
+ *
+ * Gray counterpart of DisplayFlush_ConvertArea(): every pixel becomes 0xFF or 0x00, the
+ * values the bit-planes of the frame show as fully on and off.
+ *
+ * @param ptubFrame     FBM render frame, FBM_FORMAT_GRAY_8BPP.
+ * @param pubRowMap     Physical row of each screen row, NULL for the identity.
+ * @param psArea        Screen area to convert.
+ * @param psSource      Rendered pixels covering the area.
+ */
+void DisplayFlush_ConvertAreaGray8(uint8_t **ptubFrame, const uint8_t *pubRowMap,
+                                   const sDisplayArea_t *psArea, const sDisplaySource_t *psSource)
+{
+    for (int32_t lY = psArea->lY1; lY <= psArea->lY2; lY++)
+    {
+        uint16_t usRow = (NULL != pubRowMap) ? pubRowMap[lY] : (uint16_t)lY;
+        const uint8_t *pubSourceRow = psSource->pubPixels + ((uint32_t)(lY - psSource->lY0) * psSource->usStride);
+        uint8_t *pubDestination = ptubFrame[usRow];
+
+        FBM_MarkRowsDirty(ptubFrame, usRow, usRow);
+        for (int32_t lX = psArea->lX1; lX <= psArea->lX2; lX++)
+        {
+            int32_t lSourceX = lX - psSource->lX0;
+            uint8_t ubIndex = (uint8_t)((pubSourceRow[lSourceX >> 3] >> (7 - (lSourceX & 7))) & 0x01U);
+            pubDestination[lX] = (0U != ubIndex) ? 0x00U : 0xFFU;
+        }
+    }
+}
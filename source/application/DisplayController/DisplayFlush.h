@@ -0,0 +1,61 @@
+/**
+ * @file    DisplayFlush.h
+ * @brief   Conversion of rendered 1bpp areas into FBM frames.
+ *
+ * The LVGL port hands over an area of the screen and the pixels it was rendered into:
+ * either the whole screen (direct mode) or a strip buffer holding just the area (partial
+ * mode). Both are MSB first 1bpp with the palette already skipped. Areas are rounded out
+ * to whole FBM words first, so every row is converted with aligned 32 bit copies. Gray
+ * profiles get the same pixels expanded into 8bpp gray frames.
+ *
+ * No LVGL dependency: the benchmarks run it on the host.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+#ifndef DISPLAYCONTROLLER_DISPLAYFLUSH_H_
+#define DISPLAYCONTROLLER_DISPLAYFLUSH_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+#include <stdint.h>
+
+//------------------------------------ [ DEFINES ] ----------------------------------
+
+// Areas are rounded out to this many columns (one FBM blit word)
+#define DISPLAY_FLUSH_ALIGN_COLUMNS     32
+
+//------------------------------------ [ TYPEDEF ] ----------------------------------
+
+/**
+ * @brief Screen area, inclusive corners (as lv_area_t).
+ */
+typedef struct {
+    int32_t lX1;
+    int32_t lY1;
+    int32_t lX2;
+    int32_t lY2;
+} sDisplayArea_t;
+
+/**
+ * @brief Rendered pixels of an area.
+ */
+typedef struct {
+    const uint8_t *pubPixels;   // First row, palette skipped
+    uint16_t       usStride;    // Bytes per row
+    int32_t        lX0;         // Screen column of the first pixel of a row
+    int32_t        lY0;         // Screen row of the first row
+} sDisplaySource_t;
+
+//------------------------------------ [ PROTOTYPES ] -------------------------------
+
+void DisplayFlush_RoundArea(sDisplayArea_t *psArea, uint16_t usScreenWidth);
+
+void DisplayFlush_ConvertArea(uint8_t **ptubFrame, uint16_t usFrameStride, const uint8_t *pubRowMap,
+                              const sDisplayArea_t *psArea, const sDisplaySource_t *psSource);
+
+void DisplayFlush_ConvertAreaGray8(uint8_t **ptubFrame, const uint8_t *pubRowMap,
+                                   const sDisplayArea_t *psArea, const sDisplaySource_t *psSource);
+
+#endif /* DISPLAYCONTROLLER_DISPLAYFLUSH_H_ */
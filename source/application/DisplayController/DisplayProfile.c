@@ -0,0 +1,525 @@
+/**
+ * @file    DisplayProfile.c
+ * @brief   Geometry of the installed display, applied to FBM, LED driver and LVGL together.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+
+#include "application/DisplayController/DisplayProfile.h"
+#include "application/DisplayController/lvgl_support.h"
+#include "HAL/LEDDriverInterface/LEDDriver.h"
+#include "HAL/MemoryManager/MemoryManager.h"
+#include "Middleware/FrameBufferManager/FrameBufferManager.h"
+#include "Middleware/LogManager/LogManager.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+//------------------------------------ [ DEFINES ] ----------------------------------
+
+#define PROFILE_MAGIC_0     'D'
+#define PROFILE_MAGIC_1     'P'
+#define PROFILE_CRC_BYTES   (DISPLAY_PROFILE_RECORD_BYTES - 2U)
+
+// Frames, scan and draw buffers, and the margin
+#define PROFILE_MAX_PLAN_ENTRIES    (FBM_MAX_PLAN_ENTRIES + LED_MAX_PLAN_ENTRIES + LV_PORT_MAX_PLAN_ENTRIES + 1U)
+
+//------------------------------------ [ STATIC VARIABLE ] --------------------------
+
+static sDisplayProfile_t sActiveProfile;
+static uint8_t ubIsActive = 0;
+
+//------------------------------------ [ LOCAL PROTOTYPES ] -------------------------
+
+static uint16_t ComputeCrc(const uint8_t *pubData, uint16_t usLength);
+static uint16_t GetWidth(const sDisplayProfile_t *psProfile);
+static eFBMPixelFormat_t GetPixelFormat(const sDisplayProfile_t *psProfile);
+static uint8_t GetPlanes(const sDisplayProfile_t *psProfile);
+static uint32_t GetUnitNs(const sDisplayProfile_t *psProfile);
+static uint32_t SumPlan(const sMMPlanEntry_t *psEntries, uint8_t ubCount);
+static uint8_t ConfigureProfile(const sDisplayProfile_t *psProfile);
+static void ReleaseActive(void);
+static void LogBudget(const sDisplayProfile_t *psProfile, const sDisplayProfileBudget_t *psBudget);
+static void SetFrameSources(const sDisplayProfile_t *psProfile);
+static bool AcquireScanBitPlanes(sLEDBitPlaneSet_t *psPlanes, const uint32_t **ppulDirtyRows);
+
+//------------------------------------ [ GLOBAL FUNCTIONS ] -------------------------
+
+/**
+ * @brief Fills a profile with the built-in geometry (DISPLAY_PROFILE_DEFAULT_*).
+ */
+void DisplayProfile_GetDefault(sDisplayProfile_t *psProfile)
+{
+    psProfile->ubPanels = DISPLAY_PROFILE_DEFAULT_PANELS;
+    psProfile->usPanelRows = DISPLAY_PROFILE_DEFAULT_PANEL_ROWS;
+    psProfile->usPanelColumns = DISPLAY_PROFILE_DEFAULT_PANEL_COLUMNS;
+    psProfile->ubRowAddressBits = DISPLAY_PROFILE_DEFAULT_ADDRESS_BITS;
+    psProfile->ubDoubleSided = DISPLAY_PROFILE_DEFAULT_DOUBLE_SIDED;
+    psProfile->ubLedType = DISPLAY_PROFILE_DEFAULT_LED_TYPE;
+    psProfile->usRefreshHz = DISPLAY_PROFILE_DEFAULT_REFRESH_HZ;
+    psProfile->ubGrayPlanes = DISPLAY_PROFILE_DEFAULT_GRAY_PLANES;
+}
+
+/**
+ * @brief Checks that FBM, the LED driver and this board can take a geometry.
+ *
+ * Rows must split evenly over the scan addresses the board has lines for, and columns
+ * must be whole bytes so the 1bpp rows of FBM and LVGL line up. Gray frames are shown on
+ * the front face of a monochrome unit only.
+ *
+ * @return 1 if valid, 0 if not.
+ */
+uint8_t DisplayProfile_IsValid(const sDisplayProfile_t *psProfile)
+{
+    if ((psProfile == NULL) || (psProfile->ubPanels == 0) || (psProfile->usPanelColumns == 0) ||
+        ((psProfile->usPanelColumns % 8U) != 0) ||
+        (((uint32_t)psProfile->usPanelColumns * psProfile->ubPanels) > UINT16_MAX) ||
+        (psProfile->ubRowAddressBits == 0) || (psProfile->ubRowAddressBits > LED_ROW_ADDRESS_LINES) ||
+        (psProfile->usPanelRows == 0) || (psProfile->usPanelRows > FBM_MAX_ROWS) ||
+        (psProfile->ubDoubleSided > 1U) || (psProfile->ubLedType > 1U) ||
+        (psProfile->ubGrayPlanes > LED_BCM_MAX_PLANES) || (psProfile->ubGrayPlanes > FBM_BITPLANE_MAX_PLANES) ||
+        ((psProfile->ubGrayPlanes != 0) && ((psProfile->ubDoubleSided != 0) || (psProfile->ubLedType != 0))))
+    {
+        return 0;
+    }
+
+    uint16_t usAddresses = (uint16_t)(1U << psProfile->ubRowAddressBits);
+
+    return (((psProfile->usPanelRows % usAddresses) == 0) &&
+            ((psProfile->usPanelRows / usAddresses) <= LED_MAX_ROW_GROUPS)) ? 1U : 0U;
+}
+
+/**
+ * @brief Writes a profile as a DISPLAY_PROFILE_RECORD_BYTES record (see DisplayProfile.h).
+ */
+void DisplayProfile_Encode(const sDisplayProfile_t *psProfile, uint8_t *pubRecord)
+{
+    pubRecord[0] = PROFILE_MAGIC_0;
+    pubRecord[1] = PROFILE_MAGIC_1;
+    pubRecord[2] = DISPLAY_PROFILE_VERSION;
+    pubRecord[3] = psProfile->ubPanels;
+    pubRecord[4] = (uint8_t)(psProfile->usPanelRows >> 8);
+    pubRecord[5] = (uint8_t)psProfile->usPanelRows;
+    pubRecord[6] = (uint8_t)(psProfile->usPanelColumns >> 8);
+    pubRecord[7] = (uint8_t)psProfile->usPanelColumns;
+    pubRecord[8] = psProfile->ubRowAddressBits;
+    pubRecord[9] = psProfile->ubDoubleSided;
+    pubRecord[10] = psProfile->ubLedType;
+    pubRecord[11] = psProfile->ubGrayPlanes;
+    pubRecord[12] = (uint8_t)(psProfile->usRefreshHz >> 8);
+    pubRecord[13] = (uint8_t)psProfile->usRefreshHz;
+
+    uint16_t usCrc = ComputeCrc(pubRecord, PROFILE_CRC_BYTES);
+    pubRecord[14] = (uint8_t)(usCrc >> 8);
+    pubRecord[15] = (uint8_t)usCrc;
+}
+
+/**
+ * @brief Reads a profile record.
+ *
+ * @param pubRecord Record, as persisted or received.
+ * @param usLength  Bytes available at pubRecord.
+ * @param psProfile Returns the profile; untouched on failure.
+ * @return 1 on success, 0 if the record is short, corrupt, of another version or invalid.
+ */
+uint8_t DisplayProfile_Decode(const uint8_t *pubRecord, uint16_t usLength, sDisplayProfile_t *psProfile)
+{
+    sDisplayProfile_t sProfile;
+
+    if ((pubRecord == NULL) || (psProfile == NULL) || (usLength < DISPLAY_PROFILE_RECORD_BYTES) ||
+        (pubRecord[0] != PROFILE_MAGIC_0) || (pubRecord[1] != PROFILE_MAGIC_1) ||
+        (pubRecord[2] != DISPLAY_PROFILE_VERSION) ||
+        (ComputeCrc(pubRecord, PROFILE_CRC_BYTES) != (uint16_t)((pubRecord[14] << 8) | pubRecord[15])))
+    {
+        return 0;
+    }
+
+    sProfile.ubPanels = pubRecord[3];
+    sProfile.usPanelRows = (uint16_t)((pubRecord[4] << 8) | pubRecord[5]);
+    sProfile.usPanelColumns = (uint16_t)((pubRecord[6] << 8) | pubRecord[7]);
+    sProfile.ubRowAddressBits = pubRecord[8];
+    sProfile.ubDoubleSided = pubRecord[9];
+    sProfile.ubLedType = pubRecord[10];
+    sProfile.ubGrayPlanes = pubRecord[11];
+    sProfile.usRefreshHz = (uint16_t)((pubRecord[12] << 8) | pubRecord[13]);
+
+    if (DisplayProfile_IsValid(&sProfile) == 0)
+    {
+        return 0;
+    }
+
+    *psProfile = sProfile;
+    return 1;
+}
+
+/**
+ * @brief Computes the memory and refresh budget of a profile.
+ *
+ * Footprints come from FBM, the LED driver and the LVGL port for the pixel format and
+ * planes of the profile and their current buffer mode, frame header and scan mode. Memory is checked block by
+ * block with MM_CheckPlan(): every block against the regions its purpose may use, with
+ * headers, alignment and fragmentation, followed by DISPLAY_PROFILE_MEMORY_MARGIN for
+ * the rest of the system. The blocks of the active profile count as used;
+ * DisplayProfile_Apply() checks again once it has released them.
+ *
+ * @param psProfile Profile to check.
+ * @param psBudget  Returns the budget.
+ * @return 1 if the profile fits the memory and reaches its refresh rate, 0 if not or invalid.
+ */
+uint8_t DisplayProfile_CheckBudget(const sDisplayProfile_t *psProfile, sDisplayProfileBudget_t *psBudget)
+{
+    sMMPlanEntry_t asPlan[PROFILE_MAX_PLAN_ENTRIES];
+    sMMRegionStats_t sStats;
+    uint8_t ubFrameBlocks;
+    uint8_t ubDriverBlocks;
+    uint8_t ubPortBlocks;
+
+    if ((psBudget == NULL) || (DisplayProfile_IsValid(psProfile) == 0))
+    {
+        return 0;
+    }
+
+    // In allocation order: frames, scan, draw buffers
+    ubFrameBlocks = FBM_GetAllocationPlan(psProfile->usPanelRows, psProfile->usPanelColumns, psProfile->ubDoubleSided,
+                                          GetPixelFormat(psProfile), psProfile->ubPanels, GetPlanes(psProfile), asPlan);
+    ubDriverBlocks = LEDDriver_GetAllocationPlan(psProfile->usPanelRows, psProfile->usPanelColumns,
+                                                 psProfile->ubDoubleSided, psProfile->ubPanels,
+                                                 psProfile->ubRowAddressBits, GetPlanes(psProfile),
+                                                 &asPlan[ubFrameBlocks]);
+    ubPortBlocks = lv_port_get_buffer_plan(GetWidth(psProfile), psProfile->usPanelRows,
+                                           &asPlan[ubFrameBlocks + ubDriverBlocks]);
+    psBudget->ubBlocks = (uint8_t)(ubFrameBlocks + ubDriverBlocks + ubPortBlocks);
+    asPlan[psBudget->ubBlocks].ePurpose = MM_PURPOSE_GENERAL;
+    asPlan[psBudget->ubBlocks].ulSize = DISPLAY_PROFILE_MEMORY_MARGIN;
+    asPlan[psBudget->ubBlocks].ulAlignment = 0;
+    psBudget->ubBlocks++;
+
+    psBudget->ulFrameBytes = SumPlan(asPlan, ubFrameBlocks);
+    psBudget->ulDriverBytes = SumPlan(&asPlan[ubFrameBlocks], ubDriverBlocks);
+    psBudget->ulPortBytes = SumPlan(&asPlan[ubFrameBlocks + ubDriverBlocks], ubPortBlocks);
+    psBudget->ulRequiredBytes = psBudget->ulFrameBytes + psBudget->ulDriverBytes + psBudget->ulPortBytes +
+                                DISPLAY_PROFILE_MEMORY_MARGIN;
+
+    psBudget->ulAvailableBytes = 0;
+    for (uint8_t ubRegion = 0; ubRegion < MM_REGION_COUNT; ubRegion++)
+    {
+        if (MM_GetRegionStats((eMMRegion_t)ubRegion, &sStats) != 0)
+        {
+            psBudget->ulAvailableBytes += sStats.ulTotalBytes - sStats.ulUsedBytes;
+        }
+    }
+
+    psBudget->ubPlacedBlocks = MM_CheckPlan(asPlan, psBudget->ubBlocks);
+    psBudget->ubFitsMemory = ((ubFrameBlocks != 0) && (ubDriverBlocks != 0) &&
+                              (psBudget->ubPlacedBlocks == psBudget->ubBlocks)) ? 1U : 0U;
+    psBudget->ubFitsRefresh = LEDDriver_CheckRefreshBudget(psProfile->usPanelRows, psProfile->usPanelColumns,
+                                                           psProfile->ubPanels, psProfile->ubRowAddressBits,
+                                                           GetPlanes(psProfile), GetUnitNs(psProfile),
+                                                           psProfile->usRefreshHz,
+                                                           &psBudget->sRefresh);
+
+    return ((psBudget->ubFitsMemory != 0) && (psBudget->ubFitsRefresh != 0)) ? 1U : 0U;
+}
+
+/**
+ * @brief Configures FBM, the LED driver and the LVGL display for a profile.
+ *
+ * A profile that misses its refresh rate is rejected before anything is touched, and so
+ * is one that does not fit the memory when no profile is active. Otherwise the scan is
+ * stopped and the active configuration released: the LVGL display is recreated, so
+ * screens built on the old one are gone. If the profile then does not fit or fails to
+ * configure, the previous profile is configured again. Call LEDDriver_StartScan()
+ * afterwards; the scan frame sources are set for the pixel format of the profile.
+ *
+ * @param psProfile Profile to apply.
+ * @param psBudget  Returns the budget; may be NULL.
+ * @return 1 on success, 0 if rejected or the configuration failed (the previous profile,
+ *         if any, is then active again).
+ */
+uint8_t DisplayProfile_Apply(const sDisplayProfile_t *psProfile, sDisplayProfileBudget_t *psBudget)
+{
+    sDisplayProfileBudget_t sBudget;
+    sDisplayProfile_t sPrevious = sActiveProfile;
+    uint8_t ubHadPrevious = ubIsActive;
+
+    if (DisplayProfile_IsValid(psProfile) == 0)
+    {
+        COSLOG_ERROR("DisplayProfile: Invalid geometry.\n");
+        return 0;
+    }
+
+    // What the active profile holds is only known free once it is released
+    uint8_t ubFits = DisplayProfile_CheckBudget(psProfile, &sBudget);
+    if ((ubFits == 0) && ((sBudget.ubFitsRefresh == 0) || (ubIsActive == 0)))
+    {
+        if (psBudget != NULL)
+        {
+            *psBudget = sBudget;
+        }
+        LogBudget(psProfile, &sBudget);
+        return 0;
+    }
+
+    ReleaseActive();
+    if (ubFits == 0)
+    {
+        ubFits = DisplayProfile_CheckBudget(psProfile, &sBudget);
+    }
+    if (psBudget != NULL)
+    {
+        *psBudget = sBudget;
+    }
+
+    if ((ubFits != 0) && (ConfigureProfile(psProfile) != 0))
+    {
+        sActiveProfile = *psProfile;
+        ubIsActive = 1;
+        return 1;
+    }
+    LogBudget(psProfile, &sBudget);
+
+    if ((ubHadPrevious != 0) && (ConfigureProfile(&sPrevious) != 0))
+    {
+        COSLOG_WARN("DisplayProfile: Previous profile restored.\n");
+        sActiveProfile = sPrevious;
+        ubIsActive = 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Applies the persisted profile at boot, or the built-in one.
+ *
+ * The built-in profile is used when there is no record, it does not decode or it is
+ * rejected. FBM must not be initialized yet.
+ *
+ * @param pubRecord Persisted record, NULL if there is none.
+ * @param usLength  Bytes available at pubRecord.
+ * @return 1 if a profile is active, 0 if even the built-in one failed.
+ */
+uint8_t DisplayProfile_Boot(const uint8_t *pubRecord, uint16_t usLength)
+{
+    sDisplayProfile_t sProfile;
+
+    // Lays the frames out for LVGL when it draws into them directly
+    lv_port_pre_init();
+
+    if ((DisplayProfile_Decode(pubRecord, usLength, &sProfile) != 0) && (DisplayProfile_Apply(&sProfile, NULL) != 0))
+    {
+        return 1;
+    }
+    if (pubRecord != NULL)
+    {
+        COSLOG_WARN("DisplayProfile: Persisted profile not used, falling back to the built-in one.\n");
+    }
+
+    DisplayProfile_GetDefault(&sProfile);
+    return DisplayProfile_Apply(&sProfile, NULL);
+}
+
+/**
+ * @brief Gets the profile the display is configured for.
+ * @return Active profile, or NULL if none was applied.
+ */
+const sDisplayProfile_t *DisplayProfile_GetActive(void)
+{
+    return (ubIsActive != 0) ? &sActiveProfile : NULL;
+}
+
+//------------------------------------ [ LOCAL FUNCTIONS ] --------------------------
+
+/**
+ * @brief CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF).
+ */
+static uint16_t ComputeCrc(const uint8_t *pubData, uint16_t usLength)
+{
+    uint16_t usCrc = 0xFFFFU;
+
+    for (uint16_t usIndex = 0; usIndex < usLength; usIndex++)
+    {
+        usCrc ^= (uint16_t)(pubData[usIndex] << 8);
+        for (uint8_t ubBit = 0; ubBit < 8U; ubBit++)
+        {
+            usCrc = ((usCrc & 0x8000U) != 0) ? (uint16_t)((usCrc << 1) ^ 0x1021U) : (uint16_t)(usCrc << 1);
+        }
+    }
+    return usCrc;
+}
+
+/**
+ * @brief Width of the whole panel chain in pixels.
+ */
+static uint16_t GetWidth(const sDisplayProfile_t *psProfile)
+{
+    return (uint16_t)(psProfile->usPanelColumns * psProfile->ubPanels);
+}
+
+/**
+ * @brief FBM pixel format of a profile: 8bpp gray when it has gray planes.
+ */
+static eFBMPixelFormat_t GetPixelFormat(const sDisplayProfile_t *psProfile)
+{
+    if (psProfile->ubGrayPlanes != 0)
+    {
+        return FBM_FORMAT_GRAY_8BPP;
+    }
+    return (psProfile->ubLedType != 0) ? FBM_FORMAT_RGB888 : FBM_FORMAT_MONO_1BPP;
+}
+
+/**
+ * @brief Bit-planes of a profile, in FBM and in the scan alike: one for 1bpp frames.
+ */
+static uint8_t GetPlanes(const sDisplayProfile_t *psProfile)
+{
+    return (psProfile->ubGrayPlanes != 0) ? psProfile->ubGrayPlanes : 1U;
+}
+
+/**
+ * @brief Shortest OE time of plane 0 for a profile: the planes of a white pixel together
+ *        stay lit as long as one 1bpp plane.
+ */
+static uint32_t GetUnitNs(const sDisplayProfile_t *psProfile)
+{
+    return LED_BCM_DEFAULT_UNIT_NS / ((1UL << GetPlanes(psProfile)) - 1U);
+}
+
+/**
+ * @brief Bytes of the blocks of a plan.
+ */
+static uint32_t SumPlan(const sMMPlanEntry_t *psEntries, uint8_t ubCount)
+{
+    uint32_t ulBytes = 0;
+
+    for (uint8_t ubEntry = 0; ubEntry < ubCount; ubEntry++)
+    {
+        ulBytes += psEntries[ubEntry].ulSize;
+    }
+    return ulBytes;
+}
+
+/**
+ * @brief Configures FBM, the LED driver and the LVGL display; 1 on success.
+ *
+ * FBM and the scan get their plane count from the profile alone. On failure whatever was
+ * configured is released again.
+ */
+static uint8_t ConfigureProfile(const sDisplayProfile_t *psProfile)
+{
+    sLEDScanPattern_t sPattern;
+    uint8_t ubPlanes = GetPlanes(psProfile);
+
+    if ((FBM_SetPixelFormat(GetPixelFormat(psProfile)) == 0) || (FBM_SetGrayPlanes(ubPlanes) == 0) ||
+        (LEDDriver_SetBitPlanes(ubPlanes, GetUnitNs(psProfile)) == 0))
+    {
+        COSLOG_ERROR("DisplayProfile: %u bit-planes not possible in this scan mode.\n", ubPlanes);
+        return 0;
+    }
+
+    if (FBM_Init(psProfile->usPanelRows, psProfile->usPanelColumns, psProfile->ubDoubleSided,
+                 psProfile->ubLedType, psProfile->ubPanels) == 0)
+    {
+        return 0;
+    }
+
+    LEDDriver_GetDefaultScanPattern(&sPattern, psProfile->ubRowAddressBits);
+    if (LEDDriver_ConfigurePanelPattern(psProfile->usPanelRows, psProfile->usPanelColumns, psProfile->ubDoubleSided,
+                                        psProfile->ubLedType, psProfile->ubPanels, &sPattern) == 0)
+    {
+        FBM_DeinitializeSystem(psProfile->usPanelRows);
+        return 0;
+    }
+    LEDDriver_SetRefreshRate(psProfile->usRefreshHz);
+
+    // Gray frames: FBM lays its bit-planes out as the scan payloads where the pattern allows
+    if (psProfile->ubGrayPlanes != 0)
+    {
+        uint16_t ausRowOrder[FBM_MAX_ROWS];
+        if (LEDDriver_GetStreamRowOrder(ausRowOrder, psProfile->usPanelRows) != 0)
+        {
+            (void)FBM_SetScanRowOrder(ausRowOrder);
+        }
+    }
+
+    if (!lv_port_disp_init(GetWidth(psProfile), psProfile->usPanelRows))
+    {
+        LEDDriver_ReleasePanel();
+        FBM_DeinitializeSystem(psProfile->usPanelRows);
+        return 0;
+    }
+    SetFrameSources(psProfile);
+    return 1;
+}
+
+/**
+ * @brief Points the scan at the FBM frames of the profile: the latest complete frame, or
+ *        its bit-planes for gray frames.
+ */
+static void SetFrameSources(const sDisplayProfile_t *psProfile)
+{
+    if (psProfile->ubGrayPlanes != 0)
+    {
+        LEDDriver_SetBitPlaneSource(AcquireScanBitPlanes);
+    }
+    else
+    {
+        LEDDriver_SetBitPlaneSource(NULL);
+        LEDDriver_SetFrameSource(FBM_AcquireScanBuffer);
+        LEDDriver_SetRearFrameSource(FBM_GetActiveRearBuffer);
+    }
+}
+
+/**
+ * @brief Scan frame source for gray frames: the FBM bit-planes of the latest complete frame.
+ *
+ * Planes in the scan's row order are shifted as they are (see FBM_SetScanRowOrder()).
+ */
+static bool AcquireScanBitPlanes(sLEDBitPlaneSet_t *psPlanes, const uint32_t **ppulDirtyRows)
+{
+    bool bIsNewFrame = false;
+    const sFBMBitPlaneFrame_t *psFrame = FBM_AcquireScanBitPlanes(&bIsNewFrame, ppulDirtyRows);
+
+    if ((psFrame == NULL) || !bIsNewFrame)
+    {
+        return false;
+    }
+
+    for (uint8_t ubPlane = 0; ubPlane < psFrame->ubPlanes; ubPlane++)
+    {
+        psPlanes->apubPlanes[ubPlane] = FBM_BitPlaneGetPlane(psFrame, ubPlane);
+    }
+    psPlanes->ubPlanes = psFrame->ubPlanes;
+    psPlanes->usStride = psFrame->usStride;
+    psPlanes->bStreamOrder = (psFrame->pusRowOrder != NULL);
+    return true;
+}
+
+/**
+ * @brief Stops the scan and frees the display, the scan and the frames of the active profile.
+ */
+static void ReleaseActive(void)
+{
+    // The display first: it may draw into the frames
+    LEDDriver_StopScan();
+    lv_port_disp_deinit();
+    if (ubIsActive != 0)
+    {
+        FBM_DeinitializeSystem(sActiveProfile.usPanelRows);
+        LEDDriver_ReleasePanel();
+        ubIsActive = 0;
+    }
+}
+
+/**
+ * @brief Logs why a profile was not applied.
+ */
+static void LogBudget(const sDisplayProfile_t *psProfile, const sDisplayProfileBudget_t *psBudget)
+{
+    COSLOG_ERROR("DisplayProfile: %ux%u needs %lu bytes (%u of %u blocks placed, %lu free), "
+                 "refresh short by %lu mHz.\n",
+                 GetWidth(psProfile), psProfile->usPanelRows, (unsigned long)psBudget->ulRequiredBytes,
+                 psBudget->ubPlacedBlocks, psBudget->ubBlocks, (unsigned long)psBudget->ulAvailableBytes,
+                 (unsigned long)psBudget->sRefresh.ulShortfallMilliHz);
+}
@@ -0,0 +1,109 @@
+/**
+ * @file    DisplayProfile.h
+ * @brief   Geometry of the installed display, applied to FBM, LED driver and LVGL together.
+ *
+ * One profile describes the panel chain: panels, rows and columns of one panel, row
+ * address lines, faces, LED type, gray depth and scan refresh rate. DisplayProfile_Apply()
+ * checks that the frames, scan payloads and LVGL draw buffer fit the memory manager and
+ * that the scan reaches the refresh rate, then configures FBM, the LED driver and the LVGL
+ * display from the same numbers, so they can no longer disagree. The gray depth sets both
+ * the FBM pixel format and bit-planes and the planes the scan shows.
+ *
+ * Profiles are exchanged as a 16 byte record, big-endian as EMP:
+ *
+ *   0  'D' 'P'         magic
+ *   2  version         DISPLAY_PROFILE_VERSION
+ *   3  panels
+ *   4  panel rows      (16 bit)
+ *   6  panel columns   (16 bit)
+ *   8  row address bits
+ *   9  double sided    (0/1)
+ *   10 LED type        (0 - mono, 1 - RGB)
+ *   11 gray planes     (0 - 1bpp frames, 1..8 - 8bpp gray frames shown with that many bit-planes)
+ *   12 refresh Hz      (16 bit, 0 - as fast as possible)
+ *   14 CRC-16/CCITT    (16 bit, over bytes 0..13)
+ *
+ * The same record is the persisted configuration and the payload of a configuration
+ * message.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+#ifndef DISPLAYCONTROLLER_DISPLAYPROFILE_H_
+#define DISPLAYCONTROLLER_DISPLAYPROFILE_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+#include <stdint.h>
+#include "HAL/LEDDriverInterface/LEDRefreshPlan.h"
+
+//------------------------------------ [ DEFINES ] ----------------------------------
+
+// Built-in profile: the two 64x16 modules this board ships with, 1/8 scan
+#define DISPLAY_PROFILE_DEFAULT_PANELS          2U
+#define DISPLAY_PROFILE_DEFAULT_PANEL_ROWS      16U
+#define DISPLAY_PROFILE_DEFAULT_PANEL_COLUMNS   64U
+#define DISPLAY_PROFILE_DEFAULT_ADDRESS_BITS    3U
+#define DISPLAY_PROFILE_DEFAULT_DOUBLE_SIDED    0U
+#define DISPLAY_PROFILE_DEFAULT_LED_TYPE        0U
+#define DISPLAY_PROFILE_DEFAULT_REFRESH_HZ      120U
+#define DISPLAY_PROFILE_DEFAULT_GRAY_PLANES     0U
+
+#define DISPLAY_PROFILE_RECORD_BYTES            16U
+#define DISPLAY_PROFILE_VERSION                 1U
+
+// Kept free for the rest of the system: budgeted as one general block after the display's
+#define DISPLAY_PROFILE_MEMORY_MARGIN           1024U
+
+//------------------------------------ [ TYPEDEF ] ----------------------------------
+
+/**
+ * @brief Display geometry and scan rate.
+ */
+typedef struct {
+    uint8_t  ubPanels;              // Panels connected serially
+    uint16_t usPanelRows;           // Rows of one panel
+    uint16_t usPanelColumns;        // Columns of one panel
+    uint8_t  ubRowAddressBits;      // Row address lines used (scan rate 2^bits)
+    uint8_t  ubDoubleSided;         // 0 - single sided, 1 - double sided
+    uint8_t  ubLedType;             // 0 - monochrome, 1 - RGB
+    uint16_t usRefreshHz;           // Scan cycles per second (0 - as fast as possible)
+    uint8_t  ubGrayPlanes;          // 0 - 1bpp frames, else gray frames shown with that many bit-planes
+} sDisplayProfile_t;
+
+/**
+ * @brief Memory and refresh budget of a profile.
+ */
+typedef struct {
+    uint32_t ulFrameBytes;          // FBM frames
+    uint32_t ulDriverBytes;         // LED driver payloads, packing plan and eDMA chain
+    uint32_t ulPortBytes;           // LVGL draw buffers
+    uint32_t ulRequiredBytes;       // Sum of the above and DISPLAY_PROFILE_MEMORY_MARGIN
+    uint32_t ulAvailableBytes;      // Free bytes of all regions, for the log; the fit is per block
+    uint8_t  ubBlocks;              // Blocks of the allocation plan, margin included
+    uint8_t  ubPlacedBlocks;        // Leading blocks the memory manager can place now
+    sLEDRefreshPlan_t sRefresh;     // Scan timing; ulShortfallMilliHz if the rate is missed
+    uint8_t  ubFitsMemory;
+    uint8_t  ubFitsRefresh;
+} sDisplayProfileBudget_t;
+
+//------------------------------------ [ PROTOTYPES ] -------------------------------
+
+void DisplayProfile_GetDefault(sDisplayProfile_t *psProfile);
+
+uint8_t DisplayProfile_IsValid(const sDisplayProfile_t *psProfile);
+
+void DisplayProfile_Encode(const sDisplayProfile_t *psProfile, uint8_t *pubRecord);
+
+uint8_t DisplayProfile_Decode(const uint8_t *pubRecord, uint16_t usLength, sDisplayProfile_t *psProfile);
+
+uint8_t DisplayProfile_CheckBudget(const sDisplayProfile_t *psProfile, sDisplayProfileBudget_t *psBudget);
+
+uint8_t DisplayProfile_Apply(const sDisplayProfile_t *psProfile, sDisplayProfileBudget_t *psBudget);
+
+uint8_t DisplayProfile_Boot(const uint8_t *pubRecord, uint16_t usLength);
+
+const sDisplayProfile_t *DisplayProfile_GetActive(void);
+
+#endif /* DISPLAYCONTROLLER_DISPLAYPROFILE_H_ */
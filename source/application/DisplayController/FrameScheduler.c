@@ -0,0 +1,301 @@
+/**
+ * @file    FrameScheduler.c
+ * @brief   Render and publish pacing of the display, decoupled from the main loop speed.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+
+#include "application/DisplayController/FrameScheduler.h"
+#include <string.h>
+
+//------------------------------------ [ LOCAL PROTOTYPES ] -------------------------
+
+static void AccountFrames(sFrameScheduler_t *psScheduler, uint32_t ulStartUs, uint32_t ulEndUs);
+static void MeasureLatency(sFrameScheduler_t *psScheduler, uint32_t ulNowUs);
+static bool IsPublishDue(const sFrameScheduler_t *psScheduler, uint32_t ulNowUs, uint32_t ulNextCheckUs);
+static void Publish(sFrameScheduler_t *psScheduler);
+static bool PredictVsync(const sFrameScheduler_t *psScheduler, uint32_t ulNowUs, uint32_t *pulCount,
+                         uint32_t *pulVsyncUs);
+static void ReadVsync(const sFrameScheduler_t *psScheduler, uint32_t *pulCount, uint32_t *pulVsyncUs,
+                      uint32_t *pulPeriodUs);
+
+//------------------------------------ [ GLOBAL FUNCTIONS ] -------------------------
+
+/**
+ * @brief Initializes a scheduler; the first render is due at the first FrameScheduler_Process().
+ *
+ * Call before the tick and scan interrupts are routed to it.
+ *
+ * @param psScheduler Scheduler.
+ * @param psHal       Operations; kept by reference.
+ * @param ulRenderHz  Renders per second (0 - at every FrameScheduler_Process()).
+ */
+void FrameScheduler_Init(sFrameScheduler_t *psScheduler, const sFrameSchedulerHal_t *psHal, uint32_t ulRenderHz)
+{
+    memset(psScheduler, 0, sizeof(*psScheduler));
+    psScheduler->psHal = psHal;
+    psScheduler->ulTickUs = psHal->pfnGetTimeUs();
+    psScheduler->ulNextRenderUs = psScheduler->ulTickUs;
+    psScheduler->ulLastCheckUs = psScheduler->ulTickUs;
+    psScheduler->ulCompletedFrames = psHal->pfnGetCompletedFrames();
+    FrameScheduler_SetRenderRate(psScheduler, ulRenderHz);
+}
+
+/**
+ * @brief Sets the render rate; takes effect after the next render.
+ *
+ * @param ulRenderHz Renders per second (0 - at every FrameScheduler_Process()).
+ */
+void FrameScheduler_SetRenderRate(sFrameScheduler_t *psScheduler, uint32_t ulRenderHz)
+{
+    psScheduler->ulRenderPeriodUs = (ulRenderHz != 0) ? (1000000UL / ulRenderHz) : 0U;
+}
+
+/**
+ * @brief Tick interrupt: advances the renderer tick by the whole milliseconds elapsed.
+ *
+ * The fraction of a millisecond is carried to the next call, so the tick follows real
+ * time even if the interrupt is delayed or its period is not exactly 1 ms.
+ */
+void FrameScheduler_OnTick(sFrameScheduler_t *psScheduler)
+{
+    uint32_t ulElapsedUs = psScheduler->psHal->pfnGetTimeUs() - psScheduler->ulTickUs;
+
+    if (ulElapsedUs >= 1000U)
+    {
+        uint32_t ulMs = ulElapsedUs / 1000U;
+
+        psScheduler->psHal->pfnAdvanceTick(ulMs);
+        psScheduler->ulTickUs += ulMs * 1000U;
+        psScheduler->ulTicksMs += ulMs;
+    }
+}
+
+/**
+ * @brief Scan interrupt: a scan cycle starts (vsync) and picks up the latest published frame.
+ */
+void FrameScheduler_OnScanCycleStart(sFrameScheduler_t *psScheduler)
+{
+    uint32_t ulNow = psScheduler->psHal->pfnGetTimeUs();
+
+    if (psScheduler->ulVsyncCount != 0)
+    {
+        psScheduler->ulScanPeriodUs = ulNow - psScheduler->ulVsyncUs;
+    }
+    psScheduler->ulVsyncUs = ulNow;
+
+    // Written last: the main loop re-reads the state until the count is stable
+    psScheduler->ulVsyncCount++;
+}
+
+/**
+ * @brief Main loop: publishes a held frame when its vsync is near and renders when due.
+ *
+ * Never blocks; call as often as the loop allows. Render periods that passed while the
+ * loop or a render was busy are skipped (not caught up), keeping the render phase.
+ */
+void FrameScheduler_Process(sFrameScheduler_t *psScheduler)
+{
+    const sFrameSchedulerHal_t *psHal = psScheduler->psHal;
+    uint32_t ulNow = psHal->pfnGetTimeUs();
+    bool bRenderDue = ((int32_t)(ulNow - psScheduler->ulNextRenderUs) >= 0);
+
+    MeasureLatency(psScheduler, ulNow);
+
+    // Before a render the next check comes after it
+    uint32_t ulNextCheckUs = psScheduler->ulLoopLatencyUs;
+    if (bRenderDue)
+    {
+        const sFrameSchedulerStats_t *psStats = &psScheduler->sStats;
+        uint32_t ulRenderUs = (psStats->ulLastRenderUs > psStats->ulAverageRenderUs) ?
+                              psStats->ulLastRenderUs : psStats->ulAverageRenderUs;
+
+        ulNextCheckUs = (ulRenderUs > ulNextCheckUs) ? ulRenderUs : ulNextCheckUs;
+    }
+    if (psScheduler->bFrameHeld && IsPublishDue(psScheduler, ulNow, ulNextCheckUs))
+    {
+        Publish(psScheduler);
+    }
+
+    if (!bRenderDue)
+    {
+        psScheduler->ulLastCheckUs = ulNow;
+        return;
+    }
+
+    (void)psHal->pfnRender();
+    uint32_t ulEnd = psHal->pfnGetTimeUs();
+
+    AccountFrames(psScheduler, ulNow, ulEnd);
+
+    if (psScheduler->ulRenderPeriodUs == 0)
+    {
+        psScheduler->ulNextRenderUs = ulEnd;
+    }
+    else
+    {
+        psScheduler->ulNextRenderUs += psScheduler->ulRenderPeriodUs;
+        if ((int32_t)(ulEnd - psScheduler->ulNextRenderUs) >= 0)
+        {
+            uint32_t ulMissed = ((ulEnd - psScheduler->ulNextRenderUs) / psScheduler->ulRenderPeriodUs) + 1U;
+
+            psScheduler->sStats.ulSkippedRenders += ulMissed;
+            psScheduler->ulNextRenderUs += ulMissed * psScheduler->ulRenderPeriodUs;
+        }
+    }
+
+    // A frame completed close to its vsync goes out now rather than at the next call
+    if (psScheduler->bFrameHeld && IsPublishDue(psScheduler, ulEnd, psScheduler->ulLoopLatencyUs))
+    {
+        Publish(psScheduler);
+    }
+    psScheduler->ulLastCheckUs = ulEnd;
+}
+
+/**
+ * @brief Gets the statistics since FrameScheduler_Init().
+ */
+void FrameScheduler_GetStatistics(const sFrameScheduler_t *psScheduler, sFrameSchedulerStats_t *psStats)
+{
+    uint32_t ulCount;
+    uint32_t ulVsyncUs;
+
+    *psStats = psScheduler->sStats;
+    psStats->ulTicksMs = psScheduler->ulTicksMs;
+    psStats->ulLoopLatencyUs = psScheduler->ulLoopLatencyUs;
+    psStats->ulScanPeriodUs = PredictVsync(psScheduler, psScheduler->psHal->pfnGetTimeUs(), &ulCount, &ulVsyncUs) ?
+                              psScheduler->ulScanPeriodUs : 0U;
+}
+
+//------------------------------------ [ LOCAL FUNCTIONS ] --------------------------
+
+/**
+ * @brief Accounts the frames a render completed and holds the latest one for its vsync.
+ */
+static void AccountFrames(sFrameScheduler_t *psScheduler, uint32_t ulStartUs, uint32_t ulEndUs)
+{
+    sFrameSchedulerStats_t *psStats = &psScheduler->sStats;
+    uint32_t ulCompleted = psScheduler->psHal->pfnGetCompletedFrames();
+    uint32_t ulNew = ulCompleted - psScheduler->ulCompletedFrames;
+    uint32_t ulRenderUs = ulEndUs - ulStartUs;
+
+    if (ulNew == 0)
+    {
+        return;
+    }
+    psScheduler->ulCompletedFrames = ulCompleted;
+
+    // Only the last frame is published: the earlier ones, and a frame still held, are merged
+    psStats->ulFramesRendered += ulNew;
+    psStats->ulFramesMerged += psScheduler->bFrameHeld ? ulNew : (ulNew - 1U);
+
+    psStats->ulLastRenderUs = ulRenderUs;
+    if (ulRenderUs > psStats->ulMaxRenderUs)
+    {
+        psStats->ulMaxRenderUs = ulRenderUs;
+    }
+    psStats->ulAverageRenderUs = (psStats->ulAverageRenderUs == 0) ? ulRenderUs :
+                                 (psStats->ulAverageRenderUs -
+                                  (psStats->ulAverageRenderUs >> FRAME_SCHEDULER_AVERAGE_SHIFT) +
+                                  (ulRenderUs >> FRAME_SCHEDULER_AVERAGE_SHIFT));
+
+    if (!psScheduler->bFrameHeld)
+    {
+        psScheduler->bFrameHeld = true;
+        psScheduler->bHasTarget = PredictVsync(psScheduler, ulEndUs, &psScheduler->ulHeldVsyncCount,
+                                               &psScheduler->ulTargetVsyncUs);
+    }
+}
+
+/**
+ * @brief Tracks the main loop latency: the longest recent time between two
+ *        FrameScheduler_Process() calls, renders excluded.
+ */
+static void MeasureLatency(sFrameScheduler_t *psScheduler, uint32_t ulNowUs)
+{
+    uint32_t ulGapUs = ulNowUs - psScheduler->ulLastCheckUs;
+
+    psScheduler->ulLoopLatencyUs -= psScheduler->ulLoopLatencyUs >> FRAME_SCHEDULER_LATENCY_SHIFT;
+    if (ulGapUs > psScheduler->ulLoopLatencyUs)
+    {
+        psScheduler->ulLoopLatencyUs = ulGapUs;
+    }
+}
+
+/**
+ * @brief Checks whether the held frame should be published now.
+ *
+ * Due once the next check may come after its predicted vsync: within ulNextCheckUs plus
+ * FRAME_SCHEDULER_PUBLISH_LEAD_US of it. Also due once a vsync came earlier than
+ * predicted, or at once if the scan was not running when it completed.
+ *
+ * @param ulNextCheckUs Expected time to the next check: the loop latency, or the render
+ *                      time if a render runs first.
+ */
+static bool IsPublishDue(const sFrameScheduler_t *psScheduler, uint32_t ulNowUs, uint32_t ulNextCheckUs)
+{
+    if (!psScheduler->bHasTarget || (psScheduler->ulVsyncCount != psScheduler->ulHeldVsyncCount))
+    {
+        return true;
+    }
+    return ((int32_t)(ulNowUs - (psScheduler->ulTargetVsyncUs - FRAME_SCHEDULER_PUBLISH_LEAD_US -
+                                 ulNextCheckUs)) >= 0);
+}
+
+/**
+ * @brief Publishes the held frame; late if a vsync passed since it completed.
+ */
+static void Publish(sFrameScheduler_t *psScheduler)
+{
+    psScheduler->psHal->pfnPublish();
+    psScheduler->sStats.ulFramesPublished++;
+    if (psScheduler->bHasTarget && (psScheduler->ulVsyncCount != psScheduler->ulHeldVsyncCount))
+    {
+        psScheduler->sStats.ulLateFrames++;
+    }
+    psScheduler->bFrameHeld = false;
+}
+
+/**
+ * @brief Predicts the first vsync after a time from the last one and the scan period.
+ *
+ * @param pulCount   Returns the vsyncs seen, consistent with the prediction.
+ * @param pulVsyncUs Returns the predicted vsync.
+ * @return false if the scan is not running: fewer than two cycles seen, or none for
+ *         FRAME_SCHEDULER_VSYNC_TIMEOUT periods.
+ */
+static bool PredictVsync(const sFrameScheduler_t *psScheduler, uint32_t ulNowUs, uint32_t *pulCount,
+                         uint32_t *pulVsyncUs)
+{
+    uint32_t ulVsyncUs;
+    uint32_t ulPeriodUs;
+
+    ReadVsync(psScheduler, pulCount, &ulVsyncUs, &ulPeriodUs);
+
+    uint32_t ulSinceUs = ulNowUs - ulVsyncUs;
+    if ((*pulCount < 2U) || (ulPeriodUs == 0) || (ulSinceUs > (FRAME_SCHEDULER_VSYNC_TIMEOUT * ulPeriodUs)))
+    {
+        return false;
+    }
+
+    *pulVsyncUs = ulVsyncUs + (((ulSinceUs / ulPeriodUs) + 1U) * ulPeriodUs);
+    return true;
+}
+
+/**
+ * @brief Reads the vsync state written by the scan interrupt as one consistent set.
+ */
+static void ReadVsync(const sFrameScheduler_t *psScheduler, uint32_t *pulCount, uint32_t *pulVsyncUs,
+                      uint32_t *pulPeriodUs)
+{
+    do
+    {
+        *pulCount = psScheduler->ulVsyncCount;
+        *pulVsyncUs = psScheduler->ulVsyncUs;
+        *pulPeriodUs = psScheduler->ulScanPeriodUs;
+    } while (*pulCount != psScheduler->ulVsyncCount);
+}
@@ -0,0 +1,117 @@
+/**
+ * @file    FrameScheduler.h
+ * @brief   Render and publish pacing of the display, decoupled from the main loop speed.
+ *
+ * Three clocks meet here:
+ *  - the tick interrupt (SysTick/PIT) calls FrameScheduler_OnTick(), which advances the
+ *    renderer's millisecond tick by the real time elapsed, whatever the loop does;
+ *  - the main loop calls FrameScheduler_Process(), which runs the renderer once per
+ *    render period and publishes the frames it completes;
+ *  - the scan calls FrameScheduler_OnScanCycleStart() at the start of every cycle (vsync).
+ *
+ * A completed frame is held until just before the next vsync (FRAME_SCHEDULER_PUBLISH_LEAD_US
+ * plus the measured main loop or render latency), so it is picked up by that cycle and every frame is shown for whole scan cycles. Renders
+ * completed before then are merged into the held frame. Without a running scan frames are
+ * published as soon as they are complete.
+ *
+ * The renderer, FBM and time are reached only through sFrameSchedulerHal_t, so the
+ * scheduler runs on the host with a simulated clock.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+#ifndef DISPLAYCONTROLLER_FRAMESCHEDULER_H_
+#define DISPLAYCONTROLLER_FRAMESCHEDULER_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//------------------------------------ [ DEFINES ] ----------------------------------
+
+// A held frame is published this long, plus the measured main loop latency, before the
+// predicted vsync
+#define FRAME_SCHEDULER_PUBLISH_LEAD_US     500U
+
+// Decay of the measured main loop latency per FrameScheduler_Process() (1/2^shift)
+#define FRAME_SCHEDULER_LATENCY_SHIFT       4U
+
+// The scan counts as stopped after this many periods without a cycle start
+#define FRAME_SCHEDULER_VSYNC_TIMEOUT       4U
+
+// Weight of the last render in ulAverageRenderUs (1/2^shift)
+#define FRAME_SCHEDULER_AVERAGE_SHIFT       3U
+
+//------------------------------------ [ TYPEDEF ] ----------------------------------
+
+/**
+ * @brief Renderer, frame buffer and time operations used by the scheduler.
+ */
+typedef struct {
+    uint32_t (*pfnGetTimeUs)(void);             // Free-running time, wraps at 2^32 us; ISR safe
+    void     (*pfnAdvanceTick)(uint32_t ulMs);  // Advance the renderer tick (lv_tick_inc)
+    uint32_t (*pfnRender)(void);                // Run the renderer once (lv_timer_handler); result unused
+    uint32_t (*pfnGetCompletedFrames)(void);    // Frames completed by the renderer so far (wraps)
+    void     (*pfnPublish)(void);               // Publish the completed frame to FBM
+} sFrameSchedulerHal_t;
+
+/**
+ * @brief Scheduler statistics.
+ */
+typedef struct {
+    uint32_t ulFramesRendered;      // Frames completed by the renderer
+    uint32_t ulFramesPublished;     // Frames published to FBM
+    uint32_t ulFramesMerged;        // Frames redrawn by a later render before they were published
+    uint32_t ulLateFrames;          // Published after the vsync they were held for
+    uint32_t ulSkippedRenders;      // Render periods missed because the loop or a render ran long
+    uint32_t ulLastRenderUs;        // Renderer time of the last completed frame
+    uint32_t ulMaxRenderUs;
+    uint32_t ulAverageRenderUs;     // Moving average, see FRAME_SCHEDULER_AVERAGE_SHIFT
+    uint32_t ulScanPeriodUs;        // Last measured scan cycle (0 - scan not running)
+    uint32_t ulLoopLatencyUs;       // Longest recent main loop pass, renders excluded (decaying)
+    uint32_t ulTicksMs;             // Renderer tick advanced so far
+} sFrameSchedulerStats_t;
+
+/**
+ * @brief Scheduler state.
+ */
+typedef struct {
+    const sFrameSchedulerHal_t *psHal;
+    uint32_t ulRenderPeriodUs;
+    uint32_t ulNextRenderUs;
+    uint32_t ulCompletedFrames;     // Renderer frame count already accounted for
+    uint32_t ulLastCheckUs;         // End of the last FrameScheduler_Process()
+    uint32_t ulLoopLatencyUs;       // Decaying maximum of the main loop passes
+
+    uint32_t ulTickUs;              // Time the tick has been advanced to (tick interrupt)
+    volatile uint32_t ulTicksMs;
+
+    volatile uint32_t ulVsyncCount; // Scan cycles seen (scan interrupt)
+    volatile uint32_t ulVsyncUs;    // Start of the last one
+    volatile uint32_t ulScanPeriodUs;
+
+    bool     bFrameHeld;            // A completed frame waits for its vsync
+    bool     bHasTarget;            // ulTargetVsyncUs is valid (scan running when it completed)
+    uint32_t ulTargetVsyncUs;       // Predicted vsync the held frame is for
+    uint32_t ulHeldVsyncCount;      // ulVsyncCount when it completed
+
+    sFrameSchedulerStats_t sStats;
+} sFrameScheduler_t;
+
+//------------------------------------ [ PROTOTYPES ] -------------------------------
+
+void FrameScheduler_Init(sFrameScheduler_t *psScheduler, const sFrameSchedulerHal_t *psHal, uint32_t ulRenderHz);
+
+void FrameScheduler_SetRenderRate(sFrameScheduler_t *psScheduler, uint32_t ulRenderHz);
+
+void FrameScheduler_OnTick(sFrameScheduler_t *psScheduler);
+
+void FrameScheduler_OnScanCycleStart(sFrameScheduler_t *psScheduler);
+
+void FrameScheduler_Process(sFrameScheduler_t *psScheduler);
+
+void FrameScheduler_GetStatistics(const sFrameScheduler_t *psScheduler, sFrameSchedulerStats_t *psStats);
+
+#endif /* DISPLAYCONTROLLER_FRAMESCHEDULER_H_ */
@@ -0,0 +1,291 @@
+/**
+ * @file    DisplayPathBenchmark.c
+ * @brief   Benchmark of the per-frame display data path.
+ *
+ * For every geometry of the sweep, the frame buffers and the LED driver are configured as
+ * the application does, then each stage of a frame is timed with the clock passed in:
+ *
+ *   flush        acquire the render buffer and convert a full I1 screen into it, as the
+ *                LVGL flush callback does (DisplayFlush_ConvertArea())
+ *   publish      FBM_PublishBuffer()
+ *   scan_acquire FBM_AcquireScanBuffer() as done at the start of a scan cycle
+ *   pack         LEDDriver_PrepareDisplayBuffer() with the dirty rows of the frame
+ *
+ * An incremental frame (one flushed row) is timed end to end as well. Results are
+ * printed as one JSON object per line so they can be collected and compared between
+ * builds. Memory is reported from the memory manager: blocks/bytes taken by the
+ * configuration and blocks allocated inside the timed loop (expected 0).
+ *
+ * Run before the application configures the display; the display is left unconfigured.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+
+#include "application/DisplayController/Test/DisplayPathBenchmark.h"
+#include "Middleware/FrameBufferManager/FrameBufferManager.h"
+#include "application/DisplayController/DisplayFlush.h"
+#include "HAL/LEDDriverInterface/LEDDriver.h"
+#include "HAL/MemoryManager/MemoryManager.h"
+#include "fsl_debug_console.h"
+#include <string.h>
+
+//------------------------------------ [ DEFINES ] ----------------------------------
+
+#define BENCH_COLUMNS_PER_PANEL     64U
+
+// Extra screen rows, so the flushed content moves from frame to frame
+#define BENCH_SCREEN_EXTRA_ROWS     8U
+
+//------------------------------------ [ TYPEDEF ] ----------------------------------
+
+typedef struct {
+    uint64_t udFlushTicks;
+    uint64_t udPublishTicks;
+    uint64_t udScanAcquireTicks;
+    uint64_t udPackTicks;
+    uint64_t udIncrementalTicks;
+    uint32_t ulFlushBytes;
+    uint32_t ulPackBytes;
+    uint32_t ulIncrementalPackBytes;
+} sBenchResult_t;
+
+typedef struct {
+    uint32_t ulBlocks;
+    uint32_t ulBytes;
+} sBenchMemory_t;
+
+//------------------------------------ [ STATIC VARIABLES ] -------------------------
+
+static const uint8_t aubPanelCounts[] = { 1U, 2U, 4U, 8U, 16U, 32U };
+static const uint16_t ausRowCounts[] = { 16U, 32U, 64U };
+static const uint8_t aubRowAddressBits[] = { 2U, 3U, 4U, 5U };
+
+static pfnDisplayBenchClock_t pfnBenchClock;
+static uint32_t ulBenchClockHz;
+
+//------------------------------------ [ LOCAL FUNCTIONS ] --------------------------
+
+/**
+ * @brief Converts a tick total into nanoseconds per iteration.
+ */
+static uint32_t Bench_NsPerIteration(uint64_t udTicks)
+{
+    return (uint32_t)((udTicks * 1000000000ULL) / ((uint64_t)ulBenchClockHz * DISPLAY_BENCH_ITERATIONS));
+}
+
+/**
+ * @brief Sums live blocks and used bytes over every memory region.
+ */
+static sBenchMemory_t Bench_MemoryInUse(void)
+{
+    sBenchMemory_t sMemory = { 0U, 0U };
+    sMMRegionStats_t sStats;
+
+    for (uint8_t ubRegion = 0; ubRegion < (uint8_t)MM_REGION_COUNT; ubRegion++)
+    {
+        if (MM_GetRegionStats((eMMRegion_t)ubRegion, &sStats))
+        {
+            sMemory.ulBlocks += sStats.ulLiveBlocks;
+            sMemory.ulBytes += sStats.ulUsedBytes;
+        }
+    }
+    return sMemory;
+}
+
+/**
+ * @brief Times the frame stages for the configured geometry.
+ *
+ * @param psScreen  I1 screen, BENCH_SCREEN_EXTRA_ROWS rows taller than the frame.
+ */
+static void Bench_RunFrames(const sDisplaySource_t *psScreen, sBenchResult_t *psResult)
+{
+    sLEDPackStats_t sPack;
+    sDisplaySource_t sSource = *psScreen;
+    uint16_t usHeight = FBM_GetHeight();
+    uint16_t usRowBytes = FBM_GetStride();
+    sDisplayArea_t sFull = { 0, 0, (int32_t)FBM_GetWidth() - 1, (int32_t)usHeight - 1 };
+
+    for (uint32_t ulIteration = 0; ulIteration < DISPLAY_BENCH_ITERATIONS; ulIteration++)
+    {
+        bool bIsNewFrame = false;
+        const uint32_t *pulDirtyRows = NULL;
+
+        // Full frame: every row flushed, the screen content moved by one row per frame
+        sSource.pubPixels = psScreen->pubPixels + ((ulIteration % BENCH_SCREEN_EXTRA_ROWS) * psScreen->usStride);
+        uint32_t ulStart = pfnBenchClock();
+        uint8_t **ptubRender = FBM_AcquireRenderBuffer();
+        DisplayFlush_ConvertArea(ptubRender, usRowBytes, NULL, &sFull, &sSource);
+        uint32_t ulFlushed = pfnBenchClock();
+        FBM_PublishBuffer();
+        uint32_t ulPublished = pfnBenchClock();
+        uint8_t **ptubScan = FBM_AcquireScanBuffer(&bIsNewFrame, &pulDirtyRows);
+        uint32_t ulAcquired = pfnBenchClock();
+        LEDDriver_PrepareDisplayBuffer(ptubScan, pulDirtyRows);
+        uint32_t ulPacked = pfnBenchClock();
+
+        psResult->udFlushTicks += ulFlushed - ulStart;
+        psResult->udPublishTicks += ulPublished - ulFlushed;
+        psResult->udScanAcquireTicks += ulAcquired - ulPublished;
+        psResult->udPackTicks += ulPacked - ulAcquired;
+        psResult->ulFlushBytes = (uint32_t)usRowBytes * usHeight;
+        LEDDriver_GetPackStatistics(&sPack);
+        psResult->ulPackBytes = sPack.ulBytesPacked;
+
+        // Incremental frame: one row flushed
+        sDisplayArea_t sRow = sFull;
+        sRow.lY1 = (int32_t)(ulIteration % usHeight);
+        sRow.lY2 = sRow.lY1;
+        sSource.pubPixels = psScreen->pubPixels + (((ulIteration + 1U) % BENCH_SCREEN_EXTRA_ROWS) * psScreen->usStride);
+        ulStart = pfnBenchClock();
+        ptubRender = FBM_AcquireRenderBuffer();
+        DisplayFlush_ConvertArea(ptubRender, usRowBytes, NULL, &sRow, &sSource);
+        FBM_PublishBuffer();
+        ptubScan = FBM_AcquireScanBuffer(&bIsNewFrame, &pulDirtyRows);
+        LEDDriver_PrepareDisplayBuffer(ptubScan, pulDirtyRows);
+        psResult->udIncrementalTicks += pfnBenchClock() - ulStart;
+        LEDDriver_GetPackStatistics(&sPack);
+        psResult->ulIncrementalPackBytes = sPack.ulBytesPacked;
+    }
+}
+
+/**
+ * @brief Configures one geometry, benchmarks it and prints its JSON line.
+ *
+ * sBefore is the memory in use before the sweep; the LED driver keeps its buffers between
+ * configurations and reallocates them, so the footprint is measured against it.
+ *
+ * @return 0 if the timed loop allocated memory, 1 otherwise. A geometry that does not fit
+ *         the memory map is reported as alloc_failed: a result, not a failure.
+ */
+static uint8_t Bench_RunConfiguration(uint8_t ubPanels, uint16_t usRows, uint8_t ubAddressBits,
+                                   sBenchMemory_t sBefore)
+{
+    sBenchResult_t sResult;
+    (void)memset(&sResult, 0, sizeof(sResult));
+
+    uint16_t usScanRate = (uint16_t)(1U << ubAddressBits);
+    sLEDScanPattern_t sScanPattern;
+
+    if (ubAddressBits > LED_ROW_ADDRESS_LINES)
+    {
+        // The board cannot drive this many address lines
+        PRINTF("{\"bench\":\"display_path\",\"panels\":%u,\"columns\":%u,\"rows\":%u,\"scan\":%u,"
+               "\"status\":\"unsupported\"}\r\n",
+               ubPanels, (unsigned)(ubPanels * BENCH_COLUMNS_PER_PANEL), usRows, usScanRate);
+        return 1;
+    }
+
+    (void)FBM_SetBufferMode(FBM_MODE_TRIPLE_BUFFER);
+    uint8_t ubStatus = FBM_Init(usRows, BENCH_COLUMNS_PER_PANEL, 0U, 0U, ubPanels);
+    if (ubStatus)
+    {
+        LEDDriver_GetDefaultScanPattern(&sScanPattern, ubAddressBits);
+        ubStatus = LEDDriver_ConfigurePanelPattern(usRows, BENCH_COLUMNS_PER_PANEL, 0U, 0U, ubPanels, &sScanPattern);
+    }
+
+    sBenchMemory_t sConfigured = Bench_MemoryInUse();
+
+    // I1 screen as LVGL renders it in direct mode, taller than the frame so it can be moved
+    sDisplaySource_t sScreen;
+    uint16_t usScreenStride = (uint16_t)((ubPanels * BENCH_COLUMNS_PER_PANEL) / 8U);
+    uint16_t usScreenRows = (uint16_t)(usRows + BENCH_SCREEN_EXTRA_ROWS);
+    uint8_t *pubScreen = ubStatus ? (uint8_t *)MM_Alloc(MM_PURPOSE_GENERAL, (uint32_t)usScreenStride * usScreenRows) : NULL;
+
+    if (NULL == pubScreen)
+    {
+        PRINTF("{\"bench\":\"display_path\",\"panels\":%u,\"columns\":%u,\"rows\":%u,\"scan\":%u,"
+               "\"status\":\"alloc_failed\",\"alloc_blocks\":%u,\"alloc_bytes\":%u}\r\n",
+               ubPanels, (unsigned)(ubPanels * BENCH_COLUMNS_PER_PANEL), usRows, usScanRate,
+               (unsigned)(sConfigured.ulBlocks - sBefore.ulBlocks),
+               (unsigned)(sConfigured.ulBytes - sBefore.ulBytes));
+        FBM_DeinitializeSystem(usRows);
+        return 1;
+    }
+
+    for (uint32_t ulByte = 0; ulByte < ((uint32_t)usScreenStride * usScreenRows); ulByte++)
+    {
+        pubScreen[ulByte] = (uint8_t)((ulByte * 31U) ^ (ulByte >> 5));
+    }
+    sScreen.pubPixels = pubScreen;
+    sScreen.usStride = usScreenStride;
+    sScreen.lX0 = 0;
+    sScreen.lY0 = 0;
+
+    sBenchMemory_t sLoopStart = Bench_MemoryInUse();
+    Bench_RunFrames(&sScreen, &sResult);
+    sBenchMemory_t sLoopEnd = Bench_MemoryInUse();
+
+    uint32_t ulFlushNs = Bench_NsPerIteration(sResult.udFlushTicks);
+    uint32_t ulPublishNs = Bench_NsPerIteration(sResult.udPublishTicks);
+    uint32_t ulAcquireNs = Bench_NsPerIteration(sResult.udScanAcquireTicks);
+    uint32_t ulPackNs = Bench_NsPerIteration(sResult.udPackTicks);
+
+    PRINTF("{\"bench\":\"display_path\",\"panels\":%u,\"columns\":%u,\"rows\":%u,\"scan\":%u,"
+           "\"status\":\"ok\",\"iterations\":%u,\"clock_hz\":%u,"
+           "\"stages\":{\"flush\":{\"ns\":%u,\"bytes\":%u},\"publish\":{\"ns\":%u},"
+           "\"scan_acquire\":{\"ns\":%u},\"pack\":{\"ns\":%u,\"bytes\":%u}},"
+           "\"ns_per_frame\":%u,\"ns_per_incremental_frame\":%u,\"incremental_pack_bytes\":%u,"
+           "\"alloc_blocks\":%u,\"alloc_bytes\":%u,\"loop_allocations\":%d}\r\n",
+           ubPanels, (unsigned)(ubPanels * BENCH_COLUMNS_PER_PANEL), usRows, usScanRate,
+           (unsigned)DISPLAY_BENCH_ITERATIONS, (unsigned)ulBenchClockHz,
+           (unsigned)ulFlushNs, (unsigned)sResult.ulFlushBytes, (unsigned)ulPublishNs,
+           (unsigned)ulAcquireNs, (unsigned)ulPackNs, (unsigned)sResult.ulPackBytes,
+           (unsigned)(ulFlushNs + ulPublishNs + ulAcquireNs + ulPackNs),
+           (unsigned)Bench_NsPerIteration(sResult.udIncrementalTicks),
+           (unsigned)sResult.ulIncrementalPackBytes,
+           (unsigned)(sConfigured.ulBlocks - sBefore.ulBlocks),
+           (unsigned)(sConfigured.ulBytes - sBefore.ulBytes),
+           (int)(sLoopEnd.ulBlocks - sLoopStart.ulBlocks));
+
+    MM_Free(pubScreen);
+    FBM_DeinitializeSystem(usRows);
+    return (sLoopEnd.ulBlocks == sLoopStart.ulBlocks) ? 1U : 0U;
+}
+
+//------------------------------------ [ GLOBAL FUNCTIONS ] -------------------------
+
+/**
+ * @brief Runs the display path benchmark over the whole geometry sweep.
+ *
+ * Sweeps 1..32 panels of 64 columns, 16/32/64 rows and every scan rate from 1/4 to
+ * 1/32 that leaves at least two rows per scan address. Scan rates needing more row
+ * address lines than the board routes are reported as unsupported.
+ *
+ * @param pfnClock  Free-running clock.
+ * @param ulClockHz Ticks per second of pfnClock.
+ * @return Number of configurations that allocated inside the timed loop (expected 0).
+ */
+uint8_t DisplayPathBenchmark_Run(pfnDisplayBenchClock_t pfnClock, uint32_t ulClockHz)
+{
+    uint8_t ubFailures = 0;
+
+    pfnBenchClock = pfnClock;
+    ulBenchClockHz = ulClockHz;
+    sBenchMemory_t sBaseline = Bench_MemoryInUse();
+    PRINTF("{\"bench\":\"display_path\",\"event\":\"start\"}\r\n");
+
+    for (uint8_t ubPanel = 0; ubPanel < (sizeof(aubPanelCounts) / sizeof(aubPanelCounts[0])); ubPanel++)
+    {
+        for (uint8_t ubRows = 0; ubRows < (sizeof(ausRowCounts) / sizeof(ausRowCounts[0])); ubRows++)
+        {
+            for (uint8_t ubBits = 0; ubBits < sizeof(aubRowAddressBits); ubBits++)
+            {
+                if ((2U << aubRowAddressBits[ubBits]) > ausRowCounts[ubRows])
+                {
+                    continue;
+                }
+                if (Bench_RunConfiguration(aubPanelCounts[ubPanel], ausRowCounts[ubRows], aubRowAddressBits[ubBits], sBaseline) == 0)
+                {
+                    ubFailures++;
+                }
+            }
+        }
+    }
+
+    PRINTF("{\"bench\":\"display_path\",\"event\":\"end\",\"failures\":%u}\r\n", ubFailures);
+    return ubFailures;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file    DisplayPathBenchmark.h
+ * @brief   Benchmark of the per-frame display data path.
+ *
+ * Times flush -> publish -> scan acquire -> LED packing for a sweep of display
+ * geometries and prints one JSON object per configuration on the debug console. The
+ * clock is passed in, so it runs on the host (Test/Host) or on the target (DWT cycle
+ * counter).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+#ifndef DISPLAYCONTROLLER_TEST_DISPLAYPATHBENCHMARK_H_
+#define DISPLAYCONTROLLER_TEST_DISPLAYPATHBENCHMARK_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+#include <stdint.h>
+
+//------------------------------------ [ DEFINES ] ----------------------------------
+
+// Frames timed per configuration
+#define DISPLAY_BENCH_ITERATIONS    64U
+
+//------------------------------------ [ TYPEDEF ] ----------------------------------
+
+/**
+ * @brief Free-running clock of the platform (cycles, ns, ...).
+ */
+typedef uint32_t (*pfnDisplayBenchClock_t)(void);
+
+//------------------------------------ [ PROTOTYPES ] -------------------------------
+
+uint8_t DisplayPathBenchmark_Run(pfnDisplayBenchClock_t pfnClock, uint32_t ulClockHz);
+
+#endif /* DISPLAYCONTROLLER_TEST_DISPLAYPATHBENCHMARK_H_ */
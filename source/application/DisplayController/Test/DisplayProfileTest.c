@@ -0,0 +1,335 @@
+/**
+ * @file    DisplayProfileTest.c
+ * @brief   Table test of the display profile record and checks (DisplayProfile).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+
+#include "application/DisplayController/Test/DisplayProfileTest.h"
+#include "application/DisplayController/DisplayProfile.h"
+#include "HAL/LEDDriverInterface/LEDDriver.h"
+#include "HAL/MemoryManager/MemoryManager.h"
+#include "Middleware/FrameBufferManager/FrameBufferManager.h"
+#include <string.h>
+
+//------------------------------------ [ TYPEDEF ] ----------------------------------
+
+typedef struct {
+    sDisplayProfile_t sProfile;
+    uint8_t ubValid;            // Expected DisplayProfile_IsValid()
+    uint8_t ubFitsMemory;       // Expected budget, valid profiles only
+    uint8_t ubFitsRefresh;
+} sProfileCase_t;
+
+//------------------------------------ [ STATIC VARIABLE ] --------------------------
+
+// { panels, rows, columns, address bits, double sided, LED type, refresh Hz, gray planes }
+static const sProfileCase_t asProfileCases[] = {
+    // Installed: two 64x16 panels, 1/8 scan
+    { { 2U, 16U, 64U, 3U, 0U, 0U, 120U },   1U, 1U, 1U },
+    // Four panels, 1/4 scan, double sided
+    { { 4U, 16U, 64U, 2U, 1U, 0U, 120U },   1U, 1U, 1U },
+    // Rows do not split over the scan addresses
+    { { 2U, 12U, 64U, 3U, 0U, 0U, 120U },   0U, 0U, 0U },
+    // Columns not whole bytes
+    { { 2U, 16U, 60U, 3U, 0U, 0U, 120U },   0U, 0U, 0U },
+    // More address bits than the board has lines
+    { { 2U, 64U, 64U, 6U, 0U, 0U, 120U },   0U, 0U, 0U },
+    // No panel
+    { { 0U, 16U, 64U, 3U, 0U, 0U, 120U },   0U, 0U, 0U },
+    // Frames far beyond every arena
+    { { 255U, 256U, 256U, 3U, 1U, 0U, 0U }, 1U, 0U, 1U },
+    // Sixteen panels cannot be shifted 1000 times a second
+    { { 16U, 16U, 64U, 3U, 0U, 0U, 1000U }, 1U, 1U, 0U },
+    // Installed panels in 16 gray levels
+    { { 2U, 16U, 64U, 3U, 0U, 0U, 120U, 4U },  1U, 1U, 1U },
+    // Gray frames are shown on the front face only
+    { { 2U, 16U, 64U, 3U, 1U, 0U, 120U, 4U },  0U, 0U, 0U },
+    // More planes than the scan can show
+    { { 2U, 16U, 64U, 3U, 0U, 0U, 120U, 9U },  0U, 0U, 0U },
+    // 256 gray levels cannot be shown 120 times a second
+    { { 2U, 16U, 64U, 3U, 0U, 0U, 120U, 8U },  1U, 1U, 0U },
+};
+
+//------------------------------------ [ LOCAL PROTOTYPES ] -------------------------
+
+static uint8_t CheckProfileCase(const sProfileCase_t *psCase);
+static uint8_t CheckCorruptRecords(void);
+static uint8_t CheckApplyFallback(void);
+static uint8_t CheckGrayApply(void);
+static uint8_t CheckStreamedPlanes(uint16_t usRows, uint16_t usStride);
+static uint32_t GetFreeBytes(void);
+
+//------------------------------------ [ GLOBAL FUNCTIONS ] -------------------------
+
+/**
+ * @brief Runs the profile table, the corrupt record cases and the apply fallback.
+ *
+ * @return Number of failing cases (0 - all passed).
+ */
+uint8_t DisplayProfileTest_Run(void)
+{
+    uint8_t ubFailures = 0;
+
+    for (uint32_t ulCase = 0; ulCase < (sizeof(asProfileCases) / sizeof(asProfileCases[0])); ulCase++)
+    {
+        ubFailures += (CheckProfileCase(&asProfileCases[ulCase]) == 0) ? 1U : 0U;
+    }
+    ubFailures += (CheckCorruptRecords() == 0) ? 1U : 0U;
+    ubFailures += (CheckApplyFallback() == 0) ? 1U : 0U;
+    ubFailures += (CheckGrayApply() == 0) ? 1U : 0U;
+    return ubFailures;
+}
+
+//------------------------------------ [ LOCAL FUNCTIONS ] --------------------------
+
+/**
+ * @brief Checks validation, record round trip and budget of one profile; 1 if it passes.
+ */
+static uint8_t CheckProfileCase(const sProfileCase_t *psCase)
+{
+    uint8_t aubRecord[DISPLAY_PROFILE_RECORD_BYTES];
+    sDisplayProfile_t sDecoded;
+    sDisplayProfileBudget_t sBudget;
+
+    if (DisplayProfile_IsValid(&psCase->sProfile) != psCase->ubValid)
+    {
+        return 0;
+    }
+
+    // Invalid profiles encode, but do not decode
+    memset(&sDecoded, 0, sizeof(sDecoded));
+    DisplayProfile_Encode(&psCase->sProfile, aubRecord);
+    if (DisplayProfile_Decode(aubRecord, sizeof(aubRecord), &sDecoded) != psCase->ubValid)
+    {
+        return 0;
+    }
+    if (psCase->ubValid == 0)
+    {
+        return (DisplayProfile_CheckBudget(&psCase->sProfile, &sBudget) == 0) ? 1U : 0U;
+    }
+
+    if ((sDecoded.ubPanels != psCase->sProfile.ubPanels) || (sDecoded.usPanelRows != psCase->sProfile.usPanelRows) ||
+        (sDecoded.usPanelColumns != psCase->sProfile.usPanelColumns) ||
+        (sDecoded.ubRowAddressBits != psCase->sProfile.ubRowAddressBits) ||
+        (sDecoded.ubDoubleSided != psCase->sProfile.ubDoubleSided) ||
+        (sDecoded.ubLedType != psCase->sProfile.ubLedType) || (sDecoded.usRefreshHz != psCase->sProfile.usRefreshHz) ||
+        (sDecoded.ubGrayPlanes != psCase->sProfile.ubGrayPlanes))
+    {
+        return 0;
+    }
+
+    uint8_t ubFits = DisplayProfile_CheckBudget(&sDecoded, &sBudget);
+
+    return ((sBudget.ubFitsMemory == psCase->ubFitsMemory) && (sBudget.ubFitsRefresh == psCase->ubFitsRefresh) &&
+            (ubFits == (psCase->ubFitsMemory & psCase->ubFitsRefresh)) &&
+            ((psCase->ubFitsRefresh != 0) || (sBudget.sRefresh.ulShortfallMilliHz != 0))) ? 1U : 0U;
+}
+
+/**
+ * @brief Checks that short, corrupt and foreign records are refused; 1 if they are.
+ */
+static uint8_t CheckCorruptRecords(void)
+{
+    uint8_t aubRecord[DISPLAY_PROFILE_RECORD_BYTES];
+    sDisplayProfile_t sProfile;
+
+    DisplayProfile_GetDefault(&sProfile);
+    DisplayProfile_Encode(&sProfile, aubRecord);
+    if ((DisplayProfile_Decode(aubRecord, sizeof(aubRecord), &sProfile) == 0) ||
+        (DisplayProfile_Decode(aubRecord, sizeof(aubRecord) - 1U, &sProfile) != 0) ||
+        (DisplayProfile_Decode(NULL, sizeof(aubRecord), &sProfile) != 0))
+    {
+        return 0;
+    }
+
+    // Any single bit flipped is caught
+    for (uint8_t ubByte = 0; ubByte < DISPLAY_PROFILE_RECORD_BYTES; ubByte++)
+    {
+        for (uint8_t ubBit = 0; ubBit < 8U; ubBit++)
+        {
+            aubRecord[ubByte] ^= (uint8_t)(1U << ubBit);
+            if (DisplayProfile_Decode(aubRecord, sizeof(aubRecord), &sProfile) != 0)
+            {
+                return 0;
+            }
+            aubRecord[ubByte] ^= (uint8_t)(1U << ubBit);
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Checks that a profile the memory cannot take leaves the previous one active; 1 if it does.
+ *
+ * The default profile is applied, then one whose frames exceed every arena: the active
+ * profile is released before the exact check, so the default must come back with the
+ * same memory in use.
+ */
+static uint8_t CheckApplyFallback(void)
+{
+    sDisplayProfile_t sDefault;
+    sDisplayProfileBudget_t sBudget;
+    const sDisplayProfile_t sTooLarge = { 255U, 256U, 256U, 3U, 1U, 0U, 0U };
+
+    DisplayProfile_GetDefault(&sDefault);
+    if (DisplayProfile_Apply(&sDefault, NULL) == 0)
+    {
+        return 0;
+    }
+
+    uint32_t ulFreeBytes = GetFreeBytes();
+    if ((DisplayProfile_Apply(&sTooLarge, &sBudget) != 0) || (sBudget.ubFitsMemory != 0) ||
+        (sBudget.ubPlacedBlocks >= sBudget.ubBlocks))
+    {
+        return 0;
+    }
+
+    const sDisplayProfile_t *psActive = DisplayProfile_GetActive();
+    return ((psActive != NULL) && (memcmp(psActive, &sDefault, sizeof(sDefault)) == 0) &&
+            (GetFreeBytes() == ulFreeBytes)) ? 1U : 0U;
+}
+
+/**
+ * @brief Checks that a gray profile sets up FBM and the scan with one plane count and that
+ *        published frames reach the scan as its payloads; 1 if they do.
+ *
+ * Two frames are published, the second changing a single row: each time the planes the
+ * scan takes must hold the whole frame in the scan's row order and be streamed unpacked.
+ * The default profile is applied again at the end.
+ */
+static uint8_t CheckGrayApply(void)
+{
+    sDisplayProfile_t sGray;
+    sDisplayProfile_t sDefault;
+    sLEDRefreshStats_t sRefresh;
+    sLEDPackStats_t sPack;
+    uint8_t ubPassed = 1;
+
+    DisplayProfile_GetDefault(&sDefault);
+    sGray = sDefault;
+    sGray.ubGrayPlanes = 4U;
+    if (DisplayProfile_Apply(&sGray, NULL) == 0)
+    {
+        return 0;
+    }
+
+    LEDDriver_GetRefreshStatistics(&sRefresh);
+    if ((FBM_GetPixelFormat() != FBM_FORMAT_GRAY_8BPP) || (sRefresh.ubPlanes != 4U) || (sRefresh.ubAllocatedPlanes != 4U))
+    {
+        ubPassed = 0;
+    }
+
+    uint16_t usRows = FBM_GetHeight();
+    uint16_t usWidth = FBM_GetWidth();
+    for (uint8_t ubFrame = 0; (ubFrame < 2U) && (ubPassed != 0); ubFrame++)
+    {
+        uint8_t **ptubFrame = FBM_AcquireRenderBuffer();
+        uint16_t usFirst = (ubFrame == 0) ? 0U : 5U;
+        uint16_t usLast = (ubFrame == 0) ? (uint16_t)(usRows - 1U) : 5U;
+
+        for (uint16_t usRow = usFirst; usRow <= usLast; usRow++)
+        {
+            for (uint16_t usX = 0; usX < usWidth; usX++)
+            {
+                ptubFrame[usRow][usX] = (uint8_t)((usX * 7U) + (usRow * 13U) + (ubFrame * 101U));
+            }
+        }
+        FBM_MarkRowsDirty(ptubFrame, usFirst, usLast);
+        FBM_PublishBuffer();
+
+        ubPassed = CheckStreamedPlanes(usRows, (uint16_t)(usWidth / 8U));
+    }
+
+    LEDDriver_GetPackStatistics(&sPack);
+    if ((sPack.ulStreamedFrames != 2U) || (sPack.ulRejectedFrames != 0U))
+    {
+        ubPassed = 0;
+    }
+
+    LEDDriver_SetBitPlaneSource(NULL);
+    if (DisplayProfile_Apply(&sDefault, NULL) == 0)
+    {
+        ubPassed = 0;
+    }
+    return ubPassed;
+}
+
+/**
+ * @brief Takes the published gray frame as the scan does and checks its planes; 1 if they
+ *        are the frame in the scan's row order.
+ *
+ * The default pattern sends row n + 8 and then row 7 - n for scan address n.
+ */
+static uint8_t CheckStreamedPlanes(uint16_t usRows, uint16_t usStride)
+{
+    uint16_t ausRowOrder[FBM_MAX_ROWS];
+    sLEDBitPlaneSet_t sPlanes;
+    bool bIsNewFrame = false;
+    const uint32_t *pulDirtyRows = NULL;
+    const sFBMBitPlaneFrame_t *psFrame = FBM_AcquireScanBitPlanes(&bIsNewFrame, &pulDirtyRows);
+    uint8_t **ptubGray = FBM_GetActiveFrontBuffer();
+
+    if ((psFrame == NULL) || !bIsNewFrame || (psFrame->pusRowOrder == NULL) || (psFrame->usStride != usStride) ||
+        (LEDDriver_GetStreamRowOrder(ausRowOrder, usRows) == 0))
+    {
+        return 0;
+    }
+
+    for (uint16_t usPosition = 0; usPosition < usRows; usPosition++)
+    {
+        uint16_t usAddress = usPosition / 2U;
+        uint16_t usExpected = ((usPosition & 1U) == 0) ? (uint16_t)(usAddress + 8U) : (uint16_t)(7U - usAddress);
+        if ((ausRowOrder[usPosition] != usExpected) || (psFrame->pusRowOrder[usPosition] != usExpected))
+        {
+            return 0;
+        }
+
+        // Plane p holds bit (8 - planes + p) of every pixel of the row
+        for (uint8_t ubPlane = 0; ubPlane < psFrame->ubPlanes; ubPlane++)
+        {
+            const uint8_t *pubPlaneRow = FBM_BitPlaneGetPlane(psFrame, ubPlane) + ((uint32_t)usPosition * usStride);
+            for (uint16_t usX = 0; usX < (uint16_t)(usStride * 8U); usX++)
+            {
+                uint8_t ubBit = (uint8_t)((ptubGray[usExpected][usX] >> (8U - psFrame->ubPlanes + ubPlane)) & 0x01U);
+                if (((pubPlaneRow[usX >> 3] >> (7U - (usX & 7U))) & 0x01U) != ubBit)
+                {
+                    return 0;
+                }
+            }
+        }
+    }
+
+    memset(&sPlanes, 0, sizeof(sPlanes));
+    for (uint8_t ubPlane = 0; ubPlane < psFrame->ubPlanes; ubPlane++)
+    {
+        sPlanes.apubPlanes[ubPlane] = FBM_BitPlaneGetPlane(psFrame, ubPlane);
+    }
+    sPlanes.ubPlanes = psFrame->ubPlanes;
+    sPlanes.usStride = psFrame->usStride;
+    sPlanes.bStreamOrder = true;
+    LEDDriver_PrepareBitPlanes(&sPlanes, pulDirtyRows);
+    return 1;
+}
+
+/**
+ * @brief Free bytes of all memory manager regions.
+ */
+static uint32_t GetFreeBytes(void)
+{
+    sMMRegionStats_t sStats;
+    uint32_t ulBytes = 0;
+
+    for (uint8_t ubRegion = 0; ubRegion < MM_REGION_COUNT; ubRegion++)
+    {
+        if (MM_GetRegionStats((eMMRegion_t)ubRegion, &sStats) != 0)
+        {
+            ulBytes += sStats.ulTotalBytes - sStats.ulUsedBytes;
+        }
+    }
+    return ulBytes;
+}
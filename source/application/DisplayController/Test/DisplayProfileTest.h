@@ -0,0 +1,26 @@
+/**
+ * @file    DisplayProfileTest.h
+ * @brief   Table test of the display profile record and checks (DisplayProfile).
+ *
+ * Round-trips profiles through the record, checks that corrupt, foreign and invalid
+ * records are refused, and that geometries beyond the memory or refresh budget are
+ * rejected. A gray profile is applied and its published frames are checked to reach the
+ * scan as ready bit-plane payloads. Needs the memory manager initialized; runs on the
+ * host or on the target.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+#ifndef DISPLAYCONTROLLER_TEST_DISPLAYPROFILETEST_H_
+#define DISPLAYCONTROLLER_TEST_DISPLAYPROFILETEST_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+#include <stdint.h>
+
+//------------------------------------ [ PROTOTYPES ] -------------------------------
+
+uint8_t DisplayProfileTest_Run(void);
+
+#endif /* DISPLAYCONTROLLER_TEST_DISPLAYPROFILETEST_H_ */
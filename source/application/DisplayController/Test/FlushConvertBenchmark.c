@@ -0,0 +1,157 @@
+/**
+ * @file    FlushConvertBenchmark.c
+ * @brief   Benchmark of the I1 to FBM row conversion of the LVGL flush callback.
+ *
+ * The screen is the installed one, two 64x16 panels side by side, laid out as LVGL's
+ * direct mode draw buffer: an 8 byte I1 palette, then 16 rows of 16 bytes. Each area
+ * covers every row; the FBM rows around it hold a fixed pattern, which both conversions
+ * must leave as it is.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+
+#include "application/DisplayController/Test/FlushConvertBenchmark.h"
+#include "Middleware/FrameBufferManager/FBMBlit.h"
+#include <stddef.h>
+#include <string.h>
+
+//------------------------------------ [ DEFINES ] ----------------------------------
+
+#define BENCH_WIDTH                 128U
+#define BENCH_HEIGHT                16U
+#define BENCH_STRIDE                (BENCH_WIDTH / 8U)
+#define BENCH_PALETTE_BYTES         8U
+#define BENCH_UNTOUCHED             0xA5U   // FBM content outside the area
+
+//------------------------------------ [ STATIC VARIABLES ] -------------------------
+
+static const uint16_t ausStartColumns[] = { 0U, 3U, 37U };
+static const uint16_t ausWidths[] = { 8U, 24U, 40U, 64U, 128U };
+
+static uint8_t aubScreen[BENCH_PALETTE_BYTES + (BENCH_STRIDE * BENCH_HEIGHT)];
+static uint8_t aubBitRows[BENCH_HEIGHT][BENCH_STRIDE];
+static uint8_t aubWordRows[BENCH_HEIGHT][BENCH_STRIDE];
+
+//------------------------------------ [ LOCAL FUNCTIONS ] --------------------------
+
+/**
+ * @brief Per-pixel conversion, as the flush callback did it (with the lit pixels cleared).
+ */
+static void Bench_ConvertBits(const uint8_t *pubScreen, uint16_t usX1, uint16_t usX2)
+{
+    const uint8_t *pubSource = pubScreen + BENCH_PALETTE_BYTES;
+
+    for (uint16_t usY = 0; usY < BENCH_HEIGHT; usY++)
+    {
+        uint8_t *pubRow = aubBitRows[usY];
+
+        for (uint16_t usX = usX1; usX <= usX2; usX++)
+        {
+            uint8_t ubPixel = (pubSource[(usY * BENCH_STRIDE) + (usX >> 3)] >> (7U - (usX & 7U))) & 0x01U;
+            uint8_t ubBit = (uint8_t)(1U << (7U - (usX & 7U)));
+
+            if (ubPixel)
+            {
+                pubRow[usX >> 3] &= (uint8_t)~ubBit;
+            }
+            else
+            {
+                pubRow[usX >> 3] |= ubBit;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Word-wide conversion, as the flush callback does it.
+ */
+static void Bench_ConvertWords(const uint8_t *pubScreen, uint16_t usX1, uint16_t usX2)
+{
+    const uint8_t *pubSource = pubScreen + BENCH_PALETTE_BYTES;
+
+    for (uint16_t usY = 0; usY < BENCH_HEIGHT; usY++)
+    {
+        FBM_BlitRow(aubWordRows[usY], BENCH_STRIDE, (int16_t)usX1,
+                    pubSource + (usY * BENCH_STRIDE), BENCH_STRIDE, (int16_t)usX1,
+                    (uint16_t)(usX2 - usX1 + 1U), FBM_BLIT_INVERT_COPY);
+    }
+}
+
+/**
+ * @brief Fills the screen with a pseudo-random picture.
+ */
+static void Bench_FillScreen(void)
+{
+    uint32_t ulSeed = 0x12345678UL;
+
+    memset(aubScreen, 0xFF, BENCH_PALETTE_BYTES);
+    for (uint32_t ulByte = BENCH_PALETTE_BYTES; ulByte < sizeof(aubScreen); ulByte++)
+    {
+        ulSeed = (ulSeed * 1664525UL) + 1013904223UL;
+        aubScreen[ulByte] = (uint8_t)(ulSeed >> 24);
+    }
+}
+
+//------------------------------------ [ GLOBAL FUNCTIONS ] -------------------------
+
+/**
+ * @brief Runs every start column with every area width that fits the screen.
+ *
+ * @param pfnClock  Free-running clock; NULL to check the conversion without timing.
+ * @param psResults Returns FLUSH_BENCH_CASES results; cases that do not fit have width 0.
+ * @return Number of cases whose rows differ (0 - all correct).
+ */
+uint8_t FlushConvertBenchmark_Run(pfnFlushBenchClock_t pfnClock, sFlushBenchResult_t *psResults)
+{
+    uint8_t ubFailures = 0;
+    uint8_t ubCase = 0;
+
+    Bench_FillScreen();
+
+    for (uint8_t ubStart = 0; ubStart < (sizeof(ausStartColumns) / sizeof(ausStartColumns[0])); ubStart++)
+    {
+        for (uint8_t ubWidth = 0; ubWidth < (sizeof(ausWidths) / sizeof(ausWidths[0])); ubWidth++, ubCase++)
+        {
+            sFlushBenchResult_t *psResult = &psResults[ubCase];
+            uint16_t usX1 = ausStartColumns[ubStart];
+            uint16_t usWidth = ausWidths[ubWidth];
+
+            memset(psResult, 0, sizeof(*psResult));
+            psResult->usX1 = usX1;
+            if ((usX1 + usWidth) > BENCH_WIDTH)
+            {
+                continue;
+            }
+            psResult->usWidth = usWidth;
+
+            uint16_t usX2 = (uint16_t)(usX1 + usWidth - 1U);
+            memset(aubBitRows, BENCH_UNTOUCHED, sizeof(aubBitRows));
+            memset(aubWordRows, BENCH_UNTOUCHED, sizeof(aubWordRows));
+            Bench_ConvertBits(aubScreen, usX1, usX2);
+            Bench_ConvertWords(aubScreen, usX1, usX2);
+            psResult->ubCorrect = (memcmp(aubBitRows, aubWordRows, sizeof(aubBitRows)) == 0) ? 1U : 0U;
+            ubFailures += (psResult->ubCorrect == 0U) ? 1U : 0U;
+
+            if (pfnClock != NULL)
+            {
+                uint32_t ulStart = pfnClock();
+                for (uint32_t ulIteration = 0; ulIteration < FLUSH_BENCH_ITERATIONS; ulIteration++)
+                {
+                    Bench_ConvertBits(aubScreen, usX1, usX2);
+                }
+                uint32_t ulMiddle = pfnClock();
+                for (uint32_t ulIteration = 0; ulIteration < FLUSH_BENCH_ITERATIONS; ulIteration++)
+                {
+                    Bench_ConvertWords(aubScreen, usX1, usX2);
+                }
+                psResult->ulBitTicks = (ulMiddle - ulStart) / FLUSH_BENCH_ITERATIONS;
+                psResult->ulWordTicks = (pfnClock() - ulMiddle) / FLUSH_BENCH_ITERATIONS;
+            }
+        }
+    }
+    return ubFailures;
+}
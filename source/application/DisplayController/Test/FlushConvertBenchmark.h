@@ -0,0 +1,51 @@
+/**
+ * @file    FlushConvertBenchmark.h
+ * @brief   Benchmark of the I1 to FBM row conversion of the LVGL flush callback.
+ *
+ * Converts flush areas of several widths and start columns from an I1 screen into FBM
+ * rows, once pixel by pixel as the flush callback used to and once with FBM_BlitRow(),
+ * checks both give the same rows and times them. The clock is passed in, so it runs on
+ * the host or on the target (DWT cycle counter).
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+#ifndef DISPLAYCONTROLLER_TEST_FLUSHCONVERTBENCHMARK_H_
+#define DISPLAYCONTROLLER_TEST_FLUSHCONVERTBENCHMARK_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+#include <stdint.h>
+
+//------------------------------------ [ DEFINES ] ----------------------------------
+
+// Flushes timed per case
+#define FLUSH_BENCH_ITERATIONS      256U
+
+// Start columns * area widths
+#define FLUSH_BENCH_CASES           15U
+
+//------------------------------------ [ TYPEDEF ] ----------------------------------
+
+/**
+ * @brief Free-running clock of the platform (cycles, ns, ...).
+ */
+typedef uint32_t (*pfnFlushBenchClock_t)(void);
+
+/**
+ * @brief Result of one flush area.
+ */
+typedef struct {
+    uint16_t usX1;              // First column of the area
+    uint16_t usWidth;           // Columns of the area
+    uint8_t  ubCorrect;         // Word conversion matches the per-pixel one
+    uint32_t ulBitTicks;        // Mean clock ticks of a per-pixel flush
+    uint32_t ulWordTicks;       // Mean clock ticks of a word-wide flush
+} sFlushBenchResult_t;
+
+//------------------------------------ [ PROTOTYPES ] -------------------------------
+
+uint8_t FlushConvertBenchmark_Run(pfnFlushBenchClock_t pfnClock, sFlushBenchResult_t *psResults);
+
+#endif /* DISPLAYCONTROLLER_TEST_FLUSHCONVERTBENCHMARK_H_ */
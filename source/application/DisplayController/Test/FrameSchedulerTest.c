@@ -0,0 +1,271 @@
+/**
+ * @file    FrameSchedulerTest.c
+ * @brief   Table test of the frame scheduler (FrameScheduler) on a simulated clock.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+
+#include "application/DisplayController/Test/FrameSchedulerTest.h"
+#include "application/DisplayController/FrameScheduler.h"
+#include <stddef.h>
+
+//------------------------------------ [ DEFINES ] ----------------------------------
+
+#define TEST_DURATION_US    2000000UL   // Simulated time per case
+#define TEST_TICK_US        1000U       // Tick interrupt period
+
+//------------------------------------ [ TYPEDEF ] ----------------------------------
+
+typedef struct {
+    uint32_t ulRenderHz;
+    uint32_t ulScanPeriodUs;        // 0 - scan stopped
+    uint32_t ulLoopUs;              // Other work of one main loop pass
+    uint32_t ulRenderUs;            // Renderer time of one frame
+    uint32_t ulTickJitterUs;        // Added to every other tick interrupt
+    uint32_t ulSpikeUs;             // Added to every 64th loop pass
+    uint8_t  ubExpectLate;          // 0 - no late frame allowed, 1 - some expected
+} sSchedulerCase_t;
+
+//------------------------------------ [ STATIC VARIABLE ] --------------------------
+
+static const sSchedulerCase_t asSchedulerCases[] = {
+    // Installed: 50 Hz render, 120 Hz scan, light loop
+    { 50U,  8333U, 200U,  1500U,  0U,   0U,    0U },
+    // Same under network load: loop passes of 3 ms
+    { 50U,  8333U, 3000U, 1500U,  0U,   0U,    0U },
+    // Delayed tick interrupts
+    { 50U,  8333U, 200U,  1500U,  400U, 0U,    0U },
+    // Render faster than the scan: frames merge, one per scan cycle at most
+    { 200U, 8333U, 100U,  500U,   0U,   0U,    0U },
+    // Renders longer than the render period: skipped, not caught up
+    { 50U,  8333U, 200U,  25000U, 0U,   0U,    0U },
+    // Loop passes longer than a scan cycle: published at once
+    { 50U,  8333U, 9000U, 1500U,  0U,   0U,    0U },
+    // Rare loop passes longer than the measured latency: some frames miss their vsync
+    { 50U,  8333U, 200U,  1500U,  0U,   7000U, 1U },
+    // Scan stopped: frames are published as soon as they are complete
+    { 50U,  0U,    200U,  1500U,  0U,   0U,    0U },
+};
+
+// Simulation state
+static const sSchedulerCase_t *psCase;
+static sFrameScheduler_t sScheduler;
+static uint32_t ulNowUs;
+static uint32_t ulNextTickUs;
+static uint32_t ulNextVsyncUs;
+static uint32_t ulVsyncs;
+static uint32_t ulTickCount;
+static uint32_t ulTickMs;
+static uint32_t ulFrames;
+static uint32_t ulRenders;
+static uint32_t ulLastPublishUs;
+static uint8_t  ubPublishPending;   // Published since the last vsync
+static uint32_t ulWorstLeadUs;      // Longest publish to vsync time seen
+static uint32_t ulPublishes;
+static uint32_t ulPublishesPerCycle;
+static uint8_t  ubTwoPerCycle;      // Two publishes between vsyncs (one frame never shown)
+
+//------------------------------------ [ LOCAL PROTOTYPES ] -------------------------
+
+static uint8_t RunCase(const sSchedulerCase_t *psSchedulerCase);
+static void AdvanceTime(uint32_t ulUs);
+static uint32_t SimGetTimeUs(void);
+static void SimAdvanceTick(uint32_t ulMs);
+static uint32_t SimRender(void);
+static uint32_t SimGetCompletedFrames(void);
+static void SimPublish(void);
+
+static const sFrameSchedulerHal_t sSimHal = {
+    .pfnGetTimeUs          = SimGetTimeUs,
+    .pfnAdvanceTick        = SimAdvanceTick,
+    .pfnRender             = SimRender,
+    .pfnGetCompletedFrames = SimGetCompletedFrames,
+    .pfnPublish            = SimPublish,
+};
+
+//------------------------------------ [ GLOBAL FUNCTIONS ] -------------------------
+
+/**
+ * @brief Runs every case.
+ *
+ * @return Number of failing cases (0 - all passed).
+ */
+uint8_t FrameSchedulerTest_Run(void)
+{
+    uint8_t ubFailures = 0;
+
+    for (uint32_t ulCase = 0; ulCase < (sizeof(asSchedulerCases) / sizeof(asSchedulerCases[0])); ulCase++)
+    {
+        ubFailures += (RunCase(&asSchedulerCases[ulCase]) == 0) ? 1U : 0U;
+    }
+    return ubFailures;
+}
+
+//------------------------------------ [ LOCAL FUNCTIONS ] --------------------------
+
+/**
+ * @brief Runs one case for TEST_DURATION_US of simulated time; 1 if it passes.
+ */
+static uint8_t RunCase(const sSchedulerCase_t *psSchedulerCase)
+{
+    sFrameSchedulerStats_t sStats;
+
+    psCase = psSchedulerCase;
+    ulNowUs = 0xFFF00000UL;     // Wraps during the case
+    ulNextTickUs = ulNowUs + TEST_TICK_US;
+    ulNextVsyncUs = ulNowUs + 1234U;
+    ulVsyncs = 0;
+    ulTickCount = 0;
+    ulTickMs = 0;
+    ulFrames = 0;
+    ulRenders = 0;
+    ubPublishPending = 0;
+    ulWorstLeadUs = 0;
+    ulPublishes = 0;
+    ulPublishesPerCycle = 0;
+    ubTwoPerCycle = 0;
+
+    uint32_t ulStartUs = ulNowUs;
+    uint32_t ulPass = 0;
+    FrameScheduler_Init(&sScheduler, &sSimHal, psCase->ulRenderHz);
+
+    while ((ulNowUs - ulStartUs) < TEST_DURATION_US)
+    {
+        FrameScheduler_Process(&sScheduler);
+        AdvanceTime(psCase->ulLoopUs + (((++ulPass % 64U) == 0) ? psCase->ulSpikeUs : 0U));
+    }
+    FrameScheduler_GetStatistics(&sScheduler, &sStats);
+
+    uint32_t ulElapsedMs = (ulNowUs - ulStartUs) / 1000U;
+    uint32_t ulSlots = (uint32_t)(((uint64_t)(ulNowUs - ulStartUs) * psCase->ulRenderHz) / 1000000UL);
+
+    // The tick follows real time, whatever the loop and the tick interrupt do
+    if ((ulTickMs + 2U < ulElapsedMs) || (ulTickMs > ulElapsedMs) || (sStats.ulTicksMs != ulTickMs))
+    {
+        return 0;
+    }
+
+    // Every render slot is either rendered or counted as skipped
+    if (((ulRenders + sStats.ulSkippedRenders) + 1U < ulSlots) || ((ulRenders + sStats.ulSkippedRenders) > ulSlots + 1U))
+    {
+        return 0;
+    }
+    if (((psCase->ulLoopUs + psCase->ulSpikeUs + psCase->ulRenderUs) < (1000000UL / psCase->ulRenderHz)) !=
+        (sStats.ulSkippedRenders == 0))
+    {
+        return 0;
+    }
+
+    // Every frame is published or merged, except one still held
+    if ((sStats.ulFramesRendered != ulFrames) || (sStats.ulFramesPublished != ulPublishes) ||
+        ((sStats.ulFramesPublished + sStats.ulFramesMerged) > ulFrames) ||
+        ((sStats.ulFramesPublished + sStats.ulFramesMerged) + 1U < ulFrames) ||
+        (sStats.ulLastRenderUs != psCase->ulRenderUs) || (sStats.ulMaxRenderUs != psCase->ulRenderUs))
+    {
+        return 0;
+    }
+
+    if (psCase->ulScanPeriodUs == 0)
+    {
+        return ((sStats.ulLateFrames == 0) && (sStats.ulFramesMerged == 0) && (sStats.ulScanPeriodUs == 0)) ? 1U : 0U;
+    }
+
+    if (sStats.ulScanPeriodUs != psCase->ulScanPeriodUs)
+    {
+        return 0;
+    }
+    if (psCase->ubExpectLate == 0)
+    {
+        // On time: published at most once per scan cycle, in the lead window before a vsync;
+        // the window grows by the loop or render time the next check may come after
+        return ((sStats.ulLateFrames == 0) && (ubTwoPerCycle == 0) &&
+                (ulWorstLeadUs <= (FRAME_SCHEDULER_PUBLISH_LEAD_US +
+                                   (2U * (psCase->ulLoopUs + psCase->ulRenderUs))))) ? 1U : 0U;
+    }
+    return (sStats.ulLateFrames != 0) ? 1U : 0U;
+}
+
+/**
+ * @brief Advances the simulated time, running the tick and scan interrupts that fall due.
+ */
+static void AdvanceTime(uint32_t ulUs)
+{
+    uint32_t ulEndUs = ulNowUs + ulUs;
+
+    for (;;)
+    {
+        uint32_t ulToTick = ulNextTickUs - ulNowUs;
+        uint32_t ulToVsync = (psCase->ulScanPeriodUs != 0) ? (ulNextVsyncUs - ulNowUs) : UINT32_MAX;
+        uint32_t ulToEnd = ulEndUs - ulNowUs;
+
+        if ((ulToEnd < ulToTick) && (ulToEnd < ulToVsync))
+        {
+            ulNowUs = ulEndUs;
+            return;
+        }
+        if (ulToVsync <= ulToTick)
+        {
+            ulNowUs = ulNextVsyncUs;
+            ulVsyncs++;
+            if (ubPublishPending != 0)
+            {
+                uint32_t ulLeadUs = ulNowUs - ulLastPublishUs;
+                ulWorstLeadUs = (ulLeadUs > ulWorstLeadUs) ? ulLeadUs : ulWorstLeadUs;
+            }
+            ubPublishPending = 0;
+            ulPublishesPerCycle = 0;
+            ulNextVsyncUs += psCase->ulScanPeriodUs;
+            FrameScheduler_OnScanCycleStart(&sScheduler);
+        }
+        else
+        {
+            ulNowUs = ulNextTickUs;
+            ulTickCount++;
+            ulNextTickUs += TEST_TICK_US + (((ulTickCount & 1U) != 0) ? psCase->ulTickJitterUs : 0U);
+            FrameScheduler_OnTick(&sScheduler);
+        }
+    }
+}
+
+static uint32_t SimGetTimeUs(void)
+{
+    return ulNowUs;
+}
+
+static void SimAdvanceTick(uint32_t ulMs)
+{
+    ulTickMs += ulMs;
+}
+
+/**
+ * @brief Renderer: every run draws a new frame (an animation).
+ */
+static uint32_t SimRender(void)
+{
+    ulRenders++;
+    AdvanceTime(psCase->ulRenderUs);
+    ulFrames++;
+    return 0;
+}
+
+static uint32_t SimGetCompletedFrames(void)
+{
+    return ulFrames;
+}
+
+static void SimPublish(void)
+{
+    ulPublishes++;
+    ulLastPublishUs = ulNowUs;
+
+    // Until two scan cycles were seen there is no vsync to align to
+    ubPublishPending = (ulVsyncs >= 2U) ? 1U : 0U;
+    if ((++ulPublishesPerCycle > 1U) && (ulVsyncs >= 2U))
+    {
+        ubTwoPerCycle = 1;
+    }
+}
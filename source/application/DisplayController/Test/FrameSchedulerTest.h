@@ -0,0 +1,25 @@
+/**
+ * @file    FrameSchedulerTest.h
+ * @brief   Table test of the frame scheduler (FrameScheduler) on a simulated clock.
+ *
+ * Runs the scheduler against a simulated tick interrupt, scan and renderer for loop and
+ * render loads from idle to overloaded, and checks that the renderer tick follows real
+ * time, renders keep their rate, and frames are published in the lead window before a
+ * scan cycle (or counted late). No hardware dependency: runs on the host or on the target.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+#ifndef DISPLAYCONTROLLER_TEST_FRAMESCHEDULERTEST_H_
+#define DISPLAYCONTROLLER_TEST_FRAMESCHEDULERTEST_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+#include <stdint.h>
+
+//------------------------------------ [ PROTOTYPES ] -------------------------------
+
+uint8_t FrameSchedulerTest_Run(void);
+
+#endif /* DISPLAYCONTROLLER_TEST_FRAMESCHEDULERTEST_H_ */
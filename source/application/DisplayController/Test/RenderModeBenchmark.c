@@ -0,0 +1,242 @@
+/**
+ * @file    RenderModeBenchmark.c
+ * @brief   Benchmark of the LVGL port in direct and partial render mode.
+ *
+ * Both modes run the port's path: the dirty area is rounded with DisplayFlush_RoundArea()
+ * as the invalidate-area rounder does, converted with DisplayFlush_ConvertArea() and the
+ * frame is published once. Direct mode converts from a full screen buffer; partial mode
+ * splits the area into strips of 1/8 of the screen height, each rendered and converted
+ * on its own.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+
+#include "application/DisplayController/Test/RenderModeBenchmark.h"
+#include "application/DisplayController/DisplayFlush.h"
+#include "Middleware/FrameBufferManager/FrameBufferManager.h"
+#include "Middleware/FrameBufferManager/FBMBlit.h"
+#include <string.h>
+
+//------------------------------------ [ DEFINES ] ----------------------------------
+
+#define BENCH_COLUMNS_PER_PANEL     64U
+#define BENCH_MAX_STRIDE            128U    // 16 panels
+#define BENCH_MAX_ROWS              32U
+#define BENCH_PALETTE_BYTES         8U      // LVGL I1 palette: two 32-bit colours
+#define BENCH_STRIP_DIVIDER         8U
+#define BENCH_AREAS                 3U
+
+//------------------------------------ [ TYPEDEF ] ----------------------------------
+
+typedef struct {
+    uint8_t  ubPanels;
+    uint16_t usRows;
+} sBenchWall_t;
+
+//------------------------------------ [ STATIC VARIABLES ] -------------------------
+
+static const sBenchWall_t asWalls[] = {
+    { 2U, 16U }, { 2U, 32U }, { 16U, 16U }, { 16U, 32U },
+};
+
+// Rendered picture, and the LVGL draw buffers it is copied into
+static uint8_t aubPicture[BENCH_MAX_ROWS * BENCH_MAX_STRIDE];
+static uint32_t aulScreen[(BENCH_PALETTE_BYTES + (BENCH_MAX_ROWS * BENCH_MAX_STRIDE)) / 4U];
+static uint32_t aulStrip[(BENCH_PALETTE_BYTES + ((BENCH_MAX_ROWS / BENCH_STRIP_DIVIDER) * BENCH_MAX_STRIDE)) / 4U];
+
+//------------------------------------ [ LOCAL FUNCTIONS ] --------------------------
+
+/**
+ * @brief Returns dirty area ubArea of a wall: the whole screen, a line of text or a field.
+ */
+static sDisplayArea_t Bench_Area(uint8_t ubArea, uint16_t usWidth, uint16_t usRows)
+{
+    sDisplayArea_t sArea = { 0, 0, (int32_t)usWidth - 1, (int32_t)usRows - 1 };
+
+    if (ubArea == 1U)
+    {
+        sArea.lX1 = 5;
+        sArea.lX2 = 100;
+        sArea.lY1 = 4;
+        sArea.lY2 = 11;
+    }
+    else if (ubArea == 2U)
+    {
+        sArea.lX1 = 70;
+        sArea.lX2 = 93;
+        sArea.lY1 = 0;
+        sArea.lY2 = 7;
+    }
+    return sArea;
+}
+
+/**
+ * @brief Render stand-in: copies the rows [lY1, lY2] of the area into a draw buffer.
+ */
+static void Bench_Render(uint8_t *pubPixels, uint16_t usStride, int32_t lX0, int32_t lY0,
+                         const sDisplayArea_t *psArea, uint16_t usScreenStride)
+{
+    uint16_t usWidth = (uint16_t)(psArea->lX2 - psArea->lX1 + 1);
+
+    for (int32_t lY = psArea->lY1; lY <= psArea->lY2; lY++)
+    {
+        FBM_BlitRow(pubPixels + ((uint32_t)(lY - lY0) * usStride), usStride, (int16_t)(psArea->lX1 - lX0),
+                    aubPicture + ((uint32_t)lY * usScreenStride), usScreenStride, (int16_t)psArea->lX1,
+                    usWidth, FBM_BLIT_COPY);
+    }
+}
+
+/**
+ * @brief One direct mode frame: render into the screen buffer, convert, publish.
+ */
+static void Bench_DirectFrame(const sDisplayArea_t *psArea, uint16_t usScreenStride)
+{
+    uint8_t *pubPixels = (uint8_t *)aulScreen + BENCH_PALETTE_BYTES;
+    sDisplaySource_t sSource = { pubPixels, usScreenStride, 0, 0 };
+    uint8_t **ptubFrame = FBM_AcquireRenderBuffer();
+
+    Bench_Render(pubPixels, usScreenStride, 0, 0, psArea, usScreenStride);
+    DisplayFlush_ConvertArea(ptubFrame, FBM_GetStride(), NULL, psArea, &sSource);
+    FBM_PublishBuffer();
+}
+
+/**
+ * @brief One partial mode frame: render and convert strip by strip, publish once.
+ *
+ * @return Strips rendered.
+ */
+static uint8_t Bench_PartialFrame(const sDisplayArea_t *psArea, uint16_t usScreenStride, uint16_t usStripRows)
+{
+    uint8_t *pubPixels = (uint8_t *)aulStrip + BENCH_PALETTE_BYTES;
+    uint16_t usStride = (uint16_t)(((psArea->lX2 - psArea->lX1) / 8) + 1);
+    uint8_t **ptubFrame = FBM_AcquireRenderBuffer();
+    uint8_t ubStrips = 0;
+
+    for (int32_t lY = psArea->lY1; lY <= psArea->lY2; lY += usStripRows, ubStrips++)
+    {
+        sDisplayArea_t sStrip = *psArea;
+        sDisplaySource_t sSource = { pubPixels, usStride, psArea->lX1, lY };
+
+        sStrip.lY1 = lY;
+        if ((lY + usStripRows - 1) < sStrip.lY2)
+        {
+            sStrip.lY2 = lY + usStripRows - 1;
+        }
+        Bench_Render(pubPixels, usStride, psArea->lX1, lY, &sStrip, usScreenStride);
+        DisplayFlush_ConvertArea(ptubFrame, FBM_GetStride(), NULL, &sStrip, &sSource);
+    }
+    FBM_PublishBuffer();
+    return ubStrips;
+}
+
+/**
+ * @brief Checks the published frame holds the inverted picture inside the area.
+ */
+static uint8_t Bench_CheckFrame(const sDisplayArea_t *psArea, uint16_t usScreenStride)
+{
+    uint8_t **ptubFrame = FBM_AcquireScanBuffer(NULL, NULL);
+
+    for (int32_t lY = psArea->lY1; lY <= psArea->lY2; lY++)
+    {
+        for (int32_t lX = psArea->lX1; lX <= psArea->lX2; lX++)
+        {
+            uint8_t ubMask = (uint8_t)(0x80U >> (lX & 7));
+            uint8_t ubPicture = aubPicture[((uint32_t)lY * usScreenStride) + (uint32_t)(lX >> 3)] & ubMask;
+
+            if ((ptubFrame[lY][lX >> 3] & ubMask) == ubPicture)
+            {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Fills the picture with a pseudo-random image.
+ */
+static void Bench_FillPicture(void)
+{
+    uint32_t ulSeed = 0x2468ACE1UL;
+
+    for (uint32_t ulByte = 0; ulByte < sizeof(aubPicture); ulByte++)
+    {
+        ulSeed = (ulSeed * 1664525UL) + 1013904223UL;
+        aubPicture[ulByte] = (uint8_t)(ulSeed >> 24);
+    }
+}
+
+//------------------------------------ [ GLOBAL FUNCTIONS ] -------------------------
+
+/**
+ * @brief Runs every wall size with every dirty area in both render modes.
+ *
+ * @param pfnClock  Free-running clock; NULL to check the frames without timing.
+ * @param psResults Returns RENDER_BENCH_CASES results.
+ * @return Number of cases whose published frame is wrong in either mode (0 - all correct).
+ */
+uint8_t RenderModeBenchmark_Run(pfnRenderBenchClock_t pfnClock, sRenderBenchResult_t *psResults)
+{
+    uint8_t ubFailures = 0;
+    uint8_t ubCase = 0;
+
+    Bench_FillPicture();
+
+    for (uint8_t ubWall = 0; ubWall < (sizeof(asWalls) / sizeof(asWalls[0])); ubWall++)
+    {
+        const sBenchWall_t *psWall = &asWalls[ubWall];
+        uint16_t usWidth = (uint16_t)(psWall->ubPanels * BENCH_COLUMNS_PER_PANEL);
+        uint16_t usStride = (uint16_t)(usWidth / 8U);
+        uint16_t usStripRows = (uint16_t)(psWall->usRows / BENCH_STRIP_DIVIDER);
+
+        (void)FBM_SetBufferMode(FBM_MODE_DOUBLE_BUFFER);
+        if (FBM_Init(psWall->usRows, BENCH_COLUMNS_PER_PANEL, 0U, 0U, psWall->ubPanels) == 0U)
+        {
+            return (uint8_t)(ubFailures + RENDER_BENCH_CASES - ubCase);
+        }
+
+        for (uint8_t ubArea = 0; ubArea < BENCH_AREAS; ubArea++, ubCase++)
+        {
+            sRenderBenchResult_t *psResult = &psResults[ubCase];
+            sDisplayArea_t sArea = Bench_Area(ubArea, usWidth, psWall->usRows);
+
+            DisplayFlush_RoundArea(&sArea, usWidth);
+
+            memset(psResult, 0, sizeof(*psResult));
+            psResult->ubPanels = psWall->ubPanels;
+            psResult->usRows = psWall->usRows;
+            psResult->ubArea = ubArea;
+            psResult->ulDirectBytes = 2U * (BENCH_PALETTE_BYTES + ((uint32_t)usStride * psWall->usRows));
+            psResult->ulPartialBytes = BENCH_PALETTE_BYTES + ((uint32_t)usStride * usStripRows);
+
+            Bench_DirectFrame(&sArea, usStride);
+            psResult->ubCorrect = Bench_CheckFrame(&sArea, usStride);
+            psResult->ubStrips = Bench_PartialFrame(&sArea, usStride, usStripRows);
+            psResult->ubCorrect &= Bench_CheckFrame(&sArea, usStride);
+            ubFailures += (psResult->ubCorrect == 0U) ? 1U : 0U;
+
+            if (pfnClock != NULL)
+            {
+                uint32_t ulStart = pfnClock();
+                for (uint32_t ulIteration = 0; ulIteration < RENDER_BENCH_ITERATIONS; ulIteration++)
+                {
+                    Bench_DirectFrame(&sArea, usStride);
+                }
+                uint32_t ulMiddle = pfnClock();
+                for (uint32_t ulIteration = 0; ulIteration < RENDER_BENCH_ITERATIONS; ulIteration++)
+                {
+                    (void)Bench_PartialFrame(&sArea, usStride, usStripRows);
+                }
+                psResult->ulDirectTicks = (ulMiddle - ulStart) / RENDER_BENCH_ITERATIONS;
+                psResult->ulPartialTicks = (pfnClock() - ulMiddle) / RENDER_BENCH_ITERATIONS;
+            }
+        }
+
+        FBM_DeinitializeSystem(psWall->usRows);
+    }
+    return ubFailures;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file    RenderModeBenchmark.h
+ * @brief   Benchmark of the LVGL port in direct and partial render mode.
+ *
+ * For a few wall sizes and dirty areas, compares the RAM of the LVGL draw buffers and
+ * the time of one frame: render stand-in, conversion into the FBM render slot and
+ * publish. LVGL itself is not linked; its rendering is stood in for by a copy of the
+ * area into the draw buffer, the same work in both modes. The clock is passed in, so it
+ * runs on the host or on the target (DWT cycle counter).
+ *
+ * Run before the application configures the display; the display is left unconfigured.
+ *
+ * (C) Copyright Centum T&S Group 2025. All rights reserved.
+ * This computer program may not be used, copied, distributed, translated, transmitted or assigned
+ * without the prior written authorization of Centum T&S Group.
+ */
+
+#ifndef DISPLAYCONTROLLER_TEST_RENDERMODEBENCHMARK_H_
+#define DISPLAYCONTROLLER_TEST_RENDERMODEBENCHMARK_H_
+
+//------------------------------------ [ INCLUDE FILES ] ----------------------------
+#include <stdint.h>
+
+//------------------------------------ [ DEFINES ] ----------------------------------
+
+// Frames timed per case
+#define RENDER_BENCH_ITERATIONS     64U
+
+// Wall sizes * dirty areas
+#define RENDER_BENCH_CASES          12U
+
+//------------------------------------ [ TYPEDEF ] ----------------------------------
+
+/**
+ * @brief Free-running clock of the platform (cycles, ns, ...).
+ */
+typedef uint32_t (*pfnRenderBenchClock_t)(void);
+
+/**
+ * @brief Result of one wall size and dirty area.
+ */
+typedef struct {
+    uint8_t  ubPanels;          // 64-column panels side by side
+    uint16_t usRows;            // Rows of the wall
+    uint8_t  ubArea;            // 0 - full screen, 1 - line of text, 2 - small field
+    uint8_t  ubStrips;          // Strips the partial mode renders the area in
+    uint8_t  ubCorrect;         // Both modes publish the expected frame
+    uint32_t ulDirectBytes;     // Draw buffers of direct mode (two screens)
+    uint32_t ulPartialBytes;    // Draw buffer of partial mode (one strip)
+    uint32_t ulDirectTicks;     // Mean clock ticks of a direct mode frame
+    uint32_t ulPartialTicks;    // Mean clock ticks of a partial mode frame
+} sRenderBenchResult_t;
+
+//------------------------------------ [ PROTOTYPES ] -------------------------------
+
+uint8_t RenderModeBenchmark_Run(pfnRenderBenchClock_t pfnClock, sRenderBenchResult_t *psResults);
+
+#endif /* DISPLAYCONTROLLER_TEST_RENDERMODEBENCHMARK_H_ */
@@ -1,17 +1,17 @@
-/*
- *
- */
-
-#ifndef _DEFINES_H_
-#define _DEFINES_H_
-/*******************************************************************************
- * Definitions
- ******************************************************************************/
-#define DISPLAY_TYPE_MONOCHROME  1
-#define DISPLAY_TYPE_COLOR       24
-
-#define DISPLAY_TYPE DISPLAY_TYPE_MONOCHROME
-
-#define IMAGE_RENDERING 1
-
-#endif /* _DEFINES_H_ */
+/*
+ *
+ */
+
+#ifndef _DEFINES_H_
+#define _DEFINES_H_
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define DISPLAY_TYPE_MONOCHROME  1
+#define DISPLAY_TYPE_COLOR       24
+
+#define DISPLAY_TYPE DISPLAY_TYPE_MONOCHROME
+
+#define IMAGE_RENDERING 1
+
+#endif /* _DEFINES_H_ */
@@ -1,11 +1,11 @@
-/*
- * Copyright 2024 NXP
- *
- * SPDX-License-Identifier: BSD-3-Clause
- */
-
-#ifndef LV_CONF_EXT_H
-#define LV_CONF_EXT_H
-
-
-#endif  /* LV_CONF_EXT_H */
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef LV_CONF_EXT_H
+#define LV_CONF_EXT_H
+
+
+#endif  /* LV_CONF_EXT_H */
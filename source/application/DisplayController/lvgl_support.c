@@ -1,105 +1,355 @@
-#include "../../lvgl/lvgl.h"
-#include "../../HAL/LEDDriverInterface/LEDDriver.h"
-#include "../../Middleware/FrameBufferManager/FrameBufferManager.h"
-#include "board.h"
-#include <stdio.h>
-#include <string.h>
-
-/* ---------------- DISPLAY PARAMETERS ---------------- */
-#define NUM_PANELS      2
-#define WIDTH           64     /* per panel */
-#define HEIGHT          16
-#define TOTAL_WIDTH     (WIDTH * NUM_PANELS)
-
-#define LVGL_BUF_SIZE   (TOTAL_WIDTH * 1 * HEIGHT)
-
-/* Allocate LVGL buffers (cached or non-cached is fine) */
-
-static uint8_t buf1[LVGL_BUF_SIZE];
-static uint8_t buf2[LVGL_BUF_SIZE];
-
-static const uint8_t row_map[16] =
-{
-    0,1,2,3,4,5,6,7,
-    8,9,10,11,12,13,14,15
-};
-
-
-static void flushDisplay(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p)
-{
-    uint8_t **fb = FBM_GetReserveFrontBuffer();
-    if (!fb)
-    {
-        lv_display_flush_ready(disp);
-        return;
-    }
-
-    uint8_t *src = color_p + 8;
-
-    for (int y = area->y1; y <= area->y2; y++)
-    {
-    	int phy_y = row_map[y];
-
-    	uint8_t *dst_row = fb[phy_y];
-
-        /* Clear entire row (128 pixels / 8 = 16 bytes) */
-        memset(dst_row, 0, TOTAL_WIDTH / 8);
-
-        for (int x = area->x1; x <= area->x2; x++)
-        {
-        	int bit_index_in_src  = x & 7;
-			int byte_index_in_src = (x >> 3);
-			int src_byte_offset   = (y - area->y1) * (TOTAL_WIDTH / 8) + byte_index_in_src;
-
-			uint8_t src_byte = src[src_byte_offset];
-
-			/* LVGL stores MSB-first: bit7→x0 */
-			uint8_t pixel = (src_byte >> (7 - bit_index_in_src)) & 0x01;
-
-			if (pixel)
-			{
-				int byte_in_dst = x >> 3;
-				int bit_in_dst  = 7 - (x & 7);
-				dst_row[byte_in_dst] |= (0 << bit_in_dst);
-			}
-			else
-			{
-				int byte_in_dst = x >> 3;
-				int bit_in_dst  = 7 - (x & 7);
-				dst_row[byte_in_dst] |= (1 << bit_in_dst);
-			}
-        }
-    }
-
-    /* LVGL done */
-    lv_display_flush_ready(disp);
-
-    /* Swap front/back buffer */
-    FBM_SwapBuffers();
-
-    /* Prepare output to driver */
-    LEDDriver_PrepareDisplayBuffer(FBM_GetActiveFrontBuffer());
-}
-
-
-/* ----------------------------------------------------
- * DISPLAY INITIALIZATION
- * ----------------------------------------------------*/
-void lv_port_disp_init(void)
-{
-    lv_init();
-
-    lv_display_t *disp = lv_display_create(TOTAL_WIDTH, HEIGHT);
-
-    lv_display_set_color_format(disp, LV_COLOR_FORMAT_I1);
-
-    lv_display_set_buffers(
-        disp,
-        buf1,
-        buf2,
-        LVGL_BUF_SIZE,
-        LV_DISPLAY_RENDER_MODE_DIRECT
-    );
-
-    lv_display_set_flush_cb(disp, flushDisplay);
-}
+#include "../../lvgl/lvgl.h"
+#include "../../HAL/LEDDriverInterface/LEDDriver.h"
+#include "../../Middleware/FrameBufferManager/FrameBufferManager.h"
+#include "../../Middleware/FrameBufferManager/FBMDelta.h"
+#include "../../HAL/MemoryManager/MemoryManager.h"
+#include "DisplayFlush.h"
+#include "board.h"
+#include <stdio.h>
+#include <string.h>
+
+/* ---------------- DISPLAY PARAMETERS ---------------- */
+/* The geometry comes from the display profile (DisplayProfile_Apply()) at run time */
+/* I1 draw buffers start with their palette, one 32-bit color per index */
+#define LVGL_I1_PALETTE_BYTES   (LV_COLOR_INDEXED_PALETTE_SIZE(LV_COLOR_FORMAT_I1) * sizeof(lv_color32_t))
+
+/* 1 - LVGL draws straight into the FBM render slot, which must be laid out as an I1
+   draw buffer (see lv_port_pre_init()); lit pixels are index 1, i.e. light colours */
+#ifndef LV_PORT_ZERO_COPY
+#define LV_PORT_ZERO_COPY   0
+#endif
+
+/* 1 - LVGL renders the dirty areas into a strip of 1/LV_PORT_STRIP_DIVIDER of the screen,
+   converted into the FBM render slot strip by strip; 0 - two full-screen buffers
+   (direct mode). Not used in zero-copy mode. */
+#ifndef LV_PORT_PARTIAL
+#define LV_PORT_PARTIAL         1
+#endif
+#define LV_PORT_STRIP_DIVIDER   8
+
+static lv_display_t *display = NULL;
+
+/* Frames completed by LVGL; the frame scheduler publishes the latest one (lv_port_publish()) */
+static volatile uint32_t completed_frames = 0;
+
+#if !LV_PORT_ZERO_COPY
+/* Draw buffers, from the memory manager (cached or non-cached is fine); buf2 only in
+   direct mode */
+static uint8_t *buf1 = NULL;
+static uint8_t *buf2 = NULL;
+static uint32_t buf_size = 0;
+static uint16_t screen_width = 0;
+
+
+/* Rounds every invalidated area out to whole FBM words; LVGL merges the rounded areas */
+static void roundArea(lv_event_t *e)
+{
+    lv_area_t *area = lv_event_get_param(e);
+    sDisplayArea_t rounded = { area->x1, area->y1, area->x2, area->y2 };
+
+    DisplayFlush_RoundArea(&rounded, screen_width);
+    area->x1 = rounded.lX1;
+    area->x2 = rounded.lX2;
+}
+
+static void flushDisplay(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p)
+{
+    /* Render into the FBM render slot; it already holds the last published frame */
+    uint8_t **fb = FBM_AcquireRenderBuffer();
+    if (!fb)
+    {
+        lv_display_flush_ready(disp);
+        return;
+    }
+
+    sDisplayArea_t dirty = { area->x1, area->y1, area->x2, area->y2 };
+    sDisplaySource_t source;
+
+    /* I1 pixels follow the palette. Partial mode: color_p holds just the area, rows as
+       wide as the area. Direct mode: color_p is the whole screen. */
+    source.pubPixels = color_p + LVGL_I1_PALETTE_BYTES;
+#if LV_PORT_PARTIAL
+    source.usStride = (uint16_t)lv_draw_buf_width_to_stride(lv_area_get_width(area), LV_COLOR_FORMAT_I1);
+    source.lX0 = area->x1;
+    source.lY0 = area->y1;
+#else
+    source.usStride = (uint16_t)lv_draw_buf_width_to_stride(screen_width, LV_COLOR_FORMAT_I1);
+    source.lX0 = 0;
+    source.lY0 = 0;
+#endif
+
+    /* LVGL rows are the frame rows: the scan pattern maps them to the panels */
+    if (FBM_GetPixelFormat() == FBM_FORMAT_GRAY_8BPP)
+    {
+        DisplayFlush_ConvertAreaGray8(fb, NULL, &dirty, &source);
+    }
+    else
+    {
+        DisplayFlush_ConvertArea(fb, FBM_GetStride(), NULL, &dirty, &source);
+    }
+
+    /* A frame is complete once per refresh whatever the number of strips; the frame
+       scheduler publishes it in time for the next scan cycle */
+    if (lv_display_flush_is_last(disp))
+    {
+        completed_frames++;
+    }
+
+    /* LVGL done */
+    lv_display_flush_ready(disp);
+}
+
+#else
+/* Points the LVGL draw buffer at the FBM render slot, palette in the frame header */
+static bool attachRenderBuffer(lv_display_t *disp)
+{
+    const sFBMFrame_t *frame = FBM_GetFrame(FBM_AcquireRenderBuffer());
+    if (!frame)
+    {
+        return false;
+    }
+
+    lv_draw_buf_t *draw_buf = lv_display_get_buf_active(disp);
+    draw_buf->data = frame->pubData - LVGL_I1_PALETTE_BYTES;
+    draw_buf->unaligned_data = draw_buf->data;
+    return true;
+}
+
+static void flushDisplay(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p)
+{
+    (void)color_p;
+
+    /* LVGL has drawn into the render slot itself: nothing to convert */
+    uint8_t **fb = FBM_AcquireRenderBuffer();
+    if (!fb)
+    {
+        lv_display_flush_ready(disp);
+        return;
+    }
+
+    FBM_MarkRowsDirty(fb, (uint16_t)area->y1, (uint16_t)area->y2);
+
+    if (lv_display_flush_is_last(disp))
+    {
+        completed_frames++;
+    }
+
+    lv_display_flush_ready(disp);
+}
+#endif
+
+/* ----------------------------------------------------
+ * Call before FBM_Init(): in zero-copy mode every FBM frame gets room for the I1
+ * palette in front of its pixels, so it can be used as the LVGL draw buffer.
+ * ----------------------------------------------------*/
+void lv_port_pre_init(void)
+{
+#if LV_PORT_ZERO_COPY
+    (void)FBM_SetFrameHeader(LVGL_I1_PALETTE_BYTES);
+#endif
+}
+
+
+/* ----------------------------------------------------
+ * Frames completed by LVGL so far (wraps); a frame is complete at the last flush of
+ * a refresh.
+ * ----------------------------------------------------*/
+uint32_t lv_port_get_completed_frames(void)
+{
+    return completed_frames;
+}
+
+
+/* ----------------------------------------------------
+ * Publishes the frame LVGL rendered into the FBM render slot. Called by the frame
+ * scheduler between two lv_timer_handler() runs, never during a refresh.
+ * ----------------------------------------------------*/
+void lv_port_publish(void)
+{
+    uint8_t **fb = FBM_AcquireRenderBuffer();
+    if (!fb)
+    {
+        return;
+    }
+
+    FBM_PublishBuffer();
+
+    /* The published buffer is not rendered into again until a later publish */
+    FBMDelta_OnFramePublished(fb);
+
+#if LV_PORT_ZERO_COPY
+    /* The next render slot already holds the frame just published, which is what
+       LVGL expects of its single direct mode buffer */
+    if (display != NULL)
+    {
+        (void)attachRenderBuffer(display);
+    }
+#endif
+}
+
+
+/* ----------------------------------------------------
+ * Bytes of draw buffers lv_port_disp_init() allocates for a screen; the display
+ * profile adds them to its memory budget.
+ * ----------------------------------------------------*/
+uint32_t lv_port_get_buffer_bytes(uint16_t width, uint16_t height)
+{
+#if LV_PORT_ZERO_COPY
+    /* LVGL draws into the FBM frames */
+    (void)width;
+    (void)height;
+    return 0;
+#elif LV_PORT_PARTIAL
+    /* Palette and whole rows. LVGL sizes a strip in rows of this buffer without the palette,
+       which is smaller than one row, so the strip still fits. Conversion is synchronous:
+       one buffer is enough. */
+    uint32_t rows = (height + LV_PORT_STRIP_DIVIDER - 1) / LV_PORT_STRIP_DIVIDER;
+    return LVGL_I1_PALETTE_BYTES + (lv_draw_buf_width_to_stride(width, LV_COLOR_FORMAT_I1) * rows);
+#else
+    /* Two full screens */
+    return 2 * (LVGL_I1_PALETTE_BYTES + (lv_draw_buf_width_to_stride(width, LV_COLOR_FORMAT_I1) * height));
+#endif
+}
+
+
+/* ----------------------------------------------------
+ * Draw buffers lv_port_disp_init() allocates for a screen, in allocation order, for
+ * the memory plan of the display profile. entries has room for
+ * LV_PORT_MAX_PLAN_ENTRIES; returns how many are used.
+ * ----------------------------------------------------*/
+uint8_t lv_port_get_buffer_plan(uint16_t width, uint16_t height, sMMPlanEntry_t *entries)
+{
+    uint32_t size = lv_port_get_buffer_bytes(width, height);
+#if LV_PORT_ZERO_COPY
+    (void)size;
+    (void)entries;
+    return 0;
+#elif LV_PORT_PARTIAL
+    entries[0] = (sMMPlanEntry_t){ MM_PURPOSE_RENDER_TARGET, size, 0 };
+    return 1;
+#else
+    entries[0] = (sMMPlanEntry_t){ MM_PURPOSE_RENDER_TARGET, size / 2, 0 };
+    entries[1] = entries[0];
+    return 2;
+#endif
+}
+
+
+/* ----------------------------------------------------
+ * Deletes the display and frees its draw buffers; call before the FBM frames are
+ * released. Nothing to do if no display was created.
+ * ----------------------------------------------------*/
+void lv_port_disp_deinit(void)
+{
+    if (display != NULL)
+    {
+        lv_display_delete(display);
+        display = NULL;
+    }
+
+#if !LV_PORT_ZERO_COPY
+    MM_Free(buf1);
+    MM_Free(buf2);
+    buf1 = NULL;
+    buf2 = NULL;
+    buf_size = 0;
+#endif
+}
+
+
+/* ----------------------------------------------------
+ * DISPLAY INITIALIZATION
+ * ----------------------------------------------------*/
+bool lv_port_disp_init(uint16_t width, uint16_t height)
+{
+    static bool is_lv_initialised = false;
+
+    if (!is_lv_initialised)
+    {
+        lv_init();
+        is_lv_initialised = true;
+    }
+
+    lv_port_disp_deinit();
+
+#if LV_PORT_ZERO_COPY
+    /* Needs FBM_Init() (after lv_port_pre_init()) and a frame LVGL can draw into as is */
+    const sFBMFrame_t *frame = FBM_GetFrame(FBM_AcquireRenderBuffer());
+    if (!frame || (frame->eFormat != FBM_FORMAT_MONO_1BPP) ||
+        (frame->usHeaderBytes < LVGL_I1_PALETTE_BYTES) ||
+        (frame->usWidth != width) || (frame->usHeight != height) ||
+        (frame->usStride != lv_draw_buf_width_to_stride(width, LV_COLOR_FORMAT_I1)))
+    {
+        LV_LOG_ERROR("FBM frames do not match the LVGL I1 draw buffer");
+        return false;
+    }
+#else
+    uint32_t size = lv_port_get_buffer_bytes(width, height);
+#if LV_PORT_PARTIAL
+    buf_size = size;
+    buf1 = MM_Alloc(MM_PURPOSE_RENDER_TARGET, buf_size);
+    if (!buf1)
+#else
+    buf_size = size / 2;
+    buf1 = MM_Alloc(MM_PURPOSE_RENDER_TARGET, buf_size);
+    buf2 = MM_Alloc(MM_PURPOSE_RENDER_TARGET, buf_size);
+    if (!buf1 || !buf2)
+#endif
+    {
+        LV_LOG_ERROR("No memory for the LVGL draw buffers");
+        lv_port_disp_deinit();
+        return false;
+    }
+    screen_width = width;
+#endif
+
+    lv_display_t *disp = lv_display_create(width, height);
+    if (!disp)
+    {
+        lv_port_disp_deinit();
+        return false;
+    }
+    display = disp;
+
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_I1);
+
+#if LV_PORT_ZERO_COPY
+    lv_display_set_buffers(
+        disp,
+        frame->pubData - LVGL_I1_PALETTE_BYTES,
+        NULL,
+        LVGL_I1_PALETTE_BYTES + frame->ulSizeBytes,
+        LV_DISPLAY_RENDER_MODE_DIRECT
+    );
+
+    /* Index 1 lights the LED: start from a dark screen */
+    lv_obj_set_style_bg_color(lv_display_get_screen_active(disp), lv_color_black(), 0);
+#elif LV_PORT_PARTIAL
+    lv_display_set_buffers(
+        disp,
+        buf1,
+        NULL,
+        buf_size,
+        LV_DISPLAY_RENDER_MODE_PARTIAL
+    );
+
+    lv_display_add_event_cb(disp, roundArea, LV_EVENT_INVALIDATE_AREA, NULL);
+#else
+    lv_display_set_buffers(
+        disp,
+        buf1,
+        buf2,
+        buf_size,
+        LV_DISPLAY_RENDER_MODE_DIRECT
+    );
+
+    lv_display_add_event_cb(disp, roundArea, LV_EVENT_INVALIDATE_AREA, NULL);
+#endif
+
+    lv_display_set_flush_cb(disp, flushDisplay);
+
+    /* The frame scheduler paces lv_timer_handler() at the render rate: refresh at every
+       run rather than every LV_DEF_REFR_PERIOD, which a run a tick early would miss */
+    lv_timer_set_period(lv_display_get_refr_timer(disp), 1);
+    return true;
+}
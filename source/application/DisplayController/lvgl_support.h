@@ -1,48 +1,58 @@
-/*
- * Copyright 2021, 2023 NXP
- * All rights reserved.
- *
- * SPDX-License-Identifier: BSD-3-Clause
- */
-
-#ifndef LVGL_SUPPORT_H
-#define LVGL_SUPPORT_H
-
-#include <stdint.h>
-
-/*******************************************************************************
- * Definitions
- ******************************************************************************/
-#define LVGL_PANEL_RK043FN02H  0 /* RK043FN02H-CT */
-#define LVGL_PANEL_RK043FN66HS 1 /* RK043FN66HS-CTG */
-
-/* @TEST_ANCHOR */
-
-#ifndef LVGL_PANEL
-#define LVGL_PANEL LVGL_PANEL_RK043FN66HS
-#endif
-
-#define LCD_WIDTH  480
-#define LCD_HEIGHT 272
-
-/*******************************************************************************
- * API
- ******************************************************************************/
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-void lv_port_pre_init(void);
-void lv_port_disp_init(void);
-void lv_port_indev_init(void);
-void DEMO_CleanInvalidateCacheByAddr(void * addr, int32_t dsize);
-void lv_draw_sw_i1_convert_to_vtiled(const uint8_t *src, uint32_t src_size,
-                            uint16_t width, uint16_t height,
-                            uint8_t *dst, uint32_t dst_size,
-                            bool invert);
-#if defined(__cplusplus)
-}
-#endif
-
-#endif /*LVGL_SUPPORT_H */
+/*
+ * Copyright 2021, 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef LVGL_SUPPORT_H
+#define LVGL_SUPPORT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "HAL/MemoryManager/MemoryManager.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define LVGL_PANEL_RK043FN02H  0 /* RK043FN02H-CT */
+#define LVGL_PANEL_RK043FN66HS 1 /* RK043FN66HS-CTG */
+
+/* @TEST_ANCHOR */
+
+#ifndef LVGL_PANEL
+#define LVGL_PANEL LVGL_PANEL_RK043FN66HS
+#endif
+
+#define LCD_WIDTH  480
+#define LCD_HEIGHT 272
+
+/* Draw buffers lv_port_disp_init() allocates at most */
+#define LV_PORT_MAX_PLAN_ENTRIES 2
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void lv_port_pre_init(void);
+uint32_t lv_port_get_buffer_bytes(uint16_t width, uint16_t height);
+uint8_t lv_port_get_buffer_plan(uint16_t width, uint16_t height, sMMPlanEntry_t *entries);
+bool lv_port_disp_init(uint16_t width, uint16_t height);
+void lv_port_disp_deinit(void);
+uint32_t lv_port_get_completed_frames(void);
+void lv_port_publish(void);
+void lv_port_indev_init(void);
+void DEMO_CleanInvalidateCacheByAddr(void * addr, int32_t dsize);
+void lv_draw_sw_i1_convert_to_vtiled(const uint8_t *src, uint32_t src_size,
+                            uint16_t width, uint16_t height,
+                            uint8_t *dst, uint32_t dst_size,
+                            bool invert);
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /*LVGL_SUPPORT_H */